@@ -14,6 +14,1333 @@
 static const char* dbipv4addr_registry_status __attribute__ ((__unused__)) = "AFRINIC/20191006 APNIC/20191004 ARIN/20191006 IANA/20190718 LACNIC/20191004 LISP/20191006 RIPENCC/20191005";
 static const time_t dbipv4addr_registry_unixtime __attribute__ ((__unused__)) = 1570378198;
 
+
+/* packed registry table created by ipv6calc-pack-registry-list-ipv4.pl
+ *  range starts covering the whole address space, registry of range as 4-bit value
+ *  rows: 7950 (source: 15977 + 256)
+ */
+#define DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS	7950
+#define DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK	16
+
+static const uint32_t dbipv4addr_assignment_packed_start[] __attribute__ ((aligned (64))) = {
+	0x00000000, 0x01000000, 0x02000000, 0x03000000, 0x05000000, 0x051c2000, 0x051c2800, 0x06000000,
+	0x08800000, 0x08c00000, 0x08d00000, 0x08e00000, 0x0a000000, 0x0b000000, 0x0d740000, 0x0d7c0000,
+	0x0d8c0000, 0x0d900000, 0x0da80000, 0x0db80000, 0x0df00000, 0x0df40000, 0x0e000000, 0x0e66ac00,
+	0x0e66b000, 0x0f000000, 0x17133000, 0x17133400, 0x17133800, 0x17134000, 0x17534000, 0x17534800,
+	0x17537000, 0x17538000, 0x175c7000, 0x175c8000, 0x1769e000, 0x176a0000, 0x176a2000, 0x176a2800,
+	0x176a3800, 0x176a4000, 0x176a6800, 0x176a7800, 0x176a8000, 0x176ae800, 0x176af000, 0x176af800,
+	0x176b0000, 0x176c6000, 0x176c6800, 0x176cd000, 0x176ce000, 0x176d0000, 0x176e0000, 0x176f0000,
+	0x176f0800, 0x176f0c00, 0x176f1000, 0x176f4000, 0x176f5000, 0x176f8000, 0x176fc000, 0x176ff800,
+	0x17e20000, 0x17e21000, 0x17e88000, 0x17e90000, 0x17ef8000, 0x17efa000, 0x17f9e800, 0x17f9f000,
+	0x17fc4200, 0x17fc4500, 0x17fc4700, 0x17fc4900, 0x17fc4b00, 0x17fc4d00, 0x17fc4f00, 0x17fc5000,
+	0x18297000, 0x18298000, 0x1835c000, 0x1835e000, 0x18840000, 0x18880000, 0x18e60000, 0x18e62000,
+	0x18e80000, 0x18e90000, 0x18eb1600, 0x18eb1800, 0x18eb2000, 0x19000000, 0x1a000000, 0x1b000000,
+	0x1b6e0000, 0x1b6e1400, 0x1c000000, 0x1f000000, 0x1fcf0000, 0x1fcf0800, 0x1fcf3800, 0x1fcf3c00,
+	0x20000000, 0x24000000, 0x24ff5c00, 0x24ff6000, 0x25000000, 0x256f0000, 0x25700000, 0x26000000,
+	0x27000000, 0x28000000, 0x28480000, 0x284a0000, 0x287d8000, 0x287e0000, 0x287e4000, 0x287e8000,
+	0x29000000, 0x2a000000, 0x2be17000, 0x2be17400, 0x2be21800, 0x2be21c00, 0x2be70c00, 0x2be71000,
+	0x2bf35400, 0x2bf35800, 0x2bfba000, 0x2bfba400, 0x2c000000, 0x2d040000, 0x2d051800, 0x2d051c00,
+	0x2d05f800, 0x2d05fc00, 0x2d064400, 0x2d064800, 0x2d06d700, 0x2d06d800, 0x2d06f400, 0x2d06f800,
+	0x2d080000, 0x2d100000, 0x2d28c000, 0x2d290000, 0x2d2b4000, 0x2d2b6000, 0x2d38e000, 0x2d390000,
+	0x2d400000, 0x2d413800, 0x2d413a00, 0x2d414000, 0x2d418000, 0x2d420000, 0x2d440000, 0x2d460000,
+	0x2d480000, 0x2d4b0000, 0x2d4b8000, 0x2d4c0000, 0x2d500000, 0x2d600000, 0x2d700000, 0x2d727800,
+	0x2d727c00, 0x2d72e000, 0x2d72e400, 0x2d731000, 0x2d731400, 0x2d758400, 0x2d758800, 0x2d77d000,
+	0x2d77d400, 0x2d7b8c00, 0x2d7b9000, 0x2d7e2800, 0x2d7e2c00, 0x2d800000, 0x2da00000, 0x2db45000,
+	0x2db45200, 0x2db4b300, 0x2db4b400, 0x2db67500, 0x2db67600, 0x2db7b300, 0x2db7b400, 0x2db80400,
+	0x2db80800, 0x2db86800, 0x2db86c00, 0x2db87800, 0x2db87c00, 0x2db88400, 0x2db88800, 0x2db89800,
+	0x2db89c00, 0x2db8dc00, 0x2db8e400, 0x2db8fc00, 0x2db90000, 0x2db91c00, 0x2db91f00, 0x2db92400,
+	0x2db92800, 0x2db92a00, 0x2db92b00, 0x2db93c00, 0x2db94400, 0x2db95400, 0x2db95800, 0x2db97400,
+	0x2db97800, 0x2db98000, 0x2db98400, 0x2db99000, 0x2db99800, 0x2db9a400, 0x2db9a800, 0x2db9b800,
+	0x2db9c400, 0x2db9cc00, 0x2db9d800, 0x2db9e400, 0x2db9e800, 0x2db9ec00, 0x2db9f000, 0x2db9f400,
+	0x2dba1400, 0x2dba1800, 0x2dba1c00, 0x2dba2000, 0x2dba7c00, 0x2dba7e00, 0x2dba8000, 0x2dba8400,
+	0x2dc00000, 0x2ddd1900, 0x2ddd1a00, 0x2ddd1b00, 0x2ddd1c00, 0x2ddf0000, 0x2de00000, 0x2de06400,
+	0x2de06800, 0x2de14c00, 0x2de15000, 0x2de2be00, 0x2de2c000, 0x2de36400, 0x2de36800, 0x2de4c800,
+	0x2de4ca00, 0x2de4cb00, 0x2de4cc00, 0x2de61500, 0x2de61600, 0x2de63c00, 0x2de64000, 0x2de72800,
+	0x2de72c00, 0x2debe000, 0x2debe200, 0x2df00000, 0x2df80000, 0x2df87c00, 0x2df88000, 0x2df9e000,
+	0x2df9e400, 0x2dfa1800, 0x2dfa1c00, 0x2dfcec00, 0x2dfcf000, 0x2e000000, 0x2e95c000, 0x2e95d000,
+	0x2efe5800, 0x2efe5c00, 0x2f000000, 0x2f080000, 0x2f0a0000, 0x2f0b0000, 0x2f0c0000, 0x2f0f0000,
+	0x2f100000, 0x2f1d0000, 0x2f200000, 0x2f5c0000, 0x2f800000, 0x2ff70000, 0x2ff80000, 0x31000000,
+	0x310c0000, 0x310e0000, 0x32000000, 0x323c0000, 0x323e0000, 0x32770000, 0x32780000, 0x33000000,
+	0x334f0000, 0x33500000, 0x33510000, 0x33520000, 0x33a10000, 0x33a20000, 0x34000000, 0x34500000,
+	0x34540000, 0x3480e000, 0x34810000, 0x34820000, 0x34840000, 0x34904000, 0x34906000, 0x35000000,
+	0x36000000, 0x36240000, 0x36270000, 0x36de0000, 0x36e00000, 0x39000000, 0x3a000000, 0x3d08b000,
+	0x3d08c000, 0x3d0ee000, 0x3d0ee400, 0x3e000000, 0x3e084000, 0x3e086000, 0x3e0c6000, 0x3e0c8000,
+	0x3e186000, 0x3e188000, 0x3e3dc000, 0x3e3e0000, 0x3e442000, 0x3e444000, 0x3e44e000, 0x3e450000,
+	0x3e720000, 0x3e730000, 0x3e752000, 0x3e754000, 0x3e870000, 0x3e878000, 0x3e8b0000, 0x3e8c0000,
+	0x3e8c4000, 0x3e8c8000, 0x3ead2000, 0x3ead4000, 0x3ec14000, 0x3ec18000, 0x3eea0000, 0x3eeb0000,
+	0x3ef02000, 0x3ef04000, 0x3ef06000, 0x3ef08000, 0x3ef18000, 0x3ef1a000, 0x3efb8000, 0x3efc0000,
+	0x3f000000, 0x3f8c0000, 0x3f8c1000, 0x3f8d2200, 0x3f8d2600, 0x3f8e0000, 0x3f8e1000, 0x3ff68000,
+	0x3ff68600, 0x3ff68800, 0x3ff68a00, 0x3ff68b00, 0x3ff68c00, 0x3ff68e00, 0x3ff68f00, 0x3ff69000,
+	0x3ff69900, 0x3ff69c00, 0x3ff6a000, 0x4010c000, 0x4010e000, 0x401c0000, 0x401c2000, 0x401c8000,
+	0x401c9000, 0x40204000, 0x40208000, 0x40210000, 0x40214000, 0x402b0000, 0x402bc000, 0x40397000,
+	0x40398000, 0x403f4000, 0x403f8000, 0x40414000, 0x40418000, 0x40771000, 0x40772000, 0x40785800,
+	0x40786000, 0x40786e00, 0x40787a00, 0x4089c000, 0x408a0000, 0x40bc2000, 0x40bc3000, 0x40cfd000,
+	0x40cfd800, 0x40efec00, 0x40eff000, 0x40fd2000, 0x40fd4000, 0x41127000, 0x41128000, 0x4112c000,
+	0x4112d000, 0x4112e000, 0x41274000, 0x41276000, 0x41630000, 0x41636000, 0x41638000, 0x4163c000,
+	0x41b54000, 0x41b56000, 0x42080000, 0x42088000, 0x42124000, 0x42126000, 0x422a2000, 0x422a4000,
+	0x423c0000, 0x423c4000, 0x424f6000, 0x424f8000, 0x42544000, 0x42545000, 0x4260c000, 0x42610000,
+	0x42620000, 0x42626000, 0x42768000, 0x4276c000, 0x42802000, 0x42803000, 0x42855000, 0x42856000,
+	0x42b5a000, 0x42b5c000, 0x42cb9000, 0x42cba000, 0x42cd4000, 0x42cd6000, 0x42d46000, 0x42d48000,
+	0x42e40000, 0x42e41000, 0x42e74000, 0x42e75000, 0x42e80000, 0x42e81000, 0x42eaa000, 0x42eab000,
+	0x42f8cc00, 0x42f8d000, 0x42fb8000, 0x42fbc000, 0x43162000, 0x43163c00, 0x439e3400, 0x439e3500,
+	0x439e3e00, 0x439e3f00, 0x43d18000, 0x43d1a000, 0x43d34000, 0x43d35000, 0x43d58c00, 0x43d59000,
+	0x43d77000, 0x43d78000, 0x4441e400, 0x4441f000, 0x4446c000, 0x4446d000, 0x444f0000, 0x444f4000,
+	0x45060000, 0x45064000, 0x45065000, 0x453f4000, 0x453f5000, 0x45432000, 0x45433000, 0x45485000,
+	0x45485800, 0x455e2000, 0x455e3000, 0x455e4000, 0x455e5000, 0x455e7000, 0x455e8000, 0x45a00000,
+	0x45a02000, 0x45a0a800, 0x45a0b000, 0x45ac4000, 0x45ac6000, 0x45ac8000, 0x45c24000, 0x45c28000,
+	0x45c2a000, 0x45c2b000, 0x45e6c000, 0x45e70000, 0x45e78000, 0x45e7c000, 0x45eac000, 0x45eb0000,
+	0x45eb8000, 0x45ebc000, 0x46223a00, 0x46223b00, 0x46223c00, 0x46223f00, 0x4783c000, 0x47844000,
+	0x47884000, 0x47888000, 0x47890000, 0x47894000, 0x4823f800, 0x4823fe00, 0x482c1000, 0x482c2000,
+	0x48ff0000, 0x48ff4000, 0x48ffe000, 0x49000000, 0x4a32d000, 0x4a32d800, 0x4a723000, 0x4a723400,
+	0x4a765000, 0x4a765400, 0x4c4d3000, 0x4c4d4000, 0x4d000000, 0x4ddc0000, 0x4ddc2000, 0x50438000,
+	0x50439000, 0x50472000, 0x50473000, 0x50486000, 0x50487000, 0x504ba000, 0x504bc000, 0x50561000,
+	0x50562000, 0x50574000, 0x50576000, 0x50580000, 0x50581000, 0x505f0000, 0x505f1000, 0x50d1f000,
+	0x50d1f400, 0x50f0c000, 0x50f0d000, 0x50f60000, 0x50f61000, 0x50f80000, 0x50f81000, 0x50f84000,
+	0x50f85000, 0x50f90000, 0x50f91000, 0x50f94000, 0x50f95000, 0x50fa2000, 0x50fa3000, 0x50fbd000,
+	0x50fbe000, 0x510a0000, 0x510a8000, 0x51156000, 0x51157000, 0x5117d000, 0x5117e000, 0x511a4000,
+	0x511a5000, 0x511d6000, 0x511d7000, 0x51440000, 0x51480000, 0x515be000, 0x515bf000, 0x51c00000,
+	0x51c10000, 0x52658000, 0x5265c000, 0x52818000, 0x52820000, 0x52974000, 0x52976000, 0x529c0000,
+	0x529e0000, 0x52c98000, 0x52ca0000, 0x5389c800, 0x5389d000, 0x538f1800, 0x538f2000, 0x54240000,
+	0x54250000, 0x54cd6000, 0x54cd8000, 0x54e90000, 0x54e98000, 0x54f70200, 0x54f70400, 0x55d9d800,
+	0x55d9dc00, 0x57653000, 0x57654000, 0x57794800, 0x57794c00, 0x57795c00, 0x57796000, 0x5779f800,
+	0x5779fc00, 0x57f7a000, 0x57f7a800, 0x57faa000, 0x57fac000, 0x57ff6000, 0x57ff8000, 0x5927ca00,
+	0x5927cb00, 0x59d03400, 0x59d03800, 0x59d0b400, 0x59d0b800, 0x59d0f000, 0x59d10000, 0x59ef3000,
+	0x59ef4000, 0x5bd48400, 0x5bd48500, 0x5be12000, 0x5be12200, 0x5beb0400, 0x5beb0600, 0x5c26d000,
+	0x5c26d400, 0x5cca0000, 0x5ccc0000, 0x5db36000, 0x5db36800, 0x5db37000, 0x5db37800, 0x5db37c00,
+	0x5db38000, 0x5e1a1b00, 0x5e1a1c00, 0x5e1a1f00, 0x5e1a2000, 0x5e1a2c00, 0x5e1a2d00, 0x5e1a2e00,
+	0x5e1a3000, 0x5e1a4300, 0x5e1a4400, 0x5e1a4900, 0x5e1a4a00, 0x5e1a5400, 0x5e1a5600, 0x5e670400,
+	0x5e670800, 0x5ebed000, 0x5ebef000, 0x5ebf0000, 0x5ebf8000, 0x5fa39400, 0x5fa39800, 0x5fa3c000,
+	0x5fa3d000, 0x5fa90000, 0x5fa92000, 0x5fb5bc00, 0x5fb5c000, 0x60000000, 0x60094000, 0x60096000,
+	0x60098000, 0x6009a000, 0x6009c000, 0x601e4000, 0x601e8000, 0x607d9000, 0x607da000, 0x62800000,
+	0x62810000, 0x65000000, 0x65380000, 0x65400000, 0x66000000, 0x67000000, 0x670b4000, 0x670b4400,
+	0x670cd400, 0x670cd800, 0x67135400, 0x67135800, 0x6718ec00, 0x6718f000, 0x6719e600, 0x6719e700,
+	0x671a8c00, 0x671a9000, 0x671c4400, 0x671c4800, 0x672f3e00, 0x672f4000, 0x673c0c00, 0x673c1000,
+	0x67c4b400, 0x67c4b800, 0x67ce5400, 0x67ce5800, 0x67e1c800, 0x67e1cc00, 0x67e78800, 0x67e78c00,
+	0x67e8ce00, 0x67e8d000, 0x67f16c00, 0x67f17000, 0x67f2c000, 0x67f2c400, 0x67fba400, 0x67fba800,
+	0x67fc5800, 0x67fc5c00, 0x67fd6000, 0x67fd6400, 0x68000000, 0x68252000, 0x68252800, 0x68995400,
+	0x68995800, 0x68a00000, 0x68a02000, 0x68a18000, 0x68a20000, 0x68c87000, 0x68c88000, 0x68e82400,
+	0x68e82600, 0x68e94000, 0x68e98000, 0x68f3d800, 0x68f3dc00, 0x68f40800, 0x68f40c00, 0x68fa2000,
+	0x68fa4000, 0x68fb9000, 0x68fba000, 0x69000000, 0x6a000000, 0x6b000000, 0x6b964000, 0x6b966000,
+	0x6b96a200, 0x6b96b400, 0x6b990000, 0x6b9a0000, 0x6ba1a000, 0x6ba1b000, 0x6bb58000, 0x6bb5a000,
+	0x6bbf4400, 0x6bbf4500, 0x6d000000, 0x6dec0000, 0x6dec1000, 0x6df40000, 0x6df50000, 0x6e000000,
+	0x71cb0000, 0x71cbc000, 0x74ca0000, 0x74cc0000, 0x7d3e4800, 0x7d3e4c00, 0x7f000000, 0x80000000,
+	0x80010000, 0x80070000, 0x80080000, 0x80100000, 0x80110000, 0x80160000, 0x80170000, 0x801b0000,
+	0x801d0000, 0x80270000, 0x802a0000, 0x802d0000, 0x802e0000, 0x80350000, 0x80360000, 0x80410000,
+	0x80500000, 0x80560000, 0x80580000, 0x805d0000, 0x805e0000, 0x805f0000, 0x80620000, 0x80630000,
+	0x806a0000, 0x806b0000, 0x806c0000, 0x806d0000, 0x80748000, 0x80750000, 0x807c0000, 0x807d0000,
+	0x807f0000, 0x80800000, 0x80820000, 0x80840000, 0x80860000, 0x80870000, 0x808b0000, 0x808f0000,
+	0x80a80000, 0x80a90000, 0x80b00000, 0x80b10000, 0x80b20000, 0x80b40000, 0x80b80000, 0x80ba0000,
+	0x80c70000, 0x80c80000, 0x80c90000, 0x80c90c00, 0x80c91000, 0x80ca0000, 0x80cc0000, 0x80cd0000,
+	0x80d60000, 0x80d70000, 0x80e80000, 0x80e90000, 0x80ea0000, 0x80eb0000, 0x80f00000, 0x80f10000,
+	0x80f30000, 0x80f40000, 0x80f60000, 0x80f70000, 0x80fa0000, 0x80fb0000, 0x81000000, 0x81010000,
+	0x810b0000, 0x810e0000, 0x81100000, 0x81110000, 0x81120000, 0x81130000, 0x81140000, 0x81150000,
+	0x811a0000, 0x811c0000, 0x811d0000, 0x811f0000, 0x81200000, 0x812d0000, 0x812e0000, 0x81380000,
+	0x81390000, 0x813c0000, 0x813d0000, 0x81430000, 0x81440000, 0x81450000, 0x81470000, 0x81490000,
+	0x814a0000, 0x814e0000, 0x814f0000, 0x81580000, 0x81590000, 0x815a0000, 0x815b0000, 0x815e0000,
+	0x815f0000, 0x81600000, 0x81610000, 0x81660000, 0x81690000, 0x817a0000, 0x817b0000, 0x817d0000,
+	0x817e0000, 0x81800000, 0x81810000, 0x81820000, 0x81840000, 0x81850000, 0x81880000, 0x81890000,
+	0x818c0000, 0x818d0000, 0x818e0000, 0x81900000, 0x81a90000, 0x81aa0000, 0x81af0000, 0x81b00000,
+	0x81b10000, 0x81b30000, 0x81b40000, 0x81b50000, 0x81ba0000, 0x81bb0000, 0x81bc0000, 0x81c20000,
+	0x81c40000, 0x81c70000, 0x81c80000, 0x81cc0000, 0x81cd0000, 0x81ce0000, 0x81cf0000, 0x81d00000,
+	0x81d10000, 0x81d30000, 0x81d40000, 0x81d60000, 0x81d80000, 0x81d90000, 0x81da0000, 0x81e20000,
+	0x81e40000, 0x81e80000, 0x81e90000, 0x81eb0000, 0x81f00000, 0x81f30000, 0x81f70000, 0x81f80000,
+	0x81f90000, 0x81fa0000, 0x81fe0000, 0x81ff0000, 0x82000000, 0x82010000, 0x82180000, 0x821a0000,
+	0x821b0000, 0x821c0000, 0x821d0000, 0x82200000, 0x82210000, 0x82220000, 0x82230000, 0x82250000,
+	0x82260000, 0x822b0000, 0x822c0000, 0x82360000, 0x82370000, 0x82380000, 0x82390000, 0x823b0000,
+	0x823d0000, 0x823e0000, 0x823f0000, 0x82420000, 0x82440000, 0x82450000, 0x82460000, 0x82490000,
+	0x824a0000, 0x824b0000, 0x824c0000, 0x824e0000, 0x82500000, 0x82520000, 0x82550000, 0x82570000,
+	0x82580000, 0x825a0000, 0x825c0000, 0x825e0000, 0x825f0000, 0x82600000, 0x82620000, 0x82630000,
+	0x82640000, 0x82650000, 0x82660000, 0x82670000, 0x82680000, 0x82690000, 0x826a0000, 0x82700000,
+	0x82710000, 0x82730000, 0x82740000, 0x82750000, 0x82780000, 0x82790000, 0x827b0000, 0x827c0000,
+	0x827d0000, 0x827e0000, 0x82820000, 0x82830000, 0x82850000, 0x82860000, 0x82880000, 0x82890000,
+	0x828a0000, 0x82960000, 0x82990000, 0x829a0000, 0x829b0000, 0x829c0000, 0x829e0000, 0x829f0000,
+	0x82a00000, 0x82a10000, 0x82a20000, 0x82a48000, 0x82a50000, 0x82b40000, 0x82b50000, 0x82b70000,
+	0x82b80000, 0x82b90000, 0x82bb0000, 0x82bc0000, 0x82bd0000, 0x82be0000, 0x82bf0000, 0x82c00000,
+	0x82c20000, 0x82c40000, 0x82c60000, 0x82c70000, 0x82cc0000, 0x82cd0000, 0x82ce0000, 0x82cf0000,
+	0x82d00000, 0x82d20000, 0x82d80000, 0x82da0000, 0x82dc0000, 0x82dd0000, 0x82df0000, 0x82e00000,
+	0x82e10000, 0x82f50000, 0x82f60000, 0x82f70000, 0x82f83000, 0x82f83800, 0x82f83a00, 0x82f84000,
+	0x82f84400, 0x82f86c00, 0x82f88000, 0x82fb0000, 0x82fc0000, 0x82ff0000, 0x83000000, 0x83007c00,
+	0x83008000, 0x83008400, 0x83008800, 0x83010000, 0x83020000, 0x83480000, 0x83487400, 0x83487c00,
+	0x83490000, 0x83610000, 0x83620000, 0x83630000, 0x83640000, 0x83640400, 0x83640800, 0x83643000,
+	0x83643400, 0x8364dc00, 0x8364e000, 0x83650000, 0x83660000, 0x83670000, 0x836c0000, 0x836c9800,
+	0x836c9c00, 0x836cb000, 0x836cb400, 0x836cc400, 0x836cc800, 0x836cec00, 0x836cf000, 0x836d0000,
+	0x836f0000, 0x83700000, 0x83720000, 0x83760000, 0x83810000, 0x83820000, 0x83830000, 0x83930000,
+	0x83940000, 0x83980000, 0x83990000, 0x839a0000, 0x839c0000, 0x839f0000, 0x83a10000, 0x83a10800,
+	0x83a10c00, 0x83a1dc00, 0x83a1e000, 0x83a20000, 0x83a40000, 0x83a70000, 0x83a90000, 0x83aa0000,
+	0x83ab0000, 0x83ac0000, 0x83ad0000, 0x83b20000, 0x83b30000, 0x83b40000, 0x83b50000, 0x83b60000,
+	0x83b90000, 0x83ba0000, 0x83bc0000, 0x83bd0000, 0x83c40000, 0x83c50000, 0x83cb0000, 0x83cc0000,
+	0x83cd0000, 0x83ce0000, 0x83cf0000, 0x83d00000, 0x83d30000, 0x83d40000, 0x83d50000, 0x83d60000,
+	0x83d90000, 0x83da0000, 0x83dc0000, 0x83dd0000, 0x83dd4c00, 0x83dd5000, 0x83dd8c00, 0x83dd9000,
+	0x83de0000, 0x83e00000, 0x83e10000, 0x83e30000, 0x83e50000, 0x83e70000, 0x83e80000, 0x83ea0000,
+	0x83eb0000, 0x83ec0000, 0x83ed0000, 0x83ee0000, 0x83f20000, 0x83f30000, 0x83f40000, 0x83f60000,
+	0x83f70000, 0x83f80000, 0x83f90000, 0x83fb0000, 0x83fc0000, 0x83fe0000, 0x83ff0000, 0x83ff0400,
+	0x83fff000, 0x83fff400, 0x84000000, 0x84400000, 0x844f0000, 0x84920000, 0x84930000, 0x84934000,
+	0x84938000, 0x84950000, 0x84970000, 0x84990000, 0x849a0000, 0x849b0000, 0x849c0000, 0x849d0000,
+	0x849e0000, 0x84a50000, 0x84aa0000, 0x84ab0000, 0x84ac0000, 0x84b00000, 0x84b10000, 0x84b30000,
+	0x84b40000, 0x84b50000, 0x84b70000, 0x84b80000, 0x84b90000, 0x84bc0000, 0x84bf0000, 0x84c00000,
+	0x84c30000, 0x84c50000, 0x84c70000, 0x84c80000, 0x84de0000, 0x84df0000, 0x84e30000, 0x84e40000,
+	0x84e50000, 0x84e80000, 0x84e90000, 0x84ea0000, 0x84eb0000, 0x84f40000, 0x84f50000, 0x84f70000,
+	0x84f90000, 0x84fb0000, 0x84fc0000, 0x84fd0000, 0x84fe0000, 0x84ff8000, 0x84ff8400, 0x85000000,
+	0x86000000, 0x86040000, 0x86070000, 0x86080000, 0x86110000, 0x86120000, 0x86130000, 0x86140000,
+	0x86150000, 0x86160000, 0x86190000, 0x861a0000, 0x861b0000, 0x861d0000, 0x861e0000, 0x861f0000,
+	0x86220000, 0x86260000, 0x862ae000, 0x862ae400, 0x862f0000, 0x86300000, 0x86360000, 0x86370000,
+	0x863a0000, 0x863e0000, 0x864b0000, 0x864c0000, 0x864d0000, 0x86510000, 0x86520000, 0x86530000,
+	0x86540000, 0x865a0000, 0x866f0000, 0x86730000, 0x86740000, 0x86770000, 0x86780000, 0x86820000,
+	0x86830000, 0x868a0000, 0x868b0000, 0x868e0000, 0x86900000, 0x86910000, 0x86940000, 0x86950000,
+	0x86970000, 0x86980000, 0x869b0000, 0x869c0000, 0x869d0000, 0x869f0000, 0x86a10000, 0x86a90000,
+	0x86aa0000, 0x86ab0000, 0x86ac0000, 0x86af0000, 0x86b00000, 0x86b10000, 0x86b20000, 0x86b30000,
+	0x86b40000, 0x86b50000, 0x86b70000, 0x86b90000, 0x86bc0000, 0x86bd0000, 0x86bf0000, 0x86c00000,
+	0x86c40000, 0x86c50000, 0x86cb0000, 0x86cc0000, 0x86ce0000, 0x86cf0000, 0x86d00000, 0x86d10000,
+	0x86d30000, 0x86d40000, 0x86d70000, 0x86db0000, 0x86df0000, 0x86e10000, 0x86e40000, 0x86ec0000,
+	0x86ee0000, 0x86ef0000, 0x86f00000, 0x86f2e000, 0x86f30000, 0x86f50000, 0x86f80000, 0x86f90000,
+	0x86fa0000, 0x86ff0000, 0x87000000, 0x87543400, 0x87543800, 0x87549400, 0x87549800, 0x8754e800,
+	0x87550000, 0x875a0000, 0x875b0000, 0x87950000, 0x87960000, 0x87c40000, 0x87c50000, 0x88162000,
+	0x88164000, 0x888f0000, 0x888f8000, 0x888fe000, 0x88900000, 0x88901000, 0x88910000, 0x88940000,
+	0x88950000, 0x88990000, 0x889b0000, 0x889e0000, 0x889f0000, 0x88a30000, 0x88a50000, 0x88a90000,
+	0x88ab0000, 0x88ac0000, 0x88ae0000, 0x88b90000, 0x88bc0000, 0x88c60000, 0x88c70000, 0x88c80000,
+	0x88c90000, 0x88ca0000, 0x88ce0000, 0x88cf0000, 0x88e10000, 0x88e20000, 0x88e48000, 0x88e4b000,
+	0x88e60000, 0x88e80000, 0x88ea0000, 0x88f30000, 0x88f40000, 0x88ff0000, 0x89000000, 0x89110000,
+	0x89120000, 0x89210000, 0x89230000, 0x89280000, 0x89290000, 0x892b0000, 0x892d0000, 0x892f0000,
+	0x89300000, 0x89320000, 0x89330000, 0x89370000, 0x89390000, 0x893a0000, 0x893b0000, 0x893c0000,
+	0x893f0000, 0x89410000, 0x89440000, 0x89450000, 0x89490000, 0x894b0000, 0x894c0000, 0x894d0000,
+	0x895c0000, 0x895d0000, 0x895e0000, 0x89600000, 0x89610000, 0x89620000, 0x89650000, 0x89660000,
+	0x89690000, 0x896a0000, 0x896c0000, 0x896d0000, 0x896e0000, 0x896f0000, 0x89700000, 0x89730000,
+	0x89740000, 0x89780000, 0x897a0000, 0x89810000, 0x89820000, 0x89840000, 0x89850000, 0x89860000,
+	0x898a0000, 0x898b0000, 0x89930000, 0x89940000, 0x89990000, 0x899b0000, 0x899c0000, 0x899d0000,
+	0x899e0000, 0x899f0000, 0x89a30000, 0x89a40000, 0x89a60000, 0x89a70000, 0x89ab0000, 0x89ac0000,
+	0x89ad0000, 0x89ae0000, 0x89af0000, 0x89bd0000, 0x89be0000, 0x89bf0000, 0x89c00000, 0x89c10000,
+	0x89c40000, 0x89c50000, 0x89cc0000, 0x89ce0000, 0x89d00000, 0x89d10000, 0x89d50000, 0x89d60000,
+	0x89d80000, 0x89d90000, 0x89db0000, 0x89dc0000, 0x89dc4000, 0x89dc8000, 0x89dd0000, 0x89e10000,
+	0x89e20000, 0x89e30000, 0x89f80000, 0x89f90000, 0x89fa0000, 0x89fc0000, 0x89fd0000, 0x89fe0000,
+	0x89ff0000, 0x8a000000, 0x8a006c00, 0x8a007000, 0x8a010000, 0x8a030000, 0x8a050000, 0x8a060000,
+	0x8a070000, 0x8a080000, 0x8a0e0000, 0x8a0f0000, 0x8a130000, 0x8a140000, 0x8a150000, 0x8a170000,
+	0x8a180000, 0x8a1a0000, 0x8a1e0000, 0x8a1f0000, 0x8a240000, 0x8a240800, 0x8a241000, 0x8a250000,
+	0x8a270000, 0x8a280000, 0x8a2a0000, 0x8a2b0000, 0x8a2b2000, 0x8a2b3000, 0x8a2bc000, 0x8a2bd000,
+	0x8a2c0000, 0x8a2d0000, 0x8a300000, 0x8a310000, 0x8a3b0000, 0x8a3b2400, 0x8a3b2800, 0x8a3b8800,
+	0x8a3b8c00, 0x8a3b9800, 0x8a3b9c00, 0x8a3bb400, 0x8a3bb800, 0x8a3be000, 0x8a3be400, 0x8a3c0000,
+	0x8a3e0000, 0x8a400000, 0x8a410000, 0x8a420000, 0x8a430000, 0x8a460000, 0x8a470000, 0x8a480000,
+	0x8a4b0000, 0x8a4c0000, 0x8a4d0000, 0x8a4e0000, 0x8a4f0000, 0x8a510000, 0x8a520000, 0x8a5e0000,
+	0x8a5e2800, 0x8a5e2c00, 0x8a5ea800, 0x8a5eac00, 0x8a5eb800, 0x8a5ebc00, 0x8a5f0000, 0x8a600000,
+	0x8a610000, 0x8a614c00, 0x8a615000, 0x8a620000, 0x8a630000, 0x8a637c00, 0x8a638000, 0x8a63e400,
+	0x8a63e800, 0x8a640000, 0x8a650000, 0x8a660000, 0x8a690000, 0x8a6a0000, 0x8a6b0000, 0x8a6c0000,
+	0x8a750000, 0x8a752c00, 0x8a753000, 0x8a75e000, 0x8a760000, 0x8a769800, 0x8a769c00, 0x8a76c800,
+	0x8a76cc00, 0x8a770000, 0x8a790000, 0x8a792800, 0x8a792c00, 0x8a79a400, 0x8a79a800, 0x8a7ab800,
+	0x8a7abc00, 0x8a7b0000, 0x8a7c0000, 0x8a7d0000, 0x8a808800, 0x8a809000, 0x8a820000, 0x8a830000,
+	0x8a850000, 0x8a860000, 0x8a870000, 0x8ab90000, 0x8ab94400, 0x8ab94800, 0x8ab95800, 0x8ab95c00,
+	0x8aba4c00, 0x8aba5000, 0x8abb0000, 0x8ac00000, 0x8ac20000, 0x8ac30000, 0x8ac40000, 0x8ac60000,
+	0x8aca0000, 0x8acb0000, 0x8acc0000, 0x8acc1000, 0x8acc1400, 0x8acca400, 0x8acca800, 0x8acd0000,
+	0x8acf0000, 0x8ad30000, 0x8ad50000, 0x8ad70000, 0x8ad90000, 0x8ada0000, 0x8adb0000, 0x8adb1c00,
+	0x8adb2000, 0x8adc0000, 0x8add0000, 0x8ae50000, 0x8ae70000, 0x8aea0000, 0x8aeb0000, 0x8aec0000,
+	0x8aef0000, 0x8af00000, 0x8af30000, 0x8af40000, 0x8af70000, 0x8af80000, 0x8af84000, 0x8af88000,
+	0x8afc0000, 0x8afd0000, 0x8afe0000, 0x8aff0000, 0x8aff3400, 0x8aff3800, 0x8b000000, 0x8b010000,
+	0x8b050000, 0x8b060000, 0x8b090000, 0x8b0a0000, 0x8b1a0000, 0x8b1b0000, 0x8b1f0000, 0x8b2c0000,
+	0x8b2d0000, 0x8b2e0000, 0x8b2f0000, 0x8b300000, 0x8b320000, 0x8b330000, 0x8b350000, 0x8b360000,
+	0x8b370000, 0x8b3a0000, 0x8b3b0000, 0x8b3c0000, 0x8b3f0000, 0x8b408000, 0x8b420000, 0x8b430000,
+	0x8b4a0000, 0x8b4c0000, 0x8b4f0000, 0x8b500000, 0x8b510000, 0x8b520000, 0x8b530000, 0x8b540000,
+	0x8b560000, 0x8b570000, 0x8b590000, 0x8b5d0000, 0x8b600000, 0x8b630000, 0x8b640000, 0x8b650000,
+	0x8b660000, 0x8b690000, 0x8b790000, 0x8b7a0000, 0x8b7d0000, 0x8b800000, 0x8b810000, 0x8b830000,
+	0x8b840000, 0x8b850000, 0x8b860000, 0x8b870000, 0x8b8ac000, 0x8b8ae000, 0x8b8d0000, 0x8b8e0000,
+	0x8b8f0000, 0x8b900000, 0x8b910000, 0x8b920000, 0x8b940000, 0x8b950000, 0x8b960000, 0x8b970000,
+	0x8b980000, 0x8b990000, 0x8b9a0000, 0x8b9c0000, 0x8b9f0000, 0x8ba00000, 0x8ba10000, 0x8ba20000,
+	0x8ba30000, 0x8ba40000, 0x8ba70000, 0x8ba90000, 0x8baa0000, 0x8bab0000, 0x8bae0000, 0x8baf0000,
+	0x8bb10000, 0x8bb20000, 0x8bb40000, 0x8bb40800, 0x8bb41000, 0x8bb44000, 0x8bb4e000, 0x8bb70000,
+	0x8bb80000, 0x8bb90000, 0x8bba0000, 0x8bbb0000, 0x8bbc0000, 0x8bbf0000, 0x8bc00000, 0x8bde0000,
+	0x8bdf0000, 0x8be10000, 0x8be20000, 0x8be50000, 0x8be60000, 0x8be70000, 0x8bff0000, 0x8c010000,
+	0x8c4b0000, 0x8c4c0000, 0x8c4d0000, 0x8c4f0000, 0x8c500000, 0x8c52c000, 0x8c52d000, 0x8c530000,
+	0x8c540000, 0x8c570000, 0x8c5c0000, 0x8c5d0000, 0x8c5f0000, 0x8c600000, 0x8c610000, 0x8c620000,
+	0x8c690000, 0x8c6a0000, 0x8c6d0000, 0x8c8b0000, 0x8c8f0000, 0x8c900000, 0x8c940000, 0x8c950000,
+	0x8c960000, 0x8c980000, 0x8c9f0000, 0x8ca00000, 0x8ca40000, 0x8ca50000, 0x8ca60000, 0x8ca70000,
+	0x8ca80000, 0x8ca90000, 0x8cb30000, 0x8cb40000, 0x8cb50000, 0x8cb60000, 0x8cbf0000, 0x8cc00000,
+	0x8cc80000, 0x8cc90000, 0x8ccb0000, 0x8ccc0000, 0x8ccd0000, 0x8cd00000, 0x8cd20000, 0x8cd30000,
+	0x8cd50000, 0x8cd60000, 0x8ce00000, 0x8ce10000, 0x8ce30000, 0x8ce40000, 0x8ce70000, 0x8ce80000,
+	0x8ced0000, 0x8cee0000, 0x8cf00000, 0x8cf10000, 0x8cf30000, 0x8cf40000, 0x8cf60000, 0x8cf70000,
+	0x8cf90000, 0x8cfb0000, 0x8cfd0000, 0x8cfe0000, 0x8cff0000, 0x8d000000, 0x8d560000, 0x8d570000,
+	0x8d660000, 0x8d670000, 0x8d680000, 0x8d690000, 0x8d6a0000, 0x8d6c0000, 0x8d6d0000, 0x8d710000,
+	0x8d720000, 0x8d730000, 0x8d740000, 0x8d780000, 0x8d790000, 0x8d7d0000, 0x8d7e0000, 0x8d820000,
+	0x8d830000, 0x8d840000, 0x8d850000, 0x8d860000, 0x8d8b0000, 0x8d8f0000, 0x8d950000, 0x8da30000,
+	0x8da40000, 0x8da48000, 0x8da50000, 0x8da80000, 0x8da90000, 0x8dad0000, 0x8daf0000, 0x8db10000,
+	0x8db20000, 0x8db30000, 0x8db40000, 0x8dc00000, 0x8dc10000, 0x8dc11400, 0x8dc11500, 0x8dc12800,
+	0x8dc12c00, 0x8dc16c00, 0x8dc17000, 0x8dc19800, 0x8dc1a000, 0x8dc1d600, 0x8dc1d800, 0x8dc20000,
+	0x8dc30000, 0x8dc40000, 0x8dc50000, 0x8dc80000, 0x8dca0000, 0x8dcb0000, 0x8dcc0000, 0x8dd00000,
+	0x8dd10000, 0x8ddf0000, 0x8de00000, 0x8de20000, 0x8de28800, 0x8de28b00, 0x8de28c00, 0x8de29000,
+	0x8de60000, 0x8de70000, 0x8de80000, 0x8ded0000, 0x8dee0000, 0x8df10000, 0x8df20000, 0x8df30000,
+	0x8df40000, 0x8df60000, 0x8df90000, 0x8dfb0000, 0x8dfc0000, 0x8dfe0000, 0x8dff0000, 0x8e000000,
+	0x8e5b0800, 0x8e5b1000, 0x8e5b7800, 0x8e5b8000, 0x8e5b9800, 0x8e5ba000, 0x8e9a0000, 0x8e9a8000,
+	0x8eea2000, 0x8eea2800, 0x8ef70000, 0x8ef80000, 0x8f000000, 0x8f00f000, 0x8f00f400, 0x8f010000,
+	0x8f290000, 0x8f2a0000, 0x8f2f0000, 0x8f300000, 0x8f320000, 0x8f360000, 0x8f370000, 0x8f400000,
+	0x8f410000, 0x8f420000, 0x8f590000, 0x8f5b0000, 0x8f5c0000, 0x8f5c8000, 0x8f5e0000, 0x8f5f0000,
+	0x8f600000, 0x8f610000, 0x8f620000, 0x8f630000, 0x8f640000, 0x8f6a0000, 0x8f6d0000, 0x8f750000,
+	0x8f770000, 0x8f780000, 0x8f790000, 0x8f7a0000, 0x8f7d0000, 0x8f7e0000, 0x8f7f0000, 0x8f800000,
+	0x8f810000, 0x8f830000, 0x8f880000, 0x8f890000, 0x8f892400, 0x8f892800, 0x8f89ac00, 0x8f89b000,
+	0x8f8a0000, 0x8fa00000, 0x8fa10000, 0x8fa20000, 0x8fa30000, 0x8fa50000, 0x8fa70000, 0x8fa80000,
+	0x8fa90000, 0x8faa0000, 0x8fae0000, 0x8faf0000, 0x8fb00000, 0x8fb50000, 0x8fbc0000, 0x8fbe0000,
+	0x8fc06000, 0x8fc08000, 0x8fc40000, 0x8fc50000, 0x8fca0000, 0x8fcb0000, 0x8fcd0000, 0x8fce0000,
+	0x8fd00000, 0x8fd03000, 0x8fd03400, 0x8fd10000, 0x8fd20000, 0x8fd30000, 0x8fd80000, 0x8fd90000,
+	0x8fda0000, 0x8fdb0000, 0x8fdd0000, 0x8fde0000, 0x8fe00000, 0x8fe20000, 0x8fe90000, 0x8feb0000,
+	0x8fed0000, 0x8fee0000, 0x8fef0000, 0x8ff00000, 0x8ff50000, 0x8ff60000, 0x8ff80000, 0x8ff90000,
+	0x8ffc0000, 0x8ffd0000, 0x8ffe0000, 0x8fff0000, 0x8fffb400, 0x8fffb800, 0x90000000, 0x90010000,
+	0x90020000, 0x90030000, 0x90040000, 0x90050000, 0x90060000, 0x90080000, 0x900c0000, 0x900d0000,
+	0x90100000, 0x90110000, 0x90140000, 0x90160000, 0x90180000, 0x90190000, 0x901b0000, 0x901c0000,
+	0x90200000, 0x90210000, 0x90244600, 0x90244a00, 0x90246800, 0x90246900, 0x90248000, 0x90248200,
+	0x90248600, 0x90248800, 0x90248c00, 0x90248e00, 0x90249000, 0x90249200, 0x90249400, 0x90249600,
+	0x9024b000, 0x9024b100, 0x9024b200, 0x9024b300, 0x9024b600, 0x9024ba00, 0x9024bc00, 0x9024be00,
+	0x9024ce00, 0x9024d000, 0x9024d200, 0x9024d400, 0x9024d600, 0x9024da00, 0x9024dc00, 0x9024ed00,
+	0x9024f400, 0x9024f600, 0x9024f800, 0x9024fc00, 0x9024fe00, 0x90250000, 0x90290000, 0x902a0000,
+	0x902b0000, 0x902d0000, 0x90300000, 0x90303c00, 0x90304000, 0x90310000, 0x90340000, 0x90360000,
+	0x90370000, 0x90380000, 0x903a0000, 0x903f0000, 0x90420000, 0x90430000, 0x904c0000, 0x904d0000,
+	0x90520000, 0x90530000, 0x90540000, 0x90568000, 0x90570000, 0x90580000, 0x905b4000, 0x905b8000,
+	0x905f0000, 0x90600000, 0x90610000, 0x90620000, 0x90630000, 0x906e0000, 0x906f0000, 0x90770000,
+	0x90780000, 0x90790000, 0x907a0000, 0x907b0000, 0x907c0000, 0x907d0000, 0x907f0000, 0x90800000,
+	0x90820000, 0x908d0000, 0x90910000, 0x90920000, 0x90a40000, 0x90a60000, 0x90ad0000, 0x90ae0000,
+	0x90b00000, 0x90b60000, 0x90c10000, 0x90c20000, 0x90c70000, 0x90c80000, 0x90c90000, 0x90cc0000,
+	0x90cd0000, 0x90ce0000, 0x90cf0000, 0x90d00000, 0x90d04000, 0x90d08000, 0x90d20000, 0x90d50000,
+	0x90d70000, 0x90f80000, 0x90f90000, 0x90ff0000, 0x91000000, 0x92010000, 0x92020000, 0x92050000,
+	0x920b0000, 0x920c0000, 0x92130000, 0x92140000, 0x92150000, 0x92160000, 0x92300000, 0x92310000,
+	0x92320000, 0x92330000, 0x92340000, 0x92350000, 0x92380000, 0x92390000, 0x923b0000, 0x923d0000,
+	0x92400000, 0x92410000, 0x92420000, 0x92440000, 0x92460000, 0x92470000, 0x92475e00, 0x92476000,
+	0x92480000, 0x92490000, 0x924b0000, 0x924c0000, 0x924d0000, 0x924e0000, 0x92500000, 0x92520000,
+	0x92530000, 0x92540000, 0x92570000, 0x92580000, 0x92581000, 0x92581d00, 0x92582000, 0x92586000,
+	0x92588000, 0x92588800, 0x92589000, 0x92589400, 0x92589800, 0x9258b000, 0x9258c400, 0x9258d000,
+	0x9258e800, 0x9258f000, 0x925a0000, 0x925b0000, 0x92610000, 0x92620000, 0x92630000, 0x92640000,
+	0x926f0000, 0x92700000, 0x92710000, 0x92740000, 0x92750000, 0x92760000, 0x92770000, 0x92790000,
+	0x927c0000, 0x927d0000, 0x92850000, 0x92860000, 0x92870000, 0x92880000, 0x92890000, 0x928c0000,
+	0x928d0000, 0x928e0000, 0x929b0000, 0x929c0000, 0x929e0000, 0x92a00000, 0x92a10000, 0x92a30000,
+	0x92a40000, 0x92a50000, 0x92a90000, 0x92aa0000, 0x92ab0000, 0x92ac0000, 0x92ae0000, 0x92af0000,
+	0x92b20000, 0x92b30000, 0x92b40000, 0x92b60000, 0x92b70000, 0x92b90000, 0x92ba0000, 0x92bc0000,
+	0x92bd0000, 0x92bf0000, 0x92c30000, 0x92c48000, 0x92c50000, 0x92d20000, 0x92d60000, 0x92d80000,
+	0x92d90000, 0x92db0000, 0x92dd0000, 0x92de0000, 0x92e00000, 0x92e10000, 0x92e30000, 0x92e50000,
+	0x92e60000, 0x92e90000, 0x92ea0000, 0x92eb0000, 0x92f10000, 0x92f20000, 0x92f70000, 0x92fa0000,
+	0x92fb0000, 0x92fc0000, 0x92fd0000, 0x92ffb800, 0x92ffc000, 0x93000000, 0x93060000, 0x93070000,
+	0x93080000, 0x93090000, 0x930a0000, 0x930b0000, 0x930c0000, 0x930f0000, 0x931b0000, 0x931f0000,
+	0x93200000, 0x93220000, 0x93290000, 0x932a0000, 0x932b0000, 0x932c0000, 0x932e0000, 0x93300000,
+	0x93320000, 0x93330000, 0x93340000, 0x93350000, 0x93360000, 0x93370000, 0x933c0000, 0x933d0000,
+	0x93410000, 0x93420000, 0x93430000, 0x93450000, 0x93460000, 0x934b0000, 0x934c0000, 0x934d0000,
+	0x934f0000, 0x93520000, 0x93550000, 0x93560000, 0x935a0000, 0x935b0000, 0x935c0000, 0x935c2000,
+	0x935c3000, 0x935c8000, 0x935d0000, 0x93610000, 0x93620000, 0x93650000, 0x93660000, 0x93670000,
+	0x936d0000, 0x936e0000, 0x936f0000, 0x93710000, 0x93770000, 0x93780000, 0x937a0000, 0x937c0000,
+	0x937d0000, 0x937e0000, 0x937f0000, 0x93800000, 0x93840000, 0x93850000, 0x93878000, 0x93880000,
+	0x938e0000, 0x93900000, 0x93910000, 0x93920000, 0x93930000, 0x93990000, 0x939c0000, 0x939d0000,
+	0x939f0000, 0x93a10000, 0x93a10400, 0x93a10800, 0x93a40000, 0x93a70000, 0x93a80000, 0x93ab0000,
+	0x93ae0000, 0x93af0000, 0x93b00000, 0x93b10000, 0x93b40000, 0x93b60000, 0x93b80000, 0x93b90000,
+	0x93ba0000, 0x93bb0000, 0x93bc0000, 0x93be0000, 0x93c00000, 0x93c10000, 0x93c20000, 0x93c40000,
+	0x93c60000, 0x93c80000, 0x93c90000, 0x93ca0000, 0x93cc0000, 0x93cd0000, 0x93d10000, 0x93d20000,
+	0x93d30000, 0x93d40000, 0x93d50000, 0x93d80000, 0x93dc0000, 0x93dd0000, 0x93e40000, 0x93ee0000,
+	0x93f30000, 0x93f40000, 0x93fa0000, 0x93fd0000, 0x94000000, 0x94010000, 0x94020000, 0x94040000,
+	0x94060000, 0x94070000, 0x94080000, 0x94360000, 0x94370000, 0x94380000, 0x94390000, 0x943b3900,
+	0x943b3a00, 0x943b7300, 0x943b7400, 0x943c0000, 0x943d0000, 0x943f0000, 0x94400000, 0x94403800,
+	0x94403c00, 0x94420000, 0x94422000, 0x94423000, 0x9442a000, 0x94430000, 0x94450000, 0x94460000,
+	0x94470000, 0x94480000, 0x944ce000, 0x944d0000, 0x944f0000, 0x94500000, 0x94510000, 0x94540000,
+	0x94580000, 0x94590000, 0x94650000, 0x94680000, 0x946e0000, 0x94700000, 0x94760000, 0x947c0000,
+	0x94870000, 0x94890000, 0x948a0000, 0x948d0000, 0x948f0000, 0x94900000, 0x94910000, 0x94920000,
+	0x94940000, 0x94950000, 0x94970000, 0x94980000, 0x94a00000, 0x94a10000, 0x94a20000, 0x94a90000,
+	0x94aa0000, 0x94b00000, 0x94b10000, 0x94b50000, 0x94b60000, 0x94b70000, 0x94b90000, 0x94ba0000,
+	0x94bb0000, 0x94bc0000, 0x94c30000, 0x94c40000, 0x94c70000, 0x94c80000, 0x94c90000, 0x94fb0000,
+	0x94fe0000, 0x94ff0000, 0x95000000, 0x95010000, 0x95030000, 0x95040000, 0x951b0000, 0x951c0000,
+	0x95310000, 0x95320000, 0x95360000, 0x95370000, 0x953b0000, 0x953c0000, 0x953e0000, 0x953f0000,
+	0x95510000, 0x95520000, 0x955a0000, 0x955b0000, 0x956d0000, 0x956e0000, 0x957e0000, 0x957f0000,
+	0x95810000, 0x95820000, 0x95840000, 0x95870000, 0x95880000, 0x958b0000, 0x958d0000, 0x95900000,
+	0x95910000, 0x95920000, 0x95950000, 0x95990000, 0x959e0000, 0x95a70000, 0x95a80000, 0x95aa0000,
+	0x95ab0000, 0x95ac0000, 0x95ad0000, 0x95b00000, 0x95b10000, 0x95c60000, 0x95c80000, 0x95ea0000,
+	0x95ea0800, 0x95ea8000, 0x95eac000, 0x95eb0000, 0x95f80000, 0x95f90000, 0x95fc0000, 0x95fe0000,
+	0x96000000, 0x96660000, 0x966a0000, 0x966b0000, 0x966bc800, 0x966bcc00, 0x966c0000, 0x966d0000,
+	0x966e0000, 0x96700000, 0x96710000, 0x96730000, 0x96760000, 0x96790000, 0x967b0000, 0x96800000,
+	0x96810000, 0x96810800, 0x96810c00, 0x96820000, 0x96840000, 0x96850000, 0x968a0000, 0x968c0000,
+	0x968d0000, 0x96910000, 0x96930000, 0x96940000, 0x96960000, 0x96980000, 0x969e0000, 0x969f0000,
+	0x96a10000, 0x96a60000, 0x96ad0000, 0x96ae0000, 0x96af0000, 0x96b00000, 0x96b20000, 0x96b30000,
+	0x96b70000, 0x96b80000, 0x96b90000, 0x96be0000, 0x96bf0000, 0x96c00000, 0x96c50000, 0x96c60000,
+	0x96cb0000, 0x96cc0000, 0x96ce0000, 0x96d00000, 0x96d50000, 0x96d70000, 0x96d90000, 0x96da0000,
+	0x96df0000, 0x96e00000, 0x96e30000, 0x96e40000, 0x96e50000, 0x96e60000, 0x96ec0000, 0x96ee0000,
+	0x96f10000, 0x96f20000, 0x96f25800, 0x96f25c00, 0x96f2dc00, 0x96f2e000, 0x96f30000, 0x96f40000,
+	0x96f50000, 0x96f60000, 0x96f70000, 0x96f90000, 0x96fa0000, 0x96fb0000, 0x96fc0000, 0x96fe0000,
+	0x96ff0000, 0x97000000, 0x97650000, 0x976a0000, 0x976aa000, 0x976ac000, 0x976af000, 0x97730000,
+	0x97740000, 0x97780000, 0x97790000, 0x977f0000, 0x97800000, 0x97810000, 0x97820000, 0x97830000,
+	0x97850000, 0x97860000, 0x97870000, 0x97890000, 0x979c0000, 0x979f0000, 0x97aa0000, 0x97ab0000,
+	0x97ac0000, 0x97ae0000, 0x97af0000, 0x97b20000, 0x97b30000, 0x97b40000, 0x97b50000, 0x97b60000,
+	0x97b90000, 0x97bb0000, 0x97bc0000, 0x97bd0000, 0x97be0000, 0x97c00000, 0x97c10000, 0x97d28000,
+	0x97d30000, 0x97d50000, 0x97d80000, 0x98000000, 0x98010000, 0x98204000, 0x98210000, 0x98340000,
+	0x98350000, 0x98380000, 0x983c0000, 0x98410000, 0x98418000, 0x98420000, 0x98430000, 0x98470000,
+	0x98480000, 0x98490000, 0x984a0000, 0x984b0000, 0x984c0000, 0x984d0000, 0x984f0000, 0x98510000,
+	0x98520000, 0x98530000, 0x98540000, 0x98550000, 0x98580000, 0x985b0000, 0x985c0000, 0x985d0000,
+	0x98610000, 0x98620000, 0x98640000, 0x98650000, 0x98690000, 0x986a0000, 0x98710000, 0x98720000,
+	0x98740000, 0x98760000, 0x98770000, 0x98860000, 0x98870000, 0x98880000, 0x98890000, 0x988b0000,
+	0x988c0000, 0x988f0000, 0x98900000, 0x98930000, 0x98940000, 0x98950000, 0x98960000, 0x98970000,
+	0x98980000, 0x98990000, 0x989a0000, 0x989c0000, 0x989d0000, 0x98a50000, 0x98a60000, 0x98b00000,
+	0x98c80000, 0x98d00000, 0x98e20000, 0x98e30000, 0x98e60000, 0x99000000, 0x99010000, 0x99020000,
+	0x99030000, 0x99040000, 0x99050000, 0x99060000, 0x990f0000, 0x99100000, 0x99110000, 0x99120000,
+	0x99130000, 0x99140000, 0x99150000, 0x99220000, 0x99260000, 0x99580000, 0x99590000, 0x995c0000,
+	0x99630000, 0x99640000, 0x99650000, 0x99660000, 0x996b0000, 0x996c0000, 0x996f0000, 0x99700000,
+	0x99710000, 0x99760000, 0x9a000000, 0x9a010000, 0x9a080000, 0x9a083000, 0x9a084000, 0x9a088000,
+	0x9a090000, 0x9a0a0000, 0x9a0b0000, 0x9a0e0000, 0x9a100000, 0x9a110000, 0x9a200000, 0x9a210000,
+	0x9a230000, 0x9a410000, 0x9b010000, 0x9b040000, 0x9b050000, 0x9b0b0000, 0x9b0cc000, 0x9b0ce000,
+	0x9b0d0000, 0x9b200000, 0x9b210000, 0x9b230100, 0x9b230200, 0x9b232200, 0x9b232400, 0x9b232e00,
+	0x9b233000, 0x9b23e200, 0x9b23e300, 0x9b23e800, 0x9b23e900, 0x9b2d0000, 0x9b2e0000, 0x9b360000,
+	0x9b390000, 0x9b3b0000, 0x9b3d0000, 0x9b3e0000, 0x9b3f0000, 0x9b420000, 0x9b430000, 0x9b450000,
+	0x9b460000, 0x9b470000, 0x9b480000, 0x9b490000, 0x9b4a0000, 0x9b590000, 0x9b5a0000, 0x9b5d0000,
+	0x9b5e0000, 0x9b690000, 0x9b6a0000, 0x9b830000, 0x9b860000, 0x9b880000, 0x9b8a0000, 0x9b8a4000,
+	0x9b8a8000, 0x9b8c0000, 0x9b8d0000, 0x9b8f0000, 0x9b910000, 0x9b920000, 0x9b9e0000, 0x9b9f0000,
+	0x9ba00000, 0x9ba10000, 0x9bb90000, 0x9bba0000, 0x9bbb0000, 0x9bbc0000, 0x9bbe0000, 0x9bbf0000,
+	0x9bc00000, 0x9bc10000, 0x9bc40000, 0x9bc50000, 0x9bc60000, 0x9bc70000, 0x9bca0000, 0x9bcb0000,
+	0x9bcc0000, 0x9bcd0000, 0x9bce0000, 0x9bcf0000, 0x9bd00000, 0x9bd10000, 0x9bd30000, 0x9bd40000,
+	0x9bdf0000, 0x9be00000, 0x9be30000, 0x9be50000, 0x9be60000, 0x9be70000, 0x9be80000, 0x9bf10000,
+	0x9bf50000, 0x9bf60000, 0x9bf90000, 0x9bfb0000, 0x9bfc0000, 0x9bfd0000, 0x9bfe0000, 0x9bfe2000,
+	0x9bfe4000, 0x9c000000, 0x9c00cc00, 0x9c00d000, 0x9c010000, 0x9c080000, 0x9c090000, 0x9c0a0000,
+	0x9c0b0000, 0x9c0d0000, 0x9c0e0000, 0x9c0f0000, 0x9c110000, 0x9c130000, 0x9c160000, 0x9c170000,
+	0x9c190000, 0x9c1a0000, 0x9c1c0000, 0x9c1d0000, 0x9c1f0000, 0x9c200000, 0x9c230000, 0x9c240000,
+	0x9c260000, 0x9c270000, 0x9c2b0000, 0x9c2c0000, 0x9c300000, 0x9c320000, 0x9c330000, 0x9c350000,
+	0x9c360000, 0x9c370000, 0x9c3a0000, 0x9c3b0000, 0x9c3c0000, 0x9c3d0000, 0x9c3e0000, 0x9c3f0000,
+	0x9c430000, 0x9c440000, 0x9c450000, 0x9c460000, 0x9c530000, 0x9c540000, 0x9c610000, 0x9c620000,
+	0x9c6a0000, 0x9c6b0000, 0x9c720000, 0x9c750000, 0x9c760000, 0x9c770000, 0x9c850000, 0x9c860000,
+	0x9c870000, 0x9c880000, 0x9c930000, 0x9c940000, 0x9c950000, 0x9c960000, 0x9c970000, 0x9c9b0000,
+	0x9d000000, 0x9d050000, 0x9d060000, 0x9d0a0000, 0x9d0b0000, 0x9d0f0000, 0x9d100000, 0x9d140000,
+	0x9d170000, 0x9d1e0000, 0x9d200000, 0x9d340000, 0x9d3d0000, 0x9d3e0000, 0x9d3f0000, 0x9d420000,
+	0x9d430000, 0x9d510000, 0x9d520000, 0x9d530000, 0x9d550000, 0x9d560000, 0x9d570000, 0x9d580000,
+	0x9d590000, 0x9d5c0000, 0x9d5d0000, 0x9d5e0000, 0x9d5f0000, 0x9d600000, 0x9d620000, 0x9d630000,
+	0x9d640000, 0x9d650000, 0x9d78e000, 0x9d78e800, 0x9d78ec00, 0x9d790000, 0x9d7a0000, 0x9d7b0000,
+	0x9d7c0000, 0x9d7e0000, 0x9d800000, 0x9d810000, 0x9d820000, 0x9d880000, 0x9d890000, 0x9d8a0000,
+	0x9d8b0000, 0x9d8c0000, 0x9d8d0000, 0x9d900000, 0x9d910000, 0x9d930000, 0x9d950000, 0x9d9b0000,
+	0x9d9d0000, 0x9da00000, 0x9da10000, 0x9da50000, 0x9da70000, 0x9daa0000, 0x9dab0000, 0x9dae0000,
+	0x9db10000, 0x9db20000, 0x9db30000, 0x9db40000, 0x9db60000, 0x9db9c000, 0x9dba0000, 0x9dbb0000,
+	0x9dbe0000, 0x9dbf0000, 0x9dc00000, 0x9dc10000, 0x9dc20000, 0x9dc50000, 0x9dc60000, 0x9dc80000,
+	0x9dc90000, 0x9dcb0000, 0x9dcc0000, 0x9dcd0000, 0x9dce0000, 0x9dd30000, 0x9dd40000, 0x9de30000,
+	0x9de40000, 0x9de50000, 0x9de70000, 0x9de80000, 0x9dec0000, 0x9dee0000, 0x9defc000, 0x9df00000,
+	0x9df30000, 0x9df40000, 0x9df70000, 0x9df80000, 0x9df90000, 0x9dfa0000, 0x9dfa4000, 0x9dfb0000,
+	0x9dfd0000, 0x9dfe0000, 0x9dff0000, 0x9e000000, 0x9e240000, 0x9e280000, 0x9e290000, 0x9e2c0000,
+	0x9e2e0000, 0x9e300000, 0x9e310000, 0x9e330000, 0x9e360000, 0x9e370000, 0x9e3a0000, 0x9e3b0000,
+	0x9e3c0000, 0x9e3d0000, 0x9e400000, 0x9e410000, 0x9e420000, 0x9e440000, 0x9e4b0000, 0x9e4c0000,
+	0x9e590000, 0x9e5a0000, 0x9e5b0000, 0x9e5c0000, 0x9e5d0000, 0x9e5e0000, 0x9e5f0000, 0x9e610000,
+	0x9e620000, 0x9e630000, 0x9e640000, 0x9e660000, 0x9e670000, 0x9e690000, 0x9e6a0000, 0x9e6c0000,
+	0x9e6d0000, 0x9e6f0000, 0x9e700000, 0x9e710000, 0x9e770000, 0x9e780000, 0x9e7c0000, 0x9e800000,
+	0x9e810000, 0x9e820000, 0x9e830000, 0x9e840000, 0x9e850000, 0x9e860000, 0x9e8c1000, 0x9e8c2000,
+	0x9e8c4000, 0x9e8c8000, 0x9e8d0000, 0x9e8f0000, 0x9e900000, 0x9e910000, 0x9e928000, 0x9e929000,
+	0x9e940000, 0x9e970000, 0x9e980000, 0x9e990000, 0x9e9c0000, 0x9e9d0000, 0x9e9e0000, 0x9e9f0000,
+	0x9ea00000, 0x9ea10000, 0x9ea20000, 0x9ea30000, 0x9ea60000, 0x9eaa0000, 0x9eab0000, 0x9eac0000,
+	0x9eb60000, 0x9eb70000, 0x9ebe0000, 0x9ec60000, 0x9ed80000, 0x9ed90000, 0x9eda0000, 0x9edb0000,
+	0x9edc0000, 0x9edd0000, 0x9ede0000, 0x9ede1000, 0x9edf0000, 0x9ee00000, 0x9ee10000, 0x9ee40000,
+	0x9ee60000, 0x9eeb0000, 0x9ef80000, 0x9efb0000, 0x9efc0000, 0x9eff0000, 0x9f010000, 0x9f070000,
+	0x9f090000, 0x9f0c0000, 0x9f0d0000, 0x9f0e0000, 0x9f0f0000, 0x9f100000, 0x9f110000, 0x9f140000,
+	0x9f150000, 0x9f160000, 0x9f180000, 0x9f190000, 0x9f1a0000, 0x9f1b0000, 0x9f1c0000, 0x9f1c4000,
+	0x9f1d0000, 0x9f200000, 0x9f220000, 0x9f230000, 0x9f260000, 0x9f270000, 0x9f2e0000, 0x9f2f0000,
+	0x9f320000, 0x9f340000, 0x9f350000, 0x9f3a0000, 0x9f3b0000, 0x9f3c0000, 0x9f3d0000, 0x9f450000,
+	0x9f460000, 0x9f480000, 0x9f490000, 0x9f4a0000, 0x9f4b0000, 0x9f4c0000, 0x9f500000, 0x9f510000,
+	0x9f520000, 0x9f540000, 0x9f550000, 0x9f560000, 0x9f570000, 0x9f5a0000, 0x9f5b0000, 0x9f5c0000,
+	0x9f5e0000, 0x9f5f0000, 0x9f600000, 0x9f640000, 0x9f660000, 0x9f670000, 0x9f690000, 0x9f6b0000,
+	0x9f6c0000, 0x9f6d0000, 0x9f6e0000, 0x9f720000, 0x9f730000, 0x9f750000, 0x9f753000, 0x9f754000,
+	0x9f75a000, 0x9f75c000, 0x9f75c800, 0x9f75ca00, 0x9f75d000, 0x9f75dc00, 0x9f760000, 0x9f7a0000,
+	0x9f7b0000, 0x9f820000, 0x9f830000, 0x9f860000, 0x9f870000, 0x9f878000, 0x9f87a000, 0x9f8a0000,
+	0x9f8b0000, 0x9f900000, 0x9f910000, 0x9f920000, 0x9f960000, 0x9f970000, 0x9f990000, 0x9f9a0000,
+	0x9f9b0000, 0x9f9c0000, 0x9f9d0000, 0x9fa00000, 0x9fa10000, 0x9fa20000, 0x9fa30000, 0x9fa70000,
+	0x9fa90000, 0x9faa0000, 0x9fac0000, 0x9fad0000, 0x9fae0000, 0x9fb30000, 0x9fb50000, 0x9fbe0000,
+	0x9fbf0000, 0x9fc00000, 0x9fc10000, 0x9fc40000, 0x9fc50000, 0x9fc60000, 0x9fc80000, 0x9fc90000,
+	0x9fcd0000, 0x9fce0000, 0x9fcf0000, 0x9fd00000, 0x9fd20000, 0x9fd30000, 0x9fd40000, 0x9fd50000,
+	0x9fd60000, 0x9fd80000, 0x9fda0000, 0x9fdb0000, 0x9fdc0000, 0x9fe00000, 0x9fe10000, 0x9fe20000,
+	0x9fe30000, 0x9fe80000, 0x9fe90000, 0x9fec0000, 0x9fee0000, 0x9fef0000, 0x9ff00000, 0x9ff10000,
+	0x9ff20000, 0x9ff20800, 0x9ff21000, 0x9ff22000, 0x9ff24000, 0x9ff28000, 0x9ff2e000, 0x9ff2f000,
+	0x9ff40000, 0x9ff60000, 0x9ff80000, 0x9ff90000, 0x9ffd0000, 0xa0000000, 0xa0010000, 0xa0040000,
+	0xa0050000, 0xa0070000, 0xa0080000, 0xa00a0000, 0xa00b0000, 0xa0130000, 0xa0131400, 0xa0131800,
+	0xa0132400, 0xa0132800, 0xa0132c00, 0xa0133000, 0xa0133800, 0xa0134000, 0xa0134400, 0xa0135c00,
+	0xa0136000, 0xa0136800, 0xa0137000, 0xa0139000, 0xa0139800, 0xa0139c00, 0xa013a800, 0xa013b000,
+	0xa013b400, 0xa013b800, 0xa013bc00, 0xa013c000, 0xa013c400, 0xa013c800, 0xa013cc00, 0xa013d000,
+	0xa013e400, 0xa013e800, 0xa013ec00, 0xa013f000, 0xa0140000, 0xa0140400, 0xa0140800, 0xa0141000,
+	0xa0141400, 0xa0141800, 0xa0142000, 0xa0142400, 0xa0142800, 0xa0144000, 0xa0144800, 0xa0144c00,
+	0xa0145000, 0xa0146000, 0xa0146800, 0xa0146c00, 0xa0147000, 0xa0147400, 0xa0149000, 0xa014a000,
+	0xa014ac00, 0xa014b400, 0xa014d000, 0xa014d600, 0xa014d800, 0xa014da00, 0xa014dc00, 0xa014de00,
+	0xa014e000, 0xa014e100, 0xa014e200, 0xa014f200, 0xa014f400, 0xa014f600, 0xa014f800, 0xa014fa00,
+	0xa014fc00, 0xa0150000, 0xa0160000, 0xa0170000, 0xa0190000, 0xa01a0000, 0xa01e0000, 0xa020f000,
+	0xa020f800, 0xa0260000, 0xa0270000, 0xa0280000, 0xa0290000, 0xa02c0000, 0xa0400000, 0xa0410000,
+	0xa0420000, 0xa0450000, 0xa0460000, 0xa0480000, 0xa04a0000, 0xa04b0000, 0xa04c0000, 0xa04d0000,
+	0xa04e0000, 0xa04f0000, 0xa0500000, 0xa0510000, 0xa0550000, 0xa0560000, 0xa0570000, 0xa0590000,
+	0xa05b0000, 0xa05c0000, 0xa05d0000, 0xa0600000, 0xa0610000, 0xa0650000, 0xa0670000, 0xa0690000,
+	0xa06a0000, 0xa0710000, 0xa0720000, 0xa0730000, 0xa07d0000, 0xa0980000, 0xa0990000, 0xa09a0000,
+	0xa0b40000, 0xa0b50000, 0xa0b90000, 0xa0bb0000, 0xa0bc0000, 0xa0bf0000, 0xa0c00000, 0xa0ca1000,
+	0xa0ca2000, 0xa0ca4000, 0xa0ca8000, 0xa0cd0000, 0xa0ce0000, 0xa0cf0000, 0xa0d20000, 0xa0d40000,
+	0xa0d50000, 0xa0d70000, 0xa0d80000, 0xa0de0000, 0xa0df0000, 0xa0e00000, 0xa0e2b200, 0xa0e2b300,
+	0xa0e30000, 0xa0e40000, 0xa0e50000, 0xa0e74000, 0xa0e78000, 0xa0e7c000, 0xa0e90000, 0xa0ea0000,
+	0xa0eb0000, 0xa0ec0000, 0xa0ed0000, 0xa0ee0b00, 0xa0ee0c00, 0xa0ee1500, 0xa0ee1800, 0xa0ee1e00,
+	0xa0ee1f00, 0xa0ee2000, 0xa0ee2400, 0xa0ee2800, 0xa0ee2900, 0xa0ee3000, 0xa0ee3200, 0xa0ee3300,
+	0xa0ee3400, 0xa0ee3800, 0xa0ee3900, 0xa0ee3a00, 0xa0ee3c00, 0xa0ee3e00, 0xa0ee3f00, 0xa0ee4000,
+	0xa0ee4400, 0xa0ee4800, 0xa0ee6000, 0xa0ee6400, 0xa0ee6500, 0xa0ee6800, 0xa0ee7000, 0xa0ee8000,
+	0xa0ef0000, 0xa0f20000, 0xa0f30000, 0xa0fa0000, 0xa0fb0000, 0xa0fd0000, 0xa0ff0000, 0xa1000000,
+	0xa1010000, 0xa1020000, 0xa1060000, 0xa1080000, 0xa10a0000, 0xa10b0000, 0xa10c0000, 0xa10d0000,
+	0xa1110000, 0xa1120000, 0xa1130000, 0xa1140000, 0xa1150000, 0xa1160000, 0xa1170000, 0xa1180000,
+	0xa11a0000, 0xa11b0000, 0xa11c0000, 0xa11d0000, 0xa11e0000, 0xa11f0000, 0xa1204000, 0xa1210000,
+	0xa1220000, 0xa1230000, 0xa1250000, 0xa1260000, 0xa1290000, 0xa12b0000, 0xa12c0000, 0xa1300000,
+	0xa1310000, 0xa131bc00, 0xa131c000, 0xa131e800, 0xa1320000, 0xa1330000, 0xa1340000, 0xa1370000,
+	0xa1380000, 0xa1390000, 0xa13b0000, 0xa13c0000, 0xa13e0000, 0xa13f0000, 0xa1400000, 0xa1430000,
+	0xa1440000, 0xa1460000, 0xa14b0000, 0xa14c0000, 0xa14d0000, 0xa14e0000, 0xa14f0000, 0xa1500000,
+	0xa1510000, 0xa1520000, 0xa1528000, 0xa1530000, 0xa15d0000, 0xa1610000, 0xa1680000, 0xa16b0000,
+	0xa16e0000, 0xa1710000, 0xa1740000, 0xa1750000, 0xa1770000, 0xa17a0000, 0xa17b0000, 0xa17c0000,
+	0xa17e0000, 0xa17f0000, 0xa1830000, 0xa1850000, 0xa1860000, 0xa1870000, 0xa18a0000, 0xa18b0000,
+	0xa18c0000, 0xa18d0000, 0xa18e0000, 0xa1900000, 0xa1920000, 0xa1930000, 0xa1940000, 0xa1950000,
+	0xa1980000, 0xa1990000, 0xa19c0000, 0xa19d0000, 0xa19e0000, 0xa19f0000, 0xa1bd0000, 0xa1be0000,
+	0xa1bf0000, 0xa1c40000, 0xa1c50000, 0xa1c80000, 0xa1c90000, 0xa1ca0000, 0xa1cb0000, 0xa1cf0000,
+	0xa1d00000, 0xa1d40000, 0xa1d50000, 0xa1da0000, 0xa1db0000, 0xa1e50000, 0xa1e60000, 0xa1e70000,
+	0xa1ea0000, 0xa1eb0000, 0xa1ee0000, 0xa1ef0000, 0xa1f60000, 0xa1f70000, 0xa1fb0000, 0xa1fd0000,
+	0xa1ff0000, 0xa2000000, 0xa20b0000, 0xa20c0000, 0xa20cc400, 0xa20cc800, 0xa20cd000, 0xa20cd800,
+	0xa20cf000, 0xa20cf800, 0xa20d0000, 0xa20e0000, 0xa20f0000, 0xa2150000, 0xa2160000, 0xa2170000,
+	0xa2180000, 0xa2190000, 0xa21b0000, 0xa21ba000, 0xa21ba300, 0xa2260000, 0xa2270000, 0xa2380000,
+	0xa2390000, 0xa23e0000, 0xa23f0000, 0xa2560000, 0xa2570000, 0xa2690000, 0xa26a0000, 0xa2700000,
+	0xa2710000, 0xa27a0000, 0xa27b0000, 0xa2850000, 0xa2860000, 0xa28e8000, 0xa28f0000, 0xa2910000,
+	0xa2940000, 0xa2d4a800, 0xa2d4b000, 0xa2d88a00, 0xa2d88c00, 0xa2d89000, 0xa2d9f800, 0xa2d9fc00,
+	0xa2da3800, 0xa2da4000, 0xa2da5800, 0xa2da6000, 0xa2dab000, 0xa2dab400, 0xa2db2000, 0xa2db2800,
+	0xa2db5000, 0xa2db5800, 0xa2dcf000, 0xa2dcf800, 0xa2dd4c00, 0xa2dd5000, 0xa2de5800, 0xa2de5b00,
+	0xa2dfa800, 0xa2dfb000, 0xa2f43400, 0xa2f43800, 0xa2f57c00, 0xa2f58000, 0xa2f5cc00, 0xa2f5d000,
+	0xa2f70000, 0xa2f70800, 0xa2f8c400, 0xa2f8c800, 0xa2fad800, 0xa2fadc00, 0xa2fb2000, 0xa2fb2800,
+	0xa2fd1000, 0xa2fd1400, 0xa2ff3000, 0xa2ff3400, 0xa2ffc400, 0xa2ffc800, 0xa3000000, 0xa3010000,
+	0xa3020000, 0xa3030000, 0xa3040000, 0xa3050000, 0xa3060000, 0xa3070000, 0xa3090000, 0xa30a0000,
+	0xa30b0000, 0xa30d0000, 0xa3210000, 0xa3220000, 0xa3230000, 0xa32a0000, 0xa32f4c00, 0xa32f5000,
+	0xa33e0000, 0xa3760000, 0xa3770000, 0xa3780000, 0xa3790000, 0xa37a0000, 0xa37b0000, 0xa37d0000,
+	0xa37e0000, 0xa37f0000, 0xa3810000, 0xa3820000, 0xa3960000, 0xa3980000, 0xa3990000, 0xa39c0000,
+	0xa3b00000, 0xa3b10000, 0xa3b20000, 0xa3b30000, 0xa3b50000, 0xa3bd0000, 0xa3be0000, 0xa3c30000,
+	0xa3cc0000, 0xa3cd0000, 0xa3d00000, 0xa3e60000, 0xa3e80000, 0xa3ea0000, 0xa3ef0000, 0xa3f00000,
+	0xa3f20000, 0xa3f30000, 0xa3f70000, 0xa3f80000, 0xa3fa0000, 0xa3fb0000, 0xa3ff0000, 0xa4000000,
+	0xa4290000, 0xa42a0000, 0xa42b0000, 0xa42c0000, 0xa42e0000, 0xa42f0000, 0xa4300000, 0xa4310000,
+	0xa4340000, 0xa4348000, 0xa434c000, 0xa434e000, 0xa4350000, 0xa4360000, 0xa43b0000, 0xa43e0000,
+	0xa4446000, 0xa4448000, 0xa4450000, 0xa4480000, 0xa4490000, 0xa44a0000, 0xa44b0000, 0xa44c0000,
+	0xa44d0000, 0xa44e0000, 0xa44f0000, 0xa4500000, 0xa4510000, 0xa4520000, 0xa4550000, 0xa4560000,
+	0xa4580000, 0xa4590000, 0xa45a4000, 0xa45a8000, 0xa45d8000, 0xa45e0000, 0xa4600000, 0xa4610000,
+	0xa4620000, 0xa4630000, 0xa4640000, 0xa4650000, 0xa46c0000, 0xa46d0000, 0xa4700000, 0xa4710000,
+	0xa4730000, 0xa4740000, 0xa47c0000, 0xa47e0000, 0xa4900000, 0xa4920000, 0xa4980000, 0xa49b0000,
+	0xa49c0000, 0xa4a00000, 0xa4a03800, 0xa4a03c00, 0xa4a06000, 0xa4a06800, 0xa4a07000, 0xa4a07400,
+	0xa4a09c00, 0xa4a0a000, 0xa4a0a800, 0xa4a0b000, 0xa4a0bc00, 0xa4a0c000, 0xa4a0c800, 0xa4a0e000,
+	0xa4a10000, 0xa4a30000, 0xa4a40000, 0xa4a50000, 0xa4b10000, 0xa4b20000, 0xa4d70000, 0xa4d80000,
+	0xa5000000, 0xa5010000, 0xa5030000, 0xa5060000, 0xa5080000, 0xa50c0000, 0xa50d0000, 0xa50e0000,
+	0xa50f0000, 0xa5100000, 0xa5110000, 0xa5150000, 0xa5160000, 0xa5190000, 0xa51a0000, 0xa51f0000,
+	0xa5200000, 0xa52a0000, 0xa52c0000, 0xa5310000, 0xa5400000, 0xa5450000, 0xa5460000, 0xa5490000,
+	0xa54a0000, 0xa54c0000, 0xa54d0000, 0xa54e0000, 0xa54f0000, 0xa5540000, 0xa554d000, 0xa554e000,
+	0xa554e800, 0xa5550000, 0xa5560000, 0xa5570000, 0xa55a0000, 0xa55b0000, 0xa55d0000, 0xa55e0000,
+	0xa5600000, 0xa5610000, 0xa5620000, 0xa5630000, 0xa5640000, 0xa5650400, 0xa5660000, 0xa5670000,
+	0xa56c0000, 0xa56d0000, 0xa5720000, 0xa5730000, 0xa5760000, 0xa5770000, 0xa5840000, 0xa5860000,
+	0xa58d0000, 0xa58f0000, 0xa5960000, 0xa5a50000, 0xa5a60000, 0xa5a90000, 0xa5aa0000, 0xa5ad0000,
+	0xa5ad4000, 0xa5b40000, 0xa5b50000, 0xa5b60000, 0xa5b80000, 0xa5ba0000, 0xa5bc0000, 0xa5bf0000,
+	0xa5c00000, 0xa5c10000, 0xa5c20000, 0xa5c30000, 0xa5ca0000, 0xa5cb0000, 0xa5cd0000, 0xa5ce0000,
+	0xa5d10000, 0xa5d20000, 0xa5d40000, 0xa5d50000, 0xa5d60000, 0xa5da0000, 0xa5db0000, 0xa5dc0000,
+	0xa5dd0000, 0xa5de0000, 0xa5df0000, 0xa5e40000, 0xa5e60000, 0xa5e70000, 0xa5e80000, 0xa5e90000,
+	0xa5ea0000, 0xa5f00000, 0xa5f50000, 0xa5f60000, 0xa5f70000, 0xa5ff0000, 0xa6000000, 0xa6080000,
+	0xa6100000, 0xa6318000, 0xa6320000, 0xa6400000, 0xa6420000, 0xa64b0000, 0xa64c0000, 0xa64f0000,
+	0xa6500000, 0xa6510000, 0xa6520000, 0xa6530000, 0xa6540000, 0xa6550000, 0xa6560000, 0xa6570000,
+	0xa6580000, 0xa6640000, 0xa6650000, 0xa6670000, 0xa6690000, 0xa66e0000, 0xa66f0000, 0xa6700000,
+	0xa6720000, 0xa6730000, 0xa6760000, 0xa67a0000, 0xa67d0000, 0xa67e0000, 0xa7000000, 0xa7010000,
+	0xa71c0000, 0xa71d0000, 0xa71e0000, 0xa71f0000, 0xa7380000, 0xa7400000, 0xa7510000, 0xa7520000,
+	0xa7564200, 0xa7580000, 0xa7620000, 0xa7630000, 0xa7648000, 0xa7650000, 0xa7670000, 0xa7680000,
+	0xa7690000, 0xa76a0000, 0xa76c0000, 0xa76d0000, 0xa76f0000, 0xa7700000, 0xa7740000, 0xa7750000,
+	0xa77b0000, 0xa77c0000, 0xa7820000, 0xa7830000, 0xa7860000, 0xa7870000, 0xa78b0000, 0xa78c0000,
+	0xa79d0000, 0xa79e0000, 0xa7a00000, 0xa7a02000, 0xa7a20000, 0xa7a30000, 0xa7a80000, 0xa7a90000,
+	0xa7aa0000, 0xa7ac0000, 0xa7ad0000, 0xa7af0000, 0xa7b00000, 0xa7b30000, 0xa7b40000, 0xa7bd0000,
+	0xa7be0000, 0xa7cb0000, 0xa7cc0000, 0xa7cd0000, 0xa7ce0000, 0xa7db3000, 0xa7db4000, 0xa7dce000,
+	0xa7dd0000, 0xa7e90000, 0xa7ea0000, 0xa7f90000, 0xa7f91c00, 0xa7f92000, 0xa7f95800, 0xa7f95c00,
+	0xa7f96000, 0xa7f96400, 0xa7fb0000, 0xa7fc0000, 0xa7fd0000, 0xa8000000, 0xa8010000, 0xa8020000,
+	0xa8460000, 0xa8470000, 0xa84c0000, 0xa84d0000, 0xa84e0000, 0xa84f0000, 0xa8500000, 0xa8520000,
+	0xa8530000, 0xa8540000, 0xa8590000, 0xa85a0000, 0xa85b0000, 0xa85f0000, 0xa8600000, 0xa8610000,
+	0xa8650000, 0xa8660000, 0xa86a0000, 0xa86b0000, 0xa8730000, 0xa8740000, 0xa8780000, 0xa8790000,
+	0xa87a0000, 0xa87e0000, 0xa87f0000, 0xa8800000, 0xa8810000, 0xa8820000, 0xa8850000, 0xa8860000,
+	0xa8870000, 0xa88b0000, 0xa88c0000, 0xa88d0000, 0xa88e0000, 0xa88f0000, 0xa8950000, 0xa8958000,
+	0xa895f800, 0xa895fa00, 0xa8980000, 0xa89b0000, 0xa89c0000, 0xa8a00000, 0xa8a10000, 0xa8a40000,
+	0xa8a50000, 0xa8a60000, 0xa8a70000, 0xa8a80000, 0xa8ac0000, 0xa8ad0000, 0xa8b00000, 0xa8b10000,
+	0xa8b50000, 0xa8b56400, 0xa8b56800, 0xa8b60000, 0xa8ba0000, 0xa8bb0000, 0xa8bc0000, 0xa8bd0000,
+	0xa8c20000, 0xa8c33c00, 0xa8c34000, 0xa8c39c00, 0xa8c3a000, 0xa8c4c400, 0xa8c4c800, 0xa8c4d000,
+	0xa8c4d200, 0xa8c4e400, 0xa8c4e800, 0xa8c60000, 0xa8c70000, 0xa8cd0000, 0xa8cd0400, 0xa8cd0800,
+	0xa8ce0000, 0xa8cf0000, 0xa8d10000, 0xa8d40000, 0xa8d90000, 0xa8da0000, 0xa8db0000, 0xa8dc0000,
+	0xa8e20000, 0xa8e42000, 0xa8e42400, 0xa8e50000, 0xa8e70000, 0xa8e90000, 0xa8ea0000, 0xa8eb0000,
+	0xa8f30000, 0xa8f40000, 0xa8f5bc00, 0xa8f5c000, 0xa8f5c400, 0xa8f5c600, 0xa8f80000, 0xa8fa0000,
+	0xa8fc0000, 0xa8fd0000, 0xa8fe0000, 0xa8ff0000, 0xa9000000, 0xa9020000, 0xa9200000, 0xa9400000,
+	0xa9810000, 0xa9820000, 0xa98a0000, 0xa98b0000, 0xa98c0000, 0xa98d0000, 0xa9940000, 0xa9948000,
+	0xa9950000, 0xa9960000, 0xa99e0000, 0xa99f0000, 0xa9a00000, 0xa9ca0000, 0xa9cb0000, 0xa9d00000,
+	0xa9e00000, 0xa9ef0000, 0xa9ef3400, 0xa9ef3800, 0xa9ef5800, 0xa9ef5c00, 0xa9ef9000, 0xa9ef9400,
+	0xa9efac00, 0xa9efb000, 0xa9f00000, 0xa9ff0000, 0xa9ff1000, 0xa9ff1400, 0xa9ff5400, 0xa9ff5800,
+	0xa9ff5c00, 0xa9ff6400, 0xa9ff6c00, 0xa9ff7000, 0xa9ff8c00, 0xa9ff9000, 0xa9ff9c00, 0xa9ffa000,
+	0xa9ffc800, 0xa9ffcc00, 0xaa000000, 0xaa010000, 0xaa0a7000, 0xaa0a8000, 0xaa0df600, 0xaa0df700,
+	0xaa118000, 0xaa120000, 0xaa130000, 0xaa190000, 0xaa1a0000, 0xaa210000, 0xaa220000, 0xaa25cb00,
+	0xaa25cf00, 0xaa260000, 0xaa270000, 0xaa330000, 0xaa340000, 0xaa3c0000, 0xaa3d0000, 0xaa420000,
+	0xaa430000, 0xaa460000, 0xaa470000, 0xaa4cb000, 0xaa4cb400, 0xaa4e0000, 0xaa4ed000, 0xaa4ed400,
+	0xaa505c00, 0xaa506000, 0xaa522c00, 0xaa523000, 0xaa540400, 0xaa540800, 0xaa550000, 0xaa658000,
+	0xaa660000, 0xaa668000, 0xaa670000, 0xaa6a0000, 0xaa6b0000, 0xaa850000, 0xaa858000, 0xaa960000,
+	0xaa969000, 0xaa969400, 0xaa970000, 0xaa9b0000, 0xaa9c0000, 0xaa9d0000, 0xaa9e0000, 0xaaa50000,
+	0xaaa60000, 0xaaa90000, 0xaaaa0000, 0xaab30000, 0xaab40000, 0xaac7f600, 0xaac7f700, 0xaad20000,
+	0xaad30000, 0xaae70000, 0xaae80000, 0xaae90000, 0xaaea0000, 0xaaec0000, 0xaaee0000, 0xaaf00000,
+	0xaaf40000, 0xaaf50400, 0xaaf50800, 0xaaf58400, 0xaaf58600, 0xaaf64c00, 0xaaf64d00, 0xaaf80000,
+	0xaaf80200, 0xaaf80c00, 0xaaf80e00, 0xaaf82a00, 0xaaf82c00, 0xaaf82e00, 0xaaf83000, 0xaaf88a00,
+	0xaaf88c00, 0xaaf8a000, 0xaaf8ac00, 0xaaf8be00, 0xaaf8c000, 0xaaf94000, 0xaaf94800, 0xaaf96000,
+	0xaaf98000, 0xaafb0a00, 0xaafb0c00, 0xaafb1400, 0xaafb1600, 0xaafb2800, 0xaafb3000, 0xaafb3c00,
+	0xaafb3e00, 0xaafb5a00, 0xaafb5c00, 0xaafb6e00, 0xaafb7000, 0xaafb8e00, 0xaafb9000, 0xaafb9500,
+	0xaafb9800, 0xaafb9a00, 0xaafb9e00, 0xaafbaa00, 0xaafbac00, 0xaafbae00, 0xaafbb000, 0xaafd0000,
+	0xaafd4000, 0xaafe0000, 0xaafe7800, 0xaafe7c00, 0xaafeec00, 0xaafef000, 0xaaff0000, 0xab000000,
+	0xab100000, 0xab220000, 0xab400000, 0xab4c0000, 0xab800000, 0xabcf0000, 0xac000000, 0xac508000,
+	0xac510000, 0xac51c000, 0xac520000, 0xac56d000, 0xac56e000, 0xac675800, 0xac676000, 0xac7a0000,
+	0xac7c0000, 0xacc00000, 0xacc80000, 0xacf10000, 0xacf10800, 0xacf12800, 0xacf13800, 0xacf14000,
+	0xacf14800, 0xacf15400, 0xacf15800, 0xacf1d800, 0xacf1e000, 0xacf1f800, 0xacf20000, 0xacff0000,
+	0xacff1000, 0xacff6000, 0xacff7000, 0xacff8800, 0xacff9000, 0xacffc000, 0xacffd000, 0xacffe000,
+	0xacfff000, 0xacfff800, 0xad000000, 0xadd4c000, 0xadd50000, 0xadd6c800, 0xadd6cc00, 0xadea1000,
+	0xadea1800, 0xadea6800, 0xadea7000, 0xadea8000, 0xadea8800, 0xadf49000, 0xadf4a000, 0xadf8e000,
+	0xadf90000, 0xadf94000, 0xadff9000, 0xadff9800, 0xae8a9000, 0xae8aa000, 0xae8c0000, 0xae8c4000,
+	0xaf000000, 0xaf6e8000, 0xaf6f0000, 0xb0000000, 0xb06f3800, 0xb06f3900, 0xb073b000, 0xb073b800,
+	0xb07a8000, 0xb07ac000, 0xb1000000, 0xb2000000, 0xb2ee5000, 0xb2ee6000, 0xb3000000, 0xb4000000,
+	0xb4ea0000, 0xb4eb0000, 0xb5000000, 0xb6000000, 0xb8000000, 0xb8160000, 0xb8170000, 0xb8520000,
+	0xb8530000, 0xb9000000, 0xb9086400, 0xb9086800, 0xb914dc00, 0xb914e000, 0xb91e4800, 0xb91e4c00,
+	0xb926d200, 0xb926d400, 0xb9393c00, 0xb9394000, 0xb94d0600, 0xb94d0800, 0xb94d8c00, 0xb94d8e00,
+	0xb94e6800, 0xb94e6c00, 0xb94fa400, 0xb94fa800, 0xb95af400, 0xb95af800, 0xb95da400, 0xb95da800,
+	0xb9642800, 0xb9642c00, 0xb9690700, 0xb9690800, 0xb9703700, 0xb9703800, 0xb9843000, 0xb9843400,
+	0xb985d400, 0xb985d800, 0xb9874800, 0xb9875000, 0xb9922000, 0xb9922400, 0xb993c000, 0xb993c400,
+	0xb996bd00, 0xb996c000, 0xb9a70c00, 0xb9a71000, 0xb9a96c00, 0xb9a97000, 0xb9aa3800, 0xb9aa3c00,
+	0xb9abd000, 0xb9abd400, 0xb9afe400, 0xb9afe800, 0xb9b03000, 0xb9b03800, 0xb9b29000, 0xb9b29400,
+	0xb9b41000, 0xb9b41400, 0xb9bc4c00, 0xb9bc5000, 0xb9bda000, 0xb9bda400, 0xb9bdf000, 0xb9bdf400,
+	0xb9bf8000, 0xb9bf8400, 0xb9c14800, 0xb9c14c00, 0xb9c1d400, 0xb9c1d800, 0xb9c7f000, 0xb9c7f400,
+	0xb9ca2800, 0xb9ca2c00, 0xb9caa800, 0xb9caac00, 0xb9cb2400, 0xb9cb2800, 0xb9cdb400, 0xb9cdb800,
+	0xb9cdc400, 0xb9cdc800, 0xb9cedc00, 0xb9cee000, 0xb9cf6000, 0xb9cf6400, 0xb9d1b000, 0xb9d1b400,
+	0xb9d24c00, 0xb9d25000, 0xb9d43800, 0xb9d43c00, 0xb9d44800, 0xb9d44c00, 0xb9d72000, 0xb9d72400,
+	0xba000000, 0xbc000000, 0xbc7db000, 0xbc7dc000, 0xbc838000, 0xbc840000, 0xbcd19000, 0xbcd19800,
+	0xbcd64000, 0xbcd65000, 0xbd000000, 0xc0000000, 0xc0051c00, 0xc0051f00, 0xc0052400, 0xc0052500,
+	0xc0053200, 0xc0053300, 0xc0053b00, 0xc0053c00, 0xc0053d00, 0xc0053f00, 0xc0055a00, 0xc0055b00,
+	0xc0056100, 0xc0056200, 0xc0058e00, 0xc0058f00, 0xc0059100, 0xc0059200, 0xc005a200, 0xc005a300,
+	0xc005d800, 0xc005d900, 0xc005ef00, 0xc005f000, 0xc005f100, 0xc005fe00, 0xc005ff00, 0xc0082000,
+	0xc0082c00, 0xc0087400, 0xc0087800, 0xc008a000, 0xc008b100, 0xc008b300, 0xc008b500, 0xc008b600,
+	0xc008b700, 0xc008b800, 0xc0090000, 0xc00c0100, 0xc00c0200, 0xc00c2f00, 0xc00c3000, 0xc00c3600,
+	0xc00c3700, 0xc00c4800, 0xc00c4a00, 0xc00c4c00, 0xc00c4d00, 0xc00c4e00, 0xc00c5100, 0xc00c5200,
+	0xc00c6000, 0xc00c6100, 0xc00c6300, 0xc00c6400, 0xc00c6d00, 0xc00c6e00, 0xc00c6f00, 0xc00c7000,
+	0xc00c7400, 0xc00c7600, 0xc00c7700, 0xc00cc000, 0xc00cc300, 0xc00cd900, 0xc00cdb00, 0xc00ce700,
+	0xc00ce900, 0xc00ceb00, 0xc00cec00, 0xc00cf700, 0xc00cf800, 0xc00f0000, 0xc0100000, 0xc0107b00,
+	0xc010a700, 0xc010b200, 0xc010b500, 0xc010b700, 0xc010cb00, 0xc012c300, 0xc012c400, 0xc01a1c00,
+	0xc01a3000, 0xc01a5b00, 0xc01a5c00, 0xc01a5d00, 0xc01a5f00, 0xc01a6000, 0xc01a6100, 0xc01a6900,
+	0xc01a6e00, 0xc01a6f00, 0xc01a8100, 0xc01a8500, 0xc01a8800, 0xc01a9a00, 0xc01ac200, 0xc01ad800,
+	0xc01ae700, 0xc01ae800, 0xc01ae900, 0xc01aea00, 0xc01aeb00, 0xc01aec00, 0xc01af000, 0xc01c7800,
+	0xc01c7c00, 0xc01c8400, 0xc01f0e00, 0xc01f0f00, 0xc01f1700, 0xc01f1800, 0xc01f1a00, 0xc01f1c00,
+	0xc01f1f00, 0xc01f2000, 0xc01f2800, 0xc01f2900, 0xc01f3e00, 0xc01f3f00, 0xc01f6600, 0xc01f6700,
+	0xc01f7400, 0xc01f7d00, 0xc01fa600, 0xc01fac00, 0xc01fc500, 0xc01fcf00, 0xc01fd300, 0xc01fd400,
+	0xc01fe700, 0xc01fe800, 0xc01ffc00, 0xc01ffd00, 0xc0210a00, 0xc0210b00, 0xc0210f00, 0xc0211100,
+	0xc0212400, 0xc0212500, 0xc0215700, 0xc0217000, 0xc0217100, 0xc0217300, 0xc0217600, 0xc0218000,
+	0xc0218200, 0xc0218400, 0xc0218700, 0xc0218800, 0xc0218f00, 0xc0219200, 0xc0219300, 0xc021a300,
+	0xc021a400, 0xc021a700, 0xc021a900, 0xc021ac00, 0xc021b000, 0xc021b700, 0xc021c000, 0xc021e800,
+	0xc021e900, 0xc021f000, 0xc021fe00, 0xc021ff00, 0xc0221300, 0xc0221400, 0xc0223200, 0xc0223300,
+	0xc0226b00, 0xc0226c00, 0xc0227400, 0xc0227500, 0xc022b300, 0xc022b400, 0xc0230000, 0xc0231400,
+	0xc0233b00, 0xc0233c00, 0xc0233f00, 0xc0234900, 0xc0235a00, 0xc0235b00, 0xc0235e00, 0xc0235f00,
+	0xc0236c00, 0xc0236d00, 0xc0238200, 0xc0238600, 0xc0238a00, 0xc0238b00, 0xc0239200, 0xc0239300,
+	0xc0239500, 0xc0239a00, 0xc023ac00, 0xc023ad00, 0xc023b700, 0xc023c100, 0xc023c500, 0xc023c700,
+	0xc023cf00, 0xc023d000, 0xc023e500, 0xc023e600, 0xc023f000, 0xc023f500, 0xc023f600, 0xc023f800,
+	0xc023f900, 0xc0240000, 0xc0270000, 0xc0284600, 0xc0285100, 0xc0285800, 0xc0286000, 0xc028e400,
+	0xc028e500, 0xc0296700, 0xc0298900, 0xc0298c00, 0xc0299200, 0xc0299300, 0xc0299400, 0xc0299500,
+	0xc029a100, 0xc029aa00, 0xc029ab00, 0xc029b200, 0xc029c600, 0xc029cb00, 0xc029cc00, 0xc029ce00,
+	0xc029cf00, 0xc029d200, 0xc029d300, 0xc029d800, 0xc029d900, 0xc029da00, 0xc029db00, 0xc029e300,
+	0xc029e400, 0xc02a0100, 0xc02a0200, 0xc02a2a00, 0xc02a3000, 0xc02a3500, 0xc02a3600, 0xc02a3c00,
+	0xc02a3f00, 0xc02a4100, 0xc02a5700, 0xc02a5800, 0xc02a6100, 0xc02a6200, 0xc02a6300, 0xc02a6400,
+	0xc02a6500, 0xc02a6600, 0xc02a6700, 0xc02a6c00, 0xc02a7100, 0xc02a8500, 0xc02a8f00, 0xc02a9000,
+	0xc02a9700, 0xc02a9800, 0xc02ab400, 0xc02aca00, 0xc02aed00, 0xc02aee00, 0xc02ba200, 0xc02bac00,
+	0xc02bb900, 0xc02bba00, 0xc02bc000, 0xc02bc500, 0xc02bc600, 0xc02bc700, 0xc02bcf00, 0xc02bd200,
+	0xc02bd300, 0xc02bd400, 0xc02bd500, 0xc02be200, 0xc02be600, 0xc02bea00, 0xc02beb00, 0xc02bef00,
+	0xc02bf000, 0xc02c0000, 0xc02c4400, 0xc02c4700, 0xc02c5b00, 0xc02cf000, 0xc02cfc00, 0xc02f0000,
+	0xc02f1c00, 0xc02f1d00, 0xc02f2400, 0xc02f2500, 0xc02ff200, 0xc02ff400, 0xc02ffa00, 0xc0301f00,
+	0xc0302000, 0xc0306b00, 0xc0306c00, 0xc0306d00, 0xc0306f00, 0xc0309100, 0xc0309200, 0xc030e000,
+	0xc030e100, 0xc030e700, 0xc030e800, 0xc030fd00, 0xc030fe00, 0xc0310000, 0xc0320000, 0xc0330000,
+	0xc0331000, 0xc0333000, 0xc0333100, 0xc033ac00, 0xc033b000, 0xc033c000, 0xc033c200, 0xc033f000,
+	0xc033f100, 0xc033fe00, 0xc033ff00, 0xc0340000, 0xc0343300, 0xc0344800, 0xc0344a00, 0xc0349800,
+	0xc0349900, 0xc0349f00, 0xc034a200, 0xc034ab00, 0xc034b100, 0xc034dd00, 0xc034e000, 0xc034e800,
+	0xc034e900, 0xc034fd00, 0xc034ff00, 0xc0356700, 0xc0356900, 0xc0361f00, 0xc0363500, 0xc0363600,
+	0xc0365100, 0xc0366800, 0xc0366900, 0xc0366b00, 0xc0367100, 0xc0367200, 0xc0367300, 0xc0367900,
+	0xc0367a00, 0xc0367b00, 0xc0367d00, 0xc0368100, 0xc0368200, 0xc0368300, 0xc0368400, 0xc0368500,
+	0xc0368700, 0xc0368800, 0xc0368b00, 0xc0368c00, 0xc0368d00, 0xc036de00, 0xc036e100, 0xc036e200,
+	0xc036f500, 0xc036f600, 0xc036fb00, 0xc036fc00, 0xc036fe00, 0xc036ff00, 0xc0372e00, 0xc0372f00,
+	0xc0374400, 0xc0374800, 0xc0375400, 0xc0375500, 0xc0375900, 0xc0375a00, 0xc0376200, 0xc0376400,
+	0xc0376500, 0xc0376600, 0xc0376900, 0xc0376a00, 0xc0376d00, 0xc0376e00, 0xc0377000, 0xc0377100,
+	0xc0377300, 0xc0377400, 0xc0377600, 0xc0377700, 0xc0378100, 0xc0378200, 0xc0378400, 0xc0378500,
+	0xc037bc00, 0xc037bd00, 0xc037be00, 0xc037bf00, 0xc037c100, 0xc037c200, 0xc037c500, 0xc037c600,
+	0xc037c700, 0xc037d400, 0xc037d500, 0xc037db00, 0xc037dd00, 0xc037e800, 0xc037e900, 0xc037f400,
+	0xc037f500, 0xc03a0900, 0xc03a1300, 0xc03a1c00, 0xc03a2400, 0xc03a2900, 0xc03a5a00, 0xc03a8500,
+	0xc03a8900, 0xc03ac500, 0xc03ac600, 0xc03ada00, 0xc03adb00, 0xc03ae200, 0xc03ae600, 0xc0401c00,
+	0xc0401d00, 0xc0402c00, 0xc0402e00, 0xc0406400, 0xc0406800, 0xc040ca00, 0xc040cb00, 0xc040cd00,
+	0xc0413300, 0xc0414700, 0xc0415200, 0xc0415c00, 0xc0415f00, 0xc0416000, 0xc0416100, 0xc0418200,
+	0xc0418300, 0xc0418500, 0xc0418b00, 0xc0418c00, 0xc0419000, 0xc0419300, 0xc0419800, 0xc0419900,
+	0xc0419a00, 0xc041b600, 0xc041b700, 0xc041c600, 0xc041d900, 0xc041da00, 0xc041db00, 0xc041e500,
+	0xc0420000, 0xc0430000, 0xc0430300, 0xc0430500, 0xc0430c00, 0xc0430d00, 0xc0431700, 0xc0431800,
+	0xc0432700, 0xc0432800, 0xc0432b00, 0xc0432c00, 0xc0432f00, 0xc0433000, 0xc0433200, 0xc0433300,
+	0xc0433400, 0xc0433500, 0xc0433700, 0xc0433800, 0xc0433a00, 0xc0433b00, 0xc0434c00, 0xc0434d00,
+	0xc0434f00, 0xc0435000, 0xc0435400, 0xc0435500, 0xc0435700, 0xc0435800, 0xc0435e00, 0xc0435f00,
+	0xc0436400, 0xc0436900, 0xc0438700, 0xc0438800, 0xc043a700, 0xc043a800, 0xc043aa00, 0xc043ab00,
+	0xc043ac00, 0xc043bd00, 0xc043c700, 0xc043c800, 0xc043d100, 0xc043da00, 0xc043db00, 0xc043dc00,
+	0xc043de00, 0xc043df00, 0xc043e000, 0xc043f800, 0xc043f900, 0xc043fa00, 0xc0440000, 0xc0441400,
+	0xc0441700, 0xc0441800, 0xc0441f00, 0xc0443400, 0xc0444c00, 0xc0446c00, 0xc0448400, 0xc0448500,
+	0xc0448a00, 0xc0448b00, 0xc0449700, 0xc0449a00, 0xc044a500, 0xc044ab00, 0xc044ad00, 0xc044ae00,
+	0xc044af00, 0xc044b000, 0xc044b100, 0xc044b600, 0xc044b700, 0xc044b900, 0xc044ba00, 0xc044bb00,
+	0xc044d100, 0xc044d200, 0xc044d300, 0xc044d900, 0xc044dd00, 0xc044de00, 0xc044e000, 0xc044e100,
+	0xc044e600, 0xc044e700, 0xc044eb00, 0xc044fa00, 0xc044fd00, 0xc044fe00, 0xc044ff00, 0xc0460000,
+	0xc0467800, 0xc0468500, 0xc0468700, 0xc0468800, 0xc0468900, 0xc0468c00, 0xc046a000, 0xc046ae00,
+	0xc046af00, 0xc046b300, 0xc046b600, 0xc046c000, 0xc046c800, 0xc046c900, 0xc046d800, 0xc046d900,
+	0xc046db00, 0xc046dc00, 0xc046ed00, 0xc046ee00, 0xc046f200, 0xc046f300, 0xc0470000, 0xc0480000,
+	0xc0480300, 0xc048fd00, 0xc0490c00, 0xc0490d00, 0xc0491300, 0xc0491500, 0xc0491700, 0xc0491800,
+	0xc0491a00, 0xc0492200, 0xc0492d00, 0xc0494200, 0xc0494300, 0xc049e200, 0xc049e300, 0xc049e500,
+	0xc049e600, 0xc04a8b00, 0xc04ad100, 0xc04b0400, 0xc04b0500, 0xc04b8900, 0xc04b8a00, 0xc04c0600,
+	0xc04c2400, 0xc04c7a00, 0xc04c7b00, 0xc04c8500, 0xc04c8600, 0xc04c9500, 0xc04c9700, 0xc04c9900,
+	0xc04c9a00, 0xc04ca000, 0xc04ca100, 0xc04ca300, 0xc04ca500, 0xc04cab00, 0xc04cac00, 0xc04cad00,
+	0xc04cb000, 0xc04cb100, 0xc04cf100, 0xc04cf900, 0xc04d0b00, 0xc04d0c00, 0xc04d7200, 0xc04d7400,
+	0xc04d7800, 0xc04d7c00, 0xc04d8400, 0xc04d8b00, 0xc04d8c00, 0xc04d8e00, 0xc0501400, 0xc0501600,
+	0xc0501800, 0xc0501900, 0xc0501f00, 0xc0502b00, 0xc0502e00, 0xc0502f00, 0xc0503300, 0xc0503400,
+	0xc050d100, 0xc050d200, 0xc0513b00, 0xc0513c00, 0xc0513d00, 0xc0513f00, 0xc0516d00, 0xc0516e00,
+	0xc0517900, 0xc0517a00, 0xc0517b00, 0xc0517c00, 0xc051a000, 0xc051a100, 0xc051b600, 0xc051b900,
+	0xc051c200, 0xc051c300, 0xc051e600, 0xc051e700, 0xc051ea00, 0xc051eb00, 0xc0523400, 0xc0526000,
+	0xc0526400, 0xc0526500, 0xc0527900, 0xc0527a00, 0xc0527c00, 0xc0527d00, 0xc0527f00, 0xc0528000,
+	0xc0528c00, 0xc0528d00, 0xc0528e00, 0xc0528f00, 0xc0529000, 0xc0529900, 0xc0529a00, 0xc0529d00,
+	0xc0529f00, 0xc052a100, 0xc052a200, 0xc052d600, 0xc052d700, 0xc052dc00, 0xc052de00, 0xc052df00,
+	0xc052f100, 0xc052f200, 0xc0530000, 0xc0536500, 0xc0536600, 0xc0536700, 0xc0537600, 0xc0537800,
+	0xc0537b00, 0xc0537c00, 0xc053a000, 0xc053a100, 0xc053a500, 0xc053a600, 0xc053c500, 0xc053c600,
+	0xc053c700, 0xc053c800, 0xc053c900, 0xc053ca00, 0xc053cb00, 0xc053cf00, 0xc053d000, 0xc053d800,
+	0xc053da00, 0xc053dc00, 0xc053df00, 0xc053e000, 0xc053e100, 0xc053e500, 0xc053e700, 0xc053e800,
+	0xc053ed00, 0xc053ef00, 0xc0540500, 0xc0540600, 0xc0540c00, 0xc0540d00, 0xc0540e00, 0xc0540f00,
+	0xc0541000, 0xc0541b00, 0xc0541c00, 0xc0541e00, 0xc0541f00, 0xc0542000, 0xc0542200, 0xc0543e00,
+	0xc0543f00, 0xc0544b00, 0xc0545500, 0xc0545700, 0xc0545800, 0xc0545900, 0xc0545a00, 0xc0546400,
+	0xc0546500, 0xc0546e00, 0xc0547f00, 0xc0549d00, 0xc054a600, 0xc054a700, 0xc054ad00, 0xc054ae00,
+	0xc054b000, 0xc054d000, 0xc054d400, 0xc054d500, 0xc054dc00, 0xc054de00, 0xc054e200, 0xc054e600,
+	0xc054e700, 0xc054ed00, 0xc054ef00, 0xc054f200, 0xc054f300, 0xc054f400, 0xc054f500, 0xc054f800,
+	0xc054fd00, 0xc054fe00, 0xc0560b00, 0xc0560c00, 0xc0560e00, 0xc0560f00, 0xc0561200, 0xc0561300,
+	0xc0561900, 0xc0561a00, 0xc0561b00, 0xc0561c00, 0xc0565900, 0xc0565a00, 0xc0567d00, 0xc0568000,
+	0xc0568600, 0xc0568700, 0xc0568900, 0xc0568b00, 0xc056a300, 0xc056a400, 0xc056a500, 0xc056a600,
+	0xc056a800, 0xc056a900, 0xc056aa00, 0xc056fe00, 0xc056ff00, 0xc0570000, 0xc0580000, 0xc0580100,
+	0xc0580200, 0xc0580400, 0xc0580500, 0xc0580600, 0xc0580800, 0xc0580900, 0xc0580b00, 0xc0581100,
+	0xc0581200, 0xc0581700, 0xc0581900, 0xc0585300, 0xc0585500, 0xc0585600, 0xc0585700, 0xc0586100,
+	0xc0586300, 0xc0586c00, 0xc0586d00, 0xc0587600, 0xc0587700, 0xc0587b00, 0xc0587c00, 0xc0588000,
+	0xc0588100, 0xc0588200, 0xc0588300, 0xc0588500, 0xc0588600, 0xc058bb00, 0xc058bc00, 0xc058be00,
+	0xc058bf00, 0xc058c400, 0xc058c500, 0xc058cc00, 0xc058cd00, 0xc058ee00, 0xc058f000, 0xc058fa00,
+	0xc058ff00, 0xc0590000, 0xc05a0000, 0xc05b8c00, 0xc05b8e00, 0xc05bb100, 0xc05bb200, 0xc05bb300,
+	0xc05bb400, 0xc05bb900, 0xc05bba00, 0xc05bbb00, 0xc05bbd00, 0xc05bbe00, 0xc05bbf00, 0xc05bc000,
+	0xc05bc700, 0xc05bc800, 0xc05bc900, 0xc05bca00, 0xc05bd300, 0xc05bd400, 0xc05bd600, 0xc05bea00,
+	0xc05bec00, 0xc05bf800, 0xc05bfe00, 0xc05bff00, 0xc05c5600, 0xc05c5700, 0xc05c5e00, 0xc05c5f00,
+	0xc05c6800, 0xc05c6b00, 0xc05c6c00, 0xc05c6e00, 0xc05c7400, 0xc05c7500, 0xc05c7d00, 0xc05c8c00,
+	0xc05c8d00, 0xc05c9a00, 0xc05c9b00, 0xc05c9d00, 0xc05cd800, 0xc05cd900, 0xc05cf800, 0xc05d0000,
+	0xc05e0000, 0xc05e1800, 0xc05e1900, 0xc05e1c00, 0xc05e1d00, 0xc05e2900, 0xc05e2a00, 0xc05e3900,
+	0xc05e3b00, 0xc05e3d00, 0xc05e3e00, 0xc05e4100, 0xc05e4300, 0xc05e4500, 0xc05e4c00, 0xc05e4d00,
+	0xc05e6f00, 0xc05e7600, 0xc05e7a00, 0xc05e7b00, 0xc05e9c00, 0xc05ea400, 0xc05ea900, 0xc05eaa00,
+	0xc05eac00, 0xc05ead00, 0xc05eae00, 0xc05eaf00, 0xc05ec800, 0xc05ed000, 0xc05ed200, 0xc05ed300,
+	0xc05ed400, 0xc05ed500, 0xc05edd00, 0xc05ede00, 0xc05ee200, 0xc05ee300, 0xc05ee400, 0xc05ee900,
+	0xc05eea00, 0xc05eeb00, 0xc05eec00, 0xc05eef00, 0xc05ef000, 0xc05ef200, 0xc05ef300, 0xc05ef500,
+	0xc05ef600, 0xc05ef700, 0xc0600100, 0xc0601100, 0xc0601300, 0xc0601700, 0xc0601800, 0xc0602400,
+	0xc0602500, 0xc0602900, 0xc0602b00, 0xc0602c00, 0xc0602d00, 0xc0603b00, 0xc0603c00, 0xc0603e00,
+	0xc0604400, 0xc0604900, 0xc0604a00, 0xc0604e00, 0xc0604f00, 0xc0606700, 0xc0606800, 0xc0608700,
+	0xc0608a00, 0xc0608f00, 0xc0609000, 0xc0609100, 0xc0609200, 0xc0609c00, 0xc0609e00, 0xc0609f00,
+	0xc060a400, 0xc060a800, 0xc060b100, 0xc060c000, 0xc060c100, 0xc060c800, 0xc060e000, 0xc060e900,
+	0xc060ea00, 0xc060f400, 0xc060f500, 0xc060ff00, 0xc0620000, 0xc0630000, 0xc0640100, 0xc0640200,
+	0xc0640300, 0xc0641200, 0xc0641300, 0xc0641600, 0xc0641700, 0xc0641a00, 0xc0643400, 0xc0643500,
+	0xc0643600, 0xc0643d00, 0xc0643e00, 0xc0643f00, 0xc0644000, 0xc0644d00, 0xc0644e00, 0xc0644f00,
+	0xc0645000, 0xc0645100, 0xc0646000, 0xc0646400, 0xc0646600, 0xc0648600, 0xc0648700, 0xc0648d00,
+	0xc0649000, 0xc0649100, 0xc0649a00, 0xc0649b00, 0xc064a800, 0xc064a900, 0xc064bf00, 0xc064c000,
+	0xc064ff00, 0xc0650100, 0xc0650200, 0xc0650400, 0xc0650500, 0xc0650800, 0xc0650900, 0xc0650b00,
+	0xc0650c00, 0xc0651000, 0xc0651100, 0xc0651c00, 0xc0651d00, 0xc0652200, 0xc0652300, 0xc0654b00,
+	0xc0654c00, 0xc0655100, 0xc0655b00, 0xc0655c00, 0xc0656f00, 0xc0657300, 0xc0657600, 0xc0657700,
+	0xc0658600, 0xc0658700, 0xc0658900, 0xc0658a00, 0xc0658e00, 0xc0658f00, 0xc065a100, 0xc065a900,
+	0xc065aa00, 0xc065ab00, 0xc065b000, 0xc065b100, 0xc065b300, 0xc065b500, 0xc065b700, 0xc065b800,
+	0xc065c000, 0xc065c100, 0xc065c500, 0xc065c700, 0xc065fc00, 0xc065fd00, 0xc065fe00, 0xc065ff00,
+	0xc0660100, 0xc0660200, 0xc0660600, 0xc0660900, 0xc0660a00, 0xc0661100, 0xc0665200, 0xc0665300,
+	0xc0665400, 0xc0665500, 0xc0665900, 0xc0665a00, 0xc0665c00, 0xc0665d00, 0xc0665f00, 0xc0666000,
+	0xc0669200, 0xc066b200, 0xc066cc00, 0xc066ce00, 0xc066d600, 0xc066d700, 0xc066e000, 0xc066e200,
+	0xc066e300, 0xc066e600, 0xc066ef00, 0xc066f000, 0xc066fa00, 0xc066fc00, 0xc0670200, 0xc0670300,
+	0xc0670700, 0xc0670800, 0xc0670e00, 0xc0670f00, 0xc0671400, 0xc0671500, 0xc0671700, 0xc0671800,
+	0xc0671b00, 0xc0672900, 0xc0672b00, 0xc0672c00, 0xc0675500, 0xc0677500, 0xc0678200, 0xc0678300,
+	0xc0678900, 0xc0678c00, 0xc0679300, 0xc0679400, 0xc0680f00, 0xc0681000, 0xc0681700, 0xc0681800,
+	0xc0681c00, 0xc0681e00, 0xc0682300, 0xc0682600, 0xc0682900, 0xc0682a00, 0xc0682b00, 0xc0682e00,
+	0xc0683000, 0xc0683100, 0xc0683500, 0xc0683600, 0xc0683700, 0xc0683b00, 0xc0684800, 0xc0684900,
+	0xc0684d00, 0xc0684e00, 0xc0685200, 0xc0685300, 0xc0688c00, 0xc0688d00, 0xc0688e00, 0xc0688f00,
+	0xc0689300, 0xc0689400, 0xc0689a00, 0xc0689c00, 0xc068a700, 0xc068a900, 0xc068ac00, 0xc068ad00,
+	0xc068e800, 0xc068ea00, 0xc068ee00, 0xc068ef00, 0xc068f500, 0xc068f600, 0xc068f800, 0xc068f900,
+	0xc068fb00, 0xc068fc00, 0xc0690a00, 0xc0690b00, 0xc0694b00, 0xc0694c00, 0xc06a0000, 0xc06b0000,
+	0xc06b0200, 0xc06b0300, 0xc06b0400, 0xc06b0600, 0xc06b0900, 0xc06b0a00, 0xc06b0b00, 0xc06b0e00,
+	0xc06b3300, 0xc06b6500, 0xc06b6600, 0xc06b6800, 0xc06b6900, 0xc06b6e00, 0xc06b6f00, 0xc06b7100,
+	0xc06b7200, 0xc06b7300, 0xc06b7a00, 0xc06b8200, 0xc06b8400, 0xc06b8500, 0xc06ba800, 0xc06ba900,
+	0xc06bab00, 0xc06bad00, 0xc06bae00, 0xc06baf00, 0xc06bb100, 0xc06bb300, 0xc06bbb00, 0xc06bbc00,
+	0xc06bc800, 0xc06bea00, 0xc06beb00, 0xc06bed00, 0xc06c1700, 0xc06c3200, 0xc06c3300, 0xc06c5d00,
+	0xc06c6300, 0xc06c6400, 0xc06c6600, 0xc06c6b00, 0xc06c6d00, 0xc06c7200, 0xc06c7a00, 0xc06c7d00,
+	0xc06c7f00, 0xc06c8000, 0xc06caf00, 0xc06cc300, 0xc06cd700, 0xc06ce600, 0xc06ce700, 0xc06cea00,
+	0xc06ceb00, 0xc06cee00, 0xc06cef00, 0xc06d0000, 0xc06d0f00, 0xc06d1000, 0xc06d1100, 0xc06d1200,
+	0xc06d1700, 0xc06d1800, 0xc06d1900, 0xc06d1a00, 0xc06d1e00, 0xc06d1f00, 0xc06d2500, 0xc06d2700,
+	0xc06d2d00, 0xc06d2e00, 0xc06d2f00, 0xc06d3000, 0xc06d4700, 0xc06d4800, 0xc06d4a00, 0xc06d4c00,
+	0xc06d4d00, 0xc06d4e00, 0xc06d4f00, 0xc06d5000, 0xc06d5b00, 0xc06d5e00, 0xc06d6100, 0xc06d6500,
+	0xc06d6700, 0xc06d6900, 0xc06d6d00, 0xc06d6f00, 0xc06d7500, 0xc06d7600, 0xc06d7700, 0xc06d7900,
+	0xc06d7b00, 0xc06d7c00, 0xc06d7d00, 0xc06d7e00, 0xc06d7f00, 0xc06d8000, 0xc06d8300, 0xc06d8400,
+	0xc06d8800, 0xc06d8900, 0xc06d9500, 0xc06d9600, 0xc06d9f00, 0xc06da000, 0xc06da500, 0xc06da600,
+	0xc06dac00, 0xc06dad00, 0xc06dc400, 0xc06dc500, 0xc06dcb00, 0xc06dcc00, 0xc06dd000, 0xc06dd100,
+	0xc06dd200, 0xc06dd300, 0xc06dd900, 0xc06dda00, 0xc06ddb00, 0xc06ddd00, 0xc06ddf00, 0xc06de000,
+	0xc06de700, 0xc06de800, 0xc06deb00, 0xc06dec00, 0xc06def00, 0xc06df000, 0xc06df200, 0xc06df300,
+	0xc06df400, 0xc06df800, 0xc06df900, 0xc06dfa00, 0xc06dfb00, 0xc06dfd00, 0xc06dfe00, 0xc06e0000,
+	0xc06f2000, 0xc06f2100, 0xc06f2200, 0xc06f2700, 0xc06f2800, 0xc06f2c00, 0xc06f2d00, 0xc06f2f00,
+	0xc06f3100, 0xc06f5800, 0xc06f5900, 0xc06f6400, 0xc06f6600, 0xc06f6700, 0xc06f6900, 0xc06f6a00,
+	0xc06f7c00, 0xc06f7e00, 0xc06f7f00, 0xc06f8000, 0xc06fe500, 0xc06fe700, 0xc06ffc00, 0xc06ffd00,
+	0xc0701e00, 0xc0702100, 0xc0702d00, 0xc0702e00, 0xc0703100, 0xc0703200, 0xc0703d00, 0xc0703e00,
+	0xc0704600, 0xc0705000, 0xc0706200, 0xc0706500, 0xc070cc00, 0xc070cd00, 0xc070ce00, 0xc070cf00,
+	0xc070d000, 0xc070d100, 0xc070d500, 0xc070d700, 0xc070d800, 0xc070f700, 0xc070f800, 0xc070fe00,
+	0xc070ff00, 0xc0710000, 0xc0770000, 0xc0790000, 0xc07a0000, 0xc07a0100, 0xc07a8300, 0xc07a8d00,
+	0xc07a9300, 0xc07a9700, 0xc07aab00, 0xc07aac00, 0xc07ab000, 0xc07ab100, 0xc07ab400, 0xc07ab500,
+	0xc07ad600, 0xc07ad700, 0xc07ad800, 0xc07aeb00, 0xc07aee00, 0xc07af300, 0xc07c0a00, 0xc07c0f00,
+	0xc07c1900, 0xc07c1d00, 0xc07c2000, 0xc07c2100, 0xc07c2700, 0xc07c2800, 0xc07c2e00, 0xc07c2f00,
+	0xc07c7000, 0xc07c7100, 0xc07c7300, 0xc07c7500, 0xc07c7600, 0xc07c9800, 0xc07c9900, 0xc07c9a00,
+	0xc07c9b00, 0xc07c9c00, 0xc07caa00, 0xc07cdc00, 0xc07ceb00, 0xc07cec00, 0xc07ced00, 0xc07cf600,
+	0xc07cf700, 0xc07cf900, 0xc07cfa00, 0xc07cff00, 0xc07d0000, 0xc07e0000, 0xc07e0100, 0xc07e4100,
+	0xc0810100, 0xc0813e00, 0xc0815000, 0xc0815100, 0xc0815700, 0xc0815800, 0xc0816200, 0xc0816300,
+	0xc0820000, 0xc0830000, 0xc0830d00, 0xc0830e00, 0xc0831400, 0xc0831500, 0xc0831900, 0xc0831b00,
+	0xc0831f00, 0xc0834f00, 0xc0835000, 0xc0835900, 0xc0835a00, 0xc0835d00, 0xc0836000, 0xc0836100,
+	0xc0836c00, 0xc0836d00, 0xc0838400, 0xc0838500, 0xc083fb00, 0xc083fd00, 0xc0840900, 0xc0840c00,
+	0xc0840f00, 0xc0841000, 0xc0841f00, 0xc0842000, 0xc0842200, 0xc0842300, 0xc0842400, 0xc0842900,
+	0xc0842a00, 0xc0843500, 0xc0843600, 0xc0843700, 0xc0843800, 0xc0845d00, 0xc0845e00, 0xc0846300,
+	0xc0846400, 0xc084ef00, 0xc084f000, 0xc084f400, 0xc084f600, 0xc084f700, 0xc084fc00, 0xc084fd00,
+	0xc084fe00, 0xc0850f00, 0xc0851000, 0xc0851500, 0xc0851600, 0xc0851c00, 0xc0851d00, 0xc0851f00,
+	0xc0852000, 0xc0852100, 0xc0852400, 0xc0852500, 0xc0852900, 0xc0852a00, 0xc0853500, 0xc0853800,
+	0xc0853a00, 0xc0853b00, 0xc0854000, 0xc0854100, 0xc0854300, 0xc0854400, 0xc0856c00, 0xc0857000,
+	0xc0857900, 0xc0857a00, 0xc0858300, 0xc0858400, 0xc085f400, 0xc085f500, 0xc085fa00, 0xc085fb00,
+	0xc0860000, 0xc0870000, 0xc0870700, 0xc0872600, 0xc0872e00, 0xc0872f00, 0xc0873300, 0xc0873600,
+	0xc0874200, 0xc0874300, 0xc0874400, 0xc0874500, 0xc0875200, 0xc0875300, 0xc0875a00, 0xc0875c00,
+	0xc0875e00, 0xc0875f00, 0xc0876000, 0xc0876100, 0xc0876300, 0xc0876400, 0xc0876500, 0xc0876600,
+	0xc0876700, 0xc0876d00, 0xc0878100, 0xc0878200, 0xc0878500, 0xc0878600, 0xc0878f00, 0xc0879000,
+	0xc0879100, 0xc087a900, 0xc087af00, 0xc087b000, 0xc087b900, 0xc087ba00, 0xc087bb00, 0xc087bc00,
+	0xc087cf00, 0xc087d100, 0xc087db00, 0xc087dc00, 0xc087de00, 0xc087df00, 0xc087e100, 0xc087e200,
+	0xc087e700, 0xc087eb00, 0xc087fd00, 0xc087ff00, 0xc0880700, 0xc0880800, 0xc0880900, 0xc0880a00,
+	0xc0881200, 0xc0881400, 0xc0881700, 0xc0881800, 0xc0881d00, 0xc0882000, 0xc0882700, 0xc0882800,
+	0xc0882a00, 0xc0883000, 0xc0883100, 0xc0883200, 0xc0883300, 0xc0883500, 0xc0883700, 0xc0883a00,
+	0xc0883b00, 0xc0883c00, 0xc0883d00, 0xc0883e00, 0xc0884700, 0xc0886700, 0xc0889a00, 0xc0889d00,
+	0xc08a0100, 0xc08a0900, 0xc08a5600, 0xc08a5700, 0xc08a6400, 0xc08a6500, 0xc08a6900, 0xc08a7600,
+	0xc08a9b00, 0xc08a9f00, 0xc08ab700, 0xc08ab800, 0xc08ac000, 0xc08ac100, 0xc08acc00, 0xc08acd00,
+	0xc08ae400, 0xc08ae900, 0xc08af800, 0xc08af900, 0xc08afb00, 0xc08afc00, 0xc08b4e00, 0xc08b4f00,
+	0xc08c0100, 0xc08c0200, 0xc08c0400, 0xc08c0800, 0xc08c5400, 0xc08c5800, 0xc08c8000, 0xc08d0000,
+	0xc08e0000, 0xc0900000, 0xc0904000, 0xc0904a00, 0xc0904b00, 0xc0904c00, 0xc0904e00, 0xc0906000,
+	0xc0908000, 0xc0910000, 0xc0918000, 0xc091c000, 0xc091e000, 0xc091e400, 0xc091e600, 0xc0927500,
+	0xc0927600, 0xc0927700, 0xc0927800, 0xc0927b00, 0xc0927f00, 0xc0928400, 0xc0928500, 0xc0928600,
+	0xc0928e00, 0xc0929600, 0xc0929700, 0xc0929800, 0xc0929900, 0xc0929d00, 0xc0929e00, 0xc092a300,
+	0xc092ab00, 0xc092ac00, 0xc092b700, 0xc092b800, 0xc092b900, 0xc092ba00, 0xc092bb00, 0xc092bc00,
+	0xc092c100, 0xc092c200, 0xc092c800, 0xc092c900, 0xc092cc00, 0xc092cd00, 0xc092da00, 0xc092dc00,
+	0xc092e300, 0xc092e500, 0xc092e600, 0xc092e900, 0xc092eb00, 0xc092ed00, 0xc092ee00, 0xc092f000,
+	0xc092f200, 0xc092f300, 0xc092fb00, 0xc092fe00, 0xc0931700, 0xc0931800, 0xc0932200, 0xc0932300,
+	0xc0932400, 0xc0932500, 0xc0932a00, 0xc0932b00, 0xc0934c00, 0xc0935000, 0xc0938d00, 0xc0938e00,
+	0xc0939600, 0xc0939700, 0xc0939b00, 0xc0939c00, 0xc093d200, 0xc093d300, 0xc093d400, 0xc093d500,
+	0xc093d700, 0xc093da00, 0xc093db00, 0xc093dc00, 0xc093e400, 0xc093e500, 0xc093eb00, 0xc093ec00,
+	0xc093f600, 0xc093f700, 0xc093f800, 0xc093fb00, 0xc093fc00, 0xc0942100, 0xc0945d00, 0xc0946700,
+	0xc0946800, 0xc0947400, 0xc094a600, 0xc094a800, 0xc094af00, 0xc094b000, 0xc094b100, 0xc094bb00,
+	0xc094c000, 0xc094c300, 0xc094c600, 0xc094d900, 0xc094dc00, 0xc094dd00, 0xc094de00, 0xc094df00,
+	0xc094e700, 0xc0950300, 0xc0950400, 0xc0950500, 0xc0950600, 0xc0950f00, 0xc0951000, 0xc0951300,
+	0xc0951400, 0xc0951500, 0xc0951b00, 0xc0951c00, 0xc0951d00, 0xc0952200, 0xc0952300, 0xc0952400,
+	0xc0952500, 0xc0952900, 0xc0952a00, 0xc0953600, 0xc0953700, 0xc0953900, 0xc0953a00, 0xc0953b00,
+	0xc0953d00, 0xc0954d00, 0xc0955000, 0xc0956200, 0xc0956300, 0xc0956400, 0xc0956500, 0xc0956600,
+	0xc0956700, 0xc0956e00, 0xc0957000, 0xc0957500, 0xc0957a00, 0xc0957e00, 0xc0957f00, 0xc095d100,
+	0xc095d200, 0xc095e300, 0xc095e400, 0xc095e800, 0xc095e900, 0xc095ee00, 0xc095ef00, 0xc0961000,
+	0xc0961100, 0xc0961400, 0xc0961500, 0xc0963a00, 0xc0964900, 0xc0964b00, 0xc0964d00, 0xc0964e00,
+	0xc0965500, 0xc0965900, 0xc0965a00, 0xc0965c00, 0xc0965d00, 0xc0965e00, 0xc0965f00, 0xc0966800,
+	0xc0966900, 0xc0966a00, 0xc0966b00, 0xc0967c00, 0xc0967d00, 0xc0967e00, 0xc0967f00, 0xc0968100,
+	0xc0968800, 0xc0968900, 0xc0968c00, 0xc0968d00, 0xc0969200, 0xc0969300, 0xc096b100, 0xc096b900,
+	0xc096bc00, 0xc096bf00, 0xc096c000, 0xc096c700, 0xc096ca00, 0xc096cb00, 0xc096ce00, 0xc096d000,
+	0xc096d200, 0xc096da00, 0xc096dc00, 0xc096df00, 0xc096e000, 0xc096e300, 0xc096ea00, 0xc096ee00,
+	0xc096ef00, 0xc096f600, 0xc096f700, 0xc096f800, 0xc096f900, 0xc096fc00, 0xc096fd00, 0xc096fe00,
+	0xc096ff00, 0xc0980600, 0xc0980700, 0xc0980e00, 0xc0980f00, 0xc0981100, 0xc0981200, 0xc0981a00,
+	0xc0981c00, 0xc0982a00, 0xc0982b00, 0xc0982c00, 0xc0982d00, 0xc0982f00, 0xc0983400, 0xc0983600,
+	0xc0983700, 0xc0983d00, 0xc0984000, 0xc0984400, 0xc0984500, 0xc0984600, 0xc0985200, 0xc0985300,
+	0xc0986200, 0xc0986300, 0xc0986f00, 0xc0987100, 0xc0987700, 0xc0987800, 0xc0987a00, 0xc0987b00,
+	0xc0987c00, 0xc0987d00, 0xc0988d00, 0xc0988e00, 0xc0989700, 0xc0989800, 0xc0989c00, 0xc0989d00,
+	0xc098a600, 0xc098a800, 0xc098ae00, 0xc098af00, 0xc098b800, 0xc098bc00, 0xc098d400, 0xc098d500,
+	0xc098f100, 0xc098f200, 0xc098f400, 0xc098f500, 0xc098fd00, 0xc098ff00, 0xc0990200, 0xc0990400,
+	0xc0990c00, 0xc0990d00, 0xc0990e00, 0xc0991200, 0xc0991400, 0xc0995800, 0xc0995900, 0xc0995a00,
+	0xc0995d00, 0xc0995e00, 0xc0995f00, 0xc0997300, 0xc0997400, 0xc0997500, 0xc0997700, 0xc0997900,
+	0xc0997f00, 0xc0998000, 0xc0999900, 0xc0999a00, 0xc0999b00, 0xc0999c00, 0xc0999e00, 0xc0999f00,
+	0xc099a600, 0xc099a700, 0xc099a800, 0xc099a900, 0xc099ad00, 0xc099b700, 0xc099bc00, 0xc099be00,
+	0xc099c200, 0xc099c300, 0xc099c400, 0xc099c600, 0xc099d500, 0xc099d600, 0xc099fb00, 0xc099fc00,
+	0xc09a1000, 0xc09a1a00, 0xc09b0100, 0xc09b0700, 0xc09c8400, 0xc09c8500, 0xc09c8c00, 0xc09c8e00,
+	0xc09c8f00, 0xc09c9800, 0xc09c9a00, 0xc09c9b00, 0xc09c9e00, 0xc09ca000, 0xc09ca200, 0xc09ca300,
+	0xc09ca500, 0xc09ca600, 0xc09ca700, 0xc09ca800, 0xc09ccf00, 0xc09cd000, 0xc09cd200, 0xc09cd300,
+	0xc09cd500, 0xc09cd600, 0xc09cdc00, 0xc09cdd00, 0xc09ce100, 0xc09ce200, 0xc09ce300, 0xc09ce400,
+	0xc09cef00, 0xc09cf000, 0xc09cf800, 0xc09cf900, 0xc09d0100, 0xc09d0400, 0xc09d0800, 0xc09d1200,
+	0xc09d8100, 0xc09d8200, 0xc09da500, 0xc09dad00, 0xc09dae00, 0xc09daf00, 0xc09db000, 0xc09db100,
+	0xc09db900, 0xc09dba00, 0xc09dbb00, 0xc09dbc00, 0xc09dbd00, 0xc09dbe00, 0xc09dbf00, 0xc09f1000,
+	0xc09f1f00, 0xc09f2600, 0xc09f2800, 0xc09f4600, 0xc09f4700, 0xc09f4900, 0xc09f4a00, 0xc09f4d00,
+	0xc09f4e00, 0xc09f5400, 0xc09f5600, 0xc09f5a00, 0xc09f5b00, 0xc09f5f00, 0xc09f6000, 0xc09f6300,
+	0xc09f6800, 0xc09f6900, 0xc09f6a00, 0xc09f6c00, 0xc09f6e00, 0xc09f7400, 0xc09f7600, 0xc09f7700,
+	0xc09f7900, 0xc09f7b00, 0xc0a00a00, 0xc0a00b00, 0xc0a00f00, 0xc0a01000, 0xc0a01100, 0xc0a01300,
+	0xc0a01400, 0xc0a01500, 0xc0a01800, 0xc0a01b00, 0xc0a01c00, 0xc0a02100, 0xc0a02200, 0xc0a02500,
+	0xc0a02600, 0xc0a02d00, 0xc0a02e00, 0xc0a03200, 0xc0a03300, 0xc0a04100, 0xc0a04200, 0xc0a04300,
+	0xc0a04400, 0xc0a04700, 0xc0a04800, 0xc0a05f00, 0xc0a06100, 0xc0a06a00, 0xc0a06b00, 0xc0a06d00,
+	0xc0a06f00, 0xc0a07b00, 0xc0a07c00, 0xc0a07e00, 0xc0a07f00, 0xc0a08000, 0xc0a08100, 0xc0a08e00,
+	0xc0a09000, 0xc0a09800, 0xc0a09900, 0xc0a09c00, 0xc0a09d00, 0xc0a0a000, 0xc0a0a100, 0xc0a0a200,
+	0xc0a0a900, 0xc0a0ac00, 0xc0a0ad00, 0xc0a0b100, 0xc0a0b400, 0xc0a0bc00, 0xc0a0bd00, 0xc0a0c200,
+	0xc0a0c400, 0xc0a0cd00, 0xc0a0ce00, 0xc0a0e000, 0xc0a0e200, 0xc0a0e500, 0xc0a0e600, 0xc0a0e700,
+	0xc0a0ea00, 0xc0a0f500, 0xc0a0fa00, 0xc0a0fb00, 0xc0a0fd00, 0xc0a10600, 0xc0a10800, 0xc0a14000,
+	0xc0a14200, 0xc0a18000, 0xc0a18200, 0xc0a20000, 0xc0a30000, 0xc0a32000, 0xc0a3a000, 0xc0a40000,
+	0xc0a65100, 0xc0a65200, 0xc0a69900, 0xc0a69a00, 0xc0a6fc00, 0xc0a6fd00, 0xc0a80000, 0xc0a92000,
+	0xc0a92a00, 0xc0ab0100, 0xc0ab0600, 0xc0ab6800, 0xc0ab7000, 0xc0ab8000, 0xc0abc800, 0xc0ace300,
+	0xc0ace800, 0xc0acea00, 0xc0acf000, 0xc0acf100, 0xc0acf400, 0xc0acfd00, 0xc0acfe00, 0xc0ad0100,
+	0xc0ad0500, 0xc0ad1000, 0xc0ad1900, 0xc0ad8000, 0xc0ad8800, 0xc0ae4000, 0xc0ae4500, 0xc0ae8000,
+	0xc0af0000, 0xc0af0e00, 0xc0af1000, 0xc0af2000, 0xc0af3000, 0xc0b00000, 0xc0b10000, 0xc0bb1000,
+	0xc0bb1a00, 0xc0bc0a00, 0xc0bc0b00, 0xc0bc0c00, 0xc0bc2b00, 0xc0bc2c00, 0xc0bc3d00, 0xc0bc3f00,
+	0xc0bc4200, 0xc0bc4500, 0xc0bc4600, 0xc0bc4700, 0xc0bc4800, 0xc0bc4900, 0xc0bc5000, 0xc0bc5200,
+	0xc0bc5400, 0xc0bc5c00, 0xc0bc5d00, 0xc0bc6000, 0xc0bc6100, 0xc0bc6500, 0xc0bc6600, 0xc0bc6900,
+	0xc0bc6a00, 0xc0bc6b00, 0xc0bc6c00, 0xc0bc7300, 0xc0bc7400, 0xc0bc7600, 0xc0bc7900, 0xc0bc7b00,
+	0xc0bc7d00, 0xc0bc7e00, 0xc0bc7f00, 0xc0bc8000, 0xc0bc8100, 0xc0bc8200, 0xc0bc8400, 0xc0bc8500,
+	0xc0bc8800, 0xc0bc8900, 0xc0bc9100, 0xc0bc9200, 0xc0bc9700, 0xc0bc9800, 0xc0bc9d00, 0xc0bc9f00,
+	0xc0bca400, 0xc0bca800, 0xc0bcaa00, 0xc0bcad00, 0xc0bcae00, 0xc0bcb000, 0xc0bcb900, 0xc0bcbb00,
+	0xc0bcbc00, 0xc0bcbd00, 0xc0bcbe00, 0xc0bcc200, 0xc0bcc600, 0xc0bce900, 0xc0bcee00, 0xc0bcf100,
+	0xc0bcf200, 0xc0bcf800, 0xc0bd0100, 0xc0bd0200, 0xc0bd0800, 0xc0bd0c00, 0xc0bd0e00, 0xc0bd0f00,
+	0xc0bd1700, 0xc0bd1800, 0xc0bd1900, 0xc0bd2200, 0xc0bd2300, 0xc0bd2900, 0xc0bd2a00, 0xc0bd3300,
+	0xc0bd3500, 0xc0bd3600, 0xc0bd3700, 0xc0bd3800, 0xc0bd4200, 0xc0bd4300, 0xc0bd4500, 0xc0bd4700,
+	0xc0bd4900, 0xc0bd4a00, 0xc0bd4b00, 0xc0bd4c00, 0xc0bd4d00, 0xc0bd7700, 0xc0bd7800, 0xc0bd8800,
+	0xc0bd8900, 0xc0bd8b00, 0xc0bd8d00, 0xc0bd9400, 0xc0bd9500, 0xc0bd9700, 0xc0bd9800, 0xc0bd9a00,
+	0xc0bd9b00, 0xc0bd9d00, 0xc0bd9e00, 0xc0bda000, 0xc0bda100, 0xc0bda600, 0xc0bdab00, 0xc0bdca00,
+	0xc0bdcc00, 0xc0bdd000, 0xc0bdd400, 0xc0bddf00, 0xc0bde000, 0xc0bde500, 0xc0bde600, 0xc0bdfb00,
+	0xc0bdfc00, 0xc0be1e00, 0xc0be2000, 0xc0be2c00, 0xc0be2d00, 0xc0be3a00, 0xc0be3c00, 0xc0be3d00,
+	0xc0be3e00, 0xc0be4000, 0xc0be4100, 0xc0be4200, 0xc0be4300, 0xc0be4400, 0xc0be4500, 0xc0be4600,
+	0xc0be5f00, 0xc0be6000, 0xc0be6c00, 0xc0be6d00, 0xc0be8100, 0xc0be8500, 0xc0bead00, 0xc0beaf00,
+	0xc0beb400, 0xc0beb500, 0xc0beb600, 0xc0beb800, 0xc0bebe00, 0xc0bec200, 0xc0bec900, 0xc0becb00,
+	0xc0becc00, 0xc0bece00, 0xc0bed000, 0xc0bed800, 0xc0bee900, 0xc0beed00, 0xc0bef000, 0xc0bef100,
+	0xc0bef200, 0xc0bef300, 0xc0bef700, 0xc0befa00, 0xc0c00000, 0xc0c10000, 0xc0c20000, 0xc0c30000,
+	0xc0c30100, 0xc0c30200, 0xc0c30800, 0xc0c30900, 0xc0c30c00, 0xc0c30f00, 0xc0c32200, 0xc0c32300,
+	0xc0c32700, 0xc0c32900, 0xc0c32a00, 0xc0c32c00, 0xc0c33800, 0xc0c34800, 0xc0c34900, 0xc0c36200,
+	0xc0c36300, 0xc0c36600, 0xc0c36700, 0xc0c36900, 0xc0c36b00, 0xc0c36e00, 0xc0c36f00, 0xc0c37000,
+	0xc0c37100, 0xc0c37400, 0xc0c37700, 0xc0c38600, 0xc0c39500, 0xc0c39800, 0xc0c39900, 0xc0c3aa00,
+	0xc0c3ab00, 0xc0c3b700, 0xc0c3b900, 0xc0c3c300, 0xc0c3c400, 0xc0c3c500, 0xc0c3c600, 0xc0c3db00,
+	0xc0c3dc00, 0xc0c3ec00, 0xc0c3ed00, 0xc0c3ee00, 0xc0c40100, 0xc0c49c00, 0xc0c57100, 0xc0c57200,
+	0xc0c60800, 0xc0c61000, 0xc0c71000, 0xc0c72000, 0xc0c73000, 0xc0c84000, 0xc0c85000, 0xc0cb5000,
+	0xc0cb5100, 0xc0cb6c00, 0xc0cb6e00, 0xc0cb8a00, 0xc0cb9300, 0xc0cb9a00, 0xc0cb9b00, 0xc0cb9e00,
+	0xc0cb9f00, 0xc0cbb000, 0xc0cbb100, 0xc0cbb200, 0xc0cbd500, 0xc0cbd600, 0xc0cbd800, 0xc0cbd900,
+	0xc0cbe300, 0xc0cbe400, 0xc0cbe800, 0xc0cbe900, 0xc0cbeb00, 0xc0cbec00, 0xc0cbf700, 0xc0cbf800,
+	0xc0ce4d00, 0xc0ce5200, 0xc0ce5600, 0xc0ce5700, 0xc0ce9800, 0xc0ce9e00, 0xc0cede00, 0xc0cee300,
+	0xc0cf1f00, 0xc0cf2000, 0xc0cf2100, 0xc0cf2200, 0xc0cf2400, 0xc0cf2500, 0xc0cf2800, 0xc0cf2b00,
+	0xc0cf4000, 0xc0cf4100, 0xc0cf4500, 0xc0cf5b00, 0xc0cf5c00, 0xc0cf6000, 0xc0cf6300, 0xc0cf7100,
+	0xc0cf7200, 0xc0cf7700, 0xc0cf7a00, 0xc0cf8d00, 0xc0cf8f00, 0xc0cf9000, 0xc0cf9200, 0xc0cf9300,
+	0xc0cf9700, 0xc0cf9a00, 0xc0cf9c00, 0xc0cf9f00, 0xc0cfa100, 0xc0cfa200, 0xc0cfa500, 0xc0cfa600,
+	0xc0cfb700, 0xc0cfb800, 0xc0cfbb00, 0xc0cfbc00, 0xc0cfc200, 0xc0cfc400, 0xc0cfc500, 0xc0cfc700,
+	0xc0cfc800, 0xc0cfcf00, 0xc0cff200, 0xc0cff300, 0xc0cff400, 0xc0cff500, 0xc0cff800, 0xc0cff900,
+	0xc0da0000, 0xc0db0000, 0xc0df4000, 0xc0df8000, 0xc0e30100, 0xc0e31000, 0xc0e48000, 0xc0e50000,
+	0xc0e70f00, 0xc0e71000, 0xc0e72200, 0xc0e72300, 0xc0e73b00, 0xc0e73c00, 0xc0e74300, 0xc0e74400,
+	0xc0e75200, 0xc0e75300, 0xc0e76e00, 0xc0e76f00, 0xc0e77200, 0xc0e77a00, 0xc0e77f00, 0xc0e78000,
+	0xc0e78700, 0xc0e78900, 0xc0e78c00, 0xc0e78d00, 0xc0e7a600, 0xc0e7ab00, 0xc0e7af00, 0xc0e7b100,
+	0xc0e7c100, 0xc0e7c200, 0xc0e7cb00, 0xc0e7cc00, 0xc0e7d400, 0xc0e7d500, 0xc0e7ed00, 0xc0e7ee00,
+	0xc0e7fe00, 0xc0e7ff00, 0xc0e88000, 0xc0e8a000, 0xc0eaf500, 0xc0eaf600, 0xc0ee0100, 0xc0ee0b00,
+	0xc0f01000, 0xc0f02000, 0xc0f40000, 0xc0f50000, 0xc0f50d00, 0xc0f50f00, 0xc0f52400, 0xc0f52500,
+	0xc0f53a00, 0xc0f53c00, 0xc0f53d00, 0xc0f56900, 0xc0f57100, 0xc0f57900, 0xc0f57a00, 0xc0f59400,
+	0xc0f59500, 0xc0f59800, 0xc0f59900, 0xc0f5a200, 0xc0f5a300, 0xc0f5a900, 0xc0f5aa00, 0xc0f5b900,
+	0xc0f5ba00, 0xc0f5c000, 0xc0f5c100, 0xc0f5c400, 0xc0f5c500, 0xc0f5d000, 0xc0f5d100, 0xc0f5d200,
+	0xc0f5da00, 0xc0f5e100, 0xc0f5e200, 0xc0f5f900, 0xc0f5fc00, 0xc0f70100, 0xc0f70b00, 0xc0f80000,
+	0xc0f88000, 0xc0f8c000, 0xc0f91000, 0xc0f92000, 0xc0f92a00, 0xc0f92c00, 0xc0fb2700, 0xc0fb2800,
+	0xc0fb3d00, 0xc0fb4200, 0xc0fb9400, 0xc0fb9500, 0xc0fbc300, 0xc0fbc400, 0xc0fbca00, 0xc0fbcb00,
+	0xc0fbcd00, 0xc0fbd000, 0xc0fbe200, 0xc0fbe300, 0xc1000000, 0xc113e800, 0xc113ec00, 0xc1299200,
+	0xc1299400, 0xc1524000, 0xc1526000, 0xc152e000, 0xc1530000, 0xc15f0000, 0xc15f8000, 0xc1691500,
+	0xc1691600, 0xc16c1700, 0xc16c1800, 0xc16c1c00, 0xc16c1d00, 0xc16cd600, 0xc16cd700, 0xc16cfc00,
+	0xc16d0000, 0xc16d4200, 0xc16d4400, 0xc16e6800, 0xc16e6a00, 0xc1700000, 0xc1710000, 0xc1720000,
+	0xc1724000, 0xc1726000, 0xc172a000, 0xc1732000, 0xc1738000, 0xc1742000, 0xc1748000, 0xc174c000,
+	0xc1752000, 0xc1754000, 0xc1756000, 0xc1770000, 0xc1780000, 0xc17a0000, 0xc17c0000, 0xc1b2bf00,
+	0xc1b2c000, 0xc1bc0700, 0xc1bc0800, 0xc1bd0000, 0xc1bd4000, 0xc1bd8000, 0xc1bd8100, 0xc1c20300,
+	0xc1c20400, 0xc1c22000, 0xc1c26000, 0xc1c28000, 0xc1c28100, 0xc1c2a000, 0xc1c2c000, 0xc1ddda00,
+	0xc1dddb00, 0xc1e30000, 0xc1e34000, 0xc1e38000, 0xc1e38100, 0xc2094000, 0xc2094200, 0xc2095200,
+	0xc2095400, 0xc223bf00, 0xc223c000, 0xc24f6000, 0xc24f8000, 0xc25b0000, 0xc25c0000, 0xc28cc800,
+	0xc28cd000, 0xc2c10000, 0xc2c14000, 0xc2c16000, 0xc2c1e000, 0xc2ccc000, 0xc2cd0000, 0xc2df0000,
+	0xc2df6000, 0xc2dfa000, 0xc2e00000, 0xc3185000, 0xc3185800, 0xc318c000, 0xc318e000, 0xc327da00,
+	0xc327dc00, 0xc32b0000, 0xc32b2000, 0xc3800400, 0xc3800800, 0xc38e9c00, 0xc38ea000, 0xc38ed400,
+	0xc38ed800, 0xc3a7a000, 0xc3a7b000, 0xc3ca4000, 0xc3ca6000, 0xc3eaa800, 0xc3eaa900, 0xc3eab900,
+	0xc3eaba00, 0xc3eafc00, 0xc3eb0000, 0xc3f62000, 0xc3f64000, 0xc4000000, 0xc4010100, 0xc4010200,
+	0xc4010300, 0xc4010400, 0xc4010500, 0xc4010700, 0xc4014000, 0xc4014400, 0xc4014500, 0xc4014700,
+	0xc4014800, 0xc4014a00, 0xc4016800, 0xc4016b00, 0xc4016c00, 0xc4016d00, 0xc4017000, 0xc4017100,
+	0xc4017300, 0xc4018600, 0xc4018700, 0xc4018800, 0xc4018900, 0xc4018a00, 0xc4018f00, 0xc401a000,
+	0xc401b000, 0xc4020000, 0xc4020200, 0xc4020400, 0xc4020800, 0xc4030000, 0xc4030e00, 0xc4031000,
+	0xc4032000, 0xc4033900, 0xc4034100, 0xc4034200, 0xc4034800, 0xc4034900, 0xc4034a00, 0xc4035a00,
+	0xc4035b00, 0xc4035c00, 0xc4035f00, 0xc4036000, 0xc4036800, 0xc4036900, 0xc4036a00, 0xc4036b00,
+	0xc4038400, 0xc4039400, 0xc4039800, 0xc4039900, 0xc4039a00, 0xc403b800, 0xc403e000, 0xc4042e00,
+	0xc4044700, 0xc40c0000, 0xc40c0a00, 0xc40c2000, 0xc40c4000, 0xc40c8000, 0xc40ca000, 0xc40cc000,
+	0xc40f1000, 0xc40f2000, 0xc40f4000, 0xc41b0000, 0xc41b4000, 0xc41c3000, 0xc41c4000, 0xc41d4000,
+	0xc41d6000, 0xc4200000, 0xc4200800, 0xc4202000, 0xc4206000, 0xc4208000, 0xc420a000, 0xc4280000,
+	0xc4286000, 0xc42a0000, 0xc42a4000, 0xc4d80100, 0xc4d80200, 0xc6000000, 0xc6021000, 0xc6022000,
+	0xc6076000, 0xc6078000, 0xc60b0000, 0xc60b0400, 0xc60c2000, 0xc60c4000, 0xc60f2000, 0xc60f4000,
+	0xc6114600, 0xc6114700, 0xc6114d00, 0xc6114e00, 0xc6117500, 0xc6117600, 0xc6117800, 0xc6117a00,
+	0xc611b400, 0xc611b700, 0xc611e700, 0xc611e900, 0xc6162f00, 0xc6163000, 0xc6163300, 0xc6163400,
+	0xc6163d00, 0xc6163e00, 0xc6165d00, 0xc6166200, 0xc616fa00, 0xc616fc00, 0xc61b0400, 0xc61b0900,
+	0xc6242000, 0xc6242f00, 0xc6292000, 0xc6292f00, 0xc62d7400, 0xc62d7800, 0xc6300000, 0xc6300400,
+	0xc6317000, 0xc6317200, 0xc6317c00, 0xc6317d00, 0xc6318000, 0xc6318600, 0xc631a400, 0xc631a500,
+	0xc6321000, 0xc6321800, 0xc6330c00, 0xc6330d00, 0xc6334700, 0xc6334800, 0xc6338f00, 0xc6339300,
+	0xc633c300, 0xc633c400, 0xc633d200, 0xc633d300, 0xc6342c00, 0xc6343000, 0xc6360100, 0xc6360b00,
+	0xc6360f00, 0xc6363e00, 0xc6364000, 0xc6365100, 0xc6365300, 0xc6365800, 0xc6365b00, 0xc6365c00,
+	0xc6366200, 0xc6366400, 0xc6368d00, 0xc6369800, 0xc6369a00, 0xc636a400, 0xc636a500, 0xc636a600,
+	0xc636aa00, 0xc636ab00, 0xc636ad00, 0xc636b600, 0xc636b700, 0xc636c800, 0xc636ca00, 0xc636d300,
+	0xc636db00, 0xc636dd00, 0xc636df00, 0xc636e000, 0xc636e100, 0xc636e600, 0xc636e700, 0xc636e900,
+	0xc636ea00, 0xc636eb00, 0xc636f700, 0xc636ff00, 0xc6371c00, 0xc6372000, 0xc63a0800, 0xc63a0d00,
+	0xc649dc00, 0xc649dd00, 0xc6595800, 0xc6596000, 0xc6612600, 0xc6612700, 0xc6639400, 0xc6639500,
+	0xc663ad00, 0xc663ae00, 0xc663de00, 0xc663df00, 0xc6696000, 0xc6698000, 0xc6855000, 0xc6855600,
+	0xc6858c00, 0xc6858d00, 0xc685ce00, 0xc685cf00, 0xc685e200, 0xc685e300, 0xc6878900, 0xc6878b00,
+	0xc687a700, 0xc687a800, 0xc68e0000, 0xc68f0000, 0xc6908000, 0xc6909000, 0xc693a000, 0xc693a100,
+	0xc694b100, 0xc694b300, 0xc694bd00, 0xc694be00, 0xc694c000, 0xc694c600, 0xc6978400, 0xc6978500,
+	0xc6af6400, 0xc6af6800, 0xc6b3e100, 0xc6b3e200, 0xc6b48e00, 0xc6b48f00, 0xc6b49600, 0xc6b49a00,
+	0xc6b8a100, 0xc6b8a200, 0xc6c80000, 0xc6c80a00, 0xc6cec500, 0xc6cec600, 0xc6cec800, 0xc6cecb00,
+	0xc6f08000, 0xc6f10000, 0xc6f40a00, 0xc6f40c00, 0xc6f6df00, 0xc6f6e000, 0xc7091800, 0xc7092000,
+	0xc715ac00, 0xc715b000, 0xc71a6000, 0xc71a6800, 0xc71aea00, 0xc71aeb00, 0xc7220a00, 0xc7220b00,
+	0xc72b1200, 0xc72b1400, 0xc72b2d00, 0xc72b2e00, 0xc72b3f00, 0xc72b4000, 0xc72bf600, 0xc72bf800,
+	0xc730e000, 0xc730e100, 0xc730e600, 0xc730e800, 0xc7350000, 0xc7360000, 0xc741c000, 0xc741c800,
+	0xc758d000, 0xc758d800, 0xc75b1000, 0xc75b2000, 0xc7670800, 0xc7670d00, 0xc7676600, 0xc7676700,
+	0xc7a62200, 0xc7a62600, 0xc7d43900, 0xc7d43a00, 0xc7f70000, 0xc7f72000, 0xc7f73800, 0xc7f74000,
+	0xc7f89000, 0xc7f89100, 0xc7fa8000, 0xc7faa000, 0xc8000000, 0xc8005e00, 0xc8005f00, 0xc8008900,
+	0xc8008b00, 0xc800d800, 0xc800e000, 0xc801a000, 0xc801a100, 0xc8050000, 0xc8050900, 0xc8050b00,
+	0xc8050c00, 0xc8095200, 0xc8095400, 0xc8097300, 0xc8097400, 0xc80a9800, 0xc80a9900, 0xc80a9b00,
+	0xc80a9c00, 0xc80aa000, 0xc80aa100, 0xc80aa500, 0xc80aa700, 0xc80ca800, 0xc80ca900, 0xc80ce000,
+	0xc80cf000, 0xc80f0000, 0xc8100000, 0xc8100800, 0xc8101000, 0xc8105800, 0xc8105900, 0xc81e0000,
+	0xc81e4000, 0xc8320000, 0xc8322000, 0xc8324000, 0xc8326000, 0xc8328000, 0xc8329000, 0xc83a0000,
+	0xc83a4000, 0xc83e0000, 0xc83e4000, 0xca000000, 0xca004d00, 0xca004e00, 0xca051000, 0xca052000,
+	0xca490700, 0xca490800, 0xca7b0000, 0xca7b2000, 0xca884c00, 0xca885000, 0xcaaac000, 0xcaaac400,
+	0xcaad7400, 0xcaad7800, 0xcb0d2000, 0xcb0d2100, 0xcb117e00, 0xcb117f00, 0xcb16df00, 0xcb16e000,
+	0xcb176800, 0xcb176900, 0xcb176a00, 0xcb176b00, 0xcb186c00, 0xcb186d00, 0xcb18f700, 0xcb18f800,
+	0xcb1c0800, 0xcb1c0a00, 0xcb1d3500, 0xcb1d3600, 0xcb1ff400, 0xcb1ff600, 0xcb219800, 0xcb219a00,
+	0xcb3eb400, 0xcb3eb800, 0xcb624e00, 0xcb624f00, 0xcb841000, 0xcb842000, 0xcb9f5000, 0xcb9f6000,
+	0xcbbe3800, 0xcbbe4000, 0xcc000000, 0xcc08cc00, 0xcc08d000, 0xcc0b0000, 0xcc0b0400, 0xcc0c8000,
+	0xcc0c9000, 0xcc120000, 0xcc130000, 0xcc34bf00, 0xcc34c000, 0xcc3a8800, 0xcc3a8c00, 0xcc4b8e00,
+	0xcc4b8f00, 0xcc508f00, 0xcc509000, 0xcc57a900, 0xcc57aa00, 0xcc57b300, 0xcc57b400, 0xcc57cd00,
+	0xcc57ce00, 0xcc59ce00, 0xcc59cf00, 0xcc7c6800, 0xcc7c6c00, 0xcc7e0c00, 0xcc7e0e00, 0xcc7e8000,
+	0xcc7e8200, 0xcc7e8c00, 0xcc7e8e00, 0xcc910000, 0xcc910100, 0xcc910200, 0xcc910800, 0xcc916100,
+	0xcc916200, 0xcc91c900, 0xcc91ca00, 0xcc980e00, 0xcc981000, 0xcc98e000, 0xcc98e800, 0xcc991800,
+	0xcc991a00, 0xcce12a00, 0xcce12c00, 0xcce1da00, 0xcce1db00, 0xcceb2000, 0xcceb2c00, 0xcd936000,
+	0xcd937000, 0xcd9f4f00, 0xcd9f5000, 0xcda6b100, 0xcda6b200, 0xcda6fb00, 0xcda6fc00, 0xcdc90000,
+	0xcdc91000, 0xcdc93700, 0xcdc93800, 0xcdcb4a00, 0xcdcb4c00, 0xcddcd800, 0xcddcda00, 0xcdfd0000,
+	0xcdfe0000, 0xce83c000, 0xce83d000, 0xcea72100, 0xcea72200, 0xcebedc00, 0xcebee000, 0xcec32000,
+	0xcec34000, 0xcec90000, 0xcec91000, 0xcedd5000, 0xcedd6000, 0xcedf7c00, 0xcedf7d00, 0xcedf8200,
+	0xcedf8300, 0xcedf8800, 0xcedf8900, 0xcee02000, 0xcee04000, 0xcefce000, 0xcefd0000, 0xcf594000,
+	0xcf598000, 0xcf880000, 0xcf884000, 0xcf942000, 0xcf943000, 0xcf944000, 0xcf948000, 0xcf96a000,
+	0xcf96c000, 0xcf9e4000, 0xcf9e8000, 0xcfaeb000, 0xcfaec000, 0xcfaed800, 0xcfaedc00, 0xcfb24000,
+	0xcfb26000, 0xcfb4c000, 0xcfb50000, 0xcfbda800, 0xcfbdac00, 0xcfbdb800, 0xcfbdbc00, 0xcfbdc000,
+	0xcfbdd000, 0xcfe57000, 0xcfe57500, 0xcfe57600, 0xcfe57900, 0xcfe57a00, 0xcfe58000, 0xcff80000,
+	0xcffa0000, 0xd042e800, 0xd042f000, 0xd047d400, 0xd047d800, 0xd047e000, 0xd047e800, 0xd0517400,
+	0xd0517800, 0xd0524800, 0xd0524c00, 0xd0559c00, 0xd055a000, 0xd057a600, 0xd057a800, 0xd06f3000,
+	0xd06f3800, 0xd10d0000, 0xd10e0000, 0xd110b000, 0xd110c000, 0xd12a0000, 0xd12a2000, 0xd12ac000,
+	0xd12b0000, 0xd12d0000, 0xd12d8000, 0xd13aa000, 0xd13ac000, 0xd15ec000, 0xd15ee000, 0xd163e000,
+	0xd163f000, 0xd18d0000, 0xd18d1000, 0xd1969000, 0xd196a000, 0xd1a28000, 0xd1a2a000, 0xd1cb0000,
+	0xd1cb4000, 0xd1ce0000, 0xd1ce2000, 0xd1ce2600, 0xd1ce2800, 0xd1d46000, 0xd1d48000, 0xd1d4c000,
+	0xd1d4e000, 0xd1d53000, 0xd1d54000, 0xd1fae000, 0xd1fb0000, 0xd1fbc300, 0xd1fbc600, 0xd1fbfc00,
+	0xd1fbfe00, 0xd2000000, 0xd4000000, 0xd4008000, 0xd400a000, 0xd408e600, 0xd408e800, 0xd408f100,
+	0xd408f200, 0xd408fe00, 0xd4090000, 0xd40ce000, 0xd40d0000, 0xd416a000, 0xd416c000, 0xd4314000,
+	0xd4316000, 0xd4348000, 0xd434a000, 0xd43c4000, 0xd43c6000, 0xd4400000, 0xd4408000, 0xd4459000,
+	0xd445a000, 0xd455c000, 0xd455e000, 0xd4586000, 0xd4588000, 0xd45c6600, 0xd45c6800, 0xd45f8000,
+	0xd45fa000, 0xd4600000, 0xd4602000, 0xd4644000, 0xd4646000, 0xd467a000, 0xd467c000, 0xd468e000,
+	0xd468f000, 0xd4753000, 0xd4754000, 0xd47ae000, 0xd47b0000, 0xd4818000, 0xd4820000, 0xd4d90000,
+	0xd4d98000, 0xd5120000, 0xd5128000, 0xd5374000, 0xd5378000, 0xd5834000, 0xd5836000, 0xd5886000,
+	0xd5888000, 0xd5934000, 0xd5936000, 0xd596a000, 0xd596e000, 0xd5984000, 0xd5986000, 0xd59a2000,
+	0xd59a6000, 0xd59ea000, 0xd59ec000, 0xd59f0e00, 0xd59f1000, 0xd59f8400, 0xd59f8800, 0xd5ac8000,
+	0xd5aca000, 0xd5b3a000, 0xd5b3c000, 0xd5b5e000, 0xd5b60000, 0xd5c12000, 0xd5c14000, 0xd5d4c000,
+	0xd5d50000, 0xd5dbfc00, 0xd5dc0000, 0xd5f70000, 0xd5f72000, 0xd5ff8000, 0xd5ffa000, 0xd6000000,
+	0xd8080000, 0xd8082000, 0xd80af000, 0xd80b0000, 0xd82e7a00, 0xd82e7c00, 0xd82e7e00, 0xd862d000,
+	0xd862e000, 0xd863c600, 0xd863c700, 0xd863c900, 0xd863ca00, 0xd863cc00, 0xd863cd00, 0xd863de00,
+	0xd863df00, 0xd86cf000, 0xd86d0000, 0xd8760000, 0xd8764000, 0xd876e000, 0xd8770000, 0xd897c000,
+	0xd897d000, 0xd898a000, 0xd898b000, 0xd89b4000, 0xd89b6000, 0xd89e6000, 0xd89e7000, 0xd8ab7000,
+	0xd8ab8000, 0xd8ac4000, 0xd8ac5000, 0xd8b7d000, 0xd8b7e000, 0xd8d58000, 0xd8d5c000, 0xd8e68000,
+	0xd8e6a000, 0xd8ecb000, 0xd8ecc000, 0xd8f10000, 0xd8f12000, 0xd8f18000, 0xd8f1a000, 0xd8f48000,
+	0xd8f50000, 0xd8fa6000, 0xd8fa7000, 0xd9000000, 0xd90e5000, 0xd90e6000, 0xd914e000, 0xd914f000,
+	0xd9157000, 0xd9158000, 0xd91d8000, 0xd91d9000, 0xd91dd000, 0xd91de000, 0xd9340000, 0xd9380000,
+	0xd9406000, 0xd9407000, 0xd94d4000, 0xd94d5000, 0xd94e4000, 0xd94e5000, 0xd9750000, 0xd9751000,
+	0xd98b0000, 0xd98c0000, 0xd993b800, 0xd993c000, 0xd9aa9000, 0xd9aaa000, 0xd9b20000, 0xd9b30000,
+	0xd9c79000, 0xd9c7a000, 0xda000000, 0xdc9ec400, 0xdc9ec800, 0xe0000000,
+};
+
+/* first range start of each block */
+static const uint32_t dbipv4addr_assignment_packed_index[] = {
+	0x00000000, 0x0d8c0000, 0x17537000, 0x176b0000, 0x17e20000, 0x18297000, 0x1b6e0000, 0x27000000,
+	0x2bf35400, 0x2d080000, 0x2d480000, 0x2d77d400, 0x2db80800, 0x2db92800, 0x2db9c400, 0x2dc00000,
+	0x2de4ca00, 0x2df9e400, 0x2f100000, 0x334f0000, 0x36000000, 0x3e186000, 0x3e8c4000, 0x3f000000,
+	0x3ff69900, 0x40398000, 0x40cfd800, 0x41b54000, 0x42620000, 0x42e40000, 0x439e3e00, 0x45060000,
+	0x45a02000, 0x45eb8000, 0x48ff0000, 0x50439000, 0x50d1f400, 0x50fbe000, 0x51c10000, 0x54250000,
+	0x5779fc00, 0x59ef4000, 0x5db38000, 0x5e670800, 0x60098000, 0x670cd400, 0x67c4b400, 0x67fc5800,
+	0x68e82600, 0x6b96a200, 0x71cb0000, 0x801d0000, 0x806a0000, 0x80a80000, 0x80d60000, 0x810b0000,
+	0x81390000, 0x815f0000, 0x818c0000, 0x81c40000, 0x81e40000, 0x821b0000, 0x823d0000, 0x82580000,
+	0x82710000, 0x828a0000, 0x82b80000, 0x82d00000, 0x82f84400, 0x83490000, 0x836c9c00, 0x83940000,
+	0x83ab0000, 0x83cd0000, 0x83de0000, 0x83f70000, 0x84938000, 0x84b40000, 0x84e50000, 0x86000000,
+	0x86220000, 0x86540000, 0x86970000, 0x86b40000, 0x86d30000, 0x86fa0000, 0x88164000, 0x88ab0000,
+	0x88e60000, 0x89300000, 0x895c0000, 0x89740000, 0x899e0000, 0x89c40000, 0x89e20000, 0x8a070000,
+	0x8a270000, 0x8a3b8c00, 0x8a4b0000, 0x8a610000, 0x8a750000, 0x8a7abc00, 0x8aba4c00, 0x8acf0000,
+	0x8aef0000, 0x8b050000, 0x8b370000, 0x8b560000, 0x8b840000, 0x8b980000, 0x8bb10000, 0x8bdf0000,
+	0x8c540000, 0x8c960000, 0x8cc80000, 0x8ced0000, 0x8d660000, 0x8d830000, 0x8db20000, 0x8dc30000,
+	0x8de60000, 0x8e5b0800, 0x8f290000, 0x8f600000, 0x8f810000, 0x8fa90000, 0x8fd00000, 0x8fed0000,
+	0x90020000, 0x90200000, 0x9024b000, 0x9024f400, 0x90370000, 0x905f0000, 0x90820000, 0x90cd0000,
+	0x920b0000, 0x92400000, 0x92530000, 0x9258e800, 0x927c0000, 0x92a40000, 0x92bd0000, 0x92e60000,
+	0x93080000, 0x93320000, 0x934f0000, 0x936d0000, 0x938e0000, 0x93ae0000, 0x93c60000, 0x93f30000,
+	0x943b3a00, 0x94470000, 0x94870000, 0x94aa0000, 0x94fe0000, 0x95510000, 0x95910000, 0x95ea0800,
+	0x966e0000, 0x968d0000, 0x96b70000, 0x96df0000, 0x96f50000, 0x97740000, 0x97ac0000, 0x97d30000,
+	0x98480000, 0x98610000, 0x988c0000, 0x98c80000, 0x99130000, 0x99710000, 0x9a230000, 0x9b233000,
+	0x9b460000, 0x9b8a8000, 0x9bc00000, 0x9bdf0000, 0x9bfe4000, 0x9c190000, 0x9c360000, 0x9c6a0000,
+	0x9d000000, 0x9d430000, 0x9d640000, 0x9d8b0000, 0x9db10000, 0x9dc90000, 0x9df30000, 0x9e2e0000,
+	0x9e590000, 0x9e6d0000, 0x9e8c4000, 0x9ea00000, 0x9edc0000, 0x9f090000, 0x9f1d0000, 0x9f460000,
+	0x9f5e0000, 0x9f75a000, 0x9f8b0000, 0x9fa90000, 0x9fcd0000, 0x9fe30000, 0x9ff40000, 0xa0132400,
+	0xa013b400, 0xa0141400, 0xa014ac00, 0xa014fc00, 0xa0420000, 0xa05b0000, 0xa0b40000, 0xa0d50000,
+	0xa0eb0000, 0xa0ee3400, 0xa0ef0000, 0xa1110000, 0xa1220000, 0xa1380000, 0xa1510000, 0xa17e0000,
+	0xa1980000, 0xa1d00000, 0xa1ff0000, 0xa2180000, 0xa2710000, 0xa2da3800, 0xa2dfa800, 0xa2fd1000,
+	0xa30b0000, 0xa37e0000, 0xa3cc0000, 0xa4290000, 0xa4446000, 0xa4580000, 0xa4730000, 0xa4a09c00,
+	0xa5000000, 0xa5200000, 0xa554e800, 0xa56c0000, 0xa5ad4000, 0xa5d10000, 0xa5ea0000, 0xa6500000,
+	0xa6720000, 0xa7564200, 0xa77b0000, 0xa7aa0000, 0xa7dd0000, 0xa8460000, 0xa8650000, 0xa8870000,
+	0xa8a50000, 0xa8c20000, 0xa8ce0000, 0xa8f30000, 0xa9810000, 0xa9e00000, 0xa9ff5c00, 0xaa118000,
+	0xaa430000, 0xaa660000, 0xaaa60000, 0xaaf40000, 0xaaf88c00, 0xaafb3e00, 0xaafd4000, 0xac510000,
+	0xacf14800, 0xacfff000, 0xadf90000, 0xb07a8000, 0xb8530000, 0xb94e6800, 0xb985d400, 0xb9abd000,
+	0xb9bf8000, 0xb9cdc400, 0xba000000, 0xc0053200, 0xc005d800, 0xc008b700, 0xc00c6000, 0xc00ce900,
+	0xc01a3000, 0xc01ae700, 0xc01f1f00, 0xc01fe700, 0xc0218200, 0xc021e900, 0xc0233b00, 0xc0239500,
+	0xc023f900, 0xc029a100, 0xc029e400, 0xc02a6500, 0xc02bb900, 0xc02bf000, 0xc0302000, 0xc0331000,
+	0xc0349900, 0xc0365100, 0xc0368700, 0xc0374400, 0xc0377300, 0xc037c700, 0xc03a8900, 0xc0413300,
+	0xc0419a00, 0xc0432700, 0xc0434f00, 0xc043ac00, 0xc0441700, 0xc044af00, 0xc044e600, 0xc046af00,
+	0xc0480300, 0xc049e600, 0xc04c9a00, 0xc04d7800, 0xc050d100, 0xc051c200, 0xc0528c00, 0xc052f100,
+	0xc053c700, 0xc053ed00, 0xc0543f00, 0xc054b000, 0xc054fd00, 0xc0568600, 0xc0580200, 0xc0586300,
+	0xc058bf00, 0xc05bb400, 0xc05bec00, 0xc05c8d00, 0xc05e3b00, 0xc05eac00, 0xc05eea00, 0xc0602500,
+	0xc0608a00, 0xc060ea00, 0xc0643600, 0xc0649000, 0xc0650c00, 0xc0658600, 0xc065c000, 0xc0665400,
+	0xc066e300, 0xc0671b00, 0xc0681c00, 0xc0684d00, 0xc068e800, 0xc06b0200, 0xc06b7200, 0xc06bc800,
+	0xc06c7f00, 0xc06d1700, 0xc06d4d00, 0xc06d7b00, 0xc06dac00, 0xc06de700, 0xc06f2000, 0xc06f7c00,
+	0xc0704600, 0xc070ff00, 0xc07ad600, 0xc07c7000, 0xc07cf700, 0xc0820000, 0xc0836c00, 0xc0842a00,
+	0xc084fe00, 0xc0853a00, 0xc0860000, 0xc0875e00, 0xc0879100, 0xc087e700, 0xc0882a00, 0xc08a0100,
+	0xc08ae400, 0xc08e0000, 0xc0927600, 0xc092ab00, 0xc092e300, 0xc0932400, 0xc093d700, 0xc0946800,
+	0xc094e700, 0xc0952500, 0xc0956700, 0xc0961100, 0xc0966900, 0xc096bc00, 0xc096ef00, 0xc0981c00,
+	0xc0986200, 0xc098a600, 0xc0990c00, 0xc0997f00, 0xc099c200, 0xc09c8f00, 0xc09cd500, 0xc09d8100,
+	0xc09f1f00, 0xc09f6800, 0xc0a01400, 0xc0a04400, 0xc0a09000, 0xc0a0c400, 0xc0a14200, 0xc0a92a00,
+	0xc0ad0500, 0xc0bb1a00, 0xc0bc5400, 0xc0bc7d00, 0xc0bca400, 0xc0bcf200, 0xc0bd3500, 0xc0bd8900,
+	0xc0bdcc00, 0xc0be3e00, 0xc0beb400, 0xc0bef200, 0xc0c32700, 0xc0c37100, 0xc0c3dc00, 0xc0cb5100,
+	0xc0cbe300, 0xc0cf1f00, 0xc0cf7200, 0xc0cfb700, 0xc0da0000, 0xc0e75200, 0xc0e7c100, 0xc0f01000,
+	0xc0f59500, 0xc0f5da00, 0xc0fb3d00, 0xc1299400, 0xc16d0000, 0xc1752000, 0xc1c20400, 0xc2095400,
+	0xc2df6000, 0xc38ed800, 0xc4010300, 0xc4017300, 0xc4032000, 0xc4038400, 0xc40f1000, 0xc4286000,
+	0xc6114600, 0xc6163d00, 0xc6317000, 0xc633c300, 0xc6366200, 0xc636db00, 0xc649dc00, 0xc6858c00,
+	0xc694b100, 0xc6b8a100, 0xc715ac00, 0xc730e000, 0xc7a62200, 0xc8008b00, 0xc80a9c00, 0xc81e4000,
+	0xca490700, 0xcb176800, 0xcb3eb400, 0xcc0c9000, 0xcc57ce00, 0xcc916200, 0xcd937000, 0xcdfe0000,
+	0xcedf8300, 0xcf96c000, 0xcfbdd000, 0xd0517800, 0xd12b0000, 0xd1cb4000, 0xd1fbfe00, 0xd4316000,
+	0xd45fa000, 0xd4d98000, 0xd59a6000, 0xd5d50000, 0xd862e000, 0xd897d000, 0xd8e6a000, 0xd9157000,
+	0xd98b0000,
+};
+
+/* registry of range, 2 per byte (low nibble: even row) */
+static const uint8_t dbipv4addr_assignment_packed_registry[] = {
+	0x29, 0x63, 0x23, 0x63, 0x62, 0x62, 0x69, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x36, 0x26, 0x26, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63,
+	0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x62, 0x64, 0x23, 0x36, 0x26,
+	0x23, 0x36, 0x36, 0x36, 0x26, 0x23, 0x23, 0x63, 0x62, 0x62, 0x62, 0x62, 0x25, 0x23, 0x26, 0x26,
+	0x26, 0x23, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x63, 0x62, 0x63, 0x63, 0x62, 0x32, 0x34, 0x46,
+	0x26, 0x63, 0x53, 0x32, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x32, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x65, 0x65, 0x65, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x54, 0x62, 0x62, 0x32, 0x62, 0x32, 0x32, 0x36, 0x26, 0x26, 0x26,
+	0x26, 0x26, 0x26, 0x26, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x26, 0x36, 0x36,
+	0x36, 0x26, 0x36, 0x62, 0x32, 0x32, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+	0x35, 0x35, 0x35, 0x32, 0x35, 0x35, 0x35, 0x35, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x46, 0x46, 0x26, 0x36, 0x56, 0x26, 0x36, 0x26, 0x26, 0x26, 0x36, 0x26, 0x26,
+	0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x65, 0x65, 0x62, 0x64, 0x63, 0x63, 0x62,
+	0x64, 0x63, 0x64, 0x62, 0x62, 0x62, 0x63, 0x63, 0x62, 0x64, 0x62, 0x62, 0x63, 0x65, 0x63, 0x62,
+	0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x23, 0x56, 0x56, 0x26, 0x26, 0x36, 0x32, 0x26,
+	0x26, 0x26, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x64,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x53, 0x53, 0x63, 0x53, 0x53, 0x63, 0x53, 0x53, 0x53, 0x63,
+	0x53, 0x53, 0x53, 0x53, 0x23, 0x53, 0x53, 0x63, 0x53, 0x53, 0x23, 0x53, 0x53, 0x23, 0x53, 0x53,
+	0x53, 0x53, 0x53, 0x23, 0x53, 0x23, 0x53, 0x53, 0x53, 0x53, 0x63, 0x23, 0x63, 0x23, 0x23, 0x23,
+	0x23, 0x63, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x63, 0x63, 0x63, 0x23, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62,
+	0x23, 0x26, 0x36, 0x36, 0x26, 0x23, 0x25, 0x26, 0x26, 0x26, 0x23, 0x26, 0x26, 0x26, 0x26, 0x26,
+	0x26, 0x26, 0x23, 0x23, 0x26, 0x23, 0x26, 0x23, 0x23, 0x26, 0x36, 0x36, 0x36, 0x26, 0x26, 0x36,
+	0x36, 0x36, 0x36, 0x26, 0x26, 0x56, 0x62, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x23, 0x23, 0x23,
+	0x23, 0x23, 0x23, 0x39, 0x36, 0x36, 0x26, 0x26, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x62, 0x63,
+	0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x64, 0x64, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x65, 0x63, 0x63, 0x65, 0x63, 0x23, 0x36, 0x56, 0x56,
+	0x26, 0x36, 0x36, 0x36, 0x26, 0x36, 0x46, 0x26, 0x26, 0x36, 0x56, 0x36, 0x62, 0x63, 0x63, 0x62,
+	0x65, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36, 0x36, 0x36, 0x26, 0x35, 0x36, 0x26, 0x36, 0x36, 0x26,
+	0x56, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x23, 0x36, 0x36, 0x26, 0x36, 0x36, 0x26, 0x26, 0x36,
+	0x26, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63, 0x62, 0x63, 0x63, 0x62, 0x23, 0x36,
+	0x36, 0x62, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x62, 0x32, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x23, 0x36, 0x36, 0x64, 0x64, 0x34, 0x46, 0x46, 0x36, 0x36, 0x64, 0x64, 0x64, 0x64, 0x63, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x23, 0x63, 0x32, 0x26, 0x36, 0x36, 0x36, 0x64, 0x64, 0x64, 0x63, 0x23,
+	0x26, 0x43, 0x36, 0x62, 0x62, 0x63, 0x64, 0x62, 0x23, 0x63, 0x63, 0x62, 0x62, 0x43, 0x46, 0x46,
+	0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x62, 0x32, 0x26, 0x36, 0x36, 0x46, 0x46, 0x36, 0x36, 0x26,
+	0x36, 0x36, 0x32, 0x46, 0x36, 0x36, 0x36, 0x26, 0x23, 0x46, 0x63, 0x64, 0x63, 0x63, 0x62, 0x63,
+	0x23, 0x26, 0x36, 0x46, 0x46, 0x63, 0x64, 0x24, 0x63, 0x62, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x62, 0x63, 0x63, 0x63, 0x32, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x32, 0x62,
+	0x63, 0x63, 0x23, 0x36, 0x36, 0x26, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x62,
+	0x32, 0x36, 0x36, 0x26, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x26, 0x36, 0x26,
+	0x36, 0x26, 0x36, 0x36, 0x26, 0x23, 0x36, 0x36, 0x36, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63, 0x62,
+	0x23, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x65, 0x62, 0x63, 0x62,
+	0x32, 0x36, 0x62, 0x63, 0x63, 0x23, 0x26, 0x56, 0x36, 0x36, 0x26, 0x63, 0x63, 0x62, 0x62, 0x23,
+	0x65, 0x63, 0x62, 0x25, 0x36, 0x26, 0x36, 0x36, 0x65, 0x63, 0x63, 0x53, 0x36, 0x62, 0x23, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x45, 0x46, 0x36, 0x36, 0x62, 0x63, 0x62, 0x63, 0x62, 0x62, 0x64, 0x34,
+	0x36, 0x36, 0x62, 0x62, 0x62, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x23, 0x36, 0x36, 0x62,
+	0x62, 0x62, 0x32, 0x46, 0x46, 0x46, 0x46, 0x36, 0x64, 0x64, 0x64, 0x64, 0x34, 0x32, 0x36, 0x62,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x63, 0x63, 0x32, 0x36, 0x46, 0x46, 0x46,
+	0x46, 0x63, 0x32, 0x36, 0x36, 0x64, 0x64, 0x34, 0x26, 0x36, 0x62, 0x64, 0x64, 0x63, 0x63, 0x62,
+	0x62, 0x32, 0x36, 0x32, 0x36, 0x46, 0x46, 0x32, 0x32, 0x32, 0x35, 0x26, 0x63, 0x63, 0x63, 0x35,
+	0x36, 0x62, 0x63, 0x63, 0x63, 0x23, 0x46, 0x63, 0x62, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x62,
+	0x32, 0x62, 0x63, 0x63, 0x63, 0x63, 0x32, 0x62, 0x32, 0x32, 0x32, 0x36, 0x32, 0x62, 0x62, 0x23,
+	0x36, 0x26, 0x26, 0x26, 0x63, 0x62, 0x32, 0x32, 0x62, 0x62, 0x62, 0x62, 0x62, 0x23, 0x26, 0x26,
+	0x63, 0x32, 0x26, 0x63, 0x63, 0x62, 0x62, 0x24, 0x63, 0x62, 0x63, 0x63, 0x62, 0x62, 0x63, 0x64,
+	0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x32, 0x36,
+	0x26, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63,
+	0x32, 0x36, 0x36, 0x26, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x64,
+	0x63, 0x63, 0x43, 0x26, 0x63, 0x62, 0x32, 0x62, 0x32, 0x36, 0x46, 0x36, 0x62, 0x63, 0x32, 0x56,
+	0x63, 0x42, 0x46, 0x46, 0x56, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x62, 0x63, 0x64, 0x63,
+	0x64, 0x64, 0x63, 0x32, 0x62, 0x62, 0x63, 0x63, 0x23, 0x63, 0x63, 0x62, 0x23, 0x46, 0x46, 0x62,
+	0x63, 0x63, 0x62, 0x62, 0x62, 0x43, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x32, 0x62, 0x32,
+	0x32, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x26, 0x36, 0x62, 0x23, 0x63, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36, 0x32, 0x36, 0x36, 0x26, 0x36, 0x26, 0x63, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x23, 0x63, 0x62, 0x63, 0x65, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x64, 0x63, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x32, 0x36, 0x26, 0x26, 0x63,
+	0x63, 0x43, 0x36, 0x36, 0x65, 0x64, 0x23, 0x63, 0x64, 0x63, 0x32, 0x36, 0x32, 0x56, 0x36, 0x36,
+	0x36, 0x52, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x65, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32,
+	0x62, 0x62, 0x63, 0x63, 0x63, 0x62, 0x32, 0x62, 0x62, 0x63, 0x63, 0x63, 0x24, 0x23, 0x36, 0x32,
+	0x36, 0x36, 0x36, 0x26, 0x26, 0x63, 0x63, 0x63, 0x52, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63,
+	0x63, 0x62, 0x63, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36,
+	0x26, 0x63, 0x63, 0x32, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63, 0x23, 0x36, 0x36, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x26, 0x23, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x32, 0x36, 0x34,
+	0x46, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x23, 0x36, 0x26,
+	0x36, 0x36, 0x26, 0x36, 0x32, 0x26, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x62, 0x23, 0x23, 0x26,
+	0x36, 0x26, 0x26, 0x36, 0x32, 0x62, 0x63, 0x32, 0x36, 0x62, 0x62, 0x62, 0x64, 0x62, 0x63, 0x63,
+	0x62, 0x64, 0x62, 0x62, 0x32, 0x62, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x23, 0x26, 0x26, 0x36,
+	0x26, 0x26, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x23, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x63, 0x43, 0x26, 0x26, 0x26, 0x36, 0x36, 0x36,
+	0x36, 0x64, 0x32, 0x36, 0x26, 0x64, 0x23, 0x34, 0x26, 0x26, 0x53, 0x36, 0x26, 0x36, 0x26, 0x46,
+	0x36, 0x26, 0x26, 0x63, 0x23, 0x46, 0x26, 0x64, 0x64, 0x62, 0x24, 0x63, 0x62, 0x63, 0x63, 0x63,
+	0x23, 0x26, 0x36, 0x36, 0x32, 0x62, 0x32, 0x32, 0x26, 0x65, 0x23, 0x23, 0x26, 0x36, 0x65, 0x23,
+	0x56, 0x36, 0x56, 0x56, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x36, 0x36, 0x26, 0x26, 0x36, 0x26,
+	0x26, 0x36, 0x56, 0x56, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x53, 0x62, 0x63, 0x62, 0x63,
+	0x63, 0x65, 0x63, 0x63, 0x23, 0x36, 0x36, 0x64, 0x63, 0x63, 0x32, 0x65, 0x63, 0x53, 0x36, 0x36,
+	0x56, 0x56, 0x56, 0x36, 0x26, 0x63, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63, 0x65, 0x63, 0x23, 0x63,
+	0x63, 0x23, 0x36, 0x62, 0x63, 0x62, 0x63, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x32, 0x56,
+	0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x32, 0x42, 0x36, 0x46, 0x36, 0x36, 0x36,
+	0x24, 0x23, 0x63, 0x62, 0x63, 0x32, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x32, 0x26, 0x63, 0x63, 0x32, 0x26, 0x36, 0x36, 0x26, 0x26, 0x26, 0x63, 0x63, 0x63, 0x62,
+	0x63, 0x63, 0x63, 0x62, 0x64, 0x62, 0x23, 0x23, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x32, 0x36, 0x36, 0x46, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x63, 0x63,
+	0x23, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x24, 0x63, 0x43, 0x36, 0x62, 0x23, 0x23, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x43, 0x36, 0x36, 0x36, 0x62, 0x43, 0x36, 0x36, 0x36, 0x26, 0x26,
+	0x63, 0x63, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x36, 0x62, 0x62, 0x32, 0x36, 0x36, 0x46, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x36, 0x32, 0x26, 0x36, 0x36, 0x36, 0x36, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x23, 0x63, 0x63,
+	0x63, 0x62, 0x23, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63,
+	0x63, 0x62, 0x53, 0x26, 0x63, 0x63, 0x62, 0x62, 0x65, 0x24, 0x26, 0x36, 0x65, 0x65, 0x65, 0x64,
+	0x63, 0x65, 0x45, 0x26, 0x56, 0x46, 0x62, 0x62, 0x54, 0x64, 0x42, 0x62, 0x34, 0x36, 0x65, 0x43,
+	0x46, 0x36, 0x46, 0x26, 0x46, 0x46, 0x46, 0x63, 0x25, 0x26, 0x26, 0x26, 0x36, 0x36, 0x36, 0x62,
+	0x63, 0x63, 0x32, 0x56, 0x63, 0x63, 0x23, 0x56, 0x36, 0x26, 0x63, 0x53, 0x56, 0x53, 0x56, 0x56,
+	0x53, 0x62, 0x62, 0x32, 0x62, 0x62, 0x62, 0x63, 0x23, 0x23, 0x56, 0x56, 0x36, 0x36, 0x62, 0x62,
+	0x62, 0x62, 0x62, 0x24, 0x26, 0x23, 0x56, 0x26, 0x23, 0x26, 0x23, 0x24, 0x26, 0x23, 0x46, 0x43,
+	0x52, 0x62, 0x62, 0x45, 0x36, 0x36, 0x64, 0x63, 0x43, 0x36, 0x46, 0x43, 0x36, 0x26, 0x63, 0x62,
+	0x62, 0x63, 0x23, 0x36, 0x62, 0x62, 0x62, 0x63, 0x64, 0x63, 0x63, 0x32, 0x36, 0x32, 0x36, 0x64,
+	0x62, 0x32, 0x62, 0x63, 0x63, 0x23, 0x26, 0x65, 0x62, 0x64, 0x63, 0x24, 0x64, 0x62, 0x32, 0x64,
+	0x62, 0x63, 0x63, 0x42, 0x46, 0x26, 0x36, 0x26, 0x46, 0x36, 0x26, 0x63, 0x64, 0x64, 0x62, 0x63,
+	0x64, 0x63, 0x34, 0x62, 0x62, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x36, 0x26, 0x26,
+	0x46, 0x36, 0x36, 0x26, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x62, 0x63,
+	0x62, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x32, 0x36, 0x36, 0x26, 0x43,
+	0x26, 0x36, 0x26, 0x26, 0x63, 0x63, 0x25, 0x26, 0x26, 0x26, 0x26, 0x36, 0x26, 0x24, 0x26, 0x56,
+	0x62, 0x62, 0x62, 0x62, 0x63, 0x64, 0x64, 0x32, 0x64, 0x62, 0x62, 0x63, 0x62, 0x62, 0x62, 0x63,
+	0x63, 0x62, 0x64, 0x62, 0x24, 0x26, 0x63, 0x64, 0x65, 0x62, 0x63, 0x24, 0x64, 0x62, 0x62, 0x62,
+	0x62, 0x32, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x42, 0x62, 0x63, 0x63,
+	0x65, 0x65, 0x25, 0x26, 0x56, 0x26, 0x56, 0x26, 0x26, 0x56, 0x26, 0x56, 0x26, 0x36, 0x26, 0x63,
+	0x62, 0x62, 0x65, 0x62, 0x62, 0x64, 0x62, 0x62, 0x62, 0x63, 0x62, 0x62, 0x52, 0x56, 0x56, 0x26,
+	0x56, 0x46, 0x26, 0x26, 0x63, 0x62, 0x62, 0x62, 0x52, 0x26, 0x36, 0x26, 0x36, 0x26, 0x56, 0x56,
+	0x26, 0x26, 0x56, 0x36, 0x36, 0x26, 0x46, 0x26, 0x26, 0x26, 0x56, 0x36, 0x26, 0x26, 0x46, 0x62,
+	0x64, 0x62, 0x62, 0x64, 0x64, 0x62, 0x64, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x64, 0x63, 0x64,
+	0x62, 0x62, 0x64, 0x62, 0x64, 0x63, 0x62, 0x23, 0x36, 0x26, 0x26, 0x26, 0x36, 0x26, 0x26, 0x26,
+	0x36, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x63, 0x62, 0x45, 0x62, 0x65, 0x64, 0x45, 0x26, 0x64,
+	0x64, 0x62, 0x62, 0x42, 0x26, 0x56, 0x26, 0x26, 0x36, 0x62, 0x65, 0x63, 0x63, 0x52, 0x26, 0x56,
+	0x64, 0x65, 0x65, 0x64, 0x64, 0x64, 0x32, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x24, 0x46, 0x46,
+	0x65, 0x65, 0x62, 0x62, 0x64, 0x64, 0x64, 0x64, 0x64, 0x62, 0x63, 0x62, 0x52, 0x46, 0x65, 0x63,
+	0x65, 0x62, 0x62, 0x63, 0x62, 0x54, 0x56, 0x26, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56, 0x56,
+	0x56, 0x56, 0x56, 0x56, 0x56, 0x64, 0x63, 0x63, 0x43, 0x46, 0x26, 0x36, 0x26, 0x46, 0x36, 0x46,
+	0x46, 0x26, 0x46, 0x46, 0x46, 0x46, 0x46, 0x36, 0x36, 0x26, 0x36, 0x46, 0x46, 0x46, 0x26, 0x26,
+	0x46, 0x26, 0x26, 0x46, 0x46, 0x46, 0x36, 0x64, 0x64, 0x64, 0x64, 0x24, 0x26, 0x26, 0x26, 0x26,
+	0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x36,
+	0x46, 0x46, 0x46, 0x23, 0x23, 0x26, 0x26, 0x36, 0x26, 0x26, 0x36, 0x26, 0x26, 0x36, 0x36, 0x36,
+	0x36, 0x26, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x26,
+	0x63, 0x63, 0x62, 0x63, 0x32, 0x32, 0x36, 0x36, 0x36, 0x34, 0x36, 0x24, 0x23, 0x24, 0x26, 0x26,
+	0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x32, 0x32, 0x36, 0x36, 0x36,
+	0x32, 0x32, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x32, 0x36, 0x32, 0x36, 0x36, 0x32, 0x32,
+	0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32,
+	0x34, 0x32, 0x32, 0x36, 0x32, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63,
+	0x62, 0x23, 0x36, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63,
+	0x63, 0x63, 0x62, 0x45, 0x45, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36,
+	0x26, 0x26, 0x26, 0x36, 0x32, 0x36, 0x36, 0x26, 0x23, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63, 0x63, 0x65, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x36, 0x26, 0x26, 0x26, 0x26, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x35, 0x36, 0x62, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63,
+	0x62, 0x63, 0x62, 0x32, 0x36, 0x26, 0x36, 0x26, 0x36, 0x36, 0x36, 0x26, 0x26, 0x26, 0x36, 0x36,
+	0x36, 0x26, 0x36, 0x36, 0x36, 0x56, 0x36, 0x32, 0x62, 0x62, 0x62, 0x62, 0x62, 0x32, 0x26, 0x36,
+	0x36, 0x26, 0x36, 0x56, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x62, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62,
+	0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x23, 0x36, 0x26, 0x26, 0x36, 0x26, 0x36, 0x36, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x32, 0x36, 0x26, 0x63, 0x63, 0x63, 0x34,
+	0x26, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x62, 0x65, 0x63, 0x23, 0x36, 0x36, 0x36, 0x46, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x32, 0x36, 0x36, 0x36, 0x32, 0x36, 0x26, 0x26, 0x36, 0x65, 0x62, 0x62, 0x65, 0x63, 0x63,
+	0x62, 0x62, 0x23, 0x26, 0x36, 0x26, 0x36, 0x36, 0x26, 0x46, 0x26, 0x36, 0x26, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63, 0x63, 0x63,
+	0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63,
+	0x62, 0x25, 0x36, 0x36, 0x26, 0x36, 0x36, 0x62, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x23, 0x26,
+	0x36, 0x36, 0x46, 0x65, 0x62, 0x23, 0x36, 0x62, 0x62, 0x63, 0x34, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x26, 0x26, 0x56, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x43, 0x63, 0x63, 0x32, 0x36, 0x36, 0x26, 0x36,
+	0x56, 0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x32, 0x26, 0x65, 0x63, 0x63, 0x23, 0x36,
+	0x36, 0x36, 0x65, 0x62, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65,
+	0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x63, 0x25, 0x36, 0x26, 0x63, 0x23,
+	0x36, 0x36, 0x26, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x43, 0x46, 0x46, 0x36, 0x36, 0x36, 0x36,
+	0x26, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x62, 0x63, 0x65, 0x63, 0x63, 0x63, 0x63, 0x62,
+	0x63, 0x63, 0x63, 0x62, 0x63, 0x53, 0x36, 0x26, 0x64, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63, 0x63,
+	0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63, 0x62, 0x63,
+	0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62,
+	0x62, 0x63, 0x23, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x23, 0x46, 0x36, 0x26,
+	0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x65, 0x63, 0x63, 0x63, 0x63,
+	0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x62, 0x63, 0x63, 0x64, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x36, 0x36, 0x36, 0x36, 0x36, 0x32, 0x36, 0x62, 0x62, 0x62,
+	0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x23, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x23, 0x36, 0x36, 0x62, 0x63,
+	0x63, 0x63, 0x62, 0x63, 0x62, 0x62, 0x43, 0x26, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x26, 0x23,
+	0x36, 0x26, 0x36, 0x26, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x65,
+	0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x42, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x64, 0x63, 0x62, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32,
+	0x64, 0x63, 0x63, 0x65, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63,
+	0x63, 0x63, 0x62, 0x63, 0x34, 0x46, 0x46, 0x42, 0x35, 0x34, 0x36, 0x42, 0x32, 0x46, 0x23, 0x36,
+	0x36, 0x36, 0x36, 0x32, 0x26, 0x36, 0x46, 0x36, 0x36, 0x26, 0x63, 0x63, 0x63, 0x62, 0x63, 0x62,
+	0x43, 0x36, 0x46, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63,
+	0x43, 0x63, 0x63, 0x62, 0x32, 0x36, 0x36, 0x36, 0x26, 0x63, 0x64, 0x63, 0x63, 0x63, 0x23, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x62, 0x63, 0x63, 0x23, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x36, 0x36, 0x46, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x32, 0x36, 0x26, 0x36, 0x36, 0x32,
+	0x26, 0x36, 0x32, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x62, 0x63,
+	0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63,
+	0x34, 0x36, 0x46, 0x63, 0x62, 0x62, 0x63, 0x64, 0x63, 0x63, 0x64, 0x62, 0x43, 0x63, 0x63, 0x63,
+	0x63, 0x62, 0x63, 0x62, 0x62, 0x63, 0x63, 0x62, 0x62, 0x62, 0x62, 0x63, 0x62, 0x63, 0x62, 0x63,
+	0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x46, 0x63, 0x63, 0x63, 0x23, 0x26,
+	0x36, 0x36, 0x36, 0x36, 0x46, 0x46, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x46, 0x36,
+	0x36, 0x36, 0x36, 0x62, 0x32, 0x36, 0x46, 0x36, 0x26, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36, 0x26, 0x36, 0x26, 0x36, 0x26, 0x26, 0x26, 0x36, 0x36,
+	0x26, 0x36, 0x36, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x64, 0x42, 0x36, 0x36, 0x26, 0x26, 0x26,
+	0x26, 0x36, 0x26, 0x36, 0x26, 0x26, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63,
+	0x65, 0x62, 0x62, 0x32, 0x36, 0x46, 0x36, 0x26, 0x63, 0x63, 0x63, 0x63, 0x23, 0x26, 0x36, 0x36,
+	0x26, 0x63, 0x63, 0x63, 0x63, 0x35, 0x36, 0x26, 0x56, 0x26, 0x36, 0x36, 0x36, 0x36, 0x36, 0x36,
+	0x26, 0x26, 0x26, 0x36, 0x46, 0x36, 0x36, 0x26, 0x36, 0x26, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63,
+	0x62, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x62, 0x62,
+	0x62, 0x23, 0x36, 0x36, 0x26, 0x36, 0x36, 0x26, 0x36, 0x36, 0x26, 0x26, 0x36, 0x36, 0x26, 0x26,
+	0x36, 0x64, 0x63, 0x62, 0x64, 0x23, 0x26, 0x36, 0x36, 0x26, 0x26, 0x46, 0x26, 0x64, 0x62, 0x62,
+	0x63, 0x62, 0x62, 0x62, 0x63, 0x63, 0x62, 0x63, 0x63, 0x62, 0x62, 0x64, 0x42, 0x26, 0x26, 0x26,
+	0x26, 0x36, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x64, 0x62, 0x34, 0x62, 0x64, 0x62, 0x64, 0x62,
+	0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x64, 0x64, 0x62, 0x62, 0x64, 0x62, 0x64,
+	0x62, 0x62, 0x62, 0x65, 0x65, 0x62, 0x62, 0x63, 0x62, 0x62, 0x62, 0x62, 0x42, 0x26, 0x46, 0x56,
+	0x36, 0x26, 0x36, 0x26, 0x26, 0x26, 0x26, 0x26, 0x36, 0x26, 0x36, 0x26, 0x63, 0x62, 0x62, 0x64,
+	0x63, 0x62, 0x62, 0x65, 0x62, 0x63, 0x53, 0x53, 0x23, 0x23, 0x53, 0x63, 0x53, 0x53, 0x53, 0x53,
+	0x53, 0x53, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53,
+	0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x53, 0x23, 0x23, 0x23, 0x23, 0x53, 0x23,
+	0x23, 0x53, 0x53, 0x53, 0x53, 0x23, 0x23, 0x23, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x62,
+	0x53, 0x53, 0x23, 0x53, 0x56, 0x62, 0x25, 0x24, 0x25, 0x64, 0x65, 0x65, 0x65, 0x35, 0x65, 0x45,
+	0x56, 0x32, 0x62, 0x54, 0x53, 0x56, 0x56, 0x54, 0x54, 0x64, 0x65, 0x65, 0x65, 0x25, 0x56, 0x56,
+	0x32, 0x65, 0x65, 0x45, 0x65, 0x45, 0x65, 0x45, 0x65, 0x65, 0x65, 0x64, 0x63, 0x63, 0x64, 0x62,
+	0x62, 0x63, 0x63, 0x64, 0x63, 0x64, 0x62, 0x63, 0x62, 0x63, 0x64, 0x62, 0x63, 0x64, 0x63, 0x62,
+	0x62, 0x62, 0x64, 0x64, 0x64, 0x63, 0x64, 0x63, 0x62, 0x62, 0x63, 0x65, 0x65, 0x65, 0x65, 0x65,
+	0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x63, 0x64,
+	0x62, 0x63, 0x64, 0x63, 0x62, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x62, 0x62, 0x63,
+	0x63, 0x62, 0x62, 0x64, 0x62, 0x62, 0x62, 0x63, 0x64, 0x62, 0x63, 0x63, 0x63, 0x62, 0x62, 0x62,
+	0x62, 0x62, 0x64, 0x62, 0x62, 0x62, 0x62, 0x63, 0x63, 0x63, 0x63, 0x62, 0x63, 0x63, 0x63, 0x64,
+	0x62, 0x62, 0x63, 0x63, 0x64, 0x63, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64,
+	0x64, 0x64, 0x64, 0x64, 0x64, 0x54, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x24, 0x23, 0x26,
+	0x26, 0x25, 0x26, 0x26, 0x26, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x26, 0x23, 0x23, 0x26, 0x26,
+	0x26, 0x26, 0x26, 0x23, 0x23, 0x56, 0x36, 0x56, 0x36, 0x26, 0x46, 0x26, 0x46, 0x46, 0x56, 0x46,
+	0x46, 0x46, 0x46, 0x46, 0x46, 0x26, 0x26, 0x26, 0x46, 0x56, 0x26, 0x46, 0x46, 0x36, 0x56, 0x26,
+	0x56, 0x26, 0x46, 0x26, 0x36, 0x26, 0x36, 0x26, 0x26, 0x36, 0x36, 0x36, 0x26, 0x46, 0x46, 0x46,
+	0x56, 0x46, 0x36, 0x36, 0x26, 0x26, 0x26, 0x36, 0x26, 0x26, 0x36, 0x36, 0x36, 0x26, 0x26, 0x36,
+	0x36, 0x36, 0x36, 0x46, 0x26, 0x26, 0x26, 0x26, 0x36, 0x56, 0x26, 0x26, 0x46, 0x36, 0x36, 0x36,
+	0x46, 0x26, 0x46, 0x46, 0x26, 0x26, 0x36, 0x56, 0x36, 0x36, 0x56, 0x26, 0x36, 0x36, 0x36, 0x36,
+	0x26, 0x53, 0x23, 0x63, 0x23, 0x53, 0x53, 0x53, 0x53, 0x53, 0x23, 0x63, 0x53, 0x53, 0x23, 0x23,
+	0x53, 0x53, 0x53, 0x23, 0x23, 0x53, 0x23, 0x53, 0x23, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
+	0x53, 0x63, 0x63, 0x53, 0x53, 0x53, 0x53, 0x53, 0x63, 0x53, 0x53, 0x63, 0x62, 0x62, 0x32, 0x46,
+	0x26, 0x26, 0x26, 0x36, 0x26, 0x26, 0x26, 0x26, 0x46, 0x46, 0x36, 0x26, 0x36, 0x26, 0x36, 0x46,
+	0x56, 0x46, 0x36, 0x46, 0x26, 0x36, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
+	0x35, 0x36, 0x35, 0x32, 0x35, 0x32, 0x92,
+};
+
+/* reference tables, source of packed table (not compiled, used by equivalence test) */
+#ifdef DBIPV4ADDR_ASSIGNMENT_REFERENCE
 static const s_ipv4addr_assignment dbipv4addr_assignment[] = {
 	//first     , last      , registry  
 	{ 0x01000000, 0x01ffffff, REGISTRY_APNIC      }, // 1.0.0.0         - 1.255.255.255
@@ -16255,6 +17582,8 @@ static const s_ipv4addr_assignment dbipv4addr_assignment_iana[] = {
 	{ 0xff000000, 0xffffffff, REGISTRY_IANA       }, // 255.0.0.0       - 255.255.255.255
 };
 
+#endif // DBIPV4ADDR_ASSIGNMENT_REFERENCE
+
 static const s_ipv4addr_info dbipv4addr_info[] = {
 	//first     , last      , registry  
 	{ 0x99100000, 0x991000ff, "LISP#asp-xtr"                 }, // 153.16.0.0      - 153.16.0.255
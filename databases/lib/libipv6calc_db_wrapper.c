@@ -14,11 +14,16 @@
 #include <ctype.h>
 #include <errno.h>
 #include <netinet/in.h>
+#include <sys/time.h>
+#include <sys/stat.h>
+#include <signal.h>
+#include <time.h>
 
 #include "config.h"
 
 #include "libipv6calcdebug.h"
 #include "libipv6calc.h"
+#include "libipv6calcset.h"
 
 #include "ipv6calcoptions.h"
 
@@ -31,6 +36,7 @@
 #include "libipv6calc_db_wrapper_DBIP2.h"
 #include "libipv6calc_db_wrapper_External.h"
 #include "libipv6calc_db_wrapper_BuiltIn.h"
+#include "libipv6calc_db_wrapper_Merged.h"
 
 #ifdef DOMAIN
 // fallback for IP2Location.h < 8.0.0 where "DOMAIN" is defined
@@ -91,6 +97,11 @@ static int wrapper_BuiltIn_disable     = 0;
 static int wrapper_BuiltIn_status = 0;
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+static int wrapper_Merged_disable      = 0;
+static int wrapper_Merged_status = 0;
+#endif
+
 uint32_t wrapper_features = 0;
 uint32_t wrapper_features_by_source[IPV6CALC_DB_SOURCE_MAX + 1];
 uint32_t wrapper_features_by_source_implemented[IPV6CALC_DB_SOURCE_MAX + 1];
@@ -99,23 +110,205 @@ int wrapper_features_selector[IPV6CALC_DB_FEATURE_NUM_MAX + 1][IPV6CALC_DB_PRIO_
 unsigned int wrapper_source_priority_selector[IPV6CALC_DB_SOURCE_MAX + 1];
 int wrapper_source_priority_selector_by_option = -1; // -1: uninitialized, 0: initialized, > 0: touched by option
 
+/* initialization state: -1: not called, 0: deferred until first use (lazy), 1: done */
+static int wrapper_init_state = -1;
+static char wrapper_init_prefix_string[NI_MAXHOST] = "";
+
+/* reload of database files replaced on disk */
+static volatile sig_atomic_t wrapper_reload_requested = 0;
+static int    wrapper_reload_interval = 0; // seconds, 0: disabled
+static time_t wrapper_reload_last = 0;
+static int    wrapper_reopen_force = 0; // all database files are handled as changed
+
+/* number of binary searches running interleaved on batch lookups */
+static int wrapper_lookup_interleave = IPV6CALC_DB_LOOKUP_INTERLEAVE_DEFAULT;
+
+/* generation of last-used caches (thread-local), increased on reload */
+static int wrapper_cache_generation = 1;
+#define WRAPPER_CACHE_GENERATION	__atomic_load_n(&wrapper_cache_generation, __ATOMIC_SEQ_CST)
+
+/*
+ * database handle sets (slots), RCU-style reload
+ *  lookups pin the published slot, reload fills the spare slot and publishes it,
+ *  the previous slot is released by the last reader leaving it
+ */
+static int wrapper_slot_published = 0;
+static int wrapper_slot_readers[2] = { 0, 0 };
+static int wrapper_slot_retired = -1;  // -1: none, 0/1: waiting for last reader, 2: release running
+static int wrapper_slot_reload_running = 0;
+static __thread int wrapper_slot_pinned = -1;
+static __thread int wrapper_slot_pinned_depth = 0;
+
+/* initialization cost per source in microseconds (-1: not initialized) */
+static long int wrapper_init_usec[IPV6CALC_DB_SOURCE_MAX + 1];
+#ifdef SUPPORT_MMDB
+static long int wrapper_init_usec_MMDB = -1;
+#endif
+
+/* run deferred initialization on first use */
+#define LIBIPV6CALC_DB_WRAPPER_INIT_CHECK	if (wrapper_init_state == 0) { libipv6calc_db_wrapper_init_deferred(); };
+
+static int libipv6calc_db_wrapper_init_backends(const char *prefix_string);
+static int libipv6calc_db_wrapper_get_feature_index_by_feature(const uint32_t feature);
+
+
+/*
+ * function returns microseconds since given start
+ */
+static long int libipv6calc_db_wrapper_usec_since(const struct timeval *tv_start) {
+	struct timeval tv_now;
+
+	gettimeofday(&tv_now, NULL);
+
+	return((tv_now.tv_sec - tv_start->tv_sec) * 1000000L + (tv_now.tv_usec - tv_start->tv_usec));
+};
+
+
+/*
+ * function initialise the main wrapper, but defer the backends until first use
+ *
+ * in : prefix_string (used on messages printed during initialization)
+ * out: 0=ok
+ */
+int libipv6calc_db_wrapper_init_lazy(const char *prefix_string) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_init_state == 1) {
+		// already initialized
+		return(0);
+	};
+
+	snprintf(wrapper_init_prefix_string, sizeof(wrapper_init_prefix_string), "%s", prefix_string);
+	wrapper_init_state = 0;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Initialization deferred until first use");
+
+	return(0);
+};
+
+
+/*
+ * function run deferred initialization, exit on error like callers of init would do
+ */
+static void libipv6calc_db_wrapper_init_deferred(void) {
+	int result;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called (first use)");
+
+	result = libipv6calc_db_wrapper_init_backends(wrapper_init_prefix_string);
+
+	if (result != 0) {
+		ERRORPRINT_NA("database wrapper initialization failed");
+		exit(EXIT_FAILURE);
+	};
+};
+
+
 
 /*
  * function initialise the main wrapper
  *
- * in : (nothing)
+ * in : prefix_string (used on messages printed during initialization)
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_init(const char *prefix_string) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_init_state == 1) {
+		// already initialized
+		return(0);
+	};
+
+	return(libipv6calc_db_wrapper_init_backends(prefix_string));
+};
+
+
+#ifdef SUPPORT_DB_MERGED
+/*
+ * function checks whether a source is contained in the Merged database for a feature
+ *
+ * in : f = feature number, source
+ * out: 1=contained, 0=not contained
+ */
+static int libipv6calc_db_wrapper_Merged_contains_source(const int f, const int source) {
+	uint32_t sources = libipv6calc_db_wrapper_Merged_feature_sources(f);
+	int i;
+
+	for (i = 0; i < MERGED_DB_FEATURE_SOURCES_MAX; i++) {
+		if ((int) MERGED_DB_FEATURE_SOURCE(sources, i) == source) {
+			return(1);
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * function checks whether the sources of a feature in the Merged database were
+ *  prioritized in the same order as by the current database priorities
+ *  and no other available source is prioritized in between
+ *
+ * in : f = feature number
+ * out: 1=same order, 0=different order or feature not contained
+ */
+static int libipv6calc_db_wrapper_Merged_priority_match(const int f) {
+	uint32_t sources = libipv6calc_db_wrapper_Merged_feature_sources(f);
+	int sp, s, i = 0, count = 0;
+
+	if (sources == 0) {
+		return(0);
+	};
+
+	while ((count < MERGED_DB_FEATURE_SOURCES_MAX) && (MERGED_DB_FEATURE_SOURCE(sources, count) != 0)) {
+		count++;
+	};
+
+	for (sp = IPV6CALC_DB_SOURCE_MIN; sp <= IPV6CALC_DB_SOURCE_MAX; sp++) {
+		s = wrapper_source_priority_selector[sp];
+
+		if (libipv6calc_db_wrapper_Merged_contains_source(f, s) == 0) {
+			if ((i < count) && (s != IPV6CALC_DB_SOURCE_MERGED) && ((wrapper_features_by_source[s] & (1 << f)) != 0)) {
+				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Merged sources of feature f=%d superseeded by source s=%d", f, s);
+				return(0);
+			};
+			continue;
+		};
+
+		if ((int) MERGED_DB_FEATURE_SOURCE(sources, i) != s) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Merged sources of feature f=%d prioritized differently: 0x%08x", f, sources);
+			return(0);
+		};
+		i++;
+	};
+
+	return(1);
+};
+#endif // SUPPORT_DB_MERGED
+
+
+/*
+ * function initialise all backends and select sources for features
+ *
+ * in : prefix_string
+ * out: 0=ok, 1=error
+ */
+static int libipv6calc_db_wrapper_init_backends(const char *prefix_string) {
 	int result = 0, f, p, s, j;
+	struct timeval tv_start;
 
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2
 	int r;
-#endif
+
 	s = strlen(prefix_string); // make compiler happy (avoid unused "...")
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	wrapper_init_state = 1;
+
+	for (s = 0; s <= IPV6CALC_DB_SOURCE_MAX; s++) {
+		wrapper_init_usec[s] = -1;
+	};
+
 	// clear feature selector
 	for (f = IPV6CALC_DB_FEATURE_NUM_MIN; f <= IPV6CALC_DB_FEATURE_NUM_MAX; f++) {
 		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
@@ -137,9 +330,10 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 
 	// initialize priority
 	if (wrapper_source_priority_selector_by_option == 0) {
-		// default
-		for (s = IPV6CALC_DB_SOURCE_MIN; s <= IPV6CALC_DB_SOURCE_MAX; s++) {
-			wrapper_source_priority_selector[s] = s;
+		// default, Merged in front as it is superseeding the sources it was created from
+		wrapper_source_priority_selector[IPV6CALC_DB_SOURCE_MIN] = IPV6CALC_DB_SOURCE_MERGED;
+		for (s = IPV6CALC_DB_SOURCE_MIN + 1; s <= IPV6CALC_DB_SOURCE_MAX; s++) {
+			wrapper_source_priority_selector[s] = s - 1;
 		};
 	} else {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database priorization already given by option, fill missing ones: %d", wrapper_source_priority_selector_by_option);
@@ -163,7 +357,15 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 			if (s > wrapper_source_priority_selector_by_option) {
 				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database priorization/source missing, add: %s", data_sources[j].shortname);
 				wrapper_source_priority_selector_by_option++;
-				wrapper_source_priority_selector[wrapper_source_priority_selector_by_option] = data_sources[j].number;
+				if (data_sources[j].number == IPV6CALC_DB_SOURCE_MERGED) {
+					// in front like by default, only used for features created with the same priority of the sources
+					for (s = wrapper_source_priority_selector_by_option; s > IPV6CALC_DB_SOURCE_MIN; s--) {
+						wrapper_source_priority_selector[s] = wrapper_source_priority_selector[s - 1];
+					};
+					wrapper_source_priority_selector[IPV6CALC_DB_SOURCE_MIN] = data_sources[j].number;
+				} else {
+					wrapper_source_priority_selector[wrapper_source_priority_selector_by_option] = data_sources[j].number;
+				};
 			};
 		};
 	};
@@ -174,7 +376,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 
 #ifdef SUPPORT_MMDB
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_MMDB_wrapper_init");
+	gettimeofday(&tv_start, NULL);
 	r = libipv6calc_db_wrapper_MMDB_wrapper_init();
+	wrapper_init_usec_MMDB = libipv6calc_db_wrapper_usec_since(&tv_start);
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "MMDB_wrapper_init result: %d", r);
 	if (r != 0) {
 #ifndef SUPPORT_MMDB_DYN
@@ -204,7 +408,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call GeoIP wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_GeoIP_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_GeoIP_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_GEOIP] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "GeoIP_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -226,7 +432,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call GeoIP2 wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_GeoIP2_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_GeoIP2_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_GEOIP2] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "GeoIP2_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -256,7 +464,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call IP2Location wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_IP2Location_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_IP2Location_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_IP2LOCATION] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "IP2Location_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -278,7 +488,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call DBIP wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_DBIP_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_DBIP_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_DBIP] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "DBIP_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -297,7 +509,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call DBIP2 wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_DBIP2_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_DBIP2_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_DBIP2] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "DBIP2_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -327,7 +541,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call External wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_External_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_External_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_EXTERNAL] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "External_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -346,7 +562,9 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		// Call BuiltIn wrapper
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_BuiltIn_wrapper_init");
 
+		gettimeofday(&tv_start, NULL);
 		r = libipv6calc_db_wrapper_BuiltIn_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_BUILTIN] = libipv6calc_db_wrapper_usec_since(&tv_start);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "BuiltIn_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
 
@@ -358,7 +576,30 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 	};
 #endif // SUPPORT_BUILTIN
 
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_disable == 0) {
+		// Call Merged wrapper
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call libipv6calc_db_wrapper_Merged_wrapper_init");
+
+		gettimeofday(&tv_start, NULL);
+		r = libipv6calc_db_wrapper_Merged_wrapper_init();
+		wrapper_init_usec[IPV6CALC_DB_SOURCE_MERGED] = libipv6calc_db_wrapper_usec_since(&tv_start);
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Merged_wrapper_init result: %d wrapper_features=0x%08x", r, wrapper_features);
+
+		if (r != 0) {
+			result = 1;
+		} else {
+			wrapper_Merged_status = 1; // ok
+		};
+	} else {
+		NONQUIETPRINT_WA("%sSupport for Merged disabled by option", prefix_string);
+	};
+#endif // SUPPORT_DB_MERGED
+
 	// select source for feature by standard priority (from last to first in list)
+	//  Merged is only selected if it was created with the same priority of its sources
+	//  and superseeds only the sources it was created from
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "select source for feature by standard priority");
 	// run through feature numbers
 	for (f = IPV6CALC_DB_FEATURE_NUM_MIN; f <= IPV6CALC_DB_FEATURE_NUM_MAX; f++) {
@@ -368,9 +609,24 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
 		for (sp = IPV6CALC_DB_SOURCE_MIN; sp <= IPV6CALC_DB_SOURCE_MAX; sp++) {
 			s = wrapper_source_priority_selector[sp];
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "check feature by source f=%d s=%d sp=%d", f, s, sp);
+#ifdef SUPPORT_DB_MERGED
+			if ((s == IPV6CALC_DB_SOURCE_MERGED) && ((wrapper_features_by_source[s] & (1 << f)) != 0) && (libipv6calc_db_wrapper_Merged_priority_match(f) == 0)) {
+				NONQUIETPRINT_WA("%sMerged database not used for %s (created with different database priorization)", prefix_string, ipv6calc_db_features[libipv6calc_db_wrapper_get_feature_index_by_feature(1 << f)].token);
+				continue;
+			};
+#endif
+
 			if ((wrapper_features_by_source[s] & (1 << f)) != 0) {
 				// supported, run through prio array
 				for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+#ifdef SUPPORT_DB_MERGED
+					if ((wrapper_features_selector[f][p] == IPV6CALC_DB_SOURCE_MERGED) && (libipv6calc_db_wrapper_Merged_contains_source(f, s) == 1)) {
+						// Merged contains already the result of this source, no subsequent calls
+						DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "skip feature with source f=%d s=%d p=%d (Merged already selected)", f, s, p);
+						break;
+					};
+#endif
+
 					if (wrapper_features_selector[f][p] == 0) {
 						DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "select feature with source f=%d s=%d p=%d", f, s, p);
 						wrapper_features_selector[f][p] = s;
@@ -464,13 +720,15 @@ int libipv6calc_db_wrapper_init(const char *prefix_string) {
  */
 int libipv6calc_db_wrapper_cleanup(void) {
 	int result = 0;
-
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2
 	int r;
-#endif
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
+	if (wrapper_init_state != 1) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Never initialized, nothing to cleanup");
+		return(result);
+	};
+
 #ifdef SUPPORT_GEOIP
 	if (wrapper_GeoIP_disable == 0) {
 		// Call GeoIP wrapper
@@ -541,143 +799,594 @@ int libipv6calc_db_wrapper_cleanup(void) {
 	};
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_disable == 0) {
+		// Call Merged wrapper
+		r = libipv6calc_db_wrapper_Merged_wrapper_cleanup();
+		if (r != 0) {
+			result = 1;
+		};
+	};
+#endif
+
 	return(result);
 };
 
 
-/* function get info strings */
-void libipv6calc_db_wrapper_info(char *string, const size_t size) {
-	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+/*
+ * return slot of database handles to be used by the calling thread
+ *  pinned one while inside a read lock or a reload, published one otherwise
+ *
+ * out: slot (0/1)
+ */
+int libipv6calc_db_wrapper_slot(void) {
+	if (wrapper_slot_pinned >= 0) {
+		return(wrapper_slot_pinned);
+	};
 
-#ifdef SUPPORT_GEOIP
-	if (wrapper_GeoIP_disable == 0) {
-		// Call GeoIP wrapper
-		libipv6calc_db_wrapper_GeoIP_wrapper_info(string, size);
+	return(__atomic_load_n(&wrapper_slot_published, __ATOMIC_SEQ_CST));
+};
+
+
+/*
+ * release handles of a retired slot in case no reader is left
+ *  handles shared with the published slot are kept open
+ *
+ * in : slot
+ */
+static void libipv6calc_db_wrapper_slot_release(const int slot) {
+	int expected = slot;
+
+	if (__atomic_load_n(&wrapper_slot_readers[slot], __ATOMIC_SEQ_CST) != 0) {
+		return;
 	};
-#endif
+
+	// only one caller wins
+	if (__atomic_compare_exchange_n(&wrapper_slot_retired, &expected, 2, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == 0) {
+		return;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Release database handles of slot: %d", slot);
 
 #ifdef SUPPORT_GEOIP2
-	if (wrapper_GeoIP2_disable == 0) {
-		// Call GeoIP2 wrapper
-		libipv6calc_db_wrapper_GeoIP2_wrapper_info(string, size);
+	if (wrapper_GeoIP2_status == 1) {
+		libipv6calc_db_wrapper_GeoIP2_wrapper_release(slot);
 	};
 #endif
 
 #ifdef SUPPORT_IP2LOCATION
-	if (wrapper_IP2Location_disable == 0) {
-		// Call IP2Location wrapper
-		libipv6calc_db_wrapper_IP2Location_wrapper_info(string, size);
+	if (wrapper_IP2Location_status == 1) {
+		libipv6calc_db_wrapper_IP2Location_wrapper_release(slot);
 	};
 #endif
 
 #ifdef SUPPORT_DBIP
-	if (wrapper_DBIP_disable == 0) {
-		// Call DBIP wrapper
-		libipv6calc_db_wrapper_DBIP_wrapper_info(string, size);
+	if (wrapper_DBIP_status == 1) {
+		libipv6calc_db_wrapper_DBIP_wrapper_release(slot);
 	};
 #endif
 
 #ifdef SUPPORT_DBIP2
-	if (wrapper_DBIP2_disable == 0) {
-		// Call DBIP2 wrapper
-		libipv6calc_db_wrapper_DBIP2_wrapper_info(string, size);
+	if (wrapper_DBIP2_status == 1) {
+		libipv6calc_db_wrapper_DBIP2_wrapper_release(slot);
 	};
 #endif
 
 #ifdef SUPPORT_EXTERNAL
-	if (wrapper_External_disable == 0) {
-		// Call BuiltIn wrapper
-		libipv6calc_db_wrapper_External_wrapper_info(string, size);
+	if (wrapper_External_status == 1) {
+		libipv6calc_db_wrapper_External_wrapper_release(slot);
 	};
 #endif
 
-#ifdef SUPPORT_BUILTIN
-	if (wrapper_BuiltIn_disable == 0) {
-		// Call BuiltIn wrapper
-		libipv6calc_db_wrapper_BuiltIn_wrapper_info(string, size);
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_status == 1) {
+		libipv6calc_db_wrapper_Merged_wrapper_release(slot);
 	};
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: %s", string);
-
-	return;
+	__atomic_store_n(&wrapper_slot_retired, -1, __ATOMIC_SEQ_CST);
 };
 
 
-/* function get feature string */
-void libipv6calc_db_wrapper_features(char *string, const size_t size) {
-	int i;
-	char tempstring[NI_MAXHOST];
-	char *separator;
+/*
+ * pin the published slot of database handles for the calling thread
+ *  handles of the slot are not closed by a concurrent reload until unlocked,
+ *  calls can be nested
+ */
+void libipv6calc_db_wrapper_read_lock(void) {
+	int slot;
 
-	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+	if (wrapper_slot_pinned_depth++ > 0) {
+		return;
+	};
 
-	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
-		if (wrapper_features & ipv6calc_db_features[i].number) {
-			if (strlen(string) == 0) {
-				separator = "";
-			} else {
-				separator = " ";
-			};
-			snprintf(tempstring, sizeof(tempstring), "%s%s%s", string, separator, ipv6calc_db_features[i].token);
-			snprintf(string, size, "%s", tempstring);
+	while (1) {
+		slot = __atomic_load_n(&wrapper_slot_published, __ATOMIC_SEQ_CST);
+		__atomic_add_fetch(&wrapper_slot_readers[slot], 1, __ATOMIC_SEQ_CST);
+
+		if (__atomic_load_n(&wrapper_slot_published, __ATOMIC_SEQ_CST) == slot) {
+			break;
+		};
+
+		// reload published meanwhile, leave retired slot and retry
+		if ((__atomic_sub_fetch(&wrapper_slot_readers[slot], 1, __ATOMIC_SEQ_CST) == 0) && (__atomic_load_n(&wrapper_slot_retired, __ATOMIC_SEQ_CST) == slot)) {
+			libipv6calc_db_wrapper_slot_release(slot);
 		};
 	};
 
-	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Return");
+	wrapper_slot_pinned = slot;
+};
 
-	return;
+
+/*
+ * unpin slot of database handles, last reader of a retired slot releases it
+ */
+void libipv6calc_db_wrapper_read_unlock(void) {
+	int slot = wrapper_slot_pinned;
+
+	if (wrapper_slot_pinned_depth <= 0) {
+		ERRORPRINT_NA("read unlock without read lock (FIX CODE)");
+		exit(EXIT_FAILURE);
+	};
+
+	if (--wrapper_slot_pinned_depth > 0) {
+		return;
+	};
+
+	wrapper_slot_pinned = -1;
+
+	if ((__atomic_sub_fetch(&wrapper_slot_readers[slot], 1, __ATOMIC_SEQ_CST) == 0) && (__atomic_load_n(&wrapper_slot_retired, __ATOMIC_SEQ_CST) == slot)) {
+		libipv6calc_db_wrapper_slot_release(slot);
+	};
 };
 
 
-/* function get capability string */
-void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
-#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2
-	char tempstring[NI_MAXHOST];
-#endif
+/*
+ * reload (or reopen) database files into the spare slot and publish it
+ *  the published slot stays untouched, lookups running concurrently continue
+ *  with it until they unlock, the last one releases it
+ *
+ * in : reopen (1: reopen all database files accessed by file offset or library handle)
+ * out: number of reloaded database files, -1: busy (previous slot still in use)
+ */
+static int libipv6calc_db_wrapper_reload_slot(const int reopen) {
+	int result = 0;
+	int slot_old, slot_new;
 
-	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+	if (wrapper_slot_pinned_depth > 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called inside read lock, postpone");
+		return(-1);
+	};
 
-#ifdef SUPPORT_GEOIP
-	if (wrapper_GeoIP_disable == 0) {
-#ifdef SUPPORT_GEOIP_DYN
-		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(dyn-load)", string, strlen(string) > 0 ? " " : "");
-#else // SUPPORT_GEOIP_DYN
-#ifdef SUPPORT_GEOIP_STATIC
-		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(static)", string, strlen(string) > 0 ? " " : "");
-#else // SUPPORT_GEOIP_STATIC
-		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(linked)", string, strlen(string) > 0 ? " " : "");
-#endif // SUPPORT_GEOIP_STATIC
-#endif // SUPPORT_GEOIP_DYN
-		snprintf(string, size, "%s", tempstring);
+	if (__atomic_exchange_n(&wrapper_slot_reload_running, 1, __ATOMIC_SEQ_CST) != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Reload already running, postpone");
+		return(-1);
+	};
+
+	if (__atomic_load_n(&wrapper_slot_retired, __ATOMIC_SEQ_CST) != -1) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Previous slot still in use, postpone");
+		__atomic_store_n(&wrapper_slot_reload_running, 0, __ATOMIC_SEQ_CST);
+		return(-1);
 	};
-#endif // SUPPORT_GEOIP
+
+	slot_old = __atomic_load_n(&wrapper_slot_published, __ATOMIC_SEQ_CST);
+	slot_new = 1 - slot_old;
+
+	// backends copy the handles of the old slot and replace changed ones in the pinned spare slot
+	wrapper_slot_pinned = slot_new;
+	wrapper_reopen_force = reopen;
 
 #ifdef SUPPORT_GEOIP2
-	if (wrapper_GeoIP2_disable == 0) {
-#ifdef SUPPORT_MMDB_DYN
-		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP2(dyn-load/MaxMindDB)", string, strlen(string) > 0 ? " " : "");
-#else
-		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP2(linked/MaxMindDB)", string, strlen(string) > 0 ? " " : "");
-#endif // SUPPORT_MMDB_DYN
-		snprintf(string, size, "%s", tempstring);
+	if ((reopen == 0) && (wrapper_GeoIP2_status == 1)) {
+		result += libipv6calc_db_wrapper_GeoIP2_wrapper_reload(slot_old);
 	};
-#endif // SUPPORT_GEOIP2
+#endif
 
 #ifdef SUPPORT_IP2LOCATION
-	if (wrapper_IP2Location_disable == 0) {
-#ifdef SUPPORT_IP2LOCATION_DYN
-		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(dyn-load)", string, strlen(string) > 0 ? " " : "");
-#else // SUPPORT_IP2LOCATION_DYN
-#ifdef SUPPORT_IP2LOCATION_STATIC
-		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(static)", string, strlen(string) > 0 ? " " : "");
-#else // SUPPORT_IP2LOCATION_STATIC
-		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(linked)", string, strlen(string) > 0 ? " " : "");
-#endif // SUPPORT_IP2LOCATION_STATIC
-#endif //SUPPORT_IP2LOCATION_DYN
-		snprintf(string, size, "%s", tempstring);
+	if (wrapper_IP2Location_status == 1) {
+		result += libipv6calc_db_wrapper_IP2Location_wrapper_reload(slot_old);
 	};
-#endif // SUPPORT_IP2LOCATION
+#endif
+
+#ifdef SUPPORT_DBIP
+	if (wrapper_DBIP_status == 1) {
+		result += libipv6calc_db_wrapper_DBIP_wrapper_reload(slot_old);
+	};
+#endif
+
+#ifdef SUPPORT_DBIP2
+	if ((reopen == 0) && (wrapper_DBIP2_status == 1)) {
+		result += libipv6calc_db_wrapper_DBIP2_wrapper_reload(slot_old);
+	};
+#endif
+
+#ifdef SUPPORT_EXTERNAL
+	if (wrapper_External_status == 1) {
+		result += libipv6calc_db_wrapper_External_wrapper_reload(slot_old);
+	};
+#endif
+
+#ifdef SUPPORT_DB_MERGED
+	if ((reopen == 0) && (wrapper_Merged_status == 1)) {
+		result += libipv6calc_db_wrapper_Merged_wrapper_reload(slot_old);
+	};
+#endif
+
+	wrapper_reopen_force = 0;
+	wrapper_slot_pinned = -1;
+
+	if (result > 0) {
+		// publish new slot, then retire old one
+		__atomic_store_n(&wrapper_slot_published, slot_new, __ATOMIC_SEQ_CST);
+		__atomic_store_n(&wrapper_slot_retired, slot_old, __ATOMIC_SEQ_CST);
+
+		// invalidate last-used caches
+		__atomic_add_fetch(&wrapper_cache_generation, 1, __ATOMIC_SEQ_CST);
+
+		libipv6calc_db_wrapper_slot_release(slot_old);
+	};
+
+	__atomic_store_n(&wrapper_slot_reload_running, 0, __ATOMIC_SEQ_CST);
+
+	return(result);
+};
+
+
+/*
+ * reload database files replaced on disk
+ *  new file is opened first, the handle in use is only replaced on success,
+ *  old handles are closed after the last lookup using them has finished
+ *
+ * in : (nothing)
+ * out: number of reloaded database files
+ */
+int libipv6calc_db_wrapper_reload(void) {
+	int result = 0;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_init_state != 1) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Not initialized, nothing to reload");
+		return(result);
+	};
+
+	result = libipv6calc_db_wrapper_reload_slot(0);
+
+	if (result < 0) {
+		// busy, retry on next check
+		wrapper_reload_requested = 1;
+		return(0);
+	};
+
+	if (result > 0) {
+		NONQUIETPRINT_WA("Reloaded database files: %d", result);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Finished, reloaded: %d", result);
+	return(result);
+};
+
+
+/*
+ * check for requested (signal) or scheduled (interval) reload
+ *  has to be called outside of a read lock, e.g. per input line or request
+ *
+ * in : (nothing)
+ * out: number of reloaded database files
+ */
+int libipv6calc_db_wrapper_reload_check(void) {
+	time_t now, last;
+
+	if (wrapper_reload_requested == 0) {
+		if (wrapper_reload_interval <= 0) {
+			return(0);
+		};
+
+		now = time(NULL);
+		last = __atomic_load_n(&wrapper_reload_last, __ATOMIC_SEQ_CST);
+
+		if (last == 0) {
+			__atomic_compare_exchange_n(&wrapper_reload_last, &last, now, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+			return(0);
+		};
+
+		if ((now - last) < wrapper_reload_interval) {
+			return(0);
+		};
+
+		// only one of concurrent callers takes over the interval
+		if (__atomic_compare_exchange_n(&wrapper_reload_last, &last, now, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) == 0) {
+			return(0);
+		};
+	} else {
+		__atomic_store_n(&wrapper_reload_last, time(NULL), __ATOMIC_SEQ_CST);
+	};
+
+	wrapper_reload_requested = 0;
+
+	return(libipv6calc_db_wrapper_reload());
+};
+
+
+/*
+ * request reload on next check (async-signal-safe)
+ */
+void libipv6calc_db_wrapper_reload_request(void) {
+	wrapper_reload_requested = 1;
+};
+
+
+/*
+ * signal handler requesting reload
+ */
+static void libipv6calc_db_wrapper_reload_signal_handler(int signum) {
+	if (signum == 0) { }; // make compiler happy (avoid unused "...")
+	wrapper_reload_requested = 1;
+};
+
+
+/*
+ * request reload on given signal (e.g. SIGHUP)
+ *  handler is installed with SA_RESTART, reads of input are not interrupted,
+ *  reload happens on next check
+ *
+ * in : signum
+ * out: 0=ok, -1=error
+ */
+int libipv6calc_db_wrapper_reload_on_signal(const int signum) {
+	struct sigaction sa;
+
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = libipv6calc_db_wrapper_reload_signal_handler;
+	sa.sa_flags = SA_RESTART;
+	sigemptyset(&sa.sa_mask);
+
+	return(sigaction(signum, &sa, NULL));
+};
+
+
+/*
+ * return whether scheduled reload is enabled
+ *
+ * out: 1=enabled
+ */
+int libipv6calc_db_wrapper_reload_enabled(void) {
+	return((wrapper_reload_interval > 0) ? 1 : 0);
+};
+
+
+/*
+ * reopen database files accessed by file offset or library handle
+ *  required in forked children running lookups concurrently, they would
+ *  share file offsets and handles with each other otherwise,
+ *  memory-mapped databases (BuiltIn, Merged, MaxMindDB) stay shared
+ *
+ * in : (nothing)
+ * out: number of reopened database files
+ */
+int libipv6calc_db_wrapper_reopen(void) {
+	int result = 0;
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	if (wrapper_init_state != 1) {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Not initialized, nothing to reopen");
+		return(result);
+	};
+
+	result = libipv6calc_db_wrapper_reload_slot(1);
+
+	if (result < 0) {
+		ERRORPRINT_NA("Reopen of database files not possible while lookups are running");
+		return(0);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Finished, reopened: %d", result);
+	return(result);
+};
+
+
+/*
+ * retrieve identity of a database file
+ *
+ * in : filename
+ * mod: stampp (valid=0 in case of problems)
+ */
+void libipv6calc_db_wrapper_file_stamp_get(const char *filename, s_ipv6calc_db_file_stamp *stampp) {
+	struct stat st;
+
+	memset(stampp, 0, sizeof(*stampp));
+
+	if ((filename == NULL) || (stat(filename, &st) != 0)) {
+		return;
+	};
+
+	stampp->dev   = (uint64_t) st.st_dev;
+	stampp->ino   = (uint64_t) st.st_ino;
+	stampp->mtime = (int64_t) st.st_mtime;
+	stampp->size  = (int64_t) st.st_size;
+	stampp->valid = 1;
+};
+
+
+/*
+ * check whether a database file was replaced or modified on disk
+ *  a currently missing file is not reported as changed (e.g. during update)
+ *
+ * in : filename, stampp (taken on open)
+ * out: 1=changed, 0=unchanged
+ */
+int libipv6calc_db_wrapper_file_stamp_changed(const char *filename, const s_ipv6calc_db_file_stamp *stampp) {
+	s_ipv6calc_db_file_stamp stamp;
+
+	libipv6calc_db_wrapper_file_stamp_get(filename, &stamp);
+
+	if (stamp.valid != 1) {
+		return(0);
+	};
+
+	if (wrapper_reopen_force == 1) {
+		return(1);
+	};
+
+	if ((stampp->valid != 1)
+	    || (stamp.dev != stampp->dev)
+	    || (stamp.ino != stampp->ino)
+	    || (stamp.mtime != stampp->mtime)
+	    || (stamp.size != stampp->size)
+	) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database file changed: %s", filename);
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/* function get info strings */
+void libipv6calc_db_wrapper_info(char *string, const size_t size) {
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+#ifdef SUPPORT_GEOIP
+	if (wrapper_GeoIP_disable == 0) {
+		// Call GeoIP wrapper
+		libipv6calc_db_wrapper_GeoIP_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_GEOIP2
+	if (wrapper_GeoIP2_disable == 0) {
+		// Call GeoIP2 wrapper
+		libipv6calc_db_wrapper_GeoIP2_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_IP2LOCATION
+	if (wrapper_IP2Location_disable == 0) {
+		// Call IP2Location wrapper
+		libipv6calc_db_wrapper_IP2Location_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_DBIP
+	if (wrapper_DBIP_disable == 0) {
+		// Call DBIP wrapper
+		libipv6calc_db_wrapper_DBIP_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_DBIP2
+	if (wrapper_DBIP2_disable == 0) {
+		// Call DBIP2 wrapper
+		libipv6calc_db_wrapper_DBIP2_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_EXTERNAL
+	if (wrapper_External_disable == 0) {
+		// Call BuiltIn wrapper
+		libipv6calc_db_wrapper_External_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_BUILTIN
+	if (wrapper_BuiltIn_disable == 0) {
+		// Call BuiltIn wrapper
+		libipv6calc_db_wrapper_BuiltIn_wrapper_info(string, size);
+	};
+#endif
+
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_disable == 0) {
+		// Call Merged wrapper
+		libipv6calc_db_wrapper_Merged_wrapper_info(string, size);
+	};
+#endif
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: %s", string);
+
+	return;
+};
+
+
+/* function get feature string */
+void libipv6calc_db_wrapper_features(char *string, const size_t size) {
+	int i;
+	char tempstring[NI_MAXHOST];
+	char *separator;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
+		if (wrapper_features & ipv6calc_db_features[i].number) {
+			if (strlen(string) == 0) {
+				separator = "";
+			} else {
+				separator = " ";
+			};
+			snprintf(tempstring, sizeof(tempstring), "%s%s%s", string, separator, ipv6calc_db_features[i].token);
+			snprintf(string, size, "%s", tempstring);
+		};
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Return");
+
+	return;
+};
+
+
+/* function get capability string */
+void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
+	char tempstring[NI_MAXHOST];
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
+
+#ifdef SUPPORT_GEOIP
+	if (wrapper_GeoIP_disable == 0) {
+#ifdef SUPPORT_GEOIP_DYN
+		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(dyn-load)", string, strlen(string) > 0 ? " " : "");
+#else // SUPPORT_GEOIP_DYN
+#ifdef SUPPORT_GEOIP_STATIC
+		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(static)", string, strlen(string) > 0 ? " " : "");
+#else // SUPPORT_GEOIP_STATIC
+		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP(linked)", string, strlen(string) > 0 ? " " : "");
+#endif // SUPPORT_GEOIP_STATIC
+#endif // SUPPORT_GEOIP_DYN
+		snprintf(string, size, "%s", tempstring);
+	};
+#endif // SUPPORT_GEOIP
+
+#ifdef SUPPORT_GEOIP2
+	if (wrapper_GeoIP2_disable == 0) {
+#ifdef SUPPORT_MMDB_DYN
+		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP2(dyn-load/MaxMindDB)", string, strlen(string) > 0 ? " " : "");
+#else
+		snprintf(tempstring, sizeof(tempstring), "%s%sGeoIP2(linked/MaxMindDB)", string, strlen(string) > 0 ? " " : "");
+#endif // SUPPORT_MMDB_DYN
+		snprintf(string, size, "%s", tempstring);
+	};
+#endif // SUPPORT_GEOIP2
+
+#ifdef SUPPORT_IP2LOCATION
+	if (wrapper_IP2Location_disable == 0) {
+#ifdef SUPPORT_IP2LOCATION_DYN
+		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(dyn-load)", string, strlen(string) > 0 ? " " : "");
+#else // SUPPORT_IP2LOCATION_DYN
+#ifdef SUPPORT_IP2LOCATION_STATIC
+		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(static)", string, strlen(string) > 0 ? " " : "");
+#else // SUPPORT_IP2LOCATION_STATIC
+		snprintf(tempstring, sizeof(tempstring), "%s%sIP2Location(linked)", string, strlen(string) > 0 ? " " : "");
+#endif // SUPPORT_IP2LOCATION_STATIC
+#endif //SUPPORT_IP2LOCATION_DYN
+		snprintf(string, size, "%s", tempstring);
+	};
+#endif // SUPPORT_IP2LOCATION
 
 #ifdef SUPPORT_DBIP
 	if (wrapper_DBIP_disable == 0) {
@@ -728,6 +1437,13 @@ void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
 	};
 #endif // SUPPORT_BUILTIN
 
+#ifdef SUPPORT_DB_MERGED
+	if ((wrapper_Merged_status == 1) && (wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] != 0)) {
+		snprintf(tempstring, sizeof(tempstring), "%s%sMerged database", string, strlen(string) > 0 ? " " : "");
+		snprintf(string, size, "%s", tempstring);
+	};
+#endif
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Return");
 
 	return;
@@ -737,6 +1453,8 @@ void libipv6calc_db_wrapper_capabilities(char *string, const size_t size) {
 void libipv6calc_db_wrapper_print_features_verbose(const int level_verbose) {
 	char string[NI_MAXHOST] = "";
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 #ifdef SUPPORT_MMDB
 #ifdef MMDB_INCLUDE_VERSION
 	fprintf(stderr, "MaxMindDB for GeoIP2/DBIP2 support enabled, compiled with include file version: %s\n", MMDB_INCLUDE_VERSION);
@@ -878,10 +1596,44 @@ void libipv6calc_db_wrapper_print_features_verbose(const int level_verbose) {
 	fprintf(stderr, "BuiltIn database support not compiled-in\n\n");
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_disable == 0) {
+		libipv6calc_db_wrapper_Merged_wrapper_info(string, sizeof(string));
+		fprintf(stderr, "%s\n\n", string);
+	} else {
+		fprintf(stderr, "Merged database support disabled by option\n\n");
+	};
+#endif
+
+	libipv6calc_db_wrapper_print_init_cost();
+
 	libipv6calc_db_wrapper_print_db_info(level_verbose, "");
 };
 
 
+/* function print initialization cost of database backends */
+void libipv6calc_db_wrapper_print_init_cost(void) {
+	int s;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	fprintf(stderr, "Database initialization cost:\n");
+#ifdef SUPPORT_MMDB
+	if (wrapper_init_usec_MMDB >= 0) {
+		fprintf(stderr, "  %-25s: %ld.%03ld msec\n", "MaxMindDB library", wrapper_init_usec_MMDB / 1000, wrapper_init_usec_MMDB % 1000);
+	};
+#endif
+	for (s = IPV6CALC_DB_SOURCE_MIN; s <= IPV6CALC_DB_SOURCE_MAX; s++) {
+		if (wrapper_init_usec[s] < 0) {
+			// not compiled-in or disabled
+			continue;
+		};
+		fprintf(stderr, "  %-25s: %ld.%03ld msec\n", libipv6calc_db_wrapper_get_data_source_name_by_number(s), wrapper_init_usec[s] / 1000, wrapper_init_usec[s] % 1000);
+	};
+	fprintf(stderr, "\n");
+};
+
+
 /* function get source name by number
  * in: source number
  * out: source name
@@ -923,6 +1675,8 @@ static int libipv6calc_db_wrapper_get_feature_index_by_feature(const uint32_t fe
 void libipv6calc_db_wrapper_features_help(void) {
 	int i, s, first;
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_db_features); i++) {
@@ -950,6 +1704,8 @@ void libipv6calc_db_wrapper_features_help(void) {
 void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *prefix_string) {
 	int f, p, f_index;
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 	fprintf(stderr, "%sDB features: 0x%08x\n\n", prefix_string, wrapper_features);
@@ -1028,6 +1784,16 @@ void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *p
 	fprintf(stderr, "\n");
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+	if (wrapper_Merged_disable == 0) {
+		// Call Merged wrapper
+		libipv6calc_db_wrapper_Merged_wrapper_print_db_info(level_verbose, prefix_string);
+	} else {
+		fprintf(stderr, "%sMerged support available but disabled by option\n", prefix_string);
+	};
+	fprintf(stderr, "\n");
+#endif
+
 	// summary
 	fprintf(stderr, "%sDatabase selection or priorization ('->': subsequential calls)\n", prefix_string);
 
@@ -1080,6 +1846,8 @@ void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *p
 int libipv6calc_db_wrapper_has_features(uint32_t features) {
 	int result = -1;
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with feature value to test: 0x%08x", features);
 
 	if ((wrapper_features & features) == features) {
@@ -1162,6 +1930,13 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_merged_disable:
+#ifdef SUPPORT_DB_MERGED
+			wrapper_Merged_disable = 1;
+#endif
+			result = 0;
+			break;
+
 		case DB_mmdb_lib:
 #ifdef SUPPORT_MMDB_DYN
 			result = snprintf(mmdb_lib_file, sizeof(mmdb_lib_file), "%s", optarg);
@@ -1300,6 +2075,35 @@ int libipv6calc_db_wrapper_options(const int opt, const char *optarg, const stru
 			result = 0;
 			break;
 
+		case DB_merged_dir:
+#ifdef SUPPORT_DB_MERGED
+			result = snprintf(merged_db_dir, sizeof(merged_db_dir), "%s", optarg);
+#else
+			NONQUIETPRINT_WA("Support for Merged not compiled-in, skipping option: --%s", ipv6calcoption_name(opt, longopts));
+#endif
+			result = 0;
+			break;
+
+		case DB_common_reload_interval:
+			if ((atoi(optarg) >= 0) && (atoi(optarg) <= 86400)) {
+				wrapper_reload_interval = atoi(optarg);
+				result = 0;
+			} else {
+				ERRORPRINT_WA("given value for option is out of range, exit now: --%s %d", ipv6calcoption_name(opt, longopts), atoi(optarg));
+				exit(EXIT_FAILURE);
+			};
+			break;
+
+		case DB_common_lookup_interleave:
+			if ((atoi(optarg) >= 1) && (atoi(optarg) <= IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX)) {
+				wrapper_lookup_interleave = atoi(optarg);
+				result = 0;
+			} else {
+				ERRORPRINT_WA("given value for option is out of range (1-%d), exit now: --%s %d", IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX, ipv6calcoption_name(opt, longopts), atoi(optarg));
+				exit(EXIT_FAILURE);
+			};
+			break;
+
 		/* obsolete options */
 		case DB_ip2location_ipv4:
 		case DB_ip2location_ipv6:
@@ -1481,6 +2285,8 @@ void libipv6calc_db_wrapper_geolocation_record_clear(libipv6calc_db_wrapper_geol
  * get registry number by AS number
  */
 int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_as_num32(as_num32));
 };
@@ -1490,6 +2296,8 @@ int libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32) {
  * get registry number by CC index
  */
 int libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_t cc_index) {
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	// currently only supported by BuiltIn
 	return(libipv6calc_db_wrapper_BuiltIn_registry_num_by_cc_index(cc_index));
 };
@@ -1539,7 +2347,7 @@ int libipv6calc_db_wrapper_registry_string_by_ipaddr(const ipv6calc_ipaddr *ipad
  * mod: string, data_source_ptr (if != NULL)
  * return: 0=ok
  */
-int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+static int libipv6calc_db_wrapper_country_code_by_addr_unlocked(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	unsigned int data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
 	int f = 0, p, result = -1;
 
@@ -1547,6 +2355,8 @@ int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length,
 	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
 #endif
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 	if (string == NULL) {
@@ -1599,6 +2409,25 @@ int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length,
 			goto END_libipv6calc_db_wrapper; // ok
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+			if (wrapper_Merged_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+
+				s_ipv6calc_db_attributes record;
+				libipv6calc_db_wrapper_attributes_clear(&record);
+				if ((libipv6calc_db_wrapper_Merged_attributes_by_addr(ipaddrp, &record) & IPV6CALC_DB_ATTR_CC) != 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(string, length, record.cc_index);
+					result = 0;
+					data_source = IPV6CALC_DB_SOURCE_MERGED;
+					goto END_libipv6calc_db_wrapper; // ok
+				} else {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called Merged did not return a valid country_code");
+				};
+			};
+#endif
+			break;
+
 		    case IPV6CALC_DB_SOURCE_GEOIP:
 #ifdef SUPPORT_GEOIP
 			if (wrapper_GeoIP_status == 1) {
@@ -1727,25 +2556,92 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * wrapper: country_code_by_addr with database handles pinned
+ */
+int libipv6calc_db_wrapper_country_code_by_addr(char *string, const int length, const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_country_code_by_addr_unlocked(string, length, ipaddrp, data_source_ptr);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
+/*
+ * convert CountryCode text into internal index
+ * in : cc_text, ipaddrp (for error message)
+ * mod: index_ptr
+ * out: 0=ok
+ */
+static int libipv6calc_db_wrapper_cc_index_by_country_code(const char *cc_text, const ipv6calc_ipaddr *ipaddrp, uint16_t *index_ptr) {
+	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
+	uint8_t c1, c2;
+	int result = -1;
+
+	if (strlen(cc_text) == 2) {
+		if (isalpha(cc_text[0]) && isalnum(cc_text[1])) {
+			c1 = toupper(cc_text[0]);
+			if (! (c1 >= 'A' && c1 <= 'Z')) {
+				goto END_libipv6calc_db_wrapper; // something wrong
+			};
+			c1 -= 'A';
+
+			c2 = toupper(cc_text[1]);
+			if (c2 >= '0' && c2 <= '9') {
+				c2 -= '0';
+			} else if (c2 >= 'A' && c2 <= 'Z') {
+				c2 -= 'A';
+				c2 += 10;
+			} else {
+				goto END_libipv6calc_db_wrapper; // something wrong
+			};
+
+			index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
+
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
+
+			if (index >= COUNTRYCODE_INDEX_MAX) {
+				ERRORPRINT_WA("unexpected index (too high): %d", index);
+				index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
+				goto END_libipv6calc_db_wrapper; // something wrong
+			};
+		};
+	} else {
+		ERRORPRINT_WA("returned cc_text has not 2 chars: %s (addr=%08x%08x%08x%08x)", cc_text, ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3]);
+		goto END_libipv6calc_db_wrapper; // something wrong
+	};
+
+	result = 0;
+
+END_libipv6calc_db_wrapper:
+	*index_ptr = index;
+	return(result);
+};
+
+
 /*
  * get CountryCode in special internal form (index) [A-Z] (26) x [0-9A-Z] (36)
  */
-uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+static uint16_t libipv6calc_db_wrapper_cc_index_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
 	char cc_text[256] = "";
-	uint8_t c1, c2;
 	int r;
 
 	int cache_hit = 0;
 
-	static ipv6calc_ipaddr ipaddr_cache_lastused;
-	static uint16_t cc_index_lastused;
-	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
-	static int ipaddr_cache_lastused_valid = 0;
+	static __thread ipv6calc_ipaddr ipaddr_cache_lastused;
+	static __thread uint16_t cc_index_lastused;
+	static __thread unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
+	static __thread int ipaddr_cache_lastused_valid = 0;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
-	if ((ipaddr_cache_lastused_valid == 1)
+	if ((ipaddr_cache_lastused_valid == WRAPPER_CACHE_GENERATION)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
 	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
@@ -1768,41 +2664,12 @@ uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp,
 			goto END_libipv6calc_db_wrapper_cached; // something wrong
 		};
 
-		if (strlen(cc_text) == 2) {
-			if (isalpha(cc_text[0]) && isalnum(cc_text[1])) {
-				c1 = toupper(cc_text[0]);
-				if (! (c1 >= 'A' && c1 <= 'Z')) {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-				c1 -= 'A';
-
-				c2 = toupper(cc_text[1]);
-				if (c2 >= '0' && c2 <= '9') {
-					c2 -= '0';
-				} else if (c2 >= 'A' && c2 <= 'Z') {
-					c2 -= 'A';
-					c2 += 10;
-				} else {
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-
-				index = c1 + c2 * COUNTRYCODE_LETTER1_MAX;
-
-				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "c1=%d c2=%d index=%d (0x%03x) -> test: %c%c", c1, c2, index, index, COUNTRYCODE_INDEX_TO_CHAR1(index), COUNTRYCODE_INDEX_TO_CHAR2(index));
-
-				if (index >= COUNTRYCODE_INDEX_MAX) {
-					index = COUNTRYCODE_INDEX_UNKNOWN; // failsafe
-					ERRORPRINT_WA("unexpected index (too high): %d", index);
-					goto END_libipv6calc_db_wrapper_cached; // something wrong
-				};
-			};
-		} else {
-			ERRORPRINT_WA("returned cc_text has not 2 chars: %s (addr=%08x%08x%08x%08x)", cc_text, ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3]);
+		if (libipv6calc_db_wrapper_cc_index_by_country_code(cc_text, ipaddrp, &index) != 0) {
 			goto END_libipv6calc_db_wrapper_cached; // something wrong
 		};
 
 		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
+		ipaddr_cache_lastused_valid = WRAPPER_CACHE_GENERATION;
 		cc_index_lastused = index;
 		ipaddr_cache_lastused = *ipaddrp;
 
@@ -1819,6 +2686,20 @@ END_libipv6calc_db_wrapper_cached:
 };
 
 
+/*
+ * wrapper: cc_index_by_addr with database handles pinned
+ */
+uint16_t libipv6calc_db_wrapper_cc_index_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+	uint16_t result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_cc_index_by_addr_unlocked(ipaddrp, data_source_ptr);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
 /*
  * get country code string by index
  */
@@ -1845,17 +2726,19 @@ int libipv6calc_db_wrapper_country_code_by_cc_index(char *string, const int leng
 /*
  * get AS 32-bit number
  */
-uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+static uint32_t libipv6calc_db_wrapper_as_num32_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
 	uint32_t as_num32 = ASNUM_AS_UNKNOWN; // default
 
 	int f = 0, p;
 
 	int cache_hit = 0;
 
-	static ipv6calc_ipaddr ipaddr_cache_lastused;
-	static uint32_t as_num32_lastused;
-	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
-	static int ipaddr_cache_lastused_valid = 0;
+	static __thread ipv6calc_ipaddr ipaddr_cache_lastused;
+	static __thread uint32_t as_num32_lastused;
+	static __thread unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
+	static __thread int ipaddr_cache_lastused_valid = 0;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
@@ -1878,7 +2761,7 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp,
 		exit(EXIT_FAILURE);
 	};
 
-	if ((ipaddr_cache_lastused_valid == 1)
+	if ((ipaddr_cache_lastused_valid == WRAPPER_CACHE_GENERATION)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
 	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
@@ -1904,6 +2787,24 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp,
 			goto END_libipv6calc_db_wrapper; // ok
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+			if (wrapper_Merged_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+
+				s_ipv6calc_db_attributes record;
+				libipv6calc_db_wrapper_attributes_clear(&record);
+				if ((libipv6calc_db_wrapper_Merged_attributes_by_addr(ipaddrp, &record) & IPV6CALC_DB_ATTR_AS) != 0) {
+					as_num32 = record.as_num32;
+					data_source_lastused = IPV6CALC_DB_SOURCE_MERGED;
+					goto END_libipv6calc_db_wrapper; // ok
+				} else {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called Merged did not return a valid ASN");
+				};
+			};
+#endif
+			break;
+
 		    case IPV6CALC_DB_SOURCE_GEOIP:
 #ifdef SUPPORT_GEOIP
 			if (wrapper_GeoIP_status == 1) {
@@ -1962,7 +2863,7 @@ uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp,
 END_libipv6calc_db_wrapper:
 	if (as_num32 != ASNUM_AS_UNKNOWN) {
 		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
+		ipaddr_cache_lastused_valid = WRAPPER_CACHE_GENERATION;
 		as_num32_lastused = as_num32;
 		ipaddr_cache_lastused = *ipaddrp;
 
@@ -1978,6 +2879,20 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * wrapper: as_num32_by_addr with database handles pinned
+ */
+uint32_t libipv6calc_db_wrapper_as_num32_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr) {
+	uint32_t result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_as_num32_by_addr_unlocked(ipaddrp, data_source_ptr);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
 /*
  * compress AS 32-bit number to 17 bit
  */
@@ -2042,7 +2957,7 @@ uint32_t libipv6calc_db_wrapper_as_num32_decomp17(const uint32_t as_num32_comp17
 /*
  * get GeonameID
  */
-uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr) {
+static uint32_t libipv6calc_db_wrapper_GeonameID_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr) {
 	uint32_t GeonameID = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN; // default
 	int GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
 
@@ -2050,11 +2965,13 @@ uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp
 
 	int cache_hit = 0;
 
-	static ipv6calc_ipaddr ipaddr_cache_lastused;
-	static uint32_t GeonameID_lastused;
-	static int GeonameID_type_lastused;
-	static unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
-	static int ipaddr_cache_lastused_valid = 0;
+	static __thread ipv6calc_ipaddr ipaddr_cache_lastused;
+	static __thread uint32_t GeonameID_lastused;
+	static __thread int GeonameID_type_lastused;
+	static __thread unsigned int data_source_lastused = IPV6CALC_DB_SOURCE_UNKNOWN;
+	static __thread int ipaddr_cache_lastused_valid = 0;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto);
 
@@ -2066,7 +2983,7 @@ uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp
 			goto END_libipv6calc_db_wrapper;
 		};
 	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
-		f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_AS;
+		f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_GEONAMEID;
 		if ((ipaddrp->typeinfo1 & IPV6_ADDR_RESERVED) != 0) {
 			// reserved IPv4 address has no GeonameID
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv6 address prefix (0-63): %08x%08x is reserved (skip GeonameID lookup)", (unsigned int) ipaddrp->addr[0], (unsigned int) ipaddrp->addr[1]);
@@ -2077,7 +2994,7 @@ uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp
 		exit(EXIT_FAILURE);
 	};
 
-	if ((ipaddr_cache_lastused_valid == 1)
+	if ((ipaddr_cache_lastused_valid == WRAPPER_CACHE_GENERATION)
 	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
 	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
 	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
@@ -2091,83 +3008,452 @@ uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp
 			*data_source_ptr = data_source_lastused;
 		};
 
-		// set only source from cache if caller request it
-		if (GeonameID_type_ptr != NULL) {
-			*GeonameID_type_ptr = GeonameID_type_lastused;
+		// set only source from cache if caller request it
+		if (GeonameID_type_ptr != NULL) {
+			*GeonameID_type_ptr = GeonameID_type_lastused;
+		};
+
+		cache_hit = 1;
+		goto END_libipv6calc_db_wrapper; // ok
+	};
+
+	// run through priorities
+	for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+		switch(wrapper_features_selector[f][p]) {
+		    case 0:
+			// last
+			goto END_libipv6calc_db_wrapper; // ok
+			break;
+
+		    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+			if (wrapper_Merged_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+
+				s_ipv6calc_db_attributes record;
+				libipv6calc_db_wrapper_attributes_clear(&record);
+				if ((libipv6calc_db_wrapper_Merged_attributes_by_addr(ipaddrp, &record) & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+					GeonameID = record.GeonameID;
+					GeonameID_type = record.GeonameID_type;
+					data_source_lastused = IPV6CALC_DB_SOURCE_MERGED;
+					goto END_libipv6calc_db_wrapper; // ok
+				} else {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called Merged did not return a valid GeonameID");
+				};
+			};
+#endif
+			break;
+
+		    case IPV6CALC_DB_SOURCE_GEOIP2:
+#ifdef SUPPORT_GEOIP2
+			if (wrapper_GeoIP2_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP2");
+
+				GeonameID = libipv6calc_db_wrapper_GeoIP2_wrapper_GeonameID_by_addr(ipaddrp, &GeonameID_type);
+				if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+					data_source_lastused = IPV6CALC_DB_SOURCE_GEOIP2;
+					goto END_libipv6calc_db_wrapper; // ok
+				} else {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called GeoIP (MaxMindDB) did not return a valid GeonameID");
+				};
+			};
+#endif
+			break;
+
+		    case IPV6CALC_DB_SOURCE_DBIP2:
+#ifdef SUPPORT_DBIP2
+			if (wrapper_DBIP2_status == 1) {
+
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now DBIP2");
+
+				GeonameID = libipv6calc_db_wrapper_DBIP2_wrapper_GeonameID_by_addr(ipaddrp, &GeonameID_type);
+				if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+					data_source_lastused = IPV6CALC_DB_SOURCE_DBIP2;
+					goto END_libipv6calc_db_wrapper; // ok
+				} else {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called db-ip.com (MaxMindDB) did not return a valid GeonameID");
+				};
+			};
+#endif
+			break;
+
+		    default:
+			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
+			break;
+		};
+	};
+
+END_libipv6calc_db_wrapper:
+	if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+		// store in last used cache
+		ipaddr_cache_lastused_valid = WRAPPER_CACHE_GENERATION;
+		GeonameID_lastused = GeonameID;
+		GeonameID_type_lastused = GeonameID_type;
+		ipaddr_cache_lastused = *ipaddrp;
+
+		// set only data_source from cache if caller request it
+		if (data_source_ptr != NULL) {
+			*data_source_ptr = data_source_lastused;
+		};
+
+		if (GeonameID_type_ptr != NULL) {
+			*GeonameID_type_ptr = GeonameID_type_lastused;
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x GeonameID=%u GeonameID_type=%d %s (data_source=%d)", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], GeonameID, GeonameID_type, (cache_hit == 1 ? " (cached)" : ""), data_source_lastused);
+
+	return(GeonameID);
+};
+
+
+/*
+ * wrapper: GeonameID_by_addr with database handles pinned
+ */
+uint32_t libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr) {
+	uint32_t result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_GeonameID_by_addr_unlocked(ipaddrp, data_source_ptr, GeonameID_type_ptr);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
+/*
+ * clear attributes record
+ */
+void libipv6calc_db_wrapper_attributes_clear(s_ipv6calc_db_attributes *recordp) {
+	recordp->cc_index              = COUNTRYCODE_INDEX_UNKNOWN;
+	recordp->as_num32              = ASNUM_AS_UNKNOWN;
+	recordp->GeonameID             = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
+	recordp->GeonameID_type        = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
+	recordp->registry              = REGISTRY_UNKNOWN;
+	recordp->data_source_cc        = IPV6CALC_DB_SOURCE_UNKNOWN;
+	recordp->data_source_as        = IPV6CALC_DB_SOURCE_UNKNOWN;
+	recordp->data_source_GeonameID = IPV6CALC_DB_SOURCE_UNKNOWN;
+};
+
+
+#if defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2
+/* result of one lookup in a database storing several attributes per record */
+typedef struct
+{
+	int		found;		// -1: not looked up, otherwise found attributes
+	char		country_code[256];
+	uint32_t	as_num32;
+	uint32_t	GeonameID;
+	int		GeonameID_type;
+} s_libipv6calc_db_wrapper_attributes_lookup;
+
+#define LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_CLEAR(lookup) \
+	lookup.found = -1; \
+	lookup.country_code[0] = '\0'; \
+	lookup.as_num32 = ASNUM_AS_UNKNOWN; \
+	lookup.GeonameID = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN; \
+	lookup.GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
+
+// store only the given attribute, others are handled by their own priority list
+#define LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_STORE(lookup, attribute) \
+	if (attribute == IPV6CALC_DB_ATTR_CC) { \
+		snprintf(cc_text, sizeof(cc_text), "%s", lookup.country_code); \
+	} else if (attribute == IPV6CALC_DB_ATTR_AS) { \
+		recordp->as_num32 = lookup.as_num32; \
+	} else if (attribute == IPV6CALC_DB_ATTR_GEONAMEID) { \
+		recordp->GeonameID = lookup.GeonameID; \
+		recordp->GeonameID_type = lookup.GeonameID_type; \
+	};
+#endif
+
+
+/*
+ * get CountryCode index, AS number, GeonameID and Registry at once
+ *  - each attribute follows its own database priority list like the single attribute functions
+ *  - a database storing several attributes in one record (MaxMindDB) is looked up only once
+ * in : ipaddrp, attributes (IPV6CALC_DB_ATTR_*)
+ * mod: recordp
+ * out: attributes found (IPV6CALC_DB_ATTR_*)
+ */
+static int libipv6calc_db_wrapper_all_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, const int attributes, s_ipv6calc_db_attributes *recordp) {
+	int result = 0, attributes_db = 0, a, f, p;
+	unsigned int source;
+	char cc_text[256];
+	int found;
+
+	const int attribute_list[3] = { IPV6CALC_DB_ATTR_CC, IPV6CALC_DB_ATTR_AS, IPV6CALC_DB_ATTR_GEONAMEID };
+	int feature_list[3];
+
+	int cache_hit = 0;
+
+#ifdef SUPPORT_DB_MERGED
+	s_ipv6calc_db_attributes lookup_Merged;
+	int lookup_Merged_found = -1;
+#endif
+
+	static __thread ipv6calc_ipaddr ipaddr_cache_lastused;
+	static __thread s_ipv6calc_db_attributes record_lastused;
+	static __thread int attributes_lastused;
+	static __thread int result_lastused;
+	static __thread int ipaddr_cache_lastused_valid = 0;
+
+#if defined SUPPORT_GEOIP || defined SUPPORT_IP2LOCATION
+	char tempstring[IPV6CALC_ADDR_STRING_MAX] = "";
+#endif
+
+#ifdef SUPPORT_GEOIP2
+	s_libipv6calc_db_wrapper_attributes_lookup lookup_GeoIP2;
+	LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_CLEAR(lookup_GeoIP2)
+#endif
+
+#ifdef SUPPORT_DBIP2
+	s_libipv6calc_db_wrapper_attributes_lookup lookup_DBIP2;
+	LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_CLEAR(lookup_DBIP2)
+#endif
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x proto=%d attributes=0x%x", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], ipaddrp->proto, attributes);
+
+	if ((ipaddr_cache_lastused_valid == WRAPPER_CACHE_GENERATION)
+	    &&	(attributes_lastused == attributes)
+	    &&	(ipaddr_cache_lastused.proto == ipaddrp->proto)
+	    && 	(ipaddr_cache_lastused.addr[0] == ipaddrp->addr[0])
+	    && 	(ipaddr_cache_lastused.addr[1] == ipaddrp->addr[1])
+	    && 	(ipaddr_cache_lastused.addr[2] == ipaddrp->addr[2])
+	    && 	(ipaddr_cache_lastused.addr[3] == ipaddrp->addr[3])
+	) {
+		*recordp = record_lastused;
+		result = result_lastused;
+		cache_hit = 1;
+		goto END_libipv6calc_db_wrapper_cached;
+	};
+
+	libipv6calc_db_wrapper_attributes_clear(recordp);
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		feature_list[0] = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_CC;
+		feature_list[1] = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_AS;
+		feature_list[2] = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_GEONAMEID;
+		if ((ipaddrp->typeinfo1 & IPV4_ADDR_RESERVED) == 0) {
+			attributes_db = attributes & (IPV6CALC_DB_ATTR_CC | IPV6CALC_DB_ATTR_AS | IPV6CALC_DB_ATTR_GEONAMEID);
+		} else {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv4 address: %08x is reserved (skip CountryCode/AS/GeonameID lookup)", (unsigned int) ipaddrp->addr[0]);
+		};
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		feature_list[0] = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_CC;
+		feature_list[1] = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_AS;
+		feature_list[2] = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_GEONAMEID;
+		if ((ipaddrp->typeinfo1 & IPV6_ADDR_RESERVED) == 0) {
+			attributes_db = attributes & (IPV6CALC_DB_ATTR_CC | IPV6CALC_DB_ATTR_AS | IPV6CALC_DB_ATTR_GEONAMEID);
+		} else {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Given IPv6 address prefix (0-63): %08x%08x is reserved (skip CountryCode/AS/GeonameID lookup)", (unsigned int) ipaddrp->addr[0], (unsigned int) ipaddrp->addr[1]);
+		};
+	} else {
+		ERRORPRINT_WA("unsupported proto=%d (FIX CODE)", ipaddrp->proto);
+		exit(EXIT_FAILURE);
+	};
+
+	for (a = 0; a < 3; a++) {
+		if ((attributes_db & attribute_list[a]) == 0) {
+			continue;
 		};
 
-		cache_hit = 1;
-		goto END_libipv6calc_db_wrapper; // ok
-	};
+		f = feature_list[a];
+		cc_text[0] = '\0';
 
-	// run through priorities
-	for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
-		switch(wrapper_features_selector[f][p]) {
-		    case 0:
-			// last
-			goto END_libipv6calc_db_wrapper; // ok
-			break;
+		// run through priorities
+		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			source = wrapper_features_selector[f][p];
+			found = 0;
 
-		    case IPV6CALC_DB_SOURCE_GEOIP2:
+			switch(source) {
+			    case 0:
+				// last
+				goto END_libipv6calc_db_wrapper_attribute;
+				break;
+
+			    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+				if (wrapper_Merged_status == 1) {
+					if (lookup_Merged_found < 0) {
+						DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now Merged for attributes=0x%x", attributes_db);
+						libipv6calc_db_wrapper_attributes_clear(&lookup_Merged);
+						lookup_Merged_found = libipv6calc_db_wrapper_Merged_attributes_by_addr(ipaddrp, &lookup_Merged);
+					};
+
+					if ((lookup_Merged_found & attribute_list[a]) != 0) {
+						if (attribute_list[a] == IPV6CALC_DB_ATTR_CC) {
+							libipv6calc_db_wrapper_country_code_by_cc_index(cc_text, sizeof(cc_text), lookup_Merged.cc_index);
+						} else if (attribute_list[a] == IPV6CALC_DB_ATTR_AS) {
+							recordp->as_num32 = lookup_Merged.as_num32;
+						} else if (attribute_list[a] == IPV6CALC_DB_ATTR_GEONAMEID) {
+							recordp->GeonameID = lookup_Merged.GeonameID;
+							recordp->GeonameID_type = lookup_Merged.GeonameID_type;
+						};
+						found = 1;
+					};
+				};
+#endif
+				break;
+
+			    case IPV6CALC_DB_SOURCE_GEOIP:
+#ifdef SUPPORT_GEOIP
+				if (wrapper_GeoIP_status == 1) {
+					if (strlen(tempstring) == 0) {
+						libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+					};
+
+					if (attribute_list[a] == IPV6CALC_DB_ATTR_CC) {
+						const char *result_char_ptr = libipv6calc_db_wrapper_GeoIP_wrapper_country_code_by_addr(tempstring, ipaddrp->proto);
+						if ((result_char_ptr != NULL) && (strlen(result_char_ptr) > 0)) {
+							snprintf(cc_text, sizeof(cc_text), "%s", result_char_ptr);
+							found = 1;
+						};
+					} else if (attribute_list[a] == IPV6CALC_DB_ATTR_AS) {
+						recordp->as_num32 = libipv6calc_db_wrapper_GeoIP_wrapper_asn_by_addr(ipaddrp);
+						found = (recordp->as_num32 != ASNUM_AS_UNKNOWN);
+					};
+				};
+#endif
+				break;
+
+			    case IPV6CALC_DB_SOURCE_GEOIP2:
 #ifdef SUPPORT_GEOIP2
-			if (wrapper_GeoIP2_status == 1) {
-				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP2");
+				if (wrapper_GeoIP2_status == 1) {
+					if (lookup_GeoIP2.found < 0) {
+						DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now GeoIP2 for attributes=0x%x", attributes_db);
+						lookup_GeoIP2.found = libipv6calc_db_wrapper_GeoIP2_wrapper_attributes_by_addr(ipaddrp, attributes_db, lookup_GeoIP2.country_code, sizeof(lookup_GeoIP2.country_code), &lookup_GeoIP2.as_num32, &lookup_GeoIP2.GeonameID, &lookup_GeoIP2.GeonameID_type);
+					};
 
-				GeonameID = libipv6calc_db_wrapper_GeoIP2_wrapper_GeonameID_by_addr(ipaddrp, &GeonameID_type);
-				if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
-					data_source_lastused = IPV6CALC_DB_SOURCE_GEOIP2;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called GeoIP (MaxMindDB) did not return a valid GeonameID");
+					if ((lookup_GeoIP2.found & attribute_list[a]) != 0) {
+						LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_STORE(lookup_GeoIP2, attribute_list[a])
+						found = 1;
+					};
 				};
-			};
 #endif
-			break;
+				break;
 
-		    case IPV6CALC_DB_SOURCE_DBIP2:
+			    case IPV6CALC_DB_SOURCE_DBIP2:
 #ifdef SUPPORT_DBIP2
-			if (wrapper_DBIP2_status == 1) {
+				if (wrapper_DBIP2_status == 1) {
+					if (lookup_DBIP2.found < 0) {
+						DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Call now DBIP2 for attributes=0x%x", attributes_db);
+						lookup_DBIP2.found = libipv6calc_db_wrapper_DBIP2_wrapper_attributes_by_addr(ipaddrp, attributes_db, lookup_DBIP2.country_code, sizeof(lookup_DBIP2.country_code), &lookup_DBIP2.as_num32, &lookup_DBIP2.GeonameID, &lookup_DBIP2.GeonameID_type);
+					};
 
-				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now DBIP2");
+					if ((lookup_DBIP2.found & attribute_list[a]) != 0) {
+						LIBIPV6CALC_DB_WRAPPER_ATTRIBUTES_LOOKUP_STORE(lookup_DBIP2, attribute_list[a])
+						found = 1;
+					};
+				};
+#endif
+				break;
 
-				GeonameID = libipv6calc_db_wrapper_DBIP2_wrapper_GeonameID_by_addr(ipaddrp, &GeonameID_type);
-				if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
-					data_source_lastused = IPV6CALC_DB_SOURCE_DBIP2;
-					goto END_libipv6calc_db_wrapper; // ok
-				} else {
-					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called db-ip.com (MaxMindDB) did not return a valid GeonameID");
+			    case IPV6CALC_DB_SOURCE_IP2LOCATION:
+#ifdef SUPPORT_IP2LOCATION
+				if ((wrapper_IP2Location_status == 1) && (attribute_list[a] == IPV6CALC_DB_ATTR_CC)) {
+					if (strlen(tempstring) == 0) {
+						libipaddr_ipaddrstruct_to_string(ipaddrp, tempstring, sizeof(tempstring), 0);
+					};
+
+					found = (libipv6calc_db_wrapper_IP2Location_wrapper_country_code_by_addr(tempstring, ipaddrp->proto, cc_text, sizeof(cc_text)) == 0);
 				};
-			};
 #endif
-			break;
+				break;
+
+			    case IPV6CALC_DB_SOURCE_DBIP:
+#ifdef SUPPORT_DBIP
+				if ((wrapper_DBIP_status == 1) && (attribute_list[a] == IPV6CALC_DB_ATTR_CC)) {
+					found = (libipv6calc_db_wrapper_DBIP_wrapper_country_code_by_addr(ipaddrp, cc_text, sizeof(cc_text)) == 0);
+				};
+#endif
+				break;
+
+			    case IPV6CALC_DB_SOURCE_EXTERNAL:
+#ifdef SUPPORT_EXTERNAL
+				if ((wrapper_External_status == 1) && (attribute_list[a] == IPV6CALC_DB_ATTR_CC)) {
+					found = (libipv6calc_db_wrapper_External_country_code_by_addr(ipaddrp, cc_text, sizeof(cc_text)) == 0);
+				};
+#endif
+				break;
+
+			    default:
+				goto END_libipv6calc_db_wrapper_attribute; // dummy goto in case no db is enabled
+				break;
+			};
+
+			if (found == 0) {
+				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Database did not return a valid result for attribute=0x%x: %s", attribute_list[a], libipv6calc_db_wrapper_get_data_source_name_by_number(source));
+				continue;
+			};
+
+			switch (attribute_list[a]) {
+			    case IPV6CALC_DB_ATTR_CC:
+				if (libipv6calc_db_wrapper_cc_index_by_country_code(cc_text, ipaddrp, &recordp->cc_index) == 0) {
+					recordp->data_source_cc = source;
+					if (recordp->cc_index != COUNTRYCODE_INDEX_UNKNOWN) {
+						result |= IPV6CALC_DB_ATTR_CC;
+					};
+				};
+				break;
+
+			    case IPV6CALC_DB_ATTR_AS:
+				recordp->data_source_as = source;
+				result |= IPV6CALC_DB_ATTR_AS;
+				break;
+
+			    case IPV6CALC_DB_ATTR_GEONAMEID:
+				recordp->data_source_GeonameID = source;
+				result |= IPV6CALC_DB_ATTR_GEONAMEID;
+				break;
+			};
 
-		    default:
-			goto END_libipv6calc_db_wrapper; // dummy goto in case no db is enabled
 			break;
 		};
-	};
 
-END_libipv6calc_db_wrapper:
-	if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
-		// store in last used cache
-		ipaddr_cache_lastused_valid = 1;
-		GeonameID_lastused = GeonameID;
-		GeonameID_type_lastused = GeonameID_type;
-		ipaddr_cache_lastused = *ipaddrp;
-
-		// set only data_source from cache if caller request it
-		if (data_source_ptr != NULL) {
-			*data_source_ptr = data_source_lastused;
+END_libipv6calc_db_wrapper_attribute:
+		// keep only values of found attributes, others could be touched by a database without result
+		if ((attribute_list[a] == IPV6CALC_DB_ATTR_AS) && ((result & IPV6CALC_DB_ATTR_AS) == 0)) {
+			recordp->as_num32 = ASNUM_AS_UNKNOWN;
+		} else if ((attribute_list[a] == IPV6CALC_DB_ATTR_GEONAMEID) && ((result & IPV6CALC_DB_ATTR_GEONAMEID) == 0)) {
+			recordp->GeonameID = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
+			recordp->GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
 		};
+	};
 
-		if (GeonameID_type_ptr != NULL) {
-			*GeonameID_type_ptr = GeonameID_type_lastused;
+	if ((attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) {
+		recordp->registry = libipv6calc_db_wrapper_registry_num_by_ipaddr(ipaddrp);
+		if (recordp->registry != REGISTRY_UNKNOWN) {
+			result |= IPV6CALC_DB_ATTR_REGISTRY;
 		};
 	};
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x GeonameID=%u GeonameID_type=%d %s (data_source=%d)", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], GeonameID, GeonameID_type, (cache_hit == 1 ? " (cached)" : ""), data_source_lastused);
+	// store in last used cache
+	ipaddr_cache_lastused_valid = WRAPPER_CACHE_GENERATION;
+	ipaddr_cache_lastused = *ipaddrp;
+	attributes_lastused = attributes;
+	record_lastused = *recordp;
+	result_lastused = result;
 
-	return(GeonameID);
+END_libipv6calc_db_wrapper_cached:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x%08x%08x%08x found=0x%x cc_index=%d as_num32=%u GeonameID=%u GeonameID_type=%d registry=%d%s", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], result, recordp->cc_index, recordp->as_num32, recordp->GeonameID, recordp->GeonameID_type, recordp->registry, (cache_hit == 1 ? " (cached)" : ""));
+
+	return(result);
+};
+
+
+/*
+ * wrapper: all_by_addr with database handles pinned
+ */
+int libipv6calc_db_wrapper_all_by_addr(const ipv6calc_ipaddr *ipaddrp, const int attributes, s_ipv6calc_db_attributes *recordp) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_all_by_addr_unlocked(ipaddrp, attributes, recordp);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
 };
 
 
@@ -2180,6 +3466,8 @@ END_libipv6calc_db_wrapper:
 int libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(char *resultstring, const size_t resultstring_length, const ipv6calc_macaddr *macaddrp) {
 	int retval = 1;
 #ifdef SUPPORT_BUILTIN
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	retval = libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_by_macaddr(resultstring, resultstring_length, macaddrp);
 #endif
 	return (retval);
@@ -2195,6 +3483,8 @@ int libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(char *resultstring, con
 int libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(char *resultstring, const size_t resultstring_length, const ipv6calc_macaddr *macaddrp) {
 	int retval = 1;
 #ifdef SUPPORT_BUILTIN
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	retval = libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(resultstring, resultstring_length, macaddrp);
 #endif
 	return (retval);
@@ -2363,6 +3653,8 @@ int libipv6calc_db_wrapper_registry_string_by_ipv4addr(const ipv6calc_ipv4addr *
 	int retval = 1;
 	int registry;
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv4addr(ipv4addrp);
@@ -2386,41 +3678,19 @@ int libipv6calc_db_wrapper_registry_string_by_ipv4addr(const ipv6calc_ipv4addr *
 
 
 /*
- * get registry number of an IPv4 address
+ * get registry number of an IPv4 address from databases only
+ *  (no reserved/special handling, no cache, used also for creating merged database)
  *
  * in:  ipv4addr = IPv4 address structure
  * out: registry number
  */
-int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
+static int libipv6calc_db_wrapper_registry_num_by_ipv4addr_db_unlocked(const ipv6calc_ipv4addr *ipv4addrp) {
 	int retval = REGISTRY_UNKNOWN, p, f;
 
-	int cache_hit = 0;
-
-	static ipv6calc_ipv4addr cache_lu_ipv4addr;
-	static uint32_t cache_lu_ipv4addr_registry_num;
-	static int      cache_lu_ipv4addr_valid = 0;
-
-#if defined SUPPORT_EXTERNAL
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_DB_MERGED
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword(ipv4addrp));
-
-	if ((cache_lu_ipv4addr_valid == 1)
-	    && 	(memcmp(&cache_lu_ipv4addr.in_addr, &ipv4addrp->in_addr, sizeof(struct in_addr)) == 0)
-	) {
-		retval= cache_lu_ipv4addr_registry_num;
-		cache_hit = 1;
-		goto END_libipv6calc_db_wrapper_cached;
-	};
-
-	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv4addr(ipv4addrp);
-
-	if (info != NULL) {
-		retval = REGISTRY_RESERVED;
-		goto END_libipv6calc_db_wrapper;
-	};
-
 	f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_REGISTRY;
 
 	// run through priorities
@@ -2431,6 +3701,16 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 			goto END_libipv6calc_db_wrapper; // ok
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+			if (wrapper_Merged_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+				CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, ipaddr);
+				retval = libipv6calc_db_wrapper_Merged_registry_num_by_addr(&ipaddr);
+			};
+#endif
+			break;
+
 		    case IPV6CALC_DB_SOURCE_BUILTIN:
 #ifdef SUPPORT_BUILTIN
 			if (wrapper_BuiltIn_status == 1) {
@@ -2457,19 +3737,188 @@ int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv
 		};
 	};
 
-END_libipv6calc_db_wrapper:
-	// store in last used cache
-	cache_lu_ipv4addr_valid = 1;
-	cache_lu_ipv4addr_registry_num = retval;
-	cache_lu_ipv4addr.in_addr = ipv4addrp->in_addr;
+END_libipv6calc_db_wrapper:
+	return (retval);
+};
+
+
+/*
+ * wrapper: registry_num_by_ipv4addr_db with database handles pinned
+ */
+int libipv6calc_db_wrapper_registry_num_by_ipv4addr_db(const ipv6calc_ipv4addr *ipv4addrp) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_registry_num_by_ipv4addr_db_unlocked(ipv4addrp);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
+/*
+ * get registry number of an IPv4 address
+ *
+ * in:  ipv4addr = IPv4 address structure
+ * out: registry number
+ */
+int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
+	int retval = REGISTRY_UNKNOWN;
+
+	int cache_hit = 0;
+
+	static __thread ipv6calc_ipv4addr cache_lu_ipv4addr;
+	static __thread uint32_t cache_lu_ipv4addr_registry_num;
+	static __thread int      cache_lu_ipv4addr_valid = 0;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword(ipv4addrp));
+
+	if ((cache_lu_ipv4addr_valid == WRAPPER_CACHE_GENERATION)
+	    && 	(memcmp(&cache_lu_ipv4addr.in_addr, &ipv4addrp->in_addr, sizeof(struct in_addr)) == 0)
+	) {
+		retval= cache_lu_ipv4addr_registry_num;
+		cache_hit = 1;
+		goto END_libipv6calc_db_wrapper_cached;
+	};
+
+	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv4addr(ipv4addrp);
+
+	if (info != NULL) {
+		retval = REGISTRY_RESERVED;
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	retval = libipv6calc_db_wrapper_registry_num_by_ipv4addr_db(ipv4addrp);
+
+END_libipv6calc_db_wrapper:
+	// store in last used cache
+	cache_lu_ipv4addr_valid = WRAPPER_CACHE_GENERATION;
+	cache_lu_ipv4addr_registry_num = retval;
+	cache_lu_ipv4addr.in_addr = ipv4addrp->in_addr;
+
+END_libipv6calc_db_wrapper_cached:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x reg=%d%s"
+		, ipv4addr_getdword(ipv4addrp)
+		, retval
+		, (cache_hit == 1 ? " (cached)" : "")
+	);
+	return (retval);
+};
+
+
+/*
+ * get registry numbers of a list of IPv4 addresses at once
+ *  (same result as libipv6calc_db_wrapper_registry_num_by_ipv4addr per entry,
+ *   BuiltIn database is looked up with interleaved binary searches)
+ *
+ * in:  ipv4addr_list = IPv4 address structures
+ * in:  count = number of entries
+ * mod: registry_list = registry numbers
+ */
+static void libipv6calc_db_wrapper_registry_num_by_ipv4addr_batch_unlocked(const ipv6calc_ipv4addr *ipv4addr_list, int *registry_list, const int count) {
+	int index_list[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+	int i, i_start, n, p, f;
+
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_DB_MERGED
+	ipv6calc_ipaddr ipaddr;
+#endif
+
+#ifdef SUPPORT_BUILTIN
+	uint32_t ipv4_list[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+	int registry_builtin_list[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+#endif
+
+	f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_REGISTRY;
+
+	for (i_start = 0; i_start < count; i_start += IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX) {
+		// reserved addresses have no database lookup
+		n = 0;
+		for (i = i_start; (i < count) && (i < i_start + IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX); i++) {
+			if (libipv6calc_db_wrapper_reserved_string_by_ipv4addr(&ipv4addr_list[i]) != NULL) {
+				registry_list[i] = REGISTRY_RESERVED;
+			} else {
+				registry_list[i] = REGISTRY_UNKNOWN;
+				index_list[n] = i;
+#ifdef SUPPORT_BUILTIN
+				ipv4_list[n] = ipv4addr_getdword(&ipv4addr_list[i]);
+#endif
+				n++;
+			};
+		};
+
+		if (n == 0) {
+			continue;
+		};
+
+		// run through priorities
+		for (p = 0; p < IPV6CALC_DB_PRIO_MAX; p++) {
+			if (wrapper_features_selector[f][p] == 0) {
+				// last
+				break;
+			};
+
+			switch(wrapper_features_selector[f][p]) {
+			    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+				if (wrapper_Merged_status == 1) {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+					for (i = 0; i < n; i++) {
+						CONVERT_IPV4ADDRP_IPADDR(&ipv4addr_list[index_list[i]], ipaddr);
+						registry_list[index_list[i]] = libipv6calc_db_wrapper_Merged_registry_num_by_addr(&ipaddr);
+					};
+				};
+#endif
+				break;
+
+			    case IPV6CALC_DB_SOURCE_BUILTIN:
+#ifdef SUPPORT_BUILTIN
+				if (wrapper_BuiltIn_status == 1) {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now BuiltIn");
+					libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(ipv4_list, registry_builtin_list, n);
+					for (i = 0; i < n; i++) {
+						registry_list[index_list[i]] = registry_builtin_list[i];
+					};
+				};
+#endif
+				break;
+
+			    case IPV6CALC_DB_SOURCE_EXTERNAL:
+#ifdef SUPPORT_EXTERNAL
+				if (wrapper_External_status == 1) {
+					DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now External");
+					for (i = 0; i < n; i++) {
+						CONVERT_IPV4ADDRP_IPADDR(&ipv4addr_list[index_list[i]], ipaddr);
+						registry_list[index_list[i]] = libipv6calc_db_wrapper_External_registry_num_by_addr(&ipaddr);
+					};
+				};
+#endif
+				break;
+
+			    default:
+				break;
+			};
+		};
+	};
+
+	return;
+};
 
-END_libipv6calc_db_wrapper_cached:
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Result: addr=%08x reg=%d%s"
-		, ipv4addr_getdword(ipv4addrp)
-		, retval
-		, (cache_hit == 1 ? " (cached)" : "")
-	);
-	return (retval);
+
+/*
+ * wrapper: registry_num_by_ipv4addr_batch with database handles pinned
+ */
+void libipv6calc_db_wrapper_registry_num_by_ipv4addr_batch(const ipv6calc_ipv4addr *ipv4addr_list, int *registry_list, const int count) {
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: count=%d", count);
+
+	libipv6calc_db_wrapper_read_lock();
+	libipv6calc_db_wrapper_registry_num_by_ipv4addr_batch_unlocked(ipv4addr_list, registry_list, count);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return;
 };
 
 
@@ -2484,6 +3933,8 @@ int libipv6calc_db_wrapper_registry_string_by_ipv6addr(const ipv6calc_ipv6addr *
 	int retval = 1;
 	int registry;
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Called");
 
 	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv6addr(ipv6addrp);
@@ -2508,47 +3959,19 @@ int libipv6calc_db_wrapper_registry_string_by_ipv6addr(const ipv6calc_ipv6addr *
 
 
 /*
- * get registry number of an IPv6 address
+ * get registry number of an IPv6 address from databases only
+ *  (no reserved/special handling, no cache, used also for creating merged database)
  *
  * in:  ipv6addr = IPv6 address structure
- * out: assignment number (-1 = no result)
+ * out: registry number
  */
-int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
+static int libipv6calc_db_wrapper_registry_num_by_ipv6addr_db_unlocked(const ipv6calc_ipv6addr *ipv6addrp) {
 	int retval = REGISTRY_UNKNOWN, p, f;
 
-	int cache_hit = 0;
-
-	static ipv6calc_ipv6addr cache_lu_ipv6addr;
-	static uint32_t cache_lu_ipv6addr_registry_num;
-	static int      cache_lu_ipv6addr_valid = 0;
-
-#if defined SUPPORT_EXTERNAL
+#if defined SUPPORT_EXTERNAL || defined SUPPORT_DB_MERGED
 	ipv6calc_ipaddr ipaddr;
 #endif
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
-
-	if ((cache_lu_ipv6addr_valid == 1)
-	    && 	(memcmp(&cache_lu_ipv6addr.in6_addr, &ipv6addrp->in6_addr, sizeof(struct in6_addr)) == 0)
-	) {
-		retval= cache_lu_ipv6addr_registry_num;
-		cache_hit = 1;
-		goto END_libipv6calc_db_wrapper_cached;
-	};
-
-	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv6addr(ipv6addrp);
-
-	if (info != NULL) {
-		retval = REGISTRY_RESERVED;
-		goto END_libipv6calc_db_wrapper;
-	};
-
-	if (ipv6addr_getword(ipv6addrp, 0) == 0x3ffe) {
-		// special handling of 6BONE
-		retval = REGISTRY_6BONE;
-		goto END_libipv6calc_db_wrapper;
-	};
-
 	f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_REGISTRY;
 
 	// run through priorities
@@ -2559,6 +3982,16 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 			goto END_libipv6calc_db_wrapper; // ok
 			break;
 
+		    case IPV6CALC_DB_SOURCE_MERGED:
+#ifdef SUPPORT_DB_MERGED
+			if (wrapper_Merged_status == 1) {
+				DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "Call now Merged");
+				CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
+				retval = libipv6calc_db_wrapper_Merged_registry_num_by_addr(&ipaddr);
+			};
+#endif
+			break;
+
 		    case IPV6CALC_DB_SOURCE_BUILTIN:
 #ifdef SUPPORT_BUILTIN
 			if (wrapper_BuiltIn_status == 1) {
@@ -2585,9 +4018,70 @@ int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv
 		};
 	};
 
+END_libipv6calc_db_wrapper:
+	return (retval);
+};
+
+
+/*
+ * wrapper: registry_num_by_ipv6addr_db with database handles pinned
+ */
+int libipv6calc_db_wrapper_registry_num_by_ipv6addr_db(const ipv6calc_ipv6addr *ipv6addrp) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_registry_num_by_ipv6addr_db_unlocked(ipv6addrp);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
+/*
+ * get registry number of an IPv6 address
+ *
+ * in:  ipv6addr = IPv6 address structure
+ * out: assignment number (-1 = no result)
+ */
+int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
+	int retval = REGISTRY_UNKNOWN;
+
+	int cache_hit = 0;
+
+	static __thread ipv6calc_ipv6addr cache_lu_ipv6addr;
+	static __thread uint32_t cache_lu_ipv6addr_registry_num;
+	static __thread int      cache_lu_ipv6addr_valid = 0;
+
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
+
+	if ((cache_lu_ipv6addr_valid == WRAPPER_CACHE_GENERATION)
+	    && 	(memcmp(&cache_lu_ipv6addr.in6_addr, &ipv6addrp->in6_addr, sizeof(struct in6_addr)) == 0)
+	) {
+		retval= cache_lu_ipv6addr_registry_num;
+		cache_hit = 1;
+		goto END_libipv6calc_db_wrapper_cached;
+	};
+
+	const char *info = libipv6calc_db_wrapper_reserved_string_by_ipv6addr(ipv6addrp);
+
+	if (info != NULL) {
+		retval = REGISTRY_RESERVED;
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	if (ipv6addr_getword(ipv6addrp, 0) == 0x3ffe) {
+		// special handling of 6BONE
+		retval = REGISTRY_6BONE;
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	retval = libipv6calc_db_wrapper_registry_num_by_ipv6addr_db(ipv6addrp);
+
 END_libipv6calc_db_wrapper:
 	// store in last used cache
-	cache_lu_ipv6addr_valid = 1;
+	cache_lu_ipv6addr_valid = WRAPPER_CACHE_GENERATION;
 	cache_lu_ipv6addr_registry_num = retval;
 	cache_lu_ipv6addr.in6_addr = ipv6addrp->in6_addr;
 
@@ -2611,13 +4105,15 @@ END_libipv6calc_db_wrapper_cached:
  * out: *resultstring = Registry string
  * ret: 0: ok
  */
-int libipv6calc_db_wrapper_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len) {
+static int libipv6calc_db_wrapper_info_by_ipv4addr_unlocked(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len) {
 	int retval = 1, f, p;
 
 #if defined SUPPORT_EXTERNAL
 	ipv6calc_ipaddr ipaddr;
 #endif
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x", ipv4addr_getdword(ipv4addrp));
 
 	f = IPV6CALC_DB_FEATURE_NUM_IPV4_TO_INFO;
@@ -2661,6 +4157,20 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * wrapper: info_by_ipv4addr with database handles pinned
+ */
+int libipv6calc_db_wrapper_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_info_by_ipv4addr_unlocked(ipv4addrp, string, string_len);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
 /*
  * get info string of an IPv6 address
  *
@@ -2668,13 +4178,15 @@ END_libipv6calc_db_wrapper:
  * out: *resultstring = Registry string
  * ret: 0: ok
  */
-int libipv6calc_db_wrapper_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len) {
+static int libipv6calc_db_wrapper_info_by_ipv6addr_unlocked(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len) {
 	int retval = 1, p, f;
 
 #if defined SUPPORT_EXTERNAL
 	ipv6calc_ipaddr ipaddr;
 #endif
 
+	LIBIPV6CALC_DB_WRAPPER_INIT_CHECK
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called: addr=%08x%08x%08x%08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
 
 	f = IPV6CALC_DB_FEATURE_NUM_IPV6_TO_INFO;
@@ -2718,6 +4230,20 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/*
+ * wrapper: info_by_ipv6addr with database handles pinned
+ */
+int libipv6calc_db_wrapper_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_info_by_ipv6addr_unlocked(ipv6addrp, string, string_len);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
 
 #ifdef HAVE_BERKELEY_DB_SUPPORT
 /********************************************
@@ -3320,6 +4846,145 @@ long int libipv6calc_db_wrapper_get_entry_generic(
 };
 
 
+/*
+ * generic internal database lookup function for several keys at once
+ *  binary searches of up to 'wrapper_lookup_interleave' keys are running
+ *  interleaved: each round probes one row per key and prefetches the row
+ *  of its next probe, so the cache misses of the keys are overlapping
+ *
+ * supported: IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST with IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY
+ *  (sorted, non-overlapping ranges), everything else is looked up key by key
+ *
+ * mod:	match_list: -1 : no lookup result
+ * 		    >= 0: matching row
+ */
+void libipv6calc_db_wrapper_get_entry_generic_batch(
+	const uint8_t	data_key_type,		// key type
+	const uint8_t	data_key_length,	// key length
+	const uint8_t	data_search_type,	// search type
+	const uint32_t	data_num_rows,		// number of rows
+	const int	count,			// number of keys
+	const uint32_t	*lookup_key_00_31_list,	// lookup keys MSB
+	const uint32_t	*lookup_key_32_63_list,	// lookup keys LSB (NULL in case of key length 32)
+	long int	*match_list,		// matching rows (-1: no lookup result)
+	const void	*data_array,		// pointer to array (prefetch only, can be NULL)
+	const size_t	data_row_size,		// size of an array row (prefetch only)
+	int  (*get_array_row)()			// function to get array row
+	) {
+
+	uint32_t base[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+	uint64_t key[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+	uint32_t value_first_00_31, value_last_00_31;
+	uint32_t value_first_32_63, value_last_32_63;
+	uint64_t value_first, value_last;
+	uint32_t len, half;
+	int k, k_start, k_count, interleave;
+
+	interleave = __atomic_load_n(&wrapper_lookup_interleave, __ATOMIC_RELAXED);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Called with data_key_type=%u data_key_length=%u data_num_rows=%u count=%d interleave=%d", data_key_type, data_key_length, data_num_rows, count, interleave);
+
+	if ((data_key_type != IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST)
+	    || (data_search_type != IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY)
+	    || (interleave <= 1)
+	    || (data_num_rows < 1)
+	    || ((data_key_length == 64) && (lookup_key_32_63_list == NULL))
+	) {
+		// key by key
+		for (k = 0; k < count; k++) {
+			match_list[k] = libipv6calc_db_wrapper_get_entry_generic(
+				NULL,							// pointer to data
+				IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,			// type of data_ptr
+				data_key_type,						// key type
+				0,							// key format (not relevant)
+				data_key_length,					// key length
+				data_search_type,					// search type
+				data_num_rows,						// number of rows
+				lookup_key_00_31_list[k],				// lookup key MSB
+				(lookup_key_32_63_list == NULL) ? 0 : lookup_key_32_63_list[k],	// lookup key LSB
+				NULL,							// data ptr (not used in IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
+				get_array_row						// function pointer
+			);
+		};
+		return;
+	};
+
+	if ((data_key_length != 32) && (data_key_length != 64)) {
+		ERRORPRINT_WA("unsupported data_key_length (FIX CODE): %d", data_key_length);
+		exit(EXIT_FAILURE);
+	};
+
+	for (k_start = 0; k_start < count; k_start += interleave) {
+		k_count = count - k_start;
+		if (k_count > interleave) {
+			k_count = interleave;
+		};
+
+		for (k = 0; k < k_count; k++) {
+			base[k] = 0;
+			key[k] = (uint64_t) lookup_key_00_31_list[k_start + k] << 32;
+			if (data_key_length == 64) {
+				key[k] |= lookup_key_32_63_list[k_start + k];
+			};
+		};
+
+		// all searches are running in lockstep: same remaining length for every key
+		len = data_num_rows;
+
+		while (len > 1) {
+			half = len / 2;
+
+			for (k = 0; k < k_count; k++) {
+				if (get_array_row(base[k] + half, &value_first_00_31, &value_first_32_63, &value_last_00_31, &value_last_32_63) < 0) {
+					ERRORPRINT_WA("can't retrieve keys from array for row: %lu", (unsigned long int) (base[k] + half));
+					exit(EXIT_FAILURE);
+				};
+
+				value_first = (uint64_t) value_first_00_31 << 32;
+				if (data_key_length == 64) {
+					value_first |= value_first_32_63;
+				};
+
+				// last row with first <= key
+				if (value_first <= key[k]) {
+					base[k] += half;
+				};
+
+				if ((data_array != NULL) && ((len - half) > 1)) {
+					IPV6CALC_DB_PREFETCH((const char *) data_array + (size_t) (base[k] + (len - half) / 2) * data_row_size);
+				};
+			};
+
+			len -= half;
+		};
+
+		for (k = 0; k < k_count; k++) {
+			if (get_array_row(base[k], &value_first_00_31, &value_first_32_63, &value_last_00_31, &value_last_32_63) < 0) {
+				ERRORPRINT_WA("can't retrieve keys from array for row: %lu", (unsigned long int) base[k]);
+				exit(EXIT_FAILURE);
+			};
+
+			value_first = (uint64_t) value_first_00_31 << 32;
+			value_last  = (uint64_t) value_last_00_31  << 32;
+			if (data_key_length == 64) {
+				value_first |= value_first_32_63;
+				value_last  |= value_last_32_63;
+			};
+
+			if ((value_first <= key[k]) && (key[k] <= value_last)) {
+				match_list[k_start + k] = base[k];
+			} else {
+				match_list[k_start + k] = -1;
+			};
+
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "Key %d: %016llx match=%ld", k_start + k, (unsigned long long) key[k], match_list[k_start + k]);
+		};
+	};
+
+	return;
+};
+
+
 /*********** generic function **********************/
 uint16_t libipv6calc_db_cc_to_index(const char *cc_text) {
 	uint16_t index = COUNTRYCODE_INDEX_UNKNOWN;
@@ -3546,9 +5211,14 @@ int libipv6calc_db_cc_filter(const uint16_t cc_index, const s_ipv6calc_filter_db
 
 	libipv6calc_db_wrapper_country_code_by_cc_index(cc1, sizeof(cc1), cc_index);
 
-	if (filter->cc_must_have_max > 0) {
+	if ((filter->cc_must_have_max > 0) || (filter->cc_must_have_set != NULL)) {
 		result = 1;
 
+		if ((filter->cc_must_have_set != NULL) && (libipv6calc_idset_test(filter->cc_must_have_set, cc_index) == 1)) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %s hits must-have set", cc1);
+			result = 0;
+		};
+
 		for (i = 0; i < filter->cc_must_have_max; i++) {
 			libipv6calc_db_wrapper_country_code_by_cc_index(cc2, sizeof(cc2), filter->cc_must_have[i]);
 
@@ -3580,6 +5250,11 @@ int libipv6calc_db_cc_filter(const uint16_t cc_index, const s_ipv6calc_filter_db
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: no may-not-have defined");
 	};
 
+	if ((filter->cc_may_not_have_set != NULL) && (libipv6calc_idset_test(filter->cc_may_not_have_set, cc_index) == 1)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter: %s hits may-not-have set", cc1);
+		result = 1;
+	};
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.cc filter final result: %d", result);
 	return (result);
 };
@@ -3741,9 +5416,14 @@ END_ipv6calc_db_asn_filter_check:
 int libipv6calc_db_asn_filter(const uint32_t asn, const s_ipv6calc_filter_db_asn *filter) {
 	int i, result = -1;
 
-	if (filter->asn_must_have_max > 0) {
+	if ((filter->asn_must_have_max > 0) || (filter->asn_must_have_set != NULL)) {
 		result = 1;
 
+		if ((filter->asn_must_have_set != NULL) && (libipv6calc_idset_test(filter->asn_must_have_set, asn) == 1)) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits must-have set", asn);
+			result = 0;
+		};
+
 		for (i = 0; i < filter->asn_must_have_max; i++) {
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: check %u against must-have: %u", asn, filter->asn_must_have[i]);
 			if (asn == filter->asn_must_have[i]) {
@@ -3769,6 +5449,11 @@ int libipv6calc_db_asn_filter(const uint32_t asn, const s_ipv6calc_filter_db_asn
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: no may-not-have defined");
 	};
 
+	if ((filter->asn_may_not_have_set != NULL) && (libipv6calc_idset_test(filter->asn_may_not_have_set, asn) == 1)) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter: %u hits may-not-have set", asn);
+		result = 1;
+	};
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "db.asn filter final result: %d", result);
 	return (result);
 };
@@ -3969,6 +5654,113 @@ int libipv6calc_db_registry_filter(const uint32_t registry, const s_ipv6calc_fil
 };
 
 
+/*******************************
+ * Support for merged database creation (databases/tools/ipv6calc-db-merged-create)
+ *******************************/
+
+/*
+ * source selected for a feature at given priority
+ *
+ * in : f = feature number, p = priority (0 = highest)
+ * out: source number, 0 = none
+ */
+int libipv6calc_db_wrapper_source_by_feature(const int f, const int p) {
+	if ((f < IPV6CALC_DB_FEATURE_NUM_MIN) || (f > IPV6CALC_DB_FEATURE_NUM_MAX) || (p < 0) || (p >= IPV6CALC_DB_PRIO_MAX)) {
+		return(0);
+	};
+
+	return(wrapper_features_selector[f][p]);
+};
+
+
+/*
+ * last entry of the range of a source containing the given address
+ *  (IPv4: address, IPv6: prefix bits 0-63)
+ *
+ * in : ipaddrp (IPv6: only prefix bits 0-63 are used), source
+ * mod: lastp
+ * out: 0=ok, 1=range not retrievable from source, 2=source contains IPv6 entry longer than /64
+ */
+static int libipv6calc_db_wrapper_range_last_by_addr_unlocked(const ipv6calc_ipaddr *ipaddrp, const int source, uint64_t *lastp) {
+	uint64_t first;
+	int plen = -1, result = 1;
+
+#ifdef SUPPORT_BUILTIN
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+#endif
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		first = ipaddrp->addr[0];
+	} else {
+		first = ((uint64_t) ipaddrp->addr[0] << 32) | ipaddrp->addr[1];
+	};
+
+	switch (source) {
+	    case IPV6CALC_DB_SOURCE_BUILTIN:
+#ifdef SUPPORT_BUILTIN
+		// ranges of BuiltIn tables are aligned to prefix bits 0-63
+		if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+			CONVERT_IPADDRP_IPV4ADDR(ipaddrp, ipv4addr);
+			*lastp = libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv4addr(&ipv4addr);
+		} else {
+			CONVERT_IPADDRP_IPV6ADDR(ipaddrp, ipv6addr);
+			*lastp = libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv6addr(&ipv6addr);
+		};
+		result = 0;
+#endif
+		break;
+
+	    case IPV6CALC_DB_SOURCE_GEOIP2:
+#ifdef SUPPORT_GEOIP2
+		plen = libipv6calc_db_wrapper_GeoIP2_wrapper_prefixlength_by_addr(ipaddrp);
+#endif
+		break;
+
+	    case IPV6CALC_DB_SOURCE_DBIP2:
+#ifdef SUPPORT_DBIP2
+		plen = libipv6calc_db_wrapper_DBIP2_wrapper_prefixlength_by_addr(ipaddrp);
+#endif
+		break;
+	};
+
+	if (plen >= 0) {
+		if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+			*lastp = (plen >= 32) ? first : (first | (0xffffffffu >> plen));
+			result = 0;
+		} else if (plen > 64) {
+			// more specific entries would be hidden behind the value of the first address of the /64
+			result = 2;
+		} else {
+			*lastp = (plen == 64) ? first : (first | (UINT64_MAX >> plen));
+			result = 0;
+		};
+	};
+
+	if ((result == 0) && (*lastp < first)) {
+		*lastp = first; // failsafe
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper, "addr=%08x%08x proto=%d source=%d plen=%d result=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->proto, source, plen, result);
+
+	return(result);
+};
+
+
+/*
+ * wrapper: range_last_by_addr with database handles pinned
+ */
+int libipv6calc_db_wrapper_range_last_by_addr(const ipv6calc_ipaddr *ipaddrp, const int source, uint64_t *lastp) {
+	int result;
+
+	libipv6calc_db_wrapper_read_lock();
+	result = libipv6calc_db_wrapper_range_last_by_addr_unlocked(ipaddrp, source, lastp);
+	libipv6calc_db_wrapper_read_unlock();
+
+	return(result);
+};
+
+
 /*
  * return library version numeric
  */
@@ -144,8 +144,9 @@ static const s_formatoption ipv6calc_db_features[] = {
 #define IPV6CALC_DB_SOURCE_DBIP			5
 #define IPV6CALC_DB_SOURCE_EXTERNAL		6
 #define IPV6CALC_DB_SOURCE_BUILTIN		7
+#define IPV6CALC_DB_SOURCE_MERGED		8
 
-#define IPV6CALC_DB_SOURCE_MAX			7
+#define IPV6CALC_DB_SOURCE_MAX			8
 
 #define IPV6CALC_DB_PRIO_MAX			IPV6CALC_DB_SOURCE_MAX
 
@@ -163,6 +164,7 @@ static const s_data_sources data_sources[] = {
 	{ IPV6CALC_DB_SOURCE_DBIP2	, "db-ip.com(MaxMindDB)", "DBIP2"       },
 	{ IPV6CALC_DB_SOURCE_EXTERNAL	, "External"   , "External"    },
 	{ IPV6CALC_DB_SOURCE_BUILTIN	, "BuiltIn"    , "BuiltIn"     },
+	{ IPV6CALC_DB_SOURCE_MERGED	, "Merged"     , "Merged"      },
 };
 
 // database names and descriptions
@@ -268,6 +270,16 @@ static const s_data_sources geonameid_types[] = {
 	{ IPV6CALC_DB_GEO_GEONAMEID_TYPE_CITY		, "City"      , "City"       },
 };
 
+// identity of an opened database file (for detection of replacement on disk)
+typedef struct
+{
+	uint64_t dev;
+	uint64_t ino;
+	int64_t  mtime;
+	int64_t  size;
+	int      valid;
+} s_ipv6calc_db_file_stamp;
+
 // define internal API versions
 #define IPV6CALC_DB_API_GEOIP		1
 #define IPV6CALC_DB_API_IP2LOCATION	1
@@ -332,6 +344,17 @@ static const s_data_sources geonameid_types[] = {
 #define IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY	1	 // binary search
 #define IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_SEQLONGEST	2	 // sequential longest match
 
+// batch lookup: number of binary searches running interleaved
+#define IPV6CALC_DB_LOOKUP_INTERLEAVE_DEFAULT	16
+#define IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX	64
+
+// prefetch of next probe of an interleaved binary search
+#if defined(__GNUC__) || defined(__clang__)
+#define IPV6CALC_DB_PREFETCH(ptr)	__builtin_prefetch((ptr), 0, 1)
+#else
+#define IPV6CALC_DB_PREFETCH(ptr)	((void) (ptr))
+#endif
+
 // Berkeley DB  lookup function
 #ifdef HAVE_BERKELEY_DB_SUPPORT
 #define IPV6CALC_DB_LOOKUP_DATA_DBD_FORMAT_SEMICOLON_SEP_DEC_32x2		0
@@ -362,6 +385,7 @@ typedef struct {
 
 
 extern int  libipv6calc_db_wrapper_init(const char *prefix_string);
+extern int  libipv6calc_db_wrapper_init_lazy(const char *prefix_string);
 extern int  libipv6calc_db_wrapper_cleanup(void);
 extern void libipv6calc_db_wrapper_info(char *string, const size_t size);
 extern void libipv6calc_db_wrapper_features(char *string, const size_t size);
@@ -369,10 +393,24 @@ extern void libipv6calc_db_wrapper_capabilities(char *string, const size_t size)
 extern void libipv6calc_db_wrapper_features_help(void);
 extern void libipv6calc_db_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern void libipv6calc_db_wrapper_print_features_verbose(const int level_verbose);
+extern void libipv6calc_db_wrapper_print_init_cost(void);
 extern int  libipv6calc_db_wrapper_has_features(uint32_t features);
 extern int  libipv6calc_db_wrapper_options(const int opt, const char *optarg, const struct option longopts[]);
 extern const char *libipv6calc_db_wrapper_get_data_source_name_by_number(const unsigned int number);
 
+// reload of changed database files
+extern int  libipv6calc_db_wrapper_reload(void);
+extern int  libipv6calc_db_wrapper_reload_check(void);
+extern void libipv6calc_db_wrapper_reload_request(void);
+extern int  libipv6calc_db_wrapper_reload_on_signal(const int signum);
+extern int  libipv6calc_db_wrapper_reload_enabled(void);
+extern int  libipv6calc_db_wrapper_reopen(void);
+extern void libipv6calc_db_wrapper_read_lock(void);
+extern void libipv6calc_db_wrapper_read_unlock(void);
+extern int  libipv6calc_db_wrapper_slot(void);
+extern void libipv6calc_db_wrapper_file_stamp_get(const char *filename, s_ipv6calc_db_file_stamp *stampp);
+extern int  libipv6calc_db_wrapper_file_stamp_changed(const char *filename, const s_ipv6calc_db_file_stamp *stampp);
+
 
 /* functional wrappers */
 
@@ -390,6 +428,10 @@ extern uint32_t    libipv6calc_db_wrapper_as_num32_decomp17(const uint32_t as_nu
 // GeonameID
 extern uint32_t    libipv6calc_db_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr);
 
+// CountryCode, Autonomous System, GeonameID and Registry by one lookup per database
+extern void        libipv6calc_db_wrapper_attributes_clear(s_ipv6calc_db_attributes *recordp);
+extern int         libipv6calc_db_wrapper_all_by_addr(const ipv6calc_ipaddr *ipaddrp, const int attributes, s_ipv6calc_db_attributes *recordp);
+
 // Registries
 extern int         libipv6calc_db_wrapper_registry_num_by_as_num32(const uint32_t as_num32);
 extern int         libipv6calc_db_wrapper_registry_num_by_cc_index(const uint16_t cc_index);
@@ -403,6 +445,7 @@ extern int libipv6calc_db_wrapper_ieee_vendor_string_short_by_macaddr(char *resu
 // IPv4 Registry
 extern int libipv6calc_db_wrapper_registry_string_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *resultstring, const size_t resultstring_length);
 extern int libipv6calc_db_wrapper_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp);
+extern void libipv6calc_db_wrapper_registry_num_by_ipv4addr_batch(const ipv6calc_ipv4addr *ipv4addr_list, int *registry_list, const int count);
 extern int libipv6calc_db_wrapper_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len);
 
 // IPv6 Registry
@@ -410,6 +453,12 @@ extern int libipv6calc_db_wrapper_registry_string_by_ipv6addr(const ipv6calc_ipv
 extern int libipv6calc_db_wrapper_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp);
 extern int libipv6calc_db_wrapper_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len);
 
+// Merged database creation
+extern int libipv6calc_db_wrapper_source_by_feature(const int f, const int p);
+extern int libipv6calc_db_wrapper_range_last_by_addr(const ipv6calc_ipaddr *ipaddrp, const int source, uint64_t *lastp);
+extern int libipv6calc_db_wrapper_registry_num_by_ipv4addr_db(const ipv6calc_ipv4addr *ipv4addrp);
+extern int libipv6calc_db_wrapper_registry_num_by_ipv6addr_db(const ipv6calc_ipv6addr *ipv6addrp);
+
 // geolocation record
 extern void libipv6calc_db_wrapper_geolocation_record_clear(libipv6calc_db_wrapper_geolocation_record *recordp);
 
@@ -432,6 +481,21 @@ extern long int libipv6calc_db_wrapper_get_entry_generic(
 	int  (*get_array_row)()			// function to get array row
 	);
 
+// generic DB lookup of several keys at once (interleaved binary searches)
+extern void libipv6calc_db_wrapper_get_entry_generic_batch(
+	const uint8_t	data_key_type,		// key type
+	const uint8_t	data_key_length,	// key length
+	const uint8_t	data_search_type,	// search type
+	const uint32_t	data_num_rows,		// number of rows
+	const int	count,			// number of keys
+	const uint32_t	*lookup_key_00_31_list,	// lookup keys MSB
+	const uint32_t	*lookup_key_32_63_list,	// lookup keys LSB (NULL in case of key length 32)
+	long int	*match_list,		// matching rows (-1: no lookup result)
+	const void	*data_array,		// pointer to array (prefetch only, can be NULL)
+	const size_t	data_row_size,		// size of an array row (prefetch only)
+	int  (*get_array_row)()			// function to get array row
+	);
+
 /* filter powered by database */
 extern int libipv6calc_db_cc_filter_parse(s_ipv6calc_filter_db_cc *filter, const char *token, const int negate_flag);
 extern int libipv6calc_db_cc_filter_check(const s_ipv6calc_filter_db_cc *filter, const int proto);
@@ -623,18 +623,23 @@ int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(char *res
 
 #ifdef SUPPORT_DB_IPV4_REG
 /*
- * dbipv4addr_assignment / get row (callback function for retrieving value from array)
+ * dbipv4addr_assignment_packed / get row (callback function for retrieving value from array)
+ *  range of row: start of row until start of next row - 1
  */
-int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment(const uint32_t row, uint32_t *key_first_00_31_ptr, uint32_t *key_first_32_63_ptr, uint32_t *key_last_00_31_ptr, uint32_t *key_last_32_63_ptr) {
+int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_packed(const uint32_t row, uint32_t *key_first_00_31_ptr, uint32_t *key_first_32_63_ptr, uint32_t *key_last_00_31_ptr, uint32_t *key_last_32_63_ptr) {
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Called fetching row: %lu", (unsigned long int) row);
 
-	if (row >= MAXENTRIES_ARRAY(dbipv4addr_assignment)) {
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "row out of range: %lu (maximum: %lu)", (unsigned long int) row, (unsigned long int) MAXENTRIES_ARRAY(dbipv4addr_assignment) - 1);
+	if (row >= DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "row out of range: %lu (maximum: %lu)", (unsigned long int) row, (unsigned long int) DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS - 1);
 		return(1);
 	};
 
-	*key_first_00_31_ptr = dbipv4addr_assignment[row].first;
-	*key_last_00_31_ptr  = dbipv4addr_assignment[row].last;
+	*key_first_00_31_ptr = dbipv4addr_assignment_packed_start[row];
+	if (row + 1 < DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS) {
+		*key_last_00_31_ptr  = dbipv4addr_assignment_packed_start[row + 1] - 1;
+	} else {
+		*key_last_00_31_ptr  = 0xffffffffu;
+	};
 	*key_first_32_63_ptr = 0;
 	*key_last_32_63_ptr  = 0;
 
@@ -649,27 +654,61 @@ int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment(const uint32_t
 
 
 /*
- * dbipv4addr_assignment_iana / get row (callback function for retrieving value from array)
+ * dbipv4addr_assignment_packed / get row of IPv4 address
+ *  binary search in block index, then scan of one block (one cache line)
+ *  packed table covers the whole address space, so always a row is found
  */
-int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_iana(const uint32_t row, uint32_t *key_first_00_31_ptr, uint32_t *key_first_32_63_ptr, uint32_t *key_last_00_31_ptr, uint32_t *key_last_32_63_ptr) {
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Called fetching row: %lu", (unsigned long int) row);
+static uint32_t libipv6calc_db_wrapper_BuiltIn_packed_row_by_ipv4(const uint32_t ipv4) {
+	int i_min = 0, i_max = MAXENTRIES_ARRAY(dbipv4addr_assignment_packed_index) - 1, i;
+	uint32_t row, row_max;
+
+	// last block with start <= ipv4 (first start is 0)
+	while (i_min < i_max) {
+		i = (i_min + i_max + 1) / 2;
+		if (dbipv4addr_assignment_packed_index[i] <= ipv4) {
+			i_min = i;
+		} else {
+			i_max = i - 1;
+		};
+	};
+
+	row = i_min * DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK;
+	row_max = row + DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK;
+	if (row_max > DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS) {
+		row_max = DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS;
+	};
+
+	// last row in block with start <= ipv4
+	while ((row + 1 < row_max) && (dbipv4addr_assignment_packed_start[row + 1] <= ipv4)) {
+		row++;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given IPv4 address: %08x row=%u start=%08x", (unsigned int) ipv4, (unsigned int) row, (unsigned int) dbipv4addr_assignment_packed_start[row]);
+
+	return(row);
+};
+
+#define DBIPV4ADDR_ASSIGNMENT_PACKED_REGISTRY(row)	((dbipv4addr_assignment_packed_registry[(row) >> 1] >> (((row) & 1) * 4)) & 0xf)
 
-	if (row >= MAXENTRIES_ARRAY(dbipv4addr_assignment_iana)) {
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "row out of range: %lu (maximum: %lu)", (unsigned long int) row, (unsigned long int) MAXENTRIES_ARRAY(dbipv4addr_assignment_iana) - 1);
+
+/*
+ * dbipv4addr_assignment_packed_index / get row (callback function for retrieving value from array)
+ *  range of block: start of block until start of next block - 1
+ */
+static int libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_packed_index(const uint32_t row, uint32_t *key_first_00_31_ptr, uint32_t *key_first_32_63_ptr, uint32_t *key_last_00_31_ptr, uint32_t *key_last_32_63_ptr) {
+	if (row >= MAXENTRIES_ARRAY(dbipv4addr_assignment_packed_index)) {
 		return(1);
 	};
 
-	*key_first_00_31_ptr = dbipv4addr_assignment_iana[row].first;
-	*key_last_00_31_ptr  = dbipv4addr_assignment_iana[row].last;
+	*key_first_00_31_ptr = dbipv4addr_assignment_packed_index[row];
+	if (row + 1 < MAXENTRIES_ARRAY(dbipv4addr_assignment_packed_index)) {
+		*key_last_00_31_ptr  = dbipv4addr_assignment_packed_index[row + 1] - 1;
+	} else {
+		*key_last_00_31_ptr  = 0xffffffffu;
+	};
 	*key_first_32_63_ptr = 0;
 	*key_last_32_63_ptr  = 0;
 
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Keys for row: %lu key_first_00_31_ptr=%08lx key_last_00_31_ptr=%08lxu",
-		(unsigned long int) row,
-		(unsigned long int) *key_first_00_31_ptr,
-		(unsigned long int) *key_last_00_31_ptr
-	);
-
 	return(0);
 };
 
@@ -715,60 +754,127 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4a
 	int result = IPV4_ADDR_REGISTRY_UNKNOWN;
 
 #ifdef SUPPORT_DB_IPV4_REG
-	int match = -1;
+	uint32_t row;
 
-	match = libipv6calc_db_wrapper_get_entry_generic(
-		NULL,							// pointer to data
-		IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,			// type of data_ptr
-		IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
-		0,							// key format (not relevant)
-		32,							// key length
-		IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,		// search type
-		MAXENTRIES_ARRAY(dbipv4addr_assignment),		// number of rows
-		ipv4,							// lookup key MSB
-		0,							// lookup key LSB
-		NULL,							// data ptr (not used in IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
-		libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment	// function pointer
-	);
+	// packed table contains IANA fallback already
+	row = libipv6calc_db_wrapper_BuiltIn_packed_row_by_ipv4(ipv4);
+	result = DBIPV4ADDR_ASSIGNMENT_PACKED_REGISTRY(row);
 
-	if (match > -1) {
-		result = dbipv4addr_assignment[match].registry;
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished with success result (dbipv4addr_assignment): match=%d reg=%d", match, result);
+	if (result != IPV4_ADDR_REGISTRY_UNKNOWN) {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished with success result (dbipv4addr_assignment_packed): row=%u reg=%d", (unsigned int) row, result);
 		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
+	} else {
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished without success");
+	};
+#endif // SUPPORT_DB_IPV4_REG
+
+	return(result);
+};
+
+
+/*
+ * get registry numbers of a list of IPv4 addresses at once
+ *  blocks of the packed table are found by interleaved binary searches in the
+ *  block index, rows of all found blocks are prefetched before they are scanned
+ *
+ * in:  ipv4_list = IPv4 addresses
+ * in:  count = number of entries
+ * mod: registry_list = registry numbers
+ */
+void libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(const uint32_t *ipv4_list, int *registry_list, const int count) {
+	int i;
+
+#ifdef SUPPORT_DB_IPV4_REG
+	long int match_list[IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX];
+	uint32_t row, row_max;
+	int i_start, n, found = 0;
+#endif
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given IPv4 addresses: %d", count);
+
+	for (i = 0; i < count; i++) {
+		registry_list[i] = IPV4_ADDR_REGISTRY_UNKNOWN;
 	};
 
-	if (result == IPV4_ADDR_REGISTRY_UNKNOWN) {
-		// IANA fallback
-		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Nothing found in dbipv4addr_assignment, fallback now to dbipv4addr_assignment_iana");
+#ifdef SUPPORT_DB_IPV4_REG
+	for (i_start = 0; i_start < count; i_start += IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX) {
+		n = count - i_start;
+		if (n > IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX) {
+			n = IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX;
+		};
 
-		match = libipv6calc_db_wrapper_get_entry_generic(
-			NULL,							// pointer to data
-			IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,			// type of data_ptr
+		libipv6calc_db_wrapper_get_entry_generic_batch(
 			IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,		// key type
-			0,							// key format (not relevant)
 			32,							// key length
 			IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,		// search type
-			MAXENTRIES_ARRAY(dbipv4addr_assignment_iana),		// number of rows
-			ipv4,							// lookup key MSB
-			0,							// lookup key LSB
-			NULL,							// data ptr (not used in IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
-			libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_iana	// function pointer
+			MAXENTRIES_ARRAY(dbipv4addr_assignment_packed_index),	// number of rows
+			n,							// number of keys
+			&ipv4_list[i_start],					// lookup keys MSB
+			NULL,							// lookup keys LSB
+			match_list,						// matching rows
+			dbipv4addr_assignment_packed_index,			// array (prefetch)
+			sizeof(dbipv4addr_assignment_packed_index[0]),		// size of array row (prefetch)
+			libipv6calc_db_wrapper_BuiltIn_get_row_dbipv4addr_assignment_packed_index	// function pointer
 		);
 
-		if (match > -1) {
-			result = dbipv4addr_assignment_iana[match].registry;
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished with success result (dbipv4addr_assignment_iana): match=%d reg=%d", match, result);
-			BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
-		} else {
-			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Finished without success");
+		// block index covers the whole address space, so always a block is found
+		for (i = 0; i < n; i++) {
+			IPV6CALC_DB_PREFETCH(&dbipv4addr_assignment_packed_start[match_list[i] * DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK]);
+		};
+
+		for (i = 0; i < n; i++) {
+			row = match_list[i] * DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK;
+			row_max = row + DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK;
+			if (row_max > DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS) {
+				row_max = DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS;
+			};
+
+			// last row in block with start <= ipv4
+			while ((row + 1 < row_max) && (dbipv4addr_assignment_packed_start[row + 1] <= ipv4_list[i_start + i])) {
+				row++;
+			};
+
+			registry_list[i_start + i] = DBIPV4ADDR_ASSIGNMENT_PACKED_REGISTRY(row);
+			if (registry_list[i_start + i] != IPV4_ADDR_REGISTRY_UNKNOWN) {
+				found = 1;
+			};
 		};
 	};
+
+	if (found == 1) {
+		BUILTIN_DB_USAGE_MAP_TAG(BUILTIN_DB_IPV4_REGISTRY);
+	};
 #endif // SUPPORT_DB_IPV4_REG
 
-	return(result);
+	return;
 };
 
 
+/*
+ * get last address of the range starting at an IPv4 address with unchanged registry
+ *
+ * in:  ipv4addr = IPv4 address structure
+ * out: last IPv4 address of range
+ */
+uint32_t libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp) {
+	uint32_t ipv4 = ipv4addr_getdword(ipv4addrp);
+	uint32_t last = 0xffffffffu;
+
+#ifdef SUPPORT_DB_IPV4_REG
+	uint32_t row;
+
+	// neighbor rows of packed table have different registry
+	row = libipv6calc_db_wrapper_BuiltIn_packed_row_by_ipv4(ipv4);
+	if (row + 1 < DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS) {
+		last = dbipv4addr_assignment_packed_start[row + 1] - 1;
+	};
+#endif // SUPPORT_DB_IPV4_REG
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given IPv4 address: %08x last=%08x", (unsigned int) ipv4, (unsigned int) last);
+
+	return(last);
+};
+
 /*
  * get info of an IPv4 address
  *
@@ -920,6 +1026,43 @@ int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv6addr(const ipv6calc_ipv6a
 };
 
 
+/*
+ * get last prefix (0-63) of the range starting at an IPv6 address with unchanged registry
+ *  table contains nested prefixes (longest match), so range ends at end of
+ *  any covering prefix or before begin of any following prefix
+ *
+ * in:  ipv6addr = IPv6 address structure
+ * out: last prefix (0-63) of range
+ */
+uint64_t libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp) {
+	uint64_t prefix = ((uint64_t) ipv6addr_getdword(ipv6addrp, 0) << 32) | ipv6addr_getdword(ipv6addrp, 1);
+	uint64_t last = UINT64_MAX;
+
+#ifdef SUPPORT_DB_IPV6_REG
+	uint64_t base, mask;
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(dbipv6addr_assignment); i++) {
+		base = ((uint64_t) dbipv6addr_assignment[i].ipv6addr_00_31 << 32) | dbipv6addr_assignment[i].ipv6addr_32_63;
+		mask = ((uint64_t) dbipv6addr_assignment[i].ipv6mask_00_31 << 32) | dbipv6addr_assignment[i].ipv6mask_32_63;
+
+		if ((prefix & mask) == base) {
+			if ((base | ~mask) < last) {
+				last = base | ~mask;
+			};
+		} else if (base > prefix) {
+			if ((base - 1) < last) {
+				last = base - 1;
+			};
+		};
+	};
+#endif // SUPPORT_DB_IPV6_REG
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_BuiltIn, "Given ipv6 prefix: %016llx last=%016llx", (unsigned long long) prefix, (unsigned long long) last);
+
+	return(last);
+};
+
 /*
  * get info of an IPv6 address
  *
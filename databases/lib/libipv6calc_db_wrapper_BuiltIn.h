@@ -110,8 +110,11 @@ extern int libipv6calc_db_wrapper_BuiltIn_ieee_vendor_string_short_by_macaddr(ch
 
 // IPv4 Registry
 extern int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp);
+extern void libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv4addr_batch(const uint32_t *ipv4_list, int *registry_list, const int count);
 extern int libipv6calc_db_wrapper_BuiltIn_info_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, char *string, const size_t string_len);
+extern uint32_t libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp);
 
 // IPv6 Registry
 extern int libipv6calc_db_wrapper_BuiltIn_registry_num_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp);
 extern int libipv6calc_db_wrapper_BuiltIn_info_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, char *string, const size_t string_len);
+extern uint64_t libipv6calc_db_wrapper_BuiltIn_range_last_by_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp);
@@ -86,8 +86,9 @@ static uint32_t dbip_db_usage_map[DBIP_DB_MAX_BLOCKS_32];
 char dbip_db_usage_string[NI_MAXHOST] = "";
 
 // local cache
-static DB*      db_ptr_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)];
-static db_recno_t db_recno_max_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)];
+static DB*      db_ptr_cache[2][MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)]; // per slot, see libipv6calc_db_wrapper_slot
+static db_recno_t db_recno_max_cache[2][MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)];
+static s_ipv6calc_db_file_stamp db_stamp_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)];
 
 // creation time of databases
 time_t wrapper_db_unixtime_DBIP[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc)];
@@ -104,6 +105,7 @@ static int libipv6calc_db_wrapper_DBIP_close(DB *dbp);
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_DBIP_wrapper_init(void) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int i, dbym, dbtype, ret, product;
 	DB *dbp;
 	char datastring[NI_MAXHOST];
@@ -131,8 +133,8 @@ int libipv6calc_db_wrapper_DBIP_wrapper_init(void) {
 		};
 
 		// clean local cache
-		db_ptr_cache[i] = NULL;
-		db_recno_max_cache[i] = -1;
+		db_ptr_cache[slot][i] = NULL;
+		db_recno_max_cache[slot][i] = -1;
 
 		dbp = libipv6calc_db_wrapper_DBIP_open_type(libipv6calc_db_wrapper_DBIP_db_file_desc[i].number | 0x10000, NULL);
 		if (dbp == NULL) {
@@ -243,7 +245,7 @@ int libipv6calc_db_wrapper_DBIP_wrapper_init(void) {
 
 	/* close handles which are not necessary further on */
 	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
-		if (db_ptr_cache[i] != NULL) {
+		if (db_ptr_cache[slot][i] != NULL) {
 			if (
 				(libipv6calc_db_wrapper_DBIP_db_file_desc[i].number == dbip_db_country_v4_best[DBIP_FREE].num)
 			    ||	(libipv6calc_db_wrapper_DBIP_db_file_desc[i].number == dbip_db_country_v4_best[DBIP_COMM].num)
@@ -255,7 +257,7 @@ int libipv6calc_db_wrapper_DBIP_wrapper_init(void) {
 			};
 
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Close further unused DBIP: type=%d desc='%s'", libipv6calc_db_wrapper_DBIP_db_file_desc[i].number, libipv6calc_db_wrapper_DBIP_db_file_desc[i].description);
-			libipv6calc_db_wrapper_DBIP_close(db_ptr_cache[i]);
+			libipv6calc_db_wrapper_DBIP_close(db_ptr_cache[slot][i]);
 		};
 	};
 
@@ -269,16 +271,18 @@ int libipv6calc_db_wrapper_DBIP_wrapper_init(void) {
  * wrapper: DBIP_close
  */
 static int libipv6calc_db_wrapper_DBIP_close(DB *dbp) {
-	int i;
+	int i, slot;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP, "Called");
 
 	if (dbp != NULL) {
 		/* cleanup cache entry */
-		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
-			if (db_ptr_cache[i] == dbp) {
-				db_ptr_cache[i] = NULL;
-				db_recno_max_cache[i] = -1;
+		for (slot = 0; slot < 2; slot++) {
+			for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
+				if (db_ptr_cache[slot][i] == dbp) {
+					db_ptr_cache[slot][i] = NULL;
+					db_recno_max_cache[slot][i] = -1;
+				};
 			};
 		};
 
@@ -296,14 +300,17 @@ static int libipv6calc_db_wrapper_DBIP_close(DB *dbp) {
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_DBIP_wrapper_cleanup(void) {
-	int i;
+	int i, slot;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_DBIP, "Called");
 
-	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
-		if (db_ptr_cache[i] != NULL) {
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Close DBIP: type=%d desc='%s'", libipv6calc_db_wrapper_DBIP_db_file_desc[i].number, libipv6calc_db_wrapper_DBIP_db_file_desc[i].description);
-			libipv6calc_db_wrapper_DBIP_close(db_ptr_cache[i]);
+	for (slot = 0; slot < 2; slot++) {
+		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
+			if (db_ptr_cache[slot][i] != NULL) {
+				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Close DBIP: slot=%d type=%d desc='%s'", slot, libipv6calc_db_wrapper_DBIP_db_file_desc[i].number, libipv6calc_db_wrapper_DBIP_db_file_desc[i].description);
+				// clears entries of both slots
+				libipv6calc_db_wrapper_DBIP_close(db_ptr_cache[slot][i]);
+			};
 		};
 	};
 
@@ -312,6 +319,90 @@ int libipv6calc_db_wrapper_DBIP_wrapper_cleanup(void) {
 };
 
 
+/*
+ * function reload the DBIP databases in case replaced on disk
+ *  handles of slot_old are copied to the current slot first,
+ *  new file is opened there, handle in use is kept on failure
+ *
+ * in : slot_old
+ * out: number of reloaded databases
+ */
+int libipv6calc_db_wrapper_DBIP_wrapper_reload(const int slot_old) {
+	int i, type;
+	int result = 0;
+	int slot = libipv6calc_db_wrapper_slot();
+	DB *dbp;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Called slot_old=%d slot=%d", slot_old, slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
+		db_ptr_cache[slot][i] = db_ptr_cache[slot_old][i];
+		db_recno_max_cache[slot][i] = db_recno_max_cache[slot_old][i];
+
+		if (db_ptr_cache[slot][i] == NULL) {
+			// not open
+			continue;
+		};
+
+		type = libipv6calc_db_wrapper_DBIP_db_file_desc[i].number;
+
+		if (libipv6calc_db_wrapper_file_stamp_changed(libipv6calc_db_wrapper_DBIP_dbfilename(type), &db_stamp_cache[i]) == 0) {
+			continue;
+		};
+
+		db_ptr_cache[slot][i] = NULL;
+		db_recno_max_cache[slot][i] = -1;
+
+		dbp = libipv6calc_db_wrapper_DBIP_open_type(type, NULL);
+
+		if (dbp == NULL) {
+			NONQUIETPRINT_WA("DBIP database replaced on disk but not usable, keep current one: %s", libipv6calc_db_wrapper_DBIP_dbfilename(type));
+			db_ptr_cache[slot][i] = db_ptr_cache[slot_old][i];
+			db_recno_max_cache[slot][i] = db_recno_max_cache[slot_old][i];
+			// don't retry until next replacement
+			libipv6calc_db_wrapper_file_stamp_get(libipv6calc_db_wrapper_DBIP_dbfilename(type), &db_stamp_cache[i]);
+			continue;
+		};
+
+		// old handle stays in slot_old until released
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database reloaded: type=%d desc='%s'", type, libipv6calc_db_wrapper_DBIP_db_file_desc[i].description);
+		result++;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Finished, reloaded: %d", result);
+	return(result);
+};
+
+
+/*
+ * function release the DBIP databases of a retired slot
+ *  handles still in use by the other slot are kept open
+ *
+ * in : slot
+ */
+void libipv6calc_db_wrapper_DBIP_wrapper_release(const int slot) {
+	int i;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Called slot=%d", slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_DBIP_db_file_desc); i++) {
+		if (db_ptr_cache[slot][i] == NULL) {
+			continue;
+		};
+
+		if (db_ptr_cache[slot][i] == db_ptr_cache[1 - slot][i]) {
+			// shared
+			db_ptr_cache[slot][i] = NULL;
+			db_recno_max_cache[slot][i] = -1;
+			continue;
+		};
+
+		libipv6calc_db_wrapper_DBIP_close(db_ptr_cache[slot][i]);
+	};
+};
+
+
 /*
  * function info of DBIP wrapper
  *
@@ -603,6 +694,7 @@ END_libipv6calc_db_wrapper:
  * 	db_recno_max_ptr (set if not NULL)
  */
 DB *libipv6calc_db_wrapper_DBIP_open_type(const unsigned int type_flag, long int *db_recno_max_ptr) {
+	int slot = libipv6calc_db_wrapper_slot();
 	DB *dbp = NULL;
 	DBC *dbcp;
 	DBT key, data;
@@ -627,15 +719,15 @@ DB *libipv6calc_db_wrapper_DBIP_open_type(const unsigned int type_flag, long int
 		return(NULL);
 	};
 
-	if ((info_selector == 0) && (db_ptr_cache[entry] != NULL)) {
+	if ((info_selector == 0) && (db_ptr_cache[slot][entry] != NULL)) {
 		// already open
-		dbp = db_ptr_cache[entry];
+		dbp = db_ptr_cache[slot][entry];
 
 		if (db_recno_max_ptr != NULL) {
-			*db_recno_max_ptr = db_recno_max_cache[entry];
+			*db_recno_max_ptr = db_recno_max_cache[slot][entry];
 		};
 
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database already opened (cached) dbp=%p type=%d recno_max: %u", dbp, type, db_recno_max_cache[entry]);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database already opened (cached) dbp=%p type=%d recno_max: %u", dbp, type, db_recno_max_cache[slot][entry]);
 		goto END_libipv6calc_db_wrapper;
 	};
 
@@ -662,7 +754,8 @@ DB *libipv6calc_db_wrapper_DBIP_open_type(const unsigned int type_flag, long int
 
 	if (info_selector == 0) {
 		// cache entry
-		db_ptr_cache[entry] = dbp;
+		db_ptr_cache[slot][entry] = dbp;
+		libipv6calc_db_wrapper_file_stamp_get(filename, &db_stamp_cache[entry]);
 
 		// get amount of entries in database
 		memset(&key, 0, sizeof(key));
@@ -686,17 +779,17 @@ DB *libipv6calc_db_wrapper_DBIP_open_type(const unsigned int type_flag, long int
 			goto END_libipv6calc_db_wrapper_close_error;
 		};
 
-		db_recno_max_cache[entry] = *(db_recno_t *)key.data;
+		db_recno_max_cache[slot][entry] = *(db_recno_t *)key.data;
 
-		if (db_recno_max_cache[entry] < 2) {
+		if (db_recno_max_cache[slot][entry] < 2) {
 			goto END_libipv6calc_db_wrapper_close_error;
 		};
 
 		if (db_recno_max_ptr != NULL) {
-			*db_recno_max_ptr = db_recno_max_cache[entry];
+			*db_recno_max_ptr = db_recno_max_cache[slot][entry];
 		};
 
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database successfully opened (fill-cache), dbp=%p type=%d recno_max=%u", dbp, type, db_recno_max_cache[entry]);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database successfully opened (fill-cache), dbp=%p type=%d recno_max=%u", dbp, type, db_recno_max_cache[slot][entry]);
 	} else {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_DBIP, "Database successfully opened, dbp=%p type=%d (info)", dbp, type);
 	};
@@ -83,6 +83,8 @@ extern uint32_t wrapper_features_DBIP2;
 
 extern int         libipv6calc_db_wrapper_DBIP2_wrapper_init(void);
 extern int         libipv6calc_db_wrapper_DBIP2_wrapper_cleanup(void);
+extern int         libipv6calc_db_wrapper_DBIP2_wrapper_reload(const int slot_old);
+extern void        libipv6calc_db_wrapper_DBIP2_wrapper_release(const int slot);
 extern void        libipv6calc_db_wrapper_DBIP2_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_DBIP2_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used(void);
@@ -94,6 +96,8 @@ extern int         libipv6calc_db_wrapper_DBIP2_has_features(const uint32_t feat
 extern int         libipv6calc_db_wrapper_DBIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len);
 extern uint32_t    libipv6calc_db_wrapper_DBIP2_wrapper_asn_by_addr(const ipv6calc_ipaddr *ipaddrp);
 extern uint32_t    libipv6calc_db_wrapper_DBIP2_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, int *source_ptr);
+extern int         libipv6calc_db_wrapper_DBIP2_wrapper_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, const int attributes, char *country, const size_t country_len, uint32_t *asn_ptr, uint32_t *GeonameID_ptr, int *source_ptr);
+extern int         libipv6calc_db_wrapper_DBIP2_wrapper_prefixlength_by_addr(const ipv6calc_ipaddr *ipaddrp);
 extern int         libipv6calc_db_wrapper_DBIP2_all_by_addr(const ipv6calc_ipaddr *ipaddrp, libipv6calc_db_wrapper_geolocation_record *recordp);
 
 extern char dbip2_db_dir[NI_MAXHOST];
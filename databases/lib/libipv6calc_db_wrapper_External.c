@@ -51,8 +51,9 @@ char external_db_usage_string[NI_MAXHOST] = "";
 
 // local cache
 #define IPV6CALC_DBD_SUBDB_MAX 3
-static DB *db_ptr_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
-static db_recno_t db_recno_max_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
+static DB *db_ptr_cache[2][MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX]; // per slot, see libipv6calc_db_wrapper_slot
+static db_recno_t db_recno_max_cache[2][MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
+static s_ipv6calc_db_file_stamp db_stamp_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)][IPV6CALC_DBD_SUBDB_MAX];
 
 // creation time of databases
 time_t wrapper_db_unixtime_External[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc)];
@@ -70,6 +71,7 @@ static char     *libipv6calc_db_wrapper_External_database_info(unsigned int type
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_External_wrapper_init(void) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int i, j;
 	char *result;
 	DB *dbp;
@@ -83,8 +85,8 @@ int libipv6calc_db_wrapper_External_wrapper_init(void) {
 	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
 		// clean local cache
 		for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
-			db_ptr_cache[i][j] = NULL;
-			db_recno_max_cache[i][j] = -1;
+			db_ptr_cache[slot][i][j] = NULL;
+			db_recno_max_cache[slot][i][j] = -1;
 		};
 		wrapper_db_unixtime_External[i] = 0;
 
@@ -141,17 +143,19 @@ int libipv6calc_db_wrapper_External_wrapper_init(void) {
  * wrapper: External_close
  */
 static int libipv6calc_db_wrapper_External_close(DB *dbp) {
-	int i, j;
+	int i, j, slot;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "Called");
 
 	if (dbp != NULL) {
 		/* cleanup cache entry */
-		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
-			for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
-				if (db_ptr_cache[i][j] == dbp) {
-					db_ptr_cache[i][j] = NULL;
-					db_recno_max_cache[i][j] = -1;
+		for (slot = 0; slot < 2; slot++) {
+			for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
+				for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
+					if (db_ptr_cache[slot][i][j] == dbp) {
+						db_ptr_cache[slot][i][j] = NULL;
+						db_recno_max_cache[slot][i][j] = -1;
+					};
 				};
 			};
 		};
@@ -170,16 +174,17 @@ static int libipv6calc_db_wrapper_External_close(DB *dbp) {
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_External_wrapper_cleanup(void) {
-	int i, j;
+	int i, j, slot;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_External, "Called");
 
 #ifdef SUPPORT_EXTERNAL
-	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
-		if (db_ptr_cache[i] != NULL) {
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Close External: type=%d desc='%s'", libipv6calc_db_wrapper_External_db_file_desc[i].number, libipv6calc_db_wrapper_External_db_file_desc[i].description);
+	for (slot = 0; slot < 2; slot++) {
+		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Close External: slot=%d type=%d desc='%s'", slot, libipv6calc_db_wrapper_External_db_file_desc[i].number, libipv6calc_db_wrapper_External_db_file_desc[i].description);
 			for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
-				libipv6calc_db_wrapper_External_close(db_ptr_cache[i][j]);
+				// clears entries of both slots
+				libipv6calc_db_wrapper_External_close(db_ptr_cache[slot][i][j]);
 			};
 		};
 	};
@@ -190,6 +195,99 @@ int libipv6calc_db_wrapper_External_wrapper_cleanup(void) {
 };
 
 
+/*
+ * function reload the External databases in case replaced on disk
+ *  handles of slot_old are copied to the current slot first,
+ *  new file is opened there, handle in use is kept on failure
+ *
+ * in : slot_old
+ * out: number of reloaded databases
+ */
+int libipv6calc_db_wrapper_External_wrapper_reload(const int slot_old) {
+	int i, j, type, changed;
+	int result = 0;
+	int slot = libipv6calc_db_wrapper_slot();
+	DB *dbp;
+	const unsigned int subdb_flag[IPV6CALC_DBD_SUBDB_MAX] = { 0, 0x20000, 0x40000 };
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Called slot_old=%d slot=%d", slot_old, slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
+		type = libipv6calc_db_wrapper_External_db_file_desc[i].number;
+		changed = 0;
+
+		for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
+			db_ptr_cache[slot][i][j] = db_ptr_cache[slot_old][i][j];
+			db_recno_max_cache[slot][i][j] = db_recno_max_cache[slot_old][i][j];
+
+			if (db_ptr_cache[slot][i][j] == NULL) {
+				// not open
+				continue;
+			};
+
+			if (libipv6calc_db_wrapper_file_stamp_changed(libipv6calc_db_wrapper_External_dbfilename(type), &db_stamp_cache[i][j]) == 0) {
+				continue;
+			};
+
+			db_ptr_cache[slot][i][j] = NULL;
+			db_recno_max_cache[slot][i][j] = -1;
+
+			dbp = libipv6calc_db_wrapper_External_open_type(type | subdb_flag[j], NULL);
+
+			if (dbp == NULL) {
+				NONQUIETPRINT_WA("External database replaced on disk but not usable, keep current one: %s", libipv6calc_db_wrapper_External_dbfilename(type));
+				db_ptr_cache[slot][i][j] = db_ptr_cache[slot_old][i][j];
+				db_recno_max_cache[slot][i][j] = db_recno_max_cache[slot_old][i][j];
+				// don't retry until next replacement
+				libipv6calc_db_wrapper_file_stamp_get(libipv6calc_db_wrapper_External_dbfilename(type), &db_stamp_cache[i][j]);
+				continue;
+			};
+
+			// old handle stays in slot_old until released
+			changed = 1;
+		};
+
+		if (changed == 1) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database reloaded: type=%d desc='%s'", type, libipv6calc_db_wrapper_External_db_file_desc[i].description);
+			result++;
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Finished, reloaded: %d", result);
+	return(result);
+};
+
+
+/*
+ * function release the External databases of a retired slot
+ *  handles still in use by the other slot are kept open
+ *
+ * in : slot
+ */
+void libipv6calc_db_wrapper_External_wrapper_release(const int slot) {
+	int i, j;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Called slot=%d", slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_External_db_file_desc); i++) {
+		for (j = 0; j < IPV6CALC_DBD_SUBDB_MAX; j++) {
+			if (db_ptr_cache[slot][i][j] == NULL) {
+				continue;
+			};
+
+			if (db_ptr_cache[slot][i][j] == db_ptr_cache[1 - slot][i][j]) {
+				// shared
+				db_ptr_cache[slot][i][j] = NULL;
+				db_recno_max_cache[slot][i][j] = -1;
+				continue;
+			};
+
+			libipv6calc_db_wrapper_External_close(db_ptr_cache[slot][i][j]);
+		};
+	};
+};
+
+
 /*
  * function info of External wrapper
  *
@@ -407,6 +505,7 @@ END_libipv6calc_db_wrapper:
  * 	db_recno_max_ptr (set if not NULL)
  */
 DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long int *db_recno_max_ptr) {
+	int slot = libipv6calc_db_wrapper_slot();
 	DB *dbp = NULL;
 	DBC *dbcp;
 	DBT key, data;
@@ -448,15 +547,15 @@ DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long
 		return(NULL);
 	};
 
-	if ((info_selector == 0) && (db_ptr_cache[entry][subdb] != NULL)) {
+	if ((info_selector == 0) && (db_ptr_cache[slot][entry][subdb] != NULL)) {
 		// already open
-		dbp = db_ptr_cache[entry][subdb];
+		dbp = db_ptr_cache[slot][entry][subdb];
 
 		if (db_recno_max_ptr != NULL) {
-			*db_recno_max_ptr = db_recno_max_cache[entry][subdb];
+			*db_recno_max_ptr = db_recno_max_cache[slot][entry][subdb];
 		};
 
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database already opened (cached) dbp=%p type=%d subdb=%d recno_max: %u", dbp, type, subdb, db_recno_max_cache[entry][subdb]);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database already opened (cached) dbp=%p type=%d subdb=%d recno_max: %u", dbp, type, subdb, db_recno_max_cache[slot][entry][subdb]);
 
 		goto END_libipv6calc_db_wrapper;
 	};
@@ -489,7 +588,8 @@ DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long
 
 	if (info_selector == 0) {
 		// cache entry
-		db_ptr_cache[entry][subdb] = dbp;
+		db_ptr_cache[slot][entry][subdb] = dbp;
+		libipv6calc_db_wrapper_file_stamp_get(filename, &db_stamp_cache[entry][subdb]);
 
 		// get amount of entries in database
 		memset(&key, 0, sizeof(key));
@@ -513,17 +613,17 @@ DB *libipv6calc_db_wrapper_External_open_type(const unsigned int type_flag, long
 			goto END_libipv6calc_db_wrapper_close_error;
 		};
 
-		db_recno_max_cache[entry][subdb] = *(db_recno_t *)key.data;
+		db_recno_max_cache[slot][entry][subdb] = *(db_recno_t *)key.data;
 
-		if (db_recno_max_cache[entry][subdb] < 2) {
+		if (db_recno_max_cache[slot][entry][subdb] < 2) {
 			goto END_libipv6calc_db_wrapper_close_error;
 		};
 
 		if (db_recno_max_ptr != NULL) {
-			*db_recno_max_ptr = db_recno_max_cache[entry][subdb];
+			*db_recno_max_ptr = db_recno_max_cache[slot][entry][subdb];
 		};
 
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database successfully opened (fill-cache), dbp=%p type=%d subdb=%d recno_max=%u", dbp, type, subdb, db_recno_max_cache[entry][subdb]);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database successfully opened (fill-cache), dbp=%p type=%d subdb=%d recno_max=%u", dbp, type, subdb, db_recno_max_cache[slot][entry][subdb]);
 	} else {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_External, "Database successfully opened, dbp=%p type=%d (info)", dbp, type);
 	};
@@ -54,6 +54,8 @@ typedef struct
 
 extern int         libipv6calc_db_wrapper_External_wrapper_init(void);
 extern int         libipv6calc_db_wrapper_External_wrapper_cleanup(void);
+extern int         libipv6calc_db_wrapper_External_wrapper_reload(const int slot_old);
+extern void        libipv6calc_db_wrapper_External_wrapper_release(const int slot);
 extern void        libipv6calc_db_wrapper_External_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_External_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
 extern char       *libipv6calc_db_wrapper_External_wrapper_db_info_used(void);
@@ -871,6 +871,11 @@ GeoIP *libipv6calc_db_wrapper_GeoIP_open_type(int type, int flags) {
 		goto END_libipv6calc_db_wrapper;
 	};
 
+	if (libipv6calc_db_wrapper_reload_enabled() == 1) {
+		// let library check for replaced database file
+		flags |= GEOIP_CHECK_CACHE;
+	};
+
 #ifdef SUPPORT_GEOIP_DYN
 	const char *dl_symbol = "GeoIP_open_type";
 	char *error;
@@ -912,8 +917,7 @@ GeoIP *libipv6calc_db_wrapper_GeoIP_open_type(int type, int flags) {
 		goto END_libipv6calc_db_wrapper;
 	};
 #else
-	if (flags == 0) { };  // make compiler happy (avoid unused "...")
-	gi = GeoIP_open_type(type, GEOIP_STANDARD);
+	gi = GeoIP_open_type(type, GEOIP_STANDARD | flags);
 #endif
 
 	if (gi == NULL) {
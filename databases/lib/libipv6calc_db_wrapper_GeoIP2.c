@@ -88,11 +88,12 @@ static uint32_t geoip2_db_usage_map[GeoIP2_DB_MAX_BLOCKS_32];
 char geoip2_db_usage_string[NI_MAXHOST] = "";
 
 // local cache
-static MMDB_s mmdb_cache[GeoIP2_DB_MAX+1];
+static MMDB_s mmdb_cache[2][GeoIP2_DB_MAX+1]; // per slot, see libipv6calc_db_wrapper_slot
+static s_ipv6calc_db_file_stamp mmdb_stamp[GeoIP2_DB_MAX+1];
 
 // local prototyping
 static char *libipv6calc_db_wrapper_GeoIP2_dbfilename(const unsigned int type);
-static void libipv6calc_db_wrapper_GeoIP2_close(const int type);
+static void libipv6calc_db_wrapper_GeoIP2_close(const int slot, const int type);
 
 
 /*
@@ -102,6 +103,7 @@ static void libipv6calc_db_wrapper_GeoIP2_close(const int type);
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int i, dbym, dbtype, ret, product;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called");
@@ -116,8 +118,8 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
 		type2index[libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number] = i;
 
 		// clean local cache
-		mmdb_cache[libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].file_size = 0;
-		mmdb_cache[libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].flags = 0;
+		mmdb_cache[slot][libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].file_size = 0;
+		mmdb_cache[slot][libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].flags = 0;
 
 		// add features to implemented
 		wrapper_features_by_source_implemented[IPV6CALC_DB_SOURCE_GEOIP2] |= libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].features;
@@ -150,11 +152,11 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
 			product = GeoIP2_COMM;
 		};
 
-		time_t db_time = mmdb_cache[dbtype].metadata.build_epoch;
+		time_t db_time = mmdb_cache[slot][dbtype].metadata.build_epoch;
 		struct tm *db_gmtime = gmtime(&db_time);
 
 		dbym = (db_gmtime->tm_year + 1900) * 12 + (db_gmtime->tm_mon + 1);
-		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "GEOIP2 type=%d dbym=%d Year/Month=%d unixtime=%llu", dbtype, dbym, GeoIP2_UNPACK_YM(dbym), (long long unsigned int) mmdb_cache[dbtype].metadata.build_epoch);
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "GEOIP2 type=%d dbym=%d Year/Month=%d unixtime=%llu", dbtype, dbym, GeoIP2_UNPACK_YM(dbym), (long long unsigned int) mmdb_cache[slot][dbtype].metadata.build_epoch);
 
 #define GeoIP2_DB_SELECT_BETTER(best) \
 			if ( \
@@ -238,7 +240,7 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
 
 	/* close handles which are not necessary further on */
 	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_GeoIP2_db_file_desc); i++) {
-		if (mmdb_cache[libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].file_size > 0) {
+		if (mmdb_cache[slot][libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number].file_size > 0) {
 			if (
 				(libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number == geoip2_db_country_v4_best[GeoIP2_FREE].num)
 			    ||	(libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number == geoip2_db_country_v4_best[GeoIP2_COMM].num)
@@ -250,7 +252,7 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
 			};
 
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Close further unused GeoIP2: type=%d desc='%s'", libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].description);
-			libipv6calc_db_wrapper_GeoIP2_close(libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number);
+			libipv6calc_db_wrapper_GeoIP2_close(slot, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number);
 		};
 	};
 
@@ -263,20 +265,27 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_init(void) {
 /*
  * wrapper: GeoIP2_close
  */
-static void libipv6calc_db_wrapper_GeoIP2_close(const int type) {
-	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called type=%u", type);
+static void libipv6calc_db_wrapper_GeoIP2_close(const int slot, const int type) {
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called slot=%d type=%u", slot, type);
 
-	if (mmdb_cache[type].file_size > 0) {
+	if (mmdb_cache[slot][type].file_size > 0) {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Close GeoIP2: type=%d desc='%s'", type, libipv6calc_db_wrapper_GeoIP2_db_file_desc[type2index[type]].description);
-		libipv6calc_db_wrapper_MMDB_close(&mmdb_cache[type]);
+		libipv6calc_db_wrapper_MMDB_close(&mmdb_cache[slot][type]);
 		/* cleanup cache entry */
-		mmdb_cache[type].file_size = 0;
-	} else if (mmdb_cache[type].flags > 0) {
+		mmdb_cache[slot][type].file_size = 0;
+	} else if (mmdb_cache[slot][type].flags > 0) {
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Already closed GeoIP2: type=%d desc='%s'", type, libipv6calc_db_wrapper_GeoIP2_db_file_desc[type2index[type]].description);
 	};
 };
 
 
+/*
+ * check whether handle of slot is also in use by the other slot
+ */
+#define GeoIP2_HANDLE_SHARED(slot, type) \
+	((mmdb_cache[1 - (slot)][type].file_size > 0) && (mmdb_cache[1 - (slot)][type].file_content == mmdb_cache[slot][type].file_content))
+
+
 /*
  * function cleanup the GeoIP2 wrapper
  *
@@ -284,12 +293,20 @@ static void libipv6calc_db_wrapper_GeoIP2_close(const int type) {
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_GeoIP2_wrapper_cleanup(void) {
-	int i;
+	int i, type;
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called");
 
 	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_GeoIP2_db_file_desc); i++) {
-		libipv6calc_db_wrapper_GeoIP2_close(i);
+		type = libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number;
+
+		if ((mmdb_cache[1][type].file_size > 0) && (GeoIP2_HANDLE_SHARED(1, type))) {
+			// close only once
+			mmdb_cache[1][type].file_size = 0;
+		};
+
+		libipv6calc_db_wrapper_GeoIP2_close(0, type);
+		libipv6calc_db_wrapper_GeoIP2_close(1, type);
 	};
 
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Finished");
@@ -297,6 +314,86 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_cleanup(void) {
 };
 
 
+/*
+ * function reload the GeoIP2 databases in case replaced on disk
+ *  handles of slot_old are copied to the current slot first,
+ *  new file is opened there, handle in use is kept on failure
+ *
+ * in : slot_old
+ * out: number of reloaded databases
+ */
+int libipv6calc_db_wrapper_GeoIP2_wrapper_reload(const int slot_old) {
+	int i, type, ret;
+	int result = 0;
+	int slot = libipv6calc_db_wrapper_slot();
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called slot_old=%d slot=%d", slot_old, slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_GeoIP2_db_file_desc); i++) {
+		type = libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number;
+
+		mmdb_cache[slot][type] = mmdb_cache[slot_old][type];
+
+		if (mmdb_cache[slot][type].file_size == 0) {
+			// not open
+			continue;
+		};
+
+		if (libipv6calc_db_wrapper_file_stamp_changed(libipv6calc_db_wrapper_GeoIP2_dbfilename(type), &mmdb_stamp[type]) == 0) {
+			continue;
+		};
+
+		mmdb_cache[slot][type].file_size = 0;
+
+		ret = libipv6calc_db_wrapper_GeoIP2_open_type(type);
+
+		if (ret != MMDB_SUCCESS) {
+			NONQUIETPRINT_WA("GeoIP2 database replaced on disk but not usable, keep current one: %s", libipv6calc_db_wrapper_GeoIP2_dbfilename(type));
+			mmdb_cache[slot][type] = mmdb_cache[slot_old][type];
+			// don't retry until next replacement
+			libipv6calc_db_wrapper_file_stamp_get(libipv6calc_db_wrapper_GeoIP2_dbfilename(type), &mmdb_stamp[type]);
+			continue;
+		};
+
+		// old handle stays in slot_old until released
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Database reloaded: type=%d desc='%s'", type, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].description);
+		result++;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Finished, reloaded: %d", result);
+	return(result);
+};
+
+
+/*
+ * function release the GeoIP2 databases of a retired slot
+ *  handles still in use by the other slot are kept open
+ *
+ * in : slot
+ */
+void libipv6calc_db_wrapper_GeoIP2_wrapper_release(const int slot) {
+	int i, type;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Called slot=%d", slot);
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_GeoIP2_db_file_desc); i++) {
+		type = libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].number;
+
+		if (mmdb_cache[slot][type].file_size == 0) {
+			continue;
+		};
+
+		if (GeoIP2_HANDLE_SHARED(slot, type)) {
+			mmdb_cache[slot][type].file_size = 0;
+			continue;
+		};
+
+		libipv6calc_db_wrapper_GeoIP2_close(slot, type);
+	};
+};
+
+
 /*
  * function info of GeoIP2 wrapper
  *
@@ -326,6 +423,7 @@ void libipv6calc_db_wrapper_GeoIP2_wrapper_info(char* string, const size_t size)
  * out: (void)
  */
 void libipv6calc_db_wrapper_GeoIP2_wrapper_print_db_info(const int level_verbose, const char *prefix_string) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int ret, i, type, count = 0;
 
 	const char *prefix = "\0";
@@ -349,7 +447,7 @@ void libipv6calc_db_wrapper_GeoIP2_wrapper_print_db_info(const int level_verbose
 				fprintf(stderr, "%sGeoIP2: %-30s: [%1d] %-30s (CAN'T OPEN database information)\n", prefix, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].description, type, libipv6calc_db_wrapper_GeoIP2_dbfilename(type));
 			} else {
 				fprintf(stderr, "%sGeoIP2: %-30s: [%1d] %-30s (%s)\n", prefix, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].description, type, libipv6calc_db_wrapper_GeoIP2_db_file_desc[i].filename, libipv6calc_db_wrapper_GeoIP2_database_info(type));
-				libipv6calc_db_wrapper_GeoIP2_close(type);
+				libipv6calc_db_wrapper_GeoIP2_close(slot, type);
 				count++;
 			};
 		} else {
@@ -596,6 +694,7 @@ END_libipv6calc_db_wrapper:
  * 	result
  */
 int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
+	int slot = libipv6calc_db_wrapper_slot();
 	char *filename;
 	int  entry = -1, i;
 	int ret;
@@ -611,13 +710,13 @@ int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
 	};
 
 	if (entry < 0) {
-		mmdb_cache[type].file_size = 0;
-		mmdb_cache[type].flags = 0;
+		mmdb_cache[slot][type].file_size = 0;
+		mmdb_cache[slot][type].flags = 0;
 		ret = MMDB_FILE_OPEN_ERROR;
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	if (mmdb_cache[type].file_size > 0) {
+	if (mmdb_cache[slot][type].file_size > 0) {
 		// already open
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Database already opened (cached) type=%d", type);
 		ret = MMDB_SUCCESS;
@@ -628,13 +727,13 @@ int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
 	filename = libipv6calc_db_wrapper_GeoIP2_dbfilename(type);
 
 	if (filename == NULL) {
-		mmdb_cache[type].file_size = 0;
-		mmdb_cache[type].flags = 0;
+		mmdb_cache[slot][type].file_size = 0;
+		mmdb_cache[slot][type].flags = 0;
 		ret = MMDB_FILE_OPEN_ERROR;
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	ret = libipv6calc_db_wrapper_MMDB_open(filename, MMDB_MODE_MMAP, &mmdb_cache[type]);
+	ret = libipv6calc_db_wrapper_MMDB_open(filename, MMDB_MODE_MMAP, &mmdb_cache[slot][type]);
 
 	if (ret != MMDB_SUCCESS) {
 		if (ipv6calc_quiet == 0) {
@@ -643,12 +742,14 @@ int libipv6calc_db_wrapper_GeoIP2_open_type(const unsigned int type) {
 				fprintf(stderr, "MMDB_open IO error: %s (%s)\n", strerror(errno), filename);
 			};
 		};
-		mmdb_cache[type].file_size = 0;
-		mmdb_cache[type].flags = 0;
+		mmdb_cache[slot][type].file_size = 0;
+		mmdb_cache[slot][type].flags = 0;
 		ret = MMDB_FILE_OPEN_ERROR;
 		goto END_libipv6calc_db_wrapper;
 	};
 
+	libipv6calc_db_wrapper_file_stamp_get(filename, &mmdb_stamp[type]);
+
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Database successfully opened (fill-cache), type=%d", type);
 
 END_libipv6calc_db_wrapper:
@@ -665,6 +766,7 @@ END_libipv6calc_db_wrapper:
  * wrapper: GeoIP2_database_info
  */
 char *libipv6calc_db_wrapper_GeoIP2_database_info(const unsigned int type) {
+	int slot = libipv6calc_db_wrapper_slot();
 	static char resultstring[NI_MAXHOST];
 	char datastring[NI_MAXHOST];
 	char tempstring[NI_MAXHOST];
@@ -712,7 +814,7 @@ char *libipv6calc_db_wrapper_GeoIP2_database_info(const unsigned int type) {
     fprintf(stdout, meta_dump,
 */
 
-	mmdb = mmdb_cache[type];
+	mmdb = mmdb_cache[slot][type];
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "meta: NodeCount=%i RecordSize=%i IpVersion=%i BinaryFormat=%i.%i BuildTime=%llu Type=%s", \
             mmdb.metadata.node_count,
@@ -768,6 +870,7 @@ int libipv6calc_db_wrapper_GeoIP2_has_features(uint32_t features) {
 
 /* country code */
 int libipv6calc_db_wrapper_GeoIP2_wrapper_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int result = MMDB_INVALID_DATA_ERROR;
 
 	int GeoIP2_type = 0;
@@ -798,7 +901,7 @@ int libipv6calc_db_wrapper_GeoIP2_wrapper_country_code_by_addr(const ipv6calc_ip
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[GeoIP2_type]);
+	result = libipv6calc_db_wrapper_MMDB_country_code_by_addr(ipaddrp, country, country_len, &mmdb_cache[slot][GeoIP2_type]);
  
 	if (result != MMDB_SUCCESS) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
@@ -818,6 +921,7 @@ END_libipv6calc_db_wrapper:
 
 /* ASN */
 uint32_t libipv6calc_db_wrapper_GeoIP2_wrapper_asn_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	int slot = libipv6calc_db_wrapper_slot();
 	uint32_t result = ASNUM_AS_UNKNOWN;
 
 	int GEOIP2_type = 0;
@@ -848,7 +952,7 @@ uint32_t libipv6calc_db_wrapper_GeoIP2_wrapper_asn_by_addr(const ipv6calc_ipaddr
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_asn_by_addr(ipaddrp, &mmdb_cache[GEOIP2_type]);
+	result = libipv6calc_db_wrapper_MMDB_asn_by_addr(ipaddrp, &mmdb_cache[slot][GEOIP2_type]);
  
 	if (result == ASNUM_AS_UNKNOWN) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
@@ -868,6 +972,7 @@ END_libipv6calc_db_wrapper:
 
 /* GeonameID */
 uint32_t libipv6calc_db_wrapper_GeoIP2_wrapper_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, int *source_ptr) {
+	int slot = libipv6calc_db_wrapper_slot();
 	uint32_t result = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
 
 	int GEOIP2_type = 0;
@@ -898,7 +1003,7 @@ uint32_t libipv6calc_db_wrapper_GeoIP2_wrapper_GeonameID_by_addr(const ipv6calc_
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(ipaddrp, &mmdb_cache[GEOIP2_type], source_ptr);
+	result = libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(ipaddrp, &mmdb_cache[slot][GEOIP2_type], source_ptr);
 
 	if (result == IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
@@ -916,8 +1021,152 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* CountryCode, ASN and GeonameID
+ *  attributes stored in the same database are retrieved by one lookup
+ * in : ipaddrp, attributes (IPV6CALC_DB_ATTR_*), country_len
+ * mod: country, asn_ptr, GeonameID_ptr, source_ptr (only for found attributes)
+ * out: attributes found (IPV6CALC_DB_ATTR_*)
+ */
+int libipv6calc_db_wrapper_GeoIP2_wrapper_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, const int attributes, char *country, const size_t country_len, uint32_t *asn_ptr, uint32_t *GeonameID_ptr, int *source_ptr) {
+	int slot = libipv6calc_db_wrapper_slot();
+	int result = 0, r, i, j;
+
+	int GeoIP2_type[3] = { 0, 0, 0 };
+	int GeoIP2_type_attributes[3] = { 0, 0, 0 };
+	int GeoIP2_types = 0;
+
+	const int attribute_list[3] = { IPV6CALC_DB_ATTR_CC, IPV6CALC_DB_ATTR_AS, IPV6CALC_DB_ATTR_GEONAMEID };
+	uint32_t features_list[3];
+	int type_list[3];
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		features_list[0] = IPV6CALC_DB_IPV4_TO_CC;
+		features_list[1] = IPV6CALC_DB_IPV4_TO_AS;
+		features_list[2] = IPV6CALC_DB_IPV4_TO_GEONAMEID;
+		type_list[0] = geoip2_db_country_v4;
+		type_list[1] = geoip2_db_asn_v4;
+		type_list[2] = geoip2_db_region_city_v4;
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		features_list[0] = IPV6CALC_DB_IPV6_TO_CC;
+		features_list[1] = IPV6CALC_DB_IPV6_TO_AS;
+		features_list[2] = IPV6CALC_DB_IPV6_TO_GEONAMEID;
+		type_list[0] = geoip2_db_country_v6;
+		type_list[1] = geoip2_db_asn_v6;
+		type_list[2] = geoip2_db_region_city_v6;
+	} else {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Unsupported proto: %d", ipaddrp->proto);
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	// map requested and supported attributes to database types
+	for (i = 0; i < 3; i++) {
+		if (((attributes & attribute_list[i]) == 0) || ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP2] & features_list[i]) == 0)) {
+			continue;
+		};
+
+		for (j = 0; j < GeoIP2_types; j++) {
+			if (GeoIP2_type[j] == type_list[i]) {
+				break;
+			};
+		};
+
+		if (j == GeoIP2_types) {
+			GeoIP2_type[j] = type_list[i];
+			GeoIP2_types++;
+		};
+
+		GeoIP2_type_attributes[j] |= attribute_list[i];
+	};
+
+	// one lookup per database
+	for (j = 0; j < GeoIP2_types; j++) {
+		if (libipv6calc_db_wrapper_GeoIP2_open_type(GeoIP2_type[j]) != MMDB_SUCCESS) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Error opening GeoIP2 by type");
+			continue;
+		};
+
+		r = libipv6calc_db_wrapper_MMDB_attributes_by_addr(ipaddrp, &mmdb_cache[slot][GeoIP2_type[j]], GeoIP2_type_attributes[j], country, country_len, asn_ptr, GeonameID_ptr, source_ptr);
+
+		if (r == 0) {
+			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found for attributes=0x%x", GeoIP2_type_attributes[j]);
+			continue;
+		};
+
+		GeoIP2_DB_USAGE_MAP_TAG(GeoIP2_type[j]);
+
+		result |= r;
+	};
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "requested attributes=0x%x found=0x%x", attributes, result);
+	return(result);
+};
+
+
+/* Prefix length
+ *  most specific network covering the address in databases providing CountryCode, ASN or GeonameID
+ * in : ipaddrp
+ * out: prefix length related to protocol of address, -1 if no database available
+ */
+int libipv6calc_db_wrapper_GeoIP2_wrapper_prefixlength_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	int slot = libipv6calc_db_wrapper_slot();
+	int result = -1, r, i;
+	int type_checked = -1;
+
+	uint32_t features_list[3];
+	int type_list[3];
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		features_list[0] = IPV6CALC_DB_IPV4_TO_CC;
+		features_list[1] = IPV6CALC_DB_IPV4_TO_AS;
+		features_list[2] = IPV6CALC_DB_IPV4_TO_GEONAMEID;
+		type_list[0] = geoip2_db_country_v4;
+		type_list[1] = geoip2_db_asn_v4;
+		type_list[2] = geoip2_db_region_city_v4;
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		features_list[0] = IPV6CALC_DB_IPV6_TO_CC;
+		features_list[1] = IPV6CALC_DB_IPV6_TO_AS;
+		features_list[2] = IPV6CALC_DB_IPV6_TO_GEONAMEID;
+		type_list[0] = geoip2_db_country_v6;
+		type_list[1] = geoip2_db_asn_v6;
+		type_list[2] = geoip2_db_region_city_v6;
+	} else {
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Unsupported proto: %d", ipaddrp->proto);
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	for (i = 0; i < 3; i++) {
+		if ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP2] & features_list[i]) == 0) {
+			continue;
+		};
+
+		if (type_list[i] == type_checked) {
+			// same database already checked
+			continue;
+		};
+		type_checked = type_list[i];
+
+		if (libipv6calc_db_wrapper_GeoIP2_open_type(type_list[i]) != MMDB_SUCCESS) {
+			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "Error opening GeoIP2 by type");
+			continue;
+		};
+
+		r = libipv6calc_db_wrapper_MMDB_prefixlength_by_addr(ipaddrp, &mmdb_cache[slot][type_list[i]]);
+
+		if (r > result) {
+			result = r;
+		};
+	};
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "prefixlength=%d", result);
+	return(result);
+};
+
+
 /* all information */
 int libipv6calc_db_wrapper_GeoIP2_all_by_addr(const ipv6calc_ipaddr *ipaddrp, libipv6calc_db_wrapper_geolocation_record *recordp) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int result = -1;
 
 	int GeoIP2_type = 0;
@@ -953,7 +1202,7 @@ int libipv6calc_db_wrapper_GeoIP2_all_by_addr(const ipv6calc_ipaddr *ipaddrp, li
 		goto END_libipv6calc_db_wrapper;
 	};
 
-	result = libipv6calc_db_wrapper_MMDB_all_by_addr(ipaddrp, recordp, &mmdb_cache[GeoIP2_type]);
+	result = libipv6calc_db_wrapper_MMDB_all_by_addr(ipaddrp, recordp, &mmdb_cache[slot][GeoIP2_type]);
 
 	if (result != MMDB_SUCCESS) {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
@@ -970,7 +1219,7 @@ int libipv6calc_db_wrapper_GeoIP2_all_by_addr(const ipv6calc_ipaddr *ipaddrp, li
 			goto END_libipv6calc_db_wrapper;
 		};
 
-		result = libipv6calc_db_wrapper_MMDB_all_by_addr(ipaddrp, &record_asn, &mmdb_cache[GeoIP2_type_asn]);
+		result = libipv6calc_db_wrapper_MMDB_all_by_addr(ipaddrp, &record_asn, &mmdb_cache[slot][GeoIP2_type_asn]);
 
 		if (result != MMDB_SUCCESS) {
 			DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_GeoIP2, "no match found");
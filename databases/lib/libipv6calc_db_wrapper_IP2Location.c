@@ -160,7 +160,8 @@ static uint32_t ip2location_db_usage_map[IP2LOCATION_DB_MAX_BLOCKS_32];
 char ip2location_db_usage_string[NI_MAXHOST] = "";
 
 // local cache
-static IP2Location *db_ptr_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)];
+static IP2Location *db_ptr_cache[2][MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)]; // per slot, see libipv6calc_db_wrapper_slot
+static s_ipv6calc_db_file_stamp db_stamp_cache[MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc)];
 
 // local prototyping
 static char     *libipv6calc_db_wrapper_IP2Location_dbfilename(const unsigned int type); 
@@ -174,6 +175,7 @@ static int       libipv6calc_db_wrapper_IP2Location_db_compatible(const unsigned
  * out: 0=ok, 1=error
  */
 int libipv6calc_db_wrapper_IP2Location_wrapper_init(void) {
+	int slot = libipv6calc_db_wrapper_slot();
 	int i, dbym, product, dbtype, result;
 	IP2Location *loc;
 
@@ -391,7 +393,7 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_init(void) {
 
 	/* close handles which are not necessary further on */
 	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
-		if (db_ptr_cache[i] != NULL) {
+		if (db_ptr_cache[slot][i] != NULL) {
 			if (
 				(libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number == ip2location_db_country_v4_best[IP2L_LITE].num)
 			    ||	(libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number == ip2location_db_country_v4_best[IP2L_COMM].num)
@@ -405,7 +407,7 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_init(void) {
 			};
 
 			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Close further unused IP2Location: type=%d desc='%s'", libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number, libipv6calc_db_wrapper_IP2Location_db_file_desc[i].description);
-			libipv6calc_db_wrapper_IP2Location_close(db_ptr_cache[i]);
+			libipv6calc_db_wrapper_IP2Location_close(db_ptr_cache[slot][i]);
 		};
 	};
 
@@ -421,7 +423,7 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_init(void) {
  * wrapper: IP2Location_close
  */
 int libipv6calc_db_wrapper_IP2Location_close(IP2Location *loc) {
-	int i;
+	int i, slot;
 	int result = 0;
 
 	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Called: %s", wrapper_ip2location_info);
@@ -476,9 +478,11 @@ int libipv6calc_db_wrapper_IP2Location_close(IP2Location *loc) {
 
 END_libipv6calc_db_wrapper:
 	/* cleanup cache entry */
-	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
-		if (db_ptr_cache[i] == loc) {
-			db_ptr_cache[i] = NULL;
+	for (slot = 0; slot < 2; slot++) {
+		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+			if (db_ptr_cache[slot][i] == loc) {
+				db_ptr_cache[slot][i] = NULL;
+			};
 		};
 	};
 
@@ -1053,6 +1057,7 @@ END_libipv6calc_db_wrapper:
  * wrapper extension: IP2Location_open_type
  */
 IP2Location *libipv6calc_db_wrapper_IP2Location_open_type(const unsigned int type) {
+	int slot = libipv6calc_db_wrapper_slot();
 	IP2Location *loc;
 	char *filename;
 	int  entry = -1, i;
@@ -1070,9 +1075,9 @@ IP2Location *libipv6calc_db_wrapper_IP2Location_open_type(const unsigned int typ
 		return(NULL);
 	};
 
-	if (db_ptr_cache[entry] != NULL) {
+	if (db_ptr_cache[slot][entry] != NULL) {
 		// already open
-		loc = db_ptr_cache[entry];
+		loc = db_ptr_cache[slot][entry];
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Database already opened (cached) loc=%p type=%d", loc, type);
 		goto END_libipv6calc_db_wrapper;
@@ -1089,7 +1094,8 @@ IP2Location *libipv6calc_db_wrapper_IP2Location_open_type(const unsigned int typ
 			goto END_libipv6calc_db_wrapper;
 		};
 
-		db_ptr_cache[entry] = loc;
+		db_ptr_cache[slot][entry] = loc;
+		libipv6calc_db_wrapper_file_stamp_get(filename, &db_stamp_cache[entry]);
 
 		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Database successfully opened (fill-cache), loc=%p type=%d", loc, type);
 	};
@@ -1992,12 +1998,15 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_cleanup(void) {
 	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Called");
 
 #ifdef SUPPORT_IP2LOCATION
-	int i;
-
-	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
-		if (db_ptr_cache[i] != NULL) {
-			DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Close IP2Location: type=%d desc='%s'", libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number, libipv6calc_db_wrapper_IP2Location_db_file_desc[i].description);
-			libipv6calc_db_wrapper_IP2Location_close(db_ptr_cache[i]);
+	int i, slot;
+
+	for (slot = 0; slot < 2; slot++) {
+		for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+			if (db_ptr_cache[slot][i] != NULL) {
+				DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Close IP2Location: slot=%d type=%d desc='%s'", slot, libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number, libipv6calc_db_wrapper_IP2Location_db_file_desc[i].description);
+				// clears entries of both slots
+				libipv6calc_db_wrapper_IP2Location_close(db_ptr_cache[slot][i]);
+			};
 		};
 	};
 
@@ -2009,3 +2018,88 @@ int libipv6calc_db_wrapper_IP2Location_wrapper_cleanup(void) {
 };
 
 
+/*
+ * function reload the IP2Location databases in case replaced on disk
+ *  handles of slot_old are copied to the current slot first,
+ *  new file is opened there, handle in use is kept on failure
+ *
+ * in : slot_old
+ * out: number of reloaded databases
+ */
+int libipv6calc_db_wrapper_IP2Location_wrapper_reload(const int slot_old) {
+	int result = 0;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Called slot_old=%d", slot_old);
+
+#ifdef SUPPORT_IP2LOCATION
+	int i, type;
+	int slot = libipv6calc_db_wrapper_slot();
+	IP2Location *loc;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+		db_ptr_cache[slot][i] = db_ptr_cache[slot_old][i];
+
+		if (db_ptr_cache[slot][i] == NULL) {
+			// not open
+			continue;
+		};
+
+		type = libipv6calc_db_wrapper_IP2Location_db_file_desc[i].number;
+
+		if (libipv6calc_db_wrapper_file_stamp_changed(libipv6calc_db_wrapper_IP2Location_dbfilename(type), &db_stamp_cache[i]) == 0) {
+			continue;
+		};
+
+		db_ptr_cache[slot][i] = NULL;
+
+		loc = libipv6calc_db_wrapper_IP2Location_open_type(type);
+
+		if (loc == NULL) {
+			NONQUIETPRINT_WA("IP2Location database replaced on disk but not usable, keep current one: %s", libipv6calc_db_wrapper_IP2Location_dbfilename(type));
+			db_ptr_cache[slot][i] = db_ptr_cache[slot_old][i];
+			// don't retry until next replacement
+			libipv6calc_db_wrapper_file_stamp_get(libipv6calc_db_wrapper_IP2Location_dbfilename(type), &db_stamp_cache[i]);
+			continue;
+		};
+
+		// old handle stays in slot_old until released
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Database reloaded: type=%d desc='%s'", type, libipv6calc_db_wrapper_IP2Location_db_file_desc[i].description);
+		result++;
+	};
+#endif
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Finished, reloaded: %d", result);
+	return(result);
+};
+
+
+/*
+ * function release the IP2Location databases of a retired slot
+ *  handles still in use by the other slot are kept open
+ *
+ * in : slot
+ */
+void libipv6calc_db_wrapper_IP2Location_wrapper_release(const int slot) {
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_IP2Location, "Called slot=%d", slot);
+
+#ifdef SUPPORT_IP2LOCATION
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(libipv6calc_db_wrapper_IP2Location_db_file_desc); i++) {
+		if (db_ptr_cache[slot][i] == NULL) {
+			continue;
+		};
+
+		if (db_ptr_cache[slot][i] == db_ptr_cache[1 - slot][i]) {
+			// shared
+			db_ptr_cache[slot][i] = NULL;
+			continue;
+		};
+
+		libipv6calc_db_wrapper_IP2Location_close(db_ptr_cache[slot][i]);
+	};
+#endif
+};
+
+
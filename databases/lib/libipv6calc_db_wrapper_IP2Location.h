@@ -580,6 +580,8 @@ static const s_type2 libipv6calc_db_wrapper_IP2Location_UsageType[] = {
 
 extern int         libipv6calc_db_wrapper_IP2Location_wrapper_init(void);
 extern int         libipv6calc_db_wrapper_IP2Location_wrapper_cleanup(void);
+extern int         libipv6calc_db_wrapper_IP2Location_wrapper_reload(const int slot_old);
+extern void        libipv6calc_db_wrapper_IP2Location_wrapper_release(const int slot);
 extern const char *libipv6calc_db_wrapper_IP2Location_wrapper_asnum_by_addr (const char *addr, const int proto);
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_info(char* string, const size_t size);
 extern void        libipv6calc_db_wrapper_IP2Location_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
@@ -778,25 +778,18 @@ END_libipv6calc_db_wrapper:
 };
 
 
-/* Country Code By Addr
- * in : ipaddrp, country_len, country, mmdb
+/* Country Code By Entry
+ * in : entryp, country_len, country
  * mod: country
  * out: mmdb_error
  */
-int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, MMDB_s *const mmdb) {
-	MMDB_lookup_result_s lookup_result;
+static int libipv6calc_db_wrapper_MMDB_country_code_by_entry(MMDB_entry_s *const entryp, char *country, const size_t country_len) {
 	MMDB_entry_data_s entry_data;
-	int mmdb_error = MMDB_INVALID_DATA_ERROR;
-
-	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
-
-	if (mmdb_error != MMDB_SUCCESS) {
-		goto END_libipv6calc_db_wrapper;
-	};
+	int mmdb_error = MMDB_SUCCESS;
 
 	// fetch CountryCode
 	const char *lookup_path_country_code[] = { "country", "iso_code", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_country_code);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_country_code);
 	if (entry_data.has_data) {
 		if (entry_data.type == MMDB_DATA_TYPE_UTF8_STRING) {
 			int max = (entry_data.data_size + 1 > country_len) ? country_len : entry_data.data_size +1;
@@ -808,7 +801,7 @@ int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipad
 	} else {
 		// fetch CountryCode from fallback (registered_country)
 		const char *lookup_path_registered_country_code[] = { "registered_country", "iso_code", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_registered_country_code);
+		libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_registered_country_code);
 		if (entry_data.has_data) {
 			if (entry_data.type == MMDB_DATA_TYPE_UTF8_STRING) {
 				int max = (entry_data.data_size + 1 > country_len) ? country_len : entry_data.data_size +1;
@@ -823,35 +816,26 @@ int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipad
 		};
 	};
 
-END_libipv6calc_db_wrapper:
 	return(mmdb_error);
 };
 
 
-/* ASN By Addr
- * in : ipaddrp, mmdb
+/* ASN By Entry
+ * in : entryp, mmdb
  * out: asn
  */
-uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
-	MMDB_lookup_result_s lookup_result;
+static uint32_t libipv6calc_db_wrapper_MMDB_asn_by_entry(MMDB_entry_s *const entryp, MMDB_s *const mmdb) {
 	MMDB_entry_data_s entry_data;
-	int mmdb_error = MMDB_INVALID_DATA_ERROR;
 	uint32_t result = ASNUM_AS_UNKNOWN;
 
-	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
-
-	if (mmdb_error != MMDB_SUCCESS) {
-		goto END_libipv6calc_db_wrapper;
-	};
-
 	// fetch ASN
 	if(strstr(mmdb->metadata.database_type, "ASN")) {
 		// GeoLite2-ASN
 		const char *lookup_path_asn[] = { "autonomous_system_number", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_asn);
+		libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_asn);
 	} else {
 		const char *lookup_path_asn[] = { "traits", "autonomous_system_number", NULL };
-		libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_asn);
+		libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_asn);
 	};
 	if (entry_data.has_data) {
 		if (entry_data.type == MMDB_DATA_TYPE_UINT32) {
@@ -862,23 +846,19 @@ uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp,
 		};
 	} else {
 		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_MMDB, "ASN not found");
-		mmdb_error = MMDB_INVALID_DATA_ERROR;
 	};
 
-END_libipv6calc_db_wrapper:
 	return(result);
 };
 
 
-/* GeonameID By Addr
- * in : ipaddrp, mmdb
+/* GeonameID By Entry
+ * in : entryp
  * mod: source
  * out: GeonameID
  */
-uint32_t libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, int *source_ptr) {
-	MMDB_lookup_result_s lookup_result;
+static uint32_t libipv6calc_db_wrapper_MMDB_GeonameID_by_entry(MMDB_entry_s *const entryp, int *source_ptr) {
 	MMDB_entry_data_s entry_data;
-	int mmdb_error = MMDB_INVALID_DATA_ERROR;
 	uint32_t result = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
 	int source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
 
@@ -889,51 +869,45 @@ uint32_t libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(const ipv6calc_ipaddr *ip
 			limit_24bit = 1;
 	};
 
-	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
-
-	if (mmdb_error != MMDB_SUCCESS) {
-		goto END_libipv6calc_db_wrapper;
-	};
-
 	// fetch GeonameID (nearest to global)
 	// city
 	const char *lookup_path_city_geonameid[] = { "city", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_city_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_city_geonameid);
 	CHECK_STORE_UINT32(result, "City/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_CITY;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
 
 	// district
 	const char *lookup_path_district_geonameid[] = { "subdivisions", "1", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_district_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_district_geonameid);
 	CHECK_STORE_UINT32(result, "District(subdivision#1)/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_DISTRICT;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
 
 	// stateprov
 	const char *lookup_path_stateprov_geonameid[] = { "subdivisions", "0", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_stateprov_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_stateprov_geonameid);
 	CHECK_STORE_UINT32(result, "State/Prov(subdivsion#0)/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_STATEPROV;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
 
 	// country
 	const char *lookup_path_country_geonameid[] = { "country", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_country_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_country_geonameid);
 	CHECK_STORE_UINT32(result, "Country/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_COUNTRY;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
 
 	// registered country (fallback)
 	const char *lookup_path_registered_country_geonameid[] = { "registered_country", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_registered_country_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_registered_country_geonameid);
 	CHECK_STORE_UINT32(result, "RegisteredCountry/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_COUNTRY;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
 
 	// continent
 	const char *lookup_path_continent_geonameid[] = { "continent", "geoname_id", NULL };
-	libipv6calc_db_wrapper_MMDB_aget_value(&lookup_result.entry, &entry_data, lookup_path_continent_geonameid);
+	libipv6calc_db_wrapper_MMDB_aget_value(entryp, &entry_data, lookup_path_continent_geonameid);
 	CHECK_STORE_UINT32(result, "Continent/GeonameId")
 	source = IPV6CALC_DB_GEO_GEONAMEID_TYPE_CONTINENT;
 	if ((result != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) && ((limit_24bit == 0) || (source < 0x1000000))) { goto END_libipv6calc_db_wrapper; };
@@ -948,6 +922,150 @@ END_libipv6calc_db_wrapper:
 };
 
 
+/* Country Code By Addr
+ * in : ipaddrp, country_len, country, mmdb
+ * mod: country
+ * out: mmdb_error
+ */
+int libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6calc_ipaddr *ipaddrp, char *country, const size_t country_len, MMDB_s *const mmdb) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	mmdb_error = libipv6calc_db_wrapper_MMDB_country_code_by_entry(&lookup_result.entry, country, country_len);
+
+END_libipv6calc_db_wrapper:
+	return(mmdb_error);
+};
+
+
+/* ASN By Addr
+ * in : ipaddrp, mmdb
+ * out: asn
+ */
+uint32_t libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+	uint32_t result = ASNUM_AS_UNKNOWN;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	result = libipv6calc_db_wrapper_MMDB_asn_by_entry(&lookup_result.entry, mmdb);
+
+END_libipv6calc_db_wrapper:
+	return(result);
+};
+
+
+/* GeonameID By Addr
+ * in : ipaddrp, mmdb
+ * mod: source
+ * out: GeonameID
+ */
+uint32_t libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, int *source_ptr) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+	uint32_t result = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		if (source_ptr != NULL) {
+			*source_ptr = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
+		};
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	result = libipv6calc_db_wrapper_MMDB_GeonameID_by_entry(&lookup_result.entry, source_ptr);
+
+END_libipv6calc_db_wrapper:
+	return(result);
+};
+
+
+/* CountryCode, ASN and GeonameID by addr with one lookup
+ * in : ipaddrp, mmdb, attributes (IPV6CALC_DB_ATTR_*), country_len
+ * mod: country, asn_ptr, GeonameID_ptr, source_ptr (only for requested attributes)
+ * out: requested attributes found (IPV6CALC_DB_ATTR_*)
+ */
+int libipv6calc_db_wrapper_MMDB_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, const int attributes, char *country, const size_t country_len, uint32_t *asn_ptr, uint32_t *GeonameID_ptr, int *source_ptr) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+	int result = 0;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	if ((attributes & IPV6CALC_DB_ATTR_CC) != 0) {
+		if (libipv6calc_db_wrapper_MMDB_country_code_by_entry(&lookup_result.entry, country, country_len) == MMDB_SUCCESS) {
+			result |= IPV6CALC_DB_ATTR_CC;
+		};
+	};
+
+	if ((attributes & IPV6CALC_DB_ATTR_AS) != 0) {
+		*asn_ptr = libipv6calc_db_wrapper_MMDB_asn_by_entry(&lookup_result.entry, mmdb);
+		if (*asn_ptr != ASNUM_AS_UNKNOWN) {
+			result |= IPV6CALC_DB_ATTR_AS;
+		};
+	};
+
+	if ((attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+		*GeonameID_ptr = libipv6calc_db_wrapper_MMDB_GeonameID_by_entry(&lookup_result.entry, source_ptr);
+		if (*GeonameID_ptr != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+			result |= IPV6CALC_DB_ATTR_GEONAMEID;
+		};
+	};
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "requested attributes=0x%x found=0x%x", attributes, result);
+	return(result);
+};
+
+
+/* Prefix length by addr
+ *  size of the network (record or empty range) covering the address in the database
+ * in : ipaddrp, mmdb
+ * out: prefix length related to protocol of address, -1 on error
+ */
+int libipv6calc_db_wrapper_MMDB_prefixlength_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb) {
+	MMDB_lookup_result_s lookup_result;
+	int mmdb_error = MMDB_INVALID_DATA_ERROR;
+	int result = -1;
+
+	lookup_result = libipv6calc_db_wrapper_MMDB_wrapper_lookup_by_addr(ipaddrp, mmdb, &mmdb_error);
+
+	if (mmdb_error != MMDB_SUCCESS) {
+		goto END_libipv6calc_db_wrapper;
+	};
+
+	result = lookup_result.netmask;
+
+	if ((ipaddrp->proto == IPV6CALC_PROTO_IPV4) && (mmdb->metadata.ip_version == 6)) {
+		// IPv4 address looked up in IPv6 tree
+		result -= 96;
+		if (result < 0) {
+			result = 0;
+		};
+	};
+
+END_libipv6calc_db_wrapper:
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_MMDB, "prefixlength=%d", result);
+	return(result);
+};
+
+
 /* all information by addr
  * in : ipaddrp, recordp
  * mod: recordp
@@ -48,6 +48,8 @@ extern int          libipv6calc_db_wrapper_MMDB_country_code_by_addr(const ipv6c
 extern int          libipv6calc_db_wrapper_MMDB_all_by_addr(const ipv6calc_ipaddr *ipaddrp, libipv6calc_db_wrapper_geolocation_record *recordp, MMDB_s *const mmdb);
 extern uint32_t     libipv6calc_db_wrapper_MMDB_asn_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb);
 extern uint32_t     libipv6calc_db_wrapper_MMDB_GeonameID_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, int *source_ptr);
+extern int          libipv6calc_db_wrapper_MMDB_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb, const int attributes, char *country, const size_t country_len, uint32_t *asn_ptr, uint32_t *GeonameID_ptr, int *source_ptr);
+extern int          libipv6calc_db_wrapper_MMDB_prefixlength_by_addr(const ipv6calc_ipaddr *ipaddrp, MMDB_s *const mmdb);
 
 extern int	    libipv6calc_db_wrapper_MMDB_open(const char *const filename, uint32_t flags, MMDB_s *const mmdb);
 extern void         libipv6calc_db_wrapper_MMDB_close(MMDB_s *const mmdb);
@@ -0,0 +1,628 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/lib/libipv6calc_db_wrapper_Merged.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  ipv6calc Merged database wrapper
+ *
+ *  The merged database contains per range the CountryCode, ASN, GeonameID and
+ *  Registry as selected by the database priorities at creation time (see
+ *  databases/tools/ipv6calc-db-merged-create), one lookup serves all of them.
+ *  File is mapped read-only into memory, lookup is a binary search.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+
+#include "libipv6calc_db_wrapper.h"
+
+#ifdef SUPPORT_DB_MERGED
+
+#include "libipv6calc_db_wrapper_Merged.h"
+
+
+char merged_db_dir[NI_MAXHOST] = MERGED_DB;
+
+static s_ipv6calc_merged_db merged_db[2]; // per slot, see libipv6calc_db_wrapper_slot
+static int merged_db_valid = 0;
+static int merged_db_used = 0;
+static s_ipv6calc_db_file_stamp merged_db_stamp;
+
+static char merged_db_usage_string[NI_MAXHOST] = "";
+
+// local prototyping
+static char     *libipv6calc_db_wrapper_Merged_dbfilename(void);
+static char     *libipv6calc_db_wrapper_Merged_database_info(const s_ipv6calc_merged_db *dbp);
+
+
+/*
+ * function initialise the Merged wrapper
+ *
+ * in : (nothing)
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_Merged_wrapper_init(void) {
+	char *filename;
+	int slot = libipv6calc_db_wrapper_slot();
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Called");
+
+	wrapper_features_by_source_implemented[IPV6CALC_DB_SOURCE_MERGED] |= MERGED_DB_FEATURES;
+
+	filename = libipv6calc_db_wrapper_Merged_dbfilename();
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Merged database test for availability: %s", filename);
+
+	if (access(filename, R_OK) != 0) {
+		// no file found
+		DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Merged database not available: %s (%s)", filename, strerror(errno));
+		return 0;
+	};
+
+	if (libipv6calc_db_wrapper_Merged_open(filename, &merged_db[slot]) != 0) {
+		// no proper database
+		return 0;
+	};
+
+	merged_db_valid = 1;
+
+	libipv6calc_db_wrapper_file_stamp_get(filename, &merged_db_stamp);
+
+	// finally mark database features as available
+	wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] |= merged_db[slot].header->features & MERGED_DB_FEATURES;
+
+	wrapper_features |= wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED];
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Merged database available: %s (%s)", filename, libipv6calc_db_wrapper_Merged_database_info(&merged_db[slot]));
+
+	return 0;
+};
+
+
+/*
+ * function cleanup the Merged wrapper
+ *
+ * in : (nothing)
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_Merged_wrapper_cleanup(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Called");
+
+	if (merged_db_valid == 1) {
+		if (merged_db[1].map == merged_db[0].map) {
+			// shared by both slots
+			memset(&merged_db[1], 0, sizeof(merged_db[1]));
+		};
+		libipv6calc_db_wrapper_Merged_close(&merged_db[0]);
+		libipv6calc_db_wrapper_Merged_close(&merged_db[1]);
+		merged_db_valid = 0;
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished");
+	return 0;
+};
+
+
+/*
+ * function reload the Merged database in case replaced on disk
+ *  new file is only taken if it contains the same features as the one in use
+ *
+ * in : slot_old (handles in use, copied to the current slot first)
+ * out: 1=reloaded, 0=not reloaded
+ */
+int libipv6calc_db_wrapper_Merged_wrapper_reload(const int slot_old) {
+	char *filename;
+	s_ipv6calc_merged_db merged_db_new;
+	int slot = libipv6calc_db_wrapper_slot();
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Called slot_old=%d slot=%d", slot_old, slot);
+
+	if (merged_db_valid != 1) {
+		return(0);
+	};
+
+	// copy mapping only, cursors of slot_old are updated by concurrent lookups
+	merged_db[slot].map        = merged_db[slot_old].map;
+	merged_db[slot].size       = merged_db[slot_old].size;
+	merged_db[slot].header     = merged_db[slot_old].header;
+	merged_db[slot].ipv6_first = merged_db[slot_old].ipv6_first;
+	merged_db[slot].ipv6_value = merged_db[slot_old].ipv6_value;
+	merged_db[slot].ipv4_first = merged_db[slot_old].ipv4_first;
+	merged_db[slot].ipv4_value = merged_db[slot_old].ipv4_value;
+	merged_db[slot].values     = merged_db[slot_old].values;
+	merged_db[slot].cursor_ipv4 = 0;
+	merged_db[slot].cursor_ipv6 = 0;
+
+	filename = libipv6calc_db_wrapper_Merged_dbfilename();
+
+	if (libipv6calc_db_wrapper_file_stamp_changed(filename, &merged_db_stamp) == 0) {
+		return(0);
+	};
+
+	if (libipv6calc_db_wrapper_Merged_open(filename, &merged_db_new) != 0) {
+		NONQUIETPRINT_WA("Merged database replaced on disk but not usable, keep current one: %s", filename);
+		return(0);
+	};
+
+	if (((merged_db_new.header->features & MERGED_DB_FEATURES) != (merged_db[slot].header->features & MERGED_DB_FEATURES))
+	    || (memcmp(merged_db_new.header->feature_sources, merged_db[slot].header->feature_sources, sizeof(merged_db[slot].header->feature_sources)) != 0)) {
+		NONQUIETPRINT_WA("Merged database replaced on disk with different features or sources, restart required: %s", filename);
+		libipv6calc_db_wrapper_Merged_close(&merged_db_new);
+		// don't complain again until next replacement
+		libipv6calc_db_wrapper_file_stamp_get(filename, &merged_db_stamp);
+		return(0);
+	};
+
+	// old mapping stays in slot_old until released
+	merged_db[slot] = merged_db_new;
+	libipv6calc_db_wrapper_file_stamp_get(filename, &merged_db_stamp);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Merged database reloaded: %s (%s)", filename, libipv6calc_db_wrapper_Merged_database_info(&merged_db[slot]));
+
+	return(1);
+};
+
+
+/*
+ * function release the Merged database of a retired slot
+ *  mapping is only unmapped if not in use by the other slot
+ *
+ * in : slot
+ */
+void libipv6calc_db_wrapper_Merged_wrapper_release(const int slot) {
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Called slot=%d", slot);
+
+	if (merged_db[slot].map != merged_db[1 - slot].map) {
+		libipv6calc_db_wrapper_Merged_close(&merged_db[slot]);
+	} else {
+		memset(&merged_db[slot], 0, sizeof(merged_db[slot]));
+	};
+};
+
+
+/*
+ * function info of Merged wrapper
+ *
+ * in : ptr and size of string to be filled
+ * out: modified string;
+ */
+void libipv6calc_db_wrapper_Merged_wrapper_info(char* string, const size_t size) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Called");
+
+	snprintf(string, size, "Merged available databases: Country4=%d Country6=%d ASN4=%d ASN6=%d GeonameID4=%d GeonameID6=%d IPV4_REG=%d IPV6_REG=%d", \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV4_TO_CC) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV6_TO_CC) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV4_TO_AS) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV6_TO_AS) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV4_TO_GEONAMEID) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV6_TO_GEONAMEID) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV4_TO_REGISTRY) ? 1 : 0, \
+		(wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & IPV6CALC_DB_IPV6_TO_REGISTRY) ? 1 : 0 \
+	);
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished");
+	return;
+};
+
+
+/*
+ * function print database info of Merged wrapper
+ *
+ * in : (void)
+ * out: (void)
+ */
+void libipv6calc_db_wrapper_Merged_wrapper_print_db_info(const int level_verbose, const char *prefix_string) {
+	const char *prefix = "\0";
+	if (prefix_string != NULL) {
+		prefix = prefix_string;
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Called");
+
+	if ((merged_db_valid != 1) && (access(libipv6calc_db_wrapper_Merged_dbfilename(), F_OK) != 0)) {
+		// merged database is optional, nothing to report if not created
+		DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished (no database)");
+		return;
+	};
+
+	IPV6CALC_DB_FEATURE_INFO(prefix, IPV6CALC_DB_SOURCE_MERGED)
+
+	fprintf(stderr, "%sMerged: info of available databases in directory: %s\n", prefix, merged_db_dir);
+
+	if (merged_db_valid == 1) {
+		fprintf(stderr, "%sMerged: %-20s: %-40s (%s)\n", prefix, "Merged", MERGED_DB_FILE, libipv6calc_db_wrapper_Merged_database_info(&merged_db[libipv6calc_db_wrapper_slot()]));
+	} else {
+		if (level_verbose == LEVEL_VERBOSE2) {
+			fprintf(stderr, "%sMerged: %-20s: %-40s (%s)\n", prefix, "Merged", libipv6calc_db_wrapper_Merged_dbfilename(), (access(libipv6calc_db_wrapper_Merged_dbfilename(), R_OK) == 0) ? "invalid" : strerror(errno));
+		};
+		fprintf(stderr, "%sMerged: NO usable database found in directory: %s\n", prefix, merged_db_dir);
+	};
+
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished");
+	return;
+};
+
+
+/*
+ * wrapper: string regarding used database infos
+ */
+char *libipv6calc_db_wrapper_Merged_wrapper_db_info_used(void) {
+	DEBUGPRINT_NA(DEBUG_libipv6calc_db_wrapper_Merged, "Called");
+
+	if ((merged_db_used == 1) && (merged_db_valid == 1) && (strlen(merged_db_usage_string) == 0)) {
+		snprintf(merged_db_usage_string, sizeof(merged_db_usage_string), "%s", libipv6calc_db_wrapper_Merged_database_info(&merged_db[libipv6calc_db_wrapper_slot()]));
+	};
+
+	return(merged_db_usage_string);
+};
+
+
+/*
+ * wrapper: Merged_has_features
+ *
+ * in:  features
+ * out: 1=ok, 0=not supported
+ */
+int libipv6calc_db_wrapper_Merged_has_features(uint32_t features) {
+	int result = -1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Called with feature value to test: 0x%08x", features);
+
+	if ((wrapper_features_by_source[IPV6CALC_DB_SOURCE_MERGED] & features) == features) {
+		result = 1;
+	} else {
+		result = 0;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Return with result: %d", result);
+	return(result);
+};
+
+
+/*
+ * wrapper: sources of a feature contained in the Merged database
+ *
+ * in:  f = feature number
+ * out: sources in priority order (see MERGED_DB_FEATURE_SOURCE), 0 = feature not contained
+ */
+uint32_t libipv6calc_db_wrapper_Merged_feature_sources(const int f) {
+	if ((merged_db_valid != 1) || (f < IPV6CALC_DB_FEATURE_NUM_MIN) || (f > IPV6CALC_DB_FEATURE_NUM_MAX)) {
+		return(0);
+	};
+
+	if ((merged_db[libipv6calc_db_wrapper_slot()].header->features & (1 << f)) == 0) {
+		return(0);
+	};
+
+	return(merged_db[libipv6calc_db_wrapper_slot()].header->feature_sources[f]);
+};
+
+
+/*******************************
+ * Wrapper extension functions for Merged
+ *******************************/
+
+/*
+ * wrapper extension: Merged_dbfilename
+ */
+static char *libipv6calc_db_wrapper_Merged_dbfilename(void) {
+	static char tempstring[NI_MAXHOST];
+
+	snprintf(tempstring, sizeof(tempstring), "%s/%s", merged_db_dir, MERGED_DB_FILE);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished: filename=%s", tempstring);
+	return(tempstring);
+};
+
+
+/*
+ * wrapper extension: Merged_database_info
+ */
+static char *libipv6calc_db_wrapper_Merged_database_info(const s_ipv6calc_merged_db *dbp) {
+	static char resultstring[NI_MAXHOST];
+	char datastring[NI_MAXHOST];
+	time_t unixtime = (time_t) dbp->header->unixtime;
+	struct tm *db_time;
+
+	db_time = gmtime(&unixtime);
+	if (db_time == NULL) {
+		snprintf(datastring, sizeof(datastring), "unknown");
+	} else {
+		snprintf(datastring, sizeof(datastring), "%04d%02d%02d", 1900 + db_time->tm_year, db_time->tm_mon + 1, db_time->tm_mday);
+	};
+
+	snprintf(resultstring, sizeof(resultstring), "Merged/%s ranges IPv4=%u IPv6=%u values=%u", datastring, dbp->header->count_ipv4, dbp->header->count_ipv6, dbp->header->count_values);
+
+	return(resultstring);
+};
+
+
+/*
+ * open and map merged database
+ *
+ * in : filename
+ * mod: dbp
+ * out: 0=ok, 1=error
+ */
+int libipv6calc_db_wrapper_Merged_open(const char *filename, s_ipv6calc_merged_db *dbp) {
+	int fd, result = 1;
+	struct stat st;
+	uint64_t size_expected;
+	uint32_t i;
+	const s_ipv6calc_merged_db_header *header;
+	const char *ptr;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Called: %s", filename);
+
+	memset(dbp, 0, sizeof(*dbp));
+
+	fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		ERRORPRINT_WA("can't open Merged database: %s (%s)", filename, strerror(errno));
+		return(1);
+	};
+
+	if (fstat(fd, &st) != 0) {
+		ERRORPRINT_WA("can't stat Merged database: %s (%s)", filename, strerror(errno));
+		close(fd);
+		return(1);
+	};
+
+	if ((size_t) st.st_size < sizeof(s_ipv6calc_merged_db_header)) {
+		ERRORPRINT_WA("Merged database too short: %s", filename);
+		close(fd);
+		return(1);
+	};
+
+	dbp->size = st.st_size;
+	dbp->map = mmap(NULL, dbp->size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if (dbp->map == MAP_FAILED) {
+		ERRORPRINT_WA("can't map Merged database: %s (%s)", filename, strerror(errno));
+		dbp->map = NULL;
+		return(1);
+	};
+
+	header = (const s_ipv6calc_merged_db_header *) dbp->map;
+
+	if (strncmp(header->magic, MERGED_DB_MAGIC, sizeof(header->magic)) != 0) {
+		ERRORPRINT_WA("Merged database has no valid magic: %s", filename);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	if (header->endian != MERGED_DB_ENDIAN) {
+		ERRORPRINT_WA("Merged database was created on a system with different byte order: %s", filename);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	if (header->version != MERGED_DB_VERSION) {
+		ERRORPRINT_WA("Merged database has unsupported version: %s (%u, supported: %u)", filename, header->version, MERGED_DB_VERSION);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	if ((header->count_ipv4 == 0) || (header->count_ipv6 == 0) || (header->count_values == 0)) {
+		ERRORPRINT_WA("Merged database contains no ranges: %s", filename);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	size_expected = sizeof(s_ipv6calc_merged_db_header)
+		+ (uint64_t) header->count_ipv6 * (sizeof(uint64_t) + sizeof(uint32_t))
+		+ (uint64_t) header->count_ipv4 * (sizeof(uint32_t) + sizeof(uint32_t))
+		+ (uint64_t) header->count_values * sizeof(s_ipv6calc_merged_db_value);
+
+	if (size_expected != (uint64_t) dbp->size) {
+		ERRORPRINT_WA("Merged database has unexpected size: %s (%lu, expected: %lu)", filename, (unsigned long) dbp->size, (unsigned long) size_expected);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	ptr = (const char *) dbp->map + sizeof(s_ipv6calc_merged_db_header);
+	dbp->ipv6_first = (const uint64_t *) ptr;
+	ptr += header->count_ipv6 * sizeof(uint64_t);
+	dbp->ipv6_value = (const uint32_t *) ptr;
+	ptr += header->count_ipv6 * sizeof(uint32_t);
+	dbp->ipv4_first = (const uint32_t *) ptr;
+	ptr += header->count_ipv4 * sizeof(uint32_t);
+	dbp->ipv4_value = (const uint32_t *) ptr;
+	ptr += header->count_ipv4 * sizeof(uint32_t);
+	dbp->values = (const s_ipv6calc_merged_db_value *) ptr;
+
+	if ((dbp->ipv6_first[0] != 0) || (dbp->ipv4_first[0] != 0)) {
+		ERRORPRINT_WA("Merged database ranges are not starting with 0: %s", filename);
+		goto END_libipv6calc_db_wrapper_Merged;
+	};
+
+	// values are referenced by index, check them once here instead on each lookup
+	for (i = 0; i < header->count_ipv6; i++) {
+		if (dbp->ipv6_value[i] >= header->count_values) {
+			ERRORPRINT_WA("Merged database contains invalid IPv6 value reference: %s", filename);
+			goto END_libipv6calc_db_wrapper_Merged;
+		};
+	};
+
+	for (i = 0; i < header->count_ipv4; i++) {
+		if (dbp->ipv4_value[i] >= header->count_values) {
+			ERRORPRINT_WA("Merged database contains invalid IPv4 value reference: %s", filename);
+			goto END_libipv6calc_db_wrapper_Merged;
+		};
+	};
+
+	dbp->header = header;
+	result = 0;
+
+END_libipv6calc_db_wrapper_Merged:
+	if (result != 0) {
+		munmap(dbp->map, dbp->size);
+		memset(dbp, 0, sizeof(*dbp));
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Finished: %s result=%d", filename, result);
+	return(result);
+};
+
+
+/*
+ * unmap merged database
+ */
+void libipv6calc_db_wrapper_Merged_close(s_ipv6calc_merged_db *dbp) {
+	if (dbp->map != NULL) {
+		munmap(dbp->map, dbp->size);
+	};
+	memset(dbp, 0, sizeof(*dbp));
+};
+
+
+/*
+ * search range containing the key, starting at cursor of previous lookup
+ *  keys ascending between calls result in a merge-style sweep over the ranges
+ *  (galloping forward from cursor), otherwise in a binary search
+ */
+#define MERGED_DB_RANGE_SEARCH(first, count, key, cursor) \
+	if ((first)[cursor] <= (key)) { \
+		step = 1; \
+		lo = cursor; \
+		hi = lo + 1; \
+		while ((hi < (count)) && ((first)[hi] <= (key))) { \
+			lo = hi; \
+			step <<= 1; \
+			hi = lo + step; \
+		}; \
+		if (hi > (count)) { \
+			hi = (count); \
+		}; \
+	} else { \
+		lo = 0; \
+		hi = cursor; \
+	}; \
+	while (hi - lo > 1) { \
+		mid = lo + (hi - lo) / 2; \
+		if ((first)[mid] <= (key)) { \
+			lo = mid; \
+		} else { \
+			hi = mid; \
+		}; \
+	}; \
+	cursor = lo;
+
+
+/*
+ * lookup value of range containing the address
+ *
+ * in : ipaddrp (IPv6: only prefix bits 0-63 are used)
+ * mod: dbp (cursor, shared by concurrent lookups, only a hint)
+ * out: pointer to value, NULL on unsupported protocol
+ */
+const s_ipv6calc_merged_db_value *libipv6calc_db_wrapper_Merged_lookup(s_ipv6calc_merged_db *dbp, const ipv6calc_ipaddr *ipaddrp) {
+	uint32_t lo, hi, mid, step, cursor;
+
+	// search last range starting before or at the address, first range starts always with 0
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		uint32_t key = ipaddrp->addr[0];
+
+		cursor = __atomic_load_n(&dbp->cursor_ipv4, __ATOMIC_RELAXED);
+		MERGED_DB_RANGE_SEARCH(dbp->ipv4_first, dbp->header->count_ipv4, key, cursor)
+		__atomic_store_n(&dbp->cursor_ipv4, cursor, __ATOMIC_RELAXED);
+
+		return(&dbp->values[dbp->ipv4_value[lo]]);
+	} else if (ipaddrp->proto == IPV6CALC_PROTO_IPV6) {
+		uint64_t key = ((uint64_t) ipaddrp->addr[0] << 32) | ipaddrp->addr[1];
+
+		cursor = __atomic_load_n(&dbp->cursor_ipv6, __ATOMIC_RELAXED);
+		MERGED_DB_RANGE_SEARCH(dbp->ipv6_first, dbp->header->count_ipv6, key, cursor)
+		__atomic_store_n(&dbp->cursor_ipv6, cursor, __ATOMIC_RELAXED);
+
+		return(&dbp->values[dbp->ipv6_value[lo]]);
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * get CountryCode index, AS number, GeonameID and Registry at once
+ *
+ * in : ipaddrp
+ * mod: recordp (only found attributes, data sources are set to Merged)
+ * out: attributes found (IPV6CALC_DB_ATTR_*)
+ */
+int libipv6calc_db_wrapper_Merged_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, s_ipv6calc_db_attributes *recordp) {
+	const s_ipv6calc_merged_db_value *valuep;
+	int result = 0;
+
+	if (merged_db_valid != 1) {
+		return(0);
+	};
+
+	valuep = libipv6calc_db_wrapper_Merged_lookup(&merged_db[libipv6calc_db_wrapper_slot()], ipaddrp);
+	if (valuep == NULL) {
+		return(0);
+	};
+
+	__atomic_store_n(&merged_db_used, 1, __ATOMIC_RELAXED);
+
+	result = valuep->attributes;
+
+	if ((result & IPV6CALC_DB_ATTR_CC) != 0) {
+		recordp->cc_index = valuep->cc_index;
+		recordp->data_source_cc = IPV6CALC_DB_SOURCE_MERGED;
+	};
+
+	if ((result & IPV6CALC_DB_ATTR_AS) != 0) {
+		recordp->as_num32 = valuep->as_num32;
+		recordp->data_source_as = IPV6CALC_DB_SOURCE_MERGED;
+	};
+
+	if ((result & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+		recordp->GeonameID = valuep->GeonameID;
+		recordp->GeonameID_type = valuep->GeonameID_type;
+		recordp->data_source_GeonameID = IPV6CALC_DB_SOURCE_MERGED;
+	};
+
+	if ((result & IPV6CALC_DB_ATTR_REGISTRY) != 0) {
+		recordp->registry = valuep->registry;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc_db_wrapper_Merged, "Result: addr=%08x%08x%08x%08x found=0x%x cc_index=%d as_num32=%u GeonameID=%u registry=%d", ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->addr[2], ipaddrp->addr[3], result, valuep->cc_index, valuep->as_num32, valuep->GeonameID, valuep->registry);
+
+	return(result);
+};
+
+
+/*
+ * get registry number
+ *
+ * in : ipaddrp
+ * out: registry number, REGISTRY_UNKNOWN if not found
+ */
+int libipv6calc_db_wrapper_Merged_registry_num_by_addr(const ipv6calc_ipaddr *ipaddrp) {
+	const s_ipv6calc_merged_db_value *valuep;
+
+	if (merged_db_valid != 1) {
+		return(REGISTRY_UNKNOWN);
+	};
+
+	valuep = libipv6calc_db_wrapper_Merged_lookup(&merged_db[libipv6calc_db_wrapper_slot()], ipaddrp);
+	if ((valuep == NULL) || ((valuep->attributes & IPV6CALC_DB_ATTR_REGISTRY) == 0)) {
+		return(REGISTRY_UNKNOWN);
+	};
+
+	__atomic_store_n(&merged_db_used, 1, __ATOMIC_RELAXED);
+
+	return(valuep->registry);
+};
+
+#endif // SUPPORT_DB_MERGED
@@ -0,0 +1,107 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/lib/libipv6calc_db_wrapper_Merged.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipv6calc_db_wrapper_Merged.c
+ */
+
+#include <time.h>
+#include "ipv6calctypes.h"
+
+#ifndef _libipv6calc_db_wrapper_Merged_h
+
+#define _libipv6calc_db_wrapper_Merged_h 1
+
+#ifndef MERGED_DB
+#define MERGED_DB	"/usr/share/ipv6calc/db"
+#endif
+
+#define MERGED_DB_FILE		"ipv6calc-merged.db"
+
+#define MERGED_DB_MAGIC		"ipv6calc-merged"
+#define MERGED_DB_VERSION	2
+#define MERGED_DB_ENDIAN	0x01020304
+
+// merged sources of a feature in priority order, 4 bits each starting with the lowest ones
+#define MERGED_DB_FEATURE_SOURCES_MAX		8
+#define MERGED_DB_FEATURE_SOURCE(sources, i)	(((sources) >> ((i) * 4)) & 0xf)
+
+// features which can be stored in a merged database
+#define MERGED_DB_FEATURES	( IPV6CALC_DB_IPV4_TO_CC | IPV6CALC_DB_IPV6_TO_CC \
+				| IPV6CALC_DB_IPV4_TO_AS | IPV6CALC_DB_IPV6_TO_AS \
+				| IPV6CALC_DB_IPV4_TO_GEONAMEID | IPV6CALC_DB_IPV6_TO_GEONAMEID \
+				| IPV6CALC_DB_IPV4_TO_REGISTRY | IPV6CALC_DB_IPV6_TO_REGISTRY )
+
+/*
+ * file layout (host byte order, checked by endian marker)
+ *  header
+ *  uint64_t ipv6_first[count_ipv6]	first prefix (bits 0-63) of range, ascending, starting with 0
+ *  uint32_t ipv6_value[count_ipv6]	index in values
+ *  uint32_t ipv4_first[count_ipv4]	first address of range, ascending, starting with 0
+ *  uint32_t ipv4_value[count_ipv4]	index in values
+ *  s_ipv6calc_merged_db_value values[count_values]
+ *
+ * ranges are covering the whole address space, a range ends before the next one starts
+ * IPv6 entries longer than /64 are rejected on creation
+ */
+typedef struct {
+	char     magic[16];
+	uint32_t version;
+	uint32_t endian;
+	uint64_t unixtime;		// creation time
+	uint32_t features;		// IPV6CALC_DB_* contained
+	uint32_t sources;		// bitmask (1 << IPV6CALC_DB_SOURCE_*) of merged sources
+	uint32_t count_ipv4;
+	uint32_t count_ipv6;
+	uint32_t count_values;
+	uint32_t reserved;
+	uint32_t feature_sources[32];	// per feature number: sources (see MERGED_DB_FEATURE_SOURCE)
+} s_ipv6calc_merged_db_header;
+
+typedef struct {
+	uint32_t as_num32;
+	uint32_t GeonameID;
+	uint32_t GeonameID_type;
+	uint16_t cc_index;
+	uint8_t  registry;
+	uint8_t  attributes;		// IPV6CALC_DB_ATTR_* contained
+} s_ipv6calc_merged_db_value;
+
+// mapped database
+typedef struct {
+	void    *map;
+	size_t   size;
+	const s_ipv6calc_merged_db_header *header;
+	const uint64_t *ipv6_first;
+	const uint32_t *ipv6_value;
+	const uint32_t *ipv4_first;
+	const uint32_t *ipv4_value;
+	const s_ipv6calc_merged_db_value *values;
+	uint32_t cursor_ipv4;		// range index of last lookup
+	uint32_t cursor_ipv6;
+} s_ipv6calc_merged_db;
+
+extern char merged_db_dir[NI_MAXHOST];
+
+#endif
+
+extern int         libipv6calc_db_wrapper_Merged_wrapper_init(void);
+extern int         libipv6calc_db_wrapper_Merged_wrapper_cleanup(void);
+extern int         libipv6calc_db_wrapper_Merged_wrapper_reload(const int slot_old);
+extern void        libipv6calc_db_wrapper_Merged_wrapper_release(const int slot);
+extern void        libipv6calc_db_wrapper_Merged_wrapper_info(char* string, const size_t size);
+extern void        libipv6calc_db_wrapper_Merged_wrapper_print_db_info(const int level_verbose, const char *prefix_string);
+extern char       *libipv6calc_db_wrapper_Merged_wrapper_db_info_used(void);
+
+extern int         libipv6calc_db_wrapper_Merged_has_features(uint32_t features);
+extern uint32_t    libipv6calc_db_wrapper_Merged_feature_sources(const int f);
+
+extern int         libipv6calc_db_wrapper_Merged_attributes_by_addr(const ipv6calc_ipaddr *ipaddrp, s_ipv6calc_db_attributes *recordp);
+extern int         libipv6calc_db_wrapper_Merged_registry_num_by_addr(const ipv6calc_ipaddr *ipaddrp);
+
+extern int         libipv6calc_db_wrapper_Merged_open(const char *filename, s_ipv6calc_merged_db *dbp);
+extern void        libipv6calc_db_wrapper_Merged_close(s_ipv6calc_merged_db *dbp);
+extern const s_ipv6calc_merged_db_value *libipv6calc_db_wrapper_Merged_lookup(s_ipv6calc_merged_db *dbp, const ipv6calc_ipaddr *ipaddrp);
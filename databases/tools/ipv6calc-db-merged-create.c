@@ -0,0 +1,796 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/tools/ipv6calc-db-merged-create.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Create the merged database (see databases/lib/libipv6calc_db_wrapper_Merged.c)
+ *  from the available databases, offline and independent of the lookup tools.
+ *
+ *  The address spaces are walked block-wise using the range end reported by
+ *  each source (BuiltIn range tables, MMDB netmask of GeoIP2/DB-IP.com MMDB),
+ *  equal neighbours are coalesced and random samples are verified against the
+ *  sources before finishing. Features served by sources without range
+ *  information are not merged and stay on their live lookups.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "ipv6calccommands.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcoptions.h"
+#include "ipv6calchelp.h"
+
+#include "libipv6addr.h"
+#include "libipv4addr.h"
+
+#include "../lib/libipv6calc_db_wrapper.h"
+#include "../lib/libipv6calc_db_wrapper_Merged.h"
+
+#define PROGRAM_NAME "ipv6calc-db-merged-create"
+#define PROGRAM_COPYRIGHT "(P) & (C) 2019-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
+
+#ifdef SUPPORT_DB_MERGED
+
+#define MERGED_DB_VERIFY_SAMPLES	100000
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+/* define short options */
+static char *merged_shortopts = "vh?";
+
+/* define long options */
+static struct option merged_longopts[] = {
+	{"version", 0, 0, (int) 'v'},
+	{"help"   , 0, 0, (int) 'h'},
+};
+
+// database under construction
+typedef struct {
+	uint64_t *ipv6_first;
+	uint32_t *ipv6_value;
+	uint32_t  count_ipv6;
+	uint32_t  max_ipv6;
+	uint32_t *ipv4_first;
+	uint32_t *ipv4_value;
+	uint32_t  count_ipv4;
+	uint32_t  max_ipv4;
+	s_ipv6calc_merged_db_value *values;
+	uint32_t  count_values;
+	uint32_t  max_values;
+	uint32_t *hash;			// value index + 1, 0 = empty
+	uint32_t  hash_size;
+	uint32_t  features;
+	uint32_t  sources;
+	uint32_t  feature_sources[32];
+} s_ipv6calc_merged_db_builder;
+
+
+/* display info */
+void printversion(void) {
+	fprintf(stderr, "%s: version %s\n", PROGRAM_NAME, PACKAGE_VERSION);
+};
+
+void printcopyright(void) {
+	fprintf(stderr, "%s\n", PROGRAM_COPYRIGHT);
+};
+
+static void printhelp(void) {
+	printversion();
+	printcopyright();
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Usage: %s [options] [<file>]\n", PROGRAM_NAME);
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Creates the merged database (CountryCode/ASN/GeonameID/Registry, single lookup)\n");
+	fprintf(stderr, "   from the available databases, selected by the given database options and priorities\n");
+	fprintf(stderr, "   default file: %s/%s (see --db-merged-dir)\n", merged_db_dir, MERGED_DB_FILE);
+	fprintf(stderr, "   features are only merged if all their sources can report the range of a result,\n");
+	fprintf(stderr, "   creation fails if a source contains IPv6 entries longer than /64\n");
+	fprintf(stderr, "   the lookup tools use the merged database only with the same database priorization\n");
+
+	printhelp_common(IPV6CALC_HELP_ALL);
+
+	fprintf(stderr, "\n");
+};
+
+
+/*******************************
+ * Builder
+ *******************************/
+
+#define MERGED_DB_BUILDER_HASH_SIZE_MIN	4096
+
+/*
+ * hash of a value
+ */
+static uint32_t merged_value_hash(const s_ipv6calc_merged_db_value *valuep) {
+	const unsigned char *p = (const unsigned char *) valuep;
+	uint32_t hash = 2166136261U; // FNV-1a
+	size_t i;
+
+	for (i = 0; i < sizeof(*valuep); i++) {
+		hash ^= p[i];
+		hash *= 16777619U;
+	};
+
+	return(hash);
+};
+
+
+/*
+ * grow array if full
+ */
+static int merged_grow(void **arrayp, uint32_t *maxp, const uint32_t count, const size_t size) {
+	uint32_t max;
+	void *p;
+
+	if (count < *maxp) {
+		return(0);
+	};
+
+	max = (*maxp == 0) ? 65536 : *maxp * 2;
+	p = realloc(*arrayp, (size_t) max * size);
+	if (p == NULL) {
+		fprintf(stderr, "Can't allocate memory for merged database (%lu bytes)\n", (unsigned long) max * size);
+		return(1);
+	};
+
+	*arrayp = p;
+	*maxp = max;
+	return(0);
+};
+
+
+/*
+ * grow range arrays (first/value) if full
+ */
+static int merged_grow_ranges(void **firstp, uint32_t **valuep, uint32_t *maxp, const uint32_t count, const size_t size_first) {
+	uint32_t max = *maxp;
+
+	if (merged_grow((void **) valuep, &max, count, sizeof(uint32_t)) != 0) {
+		return(1);
+	};
+
+	return(merged_grow(firstp, maxp, count, size_first));
+};
+
+
+/*
+ * (re)build value hash table
+ */
+static int merged_hash_rebuild(s_ipv6calc_merged_db_builder *builderp, const uint32_t hash_size) {
+	uint32_t i, h;
+
+	free(builderp->hash);
+	builderp->hash = calloc(hash_size, sizeof(uint32_t));
+	if (builderp->hash == NULL) {
+		fprintf(stderr, "Can't allocate memory for merged database hash\n");
+		return(1);
+	};
+	builderp->hash_size = hash_size;
+
+	for (i = 0; i < builderp->count_values; i++) {
+		h = merged_value_hash(&builderp->values[i]) & (hash_size - 1);
+		while (builderp->hash[h] != 0) {
+			h = (h + 1) & (hash_size - 1);
+		};
+		builderp->hash[h] = i + 1;
+	};
+
+	return(0);
+};
+
+
+/*
+ * initialize builder
+ *
+ * out: 0=ok, 1=error
+ */
+static int merged_builder_init(s_ipv6calc_merged_db_builder *builderp) {
+	memset(builderp, 0, sizeof(*builderp));
+	return(merged_hash_rebuild(builderp, MERGED_DB_BUILDER_HASH_SIZE_MIN));
+};
+
+
+/*
+ * free builder
+ */
+static void merged_builder_free(s_ipv6calc_merged_db_builder *builderp) {
+	free(builderp->ipv6_first);
+	free(builderp->ipv6_value);
+	free(builderp->ipv4_first);
+	free(builderp->ipv4_value);
+	free(builderp->values);
+	free(builderp->hash);
+	memset(builderp, 0, sizeof(*builderp));
+};
+
+
+/*
+ * add range to builder
+ *  ranges have to be added in ascending order without gaps starting with 0
+ *  range is coalesced with the previous one in case of identical value
+ *
+ * in : builderp, proto, first (IPv4: address, IPv6: prefix bits 0-63), valuep
+ * out: 0=ok, 1=error
+ */
+static int merged_builder_add(s_ipv6calc_merged_db_builder *builderp, const int proto, const uint64_t first, const s_ipv6calc_merged_db_value *valuep) {
+	uint32_t h, index;
+	s_ipv6calc_merged_db_value value;
+
+	// normalize unused fields to get identical values deduplicated
+	memset(&value, 0, sizeof(value));
+	value.attributes = valuep->attributes;
+	value.cc_index = ((value.attributes & IPV6CALC_DB_ATTR_CC) != 0) ? valuep->cc_index : COUNTRYCODE_INDEX_UNKNOWN;
+	value.as_num32 = ((value.attributes & IPV6CALC_DB_ATTR_AS) != 0) ? valuep->as_num32 : ASNUM_AS_UNKNOWN;
+	value.registry = ((value.attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) ? valuep->registry : REGISTRY_UNKNOWN;
+	if ((value.attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+		value.GeonameID = valuep->GeonameID;
+		value.GeonameID_type = valuep->GeonameID_type;
+	} else {
+		value.GeonameID = IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN;
+		value.GeonameID_type = IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN;
+	};
+
+	// lookup value
+	h = merged_value_hash(&value) & (builderp->hash_size - 1);
+	while (builderp->hash[h] != 0) {
+		if (memcmp(&builderp->values[builderp->hash[h] - 1], &value, sizeof(value)) == 0) {
+			break;
+		};
+		h = (h + 1) & (builderp->hash_size - 1);
+	};
+
+	if (builderp->hash[h] != 0) {
+		index = builderp->hash[h] - 1;
+	} else {
+		// new value
+		if (merged_grow((void **) &builderp->values, &builderp->max_values, builderp->count_values, sizeof(value)) != 0) {
+			return(1);
+		};
+		index = builderp->count_values;
+		builderp->values[index] = value;
+		builderp->count_values++;
+		builderp->hash[h] = index + 1;
+
+		// keep load below 50%
+		if (builderp->count_values * 2 > builderp->hash_size) {
+			if (merged_hash_rebuild(builderp, builderp->hash_size * 2) != 0) {
+				return(1);
+			};
+		};
+	};
+
+	if (proto == IPV6CALC_PROTO_IPV4) {
+		if ((builderp->count_ipv4 > 0) && (builderp->ipv4_value[builderp->count_ipv4 - 1] == index)) {
+			return(0); // coalesce
+		};
+
+		if (merged_grow_ranges((void **) &builderp->ipv4_first, &builderp->ipv4_value, &builderp->max_ipv4, builderp->count_ipv4, sizeof(uint32_t)) != 0) {
+			return(1);
+		};
+
+		builderp->ipv4_first[builderp->count_ipv4] = (uint32_t) first;
+		builderp->ipv4_value[builderp->count_ipv4] = index;
+		builderp->count_ipv4++;
+	} else if (proto == IPV6CALC_PROTO_IPV6) {
+		if ((builderp->count_ipv6 > 0) && (builderp->ipv6_value[builderp->count_ipv6 - 1] == index)) {
+			return(0); // coalesce
+		};
+
+		if (merged_grow_ranges((void **) &builderp->ipv6_first, &builderp->ipv6_value, &builderp->max_ipv6, builderp->count_ipv6, sizeof(uint64_t)) != 0) {
+			return(1);
+		};
+
+		builderp->ipv6_first[builderp->count_ipv6] = first;
+		builderp->ipv6_value[builderp->count_ipv6] = index;
+		builderp->count_ipv6++;
+	} else {
+		ERRORPRINT_WA("unsupported proto=%d (FIX CODE)", proto);
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * write builder content to file
+ *  written to a temporary file first and renamed at the end
+ *
+ * in : builderp, filename
+ * out: 0=ok, 1=error
+ */
+static int merged_builder_write(const s_ipv6calc_merged_db_builder *builderp, const char *filename) {
+	s_ipv6calc_merged_db_header header;
+	char filename_tmp[NI_MAXHOST];
+	FILE *fp;
+	int result = 1;
+
+	if ((builderp->count_ipv4 == 0) || (builderp->count_ipv6 == 0)) {
+		fprintf(stderr, "Merged database contains no ranges, not written: %s\n", filename);
+		return(1);
+	};
+
+	snprintf(filename_tmp, sizeof(filename_tmp), "%s.tmp", filename);
+
+	memset(&header, 0, sizeof(header));
+	snprintf(header.magic, sizeof(header.magic), "%s", MERGED_DB_MAGIC);
+	header.version      = MERGED_DB_VERSION;
+	header.endian       = MERGED_DB_ENDIAN;
+	header.unixtime     = (uint64_t) time(NULL);
+	header.features     = builderp->features;
+	header.sources      = builderp->sources;
+	memcpy(header.feature_sources, builderp->feature_sources, sizeof(header.feature_sources));
+	header.count_ipv4   = builderp->count_ipv4;
+	header.count_ipv6   = builderp->count_ipv6;
+	header.count_values = builderp->count_values;
+
+	fp = fopen(filename_tmp, "w");
+	if (fp == NULL) {
+		fprintf(stderr, "Can't create merged database: %s (%s)\n", filename_tmp, strerror(errno));
+		return(1);
+	};
+
+	if ((fwrite(&header, sizeof(header), 1, fp) != 1)
+	    || (fwrite(builderp->ipv6_first, sizeof(uint64_t), builderp->count_ipv6, fp) != builderp->count_ipv6)
+	    || (fwrite(builderp->ipv6_value, sizeof(uint32_t), builderp->count_ipv6, fp) != builderp->count_ipv6)
+	    || (fwrite(builderp->ipv4_first, sizeof(uint32_t), builderp->count_ipv4, fp) != builderp->count_ipv4)
+	    || (fwrite(builderp->ipv4_value, sizeof(uint32_t), builderp->count_ipv4, fp) != builderp->count_ipv4)
+	    || (fwrite(builderp->values, sizeof(s_ipv6calc_merged_db_value), builderp->count_values, fp) != builderp->count_values)) {
+		fprintf(stderr, "Can't write merged database: %s (%s)\n", filename_tmp, strerror(errno));
+		fclose(fp);
+		goto END_merged_builder_write;
+	};
+
+	if (fclose(fp) != 0) {
+		fprintf(stderr, "Can't write merged database: %s (%s)\n", filename_tmp, strerror(errno));
+		goto END_merged_builder_write;
+	};
+
+	// replace atomically, running processes keep their mapping of the old file
+	if (rename(filename_tmp, filename) != 0) {
+		fprintf(stderr, "Can't rename merged database: %s -> %s (%s)\n", filename_tmp, filename, strerror(errno));
+		goto END_merged_builder_write;
+	};
+
+	result = 0;
+
+END_merged_builder_write:
+	if (result != 0) {
+		unlink(filename_tmp);
+	};
+
+	return(result);
+};
+
+
+/*******************************
+ * Creation
+ *******************************/
+
+/*
+ * set address
+ *
+ * in : proto, first (IPv4: address, IPv6: prefix bits 0-63)
+ * mod: ipaddrp
+ */
+static void merged_ipaddr_set(ipv6calc_ipaddr *ipaddrp, const int proto, const uint64_t first) {
+	libipaddr_clearall(ipaddrp);
+
+	if (proto == IPV6CALC_PROTO_IPV4) {
+		ipaddrp->addr[0] = (uint32_t) first;
+	} else {
+		ipaddrp->addr[0] = (uint32_t) (first >> 32);
+		ipaddrp->addr[1] = (uint32_t) (first & 0xffffffffu);
+	};
+
+	ipaddrp->proto = proto;
+	ipaddrp->flag_valid = 1;
+};
+
+
+/*
+ * last entry (IPv4: address, IPv6: prefix bits 0-63) of block starting at given address
+ *  where all selected sources are returning the same result
+ *
+ * in : ipaddrp, sources
+ * mod: lastp
+ * out: 0=ok, 1=error
+ */
+static int merged_block_last(const ipv6calc_ipaddr *ipaddrp, const uint32_t sources, uint64_t *lastp) {
+	uint64_t last_source;
+	int s, r;
+
+	*lastp = (ipaddrp->proto == IPV6CALC_PROTO_IPV4) ? 0xffffffffu : UINT64_MAX;
+
+	for (s = IPV6CALC_DB_SOURCE_MIN; s <= IPV6CALC_DB_SOURCE_MAX; s++) {
+		if ((sources & (1 << s)) == 0) {
+			continue;
+		};
+
+		r = libipv6calc_db_wrapper_range_last_by_addr(ipaddrp, s, &last_source);
+		if (r == 2) {
+			fprintf(stderr, "Source contains IPv6 entries longer than /64, not supported by merged database: %s prefix=%04x:%04x:%04x:%04x::/64\n"
+				, libipv6calc_db_wrapper_get_data_source_name_by_number(s)
+				, ipaddrp->addr[0] >> 16, ipaddrp->addr[0] & 0xffff, ipaddrp->addr[1] >> 16, ipaddrp->addr[1] & 0xffff);
+			return(1);
+		} else if (r != 0) {
+			fprintf(stderr, "Source can't report range of address: %s addr=%08x%08x proto=%d\n", libipv6calc_db_wrapper_get_data_source_name_by_number(s), ipaddrp->addr[0], ipaddrp->addr[1], ipaddrp->proto);
+			return(1);
+		};
+
+		if (last_source < *lastp) {
+			*lastp = last_source;
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * retrieve value from sources
+ *
+ * in : ipaddrp, features (IPV6CALC_DB_* to be stored)
+ * mod: valuep
+ */
+static void merged_value_by_addr(const ipv6calc_ipaddr *ipaddrp, const uint32_t features, s_ipv6calc_merged_db_value *valuep) {
+	s_ipv6calc_db_attributes record;
+	int attributes = 0, r;
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+
+	memset(valuep, 0, sizeof(*valuep));
+
+	if (ipaddrp->proto == IPV6CALC_PROTO_IPV4) {
+		if ((features & IPV6CALC_DB_IPV4_TO_CC) != 0) { attributes |= IPV6CALC_DB_ATTR_CC; };
+		if ((features & IPV6CALC_DB_IPV4_TO_AS) != 0) { attributes |= IPV6CALC_DB_ATTR_AS; };
+		if ((features & IPV6CALC_DB_IPV4_TO_GEONAMEID) != 0) { attributes |= IPV6CALC_DB_ATTR_GEONAMEID; };
+	} else {
+		if ((features & IPV6CALC_DB_IPV6_TO_CC) != 0) { attributes |= IPV6CALC_DB_ATTR_CC; };
+		if ((features & IPV6CALC_DB_IPV6_TO_AS) != 0) { attributes |= IPV6CALC_DB_ATTR_AS; };
+		if ((features & IPV6CALC_DB_IPV6_TO_GEONAMEID) != 0) { attributes |= IPV6CALC_DB_ATTR_GEONAMEID; };
+	};
+
+	if (attributes != 0) {
+		r = libipv6calc_db_wrapper_all_by_addr(ipaddrp, attributes, &record) & attributes;
+
+		if ((r & IPV6CALC_DB_ATTR_CC) != 0) {
+			valuep->cc_index = record.cc_index;
+		};
+		if ((r & IPV6CALC_DB_ATTR_AS) != 0) {
+			valuep->as_num32 = record.as_num32;
+		};
+		if ((r & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+			valuep->GeonameID = record.GeonameID;
+			valuep->GeonameID_type = record.GeonameID_type;
+		};
+		valuep->attributes = r;
+	};
+
+	if ((ipaddrp->proto == IPV6CALC_PROTO_IPV4) && ((features & IPV6CALC_DB_IPV4_TO_REGISTRY) != 0)) {
+		CONVERT_IPADDRP_IPV4ADDR(ipaddrp, ipv4addr);
+		r = libipv6calc_db_wrapper_registry_num_by_ipv4addr_db(&ipv4addr);
+	} else if ((ipaddrp->proto == IPV6CALC_PROTO_IPV6) && ((features & IPV6CALC_DB_IPV6_TO_REGISTRY) != 0)) {
+		CONVERT_IPADDRP_IPV6ADDR(ipaddrp, ipv6addr);
+		r = libipv6calc_db_wrapper_registry_num_by_ipv6addr_db(&ipv6addr);
+	} else {
+		r = REGISTRY_UNKNOWN;
+	};
+
+	if (r != REGISTRY_UNKNOWN) {
+		valuep->registry = r;
+		valuep->attributes |= IPV6CALC_DB_ATTR_REGISTRY;
+	};
+};
+
+
+/*
+ * compare value from merged database with value retrieved from sources
+ *
+ * in : valuep (merged database), value_livep (sources)
+ * out: 0=identical
+ */
+static int merged_value_compare(const s_ipv6calc_merged_db_value *valuep, const s_ipv6calc_merged_db_value *value_livep) {
+	if (valuep->attributes != value_livep->attributes) {
+		return(1);
+	};
+
+	if (((valuep->attributes & IPV6CALC_DB_ATTR_CC) != 0) && (valuep->cc_index != value_livep->cc_index)) {
+		return(1);
+	};
+
+	if (((valuep->attributes & IPV6CALC_DB_ATTR_AS) != 0) && (valuep->as_num32 != value_livep->as_num32)) {
+		return(1);
+	};
+
+	if (((valuep->attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) && ((valuep->GeonameID != value_livep->GeonameID) || (valuep->GeonameID_type != value_livep->GeonameID_type))) {
+		return(1);
+	};
+
+	if (((valuep->attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) && (valuep->registry != value_livep->registry)) {
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * create merged database from all currently available sources
+ *  only features where all selected sources can report the covering range are stored
+ *  the source order per feature is stored to let the lookup tools check the database priorities
+ *
+ * in : filename
+ * out: 0=ok, 1=error
+ */
+static int merged_create(const char *filename) {
+	s_ipv6calc_merged_db_builder builder;
+	s_ipv6calc_merged_db db;
+	s_ipv6calc_merged_db_value value, value_live;
+	const s_ipv6calc_merged_db_value *valuep;
+	ipv6calc_ipaddr ipaddr;
+	uint32_t features_merge = 0, sources = 0, sources_feature, order;
+	uint32_t feature_sources[32];
+	uint64_t first, last, rnd = 0x9e3779b97f4a7c15ULL;
+	int result = 1, f, p, s, i, proto, mismatch = 0;
+	unsigned int j;
+	const char *feature_name;
+
+	memset(feature_sources, 0, sizeof(feature_sources));
+
+	// check which features can be merged
+	for (f = IPV6CALC_DB_FEATURE_NUM_MIN; f <= IPV6CALC_DB_FEATURE_NUM_MAX; f++) {
+		if (((MERGED_DB_FEATURES & (1 << f)) == 0) || (libipv6calc_db_wrapper_has_features(1 << f) != 1)) {
+			continue;
+		};
+
+		feature_name = "unknown";
+		for (j = 0; j < MAXENTRIES_ARRAY(ipv6calc_db_features); j++) {
+			if (ipv6calc_db_features[j].number == (uint32_t) (1 << f)) {
+				feature_name = ipv6calc_db_features[j].explanation;
+				break;
+			};
+		};
+
+		sources_feature = 0;
+		order = 0;
+		for (p = 0; p < MERGED_DB_FEATURE_SOURCES_MAX; p++) {
+			s = libipv6calc_db_wrapper_source_by_feature(f, p);
+			if (s == 0) {
+				break;
+			};
+
+			if ((s != IPV6CALC_DB_SOURCE_BUILTIN) && (s != IPV6CALC_DB_SOURCE_GEOIP2) && (s != IPV6CALC_DB_SOURCE_DBIP2)) {
+				// range of result not retrievable
+				sources_feature = 0;
+				break;
+			};
+
+			sources_feature |= (1 << s);
+			order |= ((uint32_t) s) << (p * 4);
+		};
+
+		if (sources_feature == 0) {
+			NONQUIETPRINT_WA("Merged database: feature not merged (source without range support): %s", feature_name);
+			continue;
+		};
+
+		NONQUIETPRINT_WA("Merged database: feature merged: %s", feature_name);
+		features_merge |= (1 << f);
+		sources |= sources_feature;
+		feature_sources[f] = order;
+	};
+
+	if (features_merge == 0) {
+		fprintf(stderr, "No feature available for merged database\n");
+		return(1);
+	};
+
+	if (merged_builder_init(&builder) != 0) {
+		return(1);
+	};
+
+	builder.features = features_merge;
+	builder.sources = sources;
+	memcpy(builder.feature_sources, feature_sources, sizeof(builder.feature_sources));
+
+	// walk through address spaces
+	for (i = 0; i < 2; i++) {
+		proto = (i == 0) ? IPV6CALC_PROTO_IPV4 : IPV6CALC_PROTO_IPV6;
+		first = 0;
+		while (1) {
+			merged_ipaddr_set(&ipaddr, proto, first);
+
+			if (merged_block_last(&ipaddr, sources, &last) != 0) {
+				goto END_merged_create;
+			};
+
+			merged_value_by_addr(&ipaddr, features_merge, &value);
+
+			if (merged_builder_add(&builder, proto, first, &value) != 0) {
+				goto END_merged_create;
+			};
+
+			if (last == ((proto == IPV6CALC_PROTO_IPV4) ? 0xffffffffu : UINT64_MAX)) {
+				break;
+			};
+			first = last + 1;
+		};
+	};
+
+	NONQUIETPRINT_WA("Merged database: ranges IPv4=%u IPv6=%u values=%u", builder.count_ipv4, builder.count_ipv6, builder.count_values);
+
+	if (merged_builder_write(&builder, filename) != 0) {
+		goto END_merged_create;
+	};
+
+	// verify by random samples against the sources
+	if (libipv6calc_db_wrapper_Merged_open(filename, &db) != 0) {
+		fprintf(stderr, "Can't open created merged database: %s\n", filename);
+		goto END_merged_create;
+	};
+
+	for (i = 0; i < MERGED_DB_VERIFY_SAMPLES; i++) {
+		// xorshift64
+		rnd ^= rnd << 13;
+		rnd ^= rnd >> 7;
+		rnd ^= rnd << 17;
+
+		if ((i & 1) == 0) {
+			merged_ipaddr_set(&ipaddr, IPV6CALC_PROTO_IPV4, rnd >> 32);
+		} else if ((i & 2) == 0) {
+			// global unicast 2000::/3
+			merged_ipaddr_set(&ipaddr, IPV6CALC_PROTO_IPV6, (rnd >> 3) | 0x2000000000000000ULL);
+		} else {
+			merged_ipaddr_set(&ipaddr, IPV6CALC_PROTO_IPV6, rnd);
+		};
+
+		valuep = libipv6calc_db_wrapper_Merged_lookup(&db, &ipaddr);
+		merged_value_by_addr(&ipaddr, features_merge, &value_live);
+
+		if ((valuep == NULL) || (merged_value_compare(valuep, &value_live) != 0)) {
+			mismatch++;
+			fprintf(stderr, "Merged database verification mismatch: addr=%08x%08x%08x%08x proto=%d\n", ipaddr.addr[0], ipaddr.addr[1], ipaddr.addr[2], ipaddr.addr[3], ipaddr.proto);
+		};
+	};
+
+	libipv6calc_db_wrapper_Merged_close(&db);
+
+	if (mismatch > 0) {
+		fprintf(stderr, "Merged database verification failed: mismatches=%d samples=%d\n", mismatch, MERGED_DB_VERIFY_SAMPLES);
+		unlink(filename);
+		goto END_merged_create;
+	};
+
+	NONQUIETPRINT_WA("Merged database: verification successful with samples=%d", MERGED_DB_VERIFY_SAMPLES);
+	NONQUIETPRINT_WA("Merged database: written: %s", filename);
+	result = 0;
+
+END_merged_create:
+	merged_builder_free(&builder);
+	return(result);
+};
+
+
+/**************************************************/
+/* main */
+int main(int argc, char *argv[]) {
+	/* check compatibility */
+#ifdef SHARED_LIBRARY
+	IPV6CALC_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+	IPV6CALC_DB_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+#endif // SHARED_LIBRARY
+
+	int i, lop, result;
+	unsigned long int command = 0;
+	char filename[NI_MAXHOST];
+
+	/* options */
+	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
+	char   shortopts[NI_MAXHOST] = "";
+	int    longopts_maxentries = 0;
+
+	/* initialize debug value from environment for bootstrap debugging */
+	ipv6calc_debug_from_env(); // ipv6calc_debug usage ok
+
+	/* add options */
+	ipv6calc_options_add_common_basic(shortopts, sizeof(shortopts), longopts, &longopts_maxentries);
+	ipv6calc_options_add(shortopts, sizeof(shortopts), longopts, &longopts_maxentries, merged_shortopts, merged_longopts, MAXENTRIES_ARRAY(merged_longopts));
+
+	/* initialize options from environment */
+	ipv6calc_common_options_from_env(longopts, NULL);
+
+	/* Fetch the command-line arguments. */
+	while ((i = getopt_long(argc, argv, shortopts, longopts, &lop)) != EOF) {
+		if ((i == '?') && (strcmp(argv[optind - 1], "-?") != 0)) {
+			exit(EXIT_FAILURE);
+		};
+
+		/* catch common options */
+		result = ipv6calcoptions_common_basic(i, optarg, longopts);
+		if (result == 0) {
+			// found
+			continue;
+		};
+
+		switch (i) {
+			case -1:
+				break;
+
+			case 'v':
+				command |= CMD_printversion;
+				break;
+
+			case 'h':
+			case '?':
+				command |= CMD_printhelp;
+				break;
+
+			default:
+				fprintf(stderr, "Usage: (see '%s -?|-h|--help' for more help)\n", PROGRAM_NAME);
+				exit(EXIT_FAILURE);
+				break;
+		};
+	};
+
+	argv += optind;
+	argc -= optind;
+
+	if ((command & CMD_printhelp) != 0) {
+		printhelp();
+		exit(EXIT_SUCCESS);
+	};
+
+	if ((command & CMD_printversion) != 0) {
+		printversion();
+		exit(EXIT_SUCCESS);
+	};
+
+	if (argc > 1) {
+		fprintf(stderr, "Too many arguments (see '%s -?|-h|--help' for more help)\n", PROGRAM_NAME);
+		exit(EXIT_FAILURE);
+	} else if (argc == 1) {
+		snprintf(filename, sizeof(filename), "%s", argv[0]);
+	} else {
+		snprintf(filename, sizeof(filename), "%s/%s", merged_db_dir, MERGED_DB_FILE);
+	};
+
+	// the merged database itself must not be used as source
+	libipv6calc_db_wrapper_options(DB_merged_disable, NULL, longopts);
+
+	/* initialise database wrapper */
+	result = libipv6calc_db_wrapper_init("");
+	if (result != 0) {
+		exit(EXIT_FAILURE);
+	};
+
+	result = merged_create(filename);
+
+	libipv6calc_db_wrapper_cleanup();
+
+	exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+};
+
+#else // SUPPORT_DB_MERGED
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+int main(void) {
+	fprintf(stderr, "%s: support for Merged database not compiled-in\n", PROGRAM_NAME);
+	exit(EXIT_FAILURE);
+};
+
+#endif // SUPPORT_DB_MERGED
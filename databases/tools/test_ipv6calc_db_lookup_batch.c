@@ -0,0 +1,268 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/tools/test_ipv6calc_db_lookup_batch.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Test and benchmark of the interleaved binary search (see
+ *  libipv6calc_db_wrapper_get_entry_generic_batch): pseudo-random keys are
+ *  looked up in a synthetic table of sorted first/last ranges key by key
+ *  and in batches with interleave 1/8/16/32, results must be identical.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <time.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "ipv6calccommands.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcoptions.h"
+
+#include "../lib/libipv6calc_db_wrapper.h"
+
+#define PROGRAM_NAME "test_ipv6calc_db_lookup_batch"
+#define PROGRAM_COPYRIGHT "(P) & (C) 2019-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
+
+#define TEST_ROWS_DEFAULT	(1 << 20)
+#define TEST_KEYS_DEFAULT	(1 << 18)
+#define TEST_BATCH		256	// keys per call (like lines per block in ipv6logstats)
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+typedef struct {
+	uint32_t first;
+	uint32_t last;
+} s_test_range;
+
+static s_test_range *test_table;
+static uint32_t test_rows;
+
+static const int test_interleave[] = { 1, 8, 16, 32 };
+
+
+/* display info */
+void printversion(void) {
+	fprintf(stderr, "%s: version %s\n", PROGRAM_NAME, PACKAGE_VERSION);
+};
+
+void printcopyright(void) {
+	fprintf(stderr, "%s\n", PROGRAM_COPYRIGHT);
+};
+
+static void printhelp(void) {
+	printversion();
+	printcopyright();
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Usage: %s [options] [-n <rows>] [-k <keys>] [-B]\n", PROGRAM_NAME);
+	fprintf(stderr, "\n");
+	fprintf(stderr, "  -n <rows>  : rows of synthetic table (default: %d)\n", TEST_ROWS_DEFAULT);
+	fprintf(stderr, "  -k <keys>  : number of lookup keys (default: %d)\n", TEST_KEYS_DEFAULT);
+	fprintf(stderr, "  -B         : benchmark, print time per lookup\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Compares key by key lookups with interleaved lookups (interleave:");
+	fprintf(stderr, " 1 8 16 32), results must be identical\n");
+	fprintf(stderr, "\n");
+};
+
+
+/*
+ * get row of synthetic table
+ */
+static int test_get_row(const uint32_t row, uint32_t *first_00_31, uint32_t *first_32_63, uint32_t *last_00_31, uint32_t *last_32_63) {
+	if (row >= test_rows) {
+		return(-1);
+	};
+
+	*first_00_31 = test_table[row].first;
+	*last_00_31  = test_table[row].last;
+	*first_32_63 = 0;
+	*last_32_63  = 0;
+	return(0);
+};
+
+
+/*
+ * nanoseconds of monotonic clock
+ */
+static double test_time_ns(void) {
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return((double) ts.tv_sec * 1e9 + (double) ts.tv_nsec);
+};
+
+
+/* main */
+#define DEBUG_function_name "test_ipv6calc_db_lookup_batch/main"
+int main(int argc, char *argv[]) {
+	/* check compatibility */
+#ifdef SHARED_LIBRARY
+	IPV6CALC_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+	IPV6CALC_DB_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+#endif // SHARED_LIBRARY
+
+	int i, k, b, n, lop, result, keys = TEST_KEYS_DEFAULT, benchmark = 0;
+	long int rows = TEST_ROWS_DEFAULT, mismatches = 0, found = 0;
+	uint32_t *test_keys, first, span;
+	long int *match_expected, *match;
+	double t_start, t_single = 0, t_batch;
+	char interleave[16];
+
+	/* options */
+	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
+	char   shortopts[NI_MAXHOST] = "n:k:B";
+	int    longopts_maxentries = 0;
+
+	/* add options */
+	ipv6calc_options_add_common_basic(shortopts, sizeof(shortopts), longopts, &longopts_maxentries);
+
+	/* Fetch the command-line arguments. */
+	while ((i = getopt_long(argc, argv, shortopts, longopts, &lop)) != EOF) {
+		switch (i) {
+			case 'n':
+				rows = atol(optarg);
+				continue;
+
+			case 'k':
+				keys = atoi(optarg);
+				continue;
+
+			case 'B':
+				benchmark = 1;
+				continue;
+		};
+
+		/* catch common options */
+		result = ipv6calcoptions_common_basic(i, optarg, longopts);
+		if (result == 0) {
+			// found
+			continue;
+		};
+
+		printhelp();
+		exit(EXIT_FAILURE);
+	};
+
+	if ((optind != argc) || (rows < 2) || (rows > 0x10000000) || (keys < 1)) {
+		printhelp();
+		exit(EXIT_FAILURE);
+	};
+
+	test_rows = rows;
+
+	test_table = malloc(sizeof(s_test_range) * test_rows);
+	test_keys = malloc(sizeof(uint32_t) * keys);
+	match_expected = malloc(sizeof(long int) * keys);
+	match = malloc(sizeof(long int) * keys);
+
+	if ((test_table == NULL) || (test_keys == NULL) || (match_expected == NULL) || (match == NULL)) {
+		fprintf(stderr, "ERROR : can't allocate memory\n");
+		exit(EXIT_FAILURE);
+	};
+
+	/* sorted non-overlapping ranges with gaps over the whole 32-bit space */
+	srand(34);
+	span = (uint32_t) (0x100000000ULL / test_rows);
+	for (i = 0; i < (int) test_rows; i++) {
+		first = (uint32_t) i * span + (span > 1 ? (uint32_t) rand() % (span / 2) : 0);
+		test_table[i].first = first;
+		test_table[i].last = first + (span > 2 ? (uint32_t) rand() % (span / 2) : 0);
+	};
+
+	for (k = 0; k < keys; k++) {
+		test_keys[k] = ((uint32_t) rand() << 16) ^ (uint32_t) rand();
+	};
+
+	/* key by key */
+	t_start = test_time_ns();
+	for (k = 0; k < keys; k++) {
+		match_expected[k] = libipv6calc_db_wrapper_get_entry_generic(
+			NULL,						// pointer to data
+			IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY,		// type of data_ptr
+			IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,	// key type
+			0,						// key format (not relevant)
+			32,						// key length
+			IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,	// search type
+			test_rows,					// number of rows
+			test_keys[k],					// lookup key MSB
+			0,						// lookup key LSB
+			NULL,						// data ptr (not used in IPV6CALC_DB_LOOKUP_DATA_PTR_TYPE_ARRAY)
+			test_get_row					// function pointer
+		);
+
+		if (match_expected[k] >= 0) {
+			found++;
+		};
+	};
+	t_single = test_time_ns() - t_start;
+
+	if (benchmark == 1) {
+		printf("rows=%u keys=%d found=%ld\n", test_rows, keys, found);
+		printf("key by key       : %7.1f ns/lookup\n", t_single / keys);
+	};
+
+	/* interleaved */
+	for (i = 0; i < (int) (sizeof(test_interleave) / sizeof(test_interleave[0])); i++) {
+		snprintf(interleave, sizeof(interleave), "%d", test_interleave[i]);
+		libipv6calc_db_wrapper_options(DB_common_lookup_interleave, interleave, longopts);
+
+		memset(match, 0, sizeof(long int) * keys);
+
+		t_start = test_time_ns();
+		for (b = 0; b < keys; b += TEST_BATCH) {
+			n = (keys - b < TEST_BATCH) ? keys - b : TEST_BATCH;
+
+			libipv6calc_db_wrapper_get_entry_generic_batch(
+				IPV6CALC_DB_LOOKUP_DATA_KEY_TYPE_FIRST_LAST,	// key type
+				32,						// key length
+				IPV6CALC_DB_LOOKUP_DATA_SEARCH_TYPE_BINARY,	// search type
+				test_rows,					// number of rows
+				n,						// number of keys
+				&test_keys[b],					// lookup keys MSB
+				NULL,						// lookup keys LSB
+				&match[b],					// matching rows
+				test_table,					// array (prefetch)
+				sizeof(s_test_range),				// size of array row
+				test_get_row					// function pointer
+			);
+		};
+		t_batch = test_time_ns() - t_start;
+
+		for (k = 0; k < keys; k++) {
+			if (match[k] != match_expected[k]) {
+				if (mismatches < 10) {
+					fprintf(stderr, "ERROR : interleave=%d key=%08x match=%ld expected=%ld\n", test_interleave[i], test_keys[k], match[k], match_expected[k]);
+				};
+				mismatches++;
+			};
+		};
+
+		if (benchmark == 1) {
+			printf("interleave=%-2d    : %7.1f ns/lookup (%.2fx)\n", test_interleave[i], t_batch / keys, t_single / t_batch);
+		};
+	};
+
+	free(test_table);
+	free(test_keys);
+	free(match_expected);
+	free(match);
+
+	if (mismatches != 0) {
+		fprintf(stderr, "ERROR : interleaved lookups differ from key by key lookups: %ld\n", mismatches);
+		exit(EXIT_FAILURE);
+	};
+
+	if (benchmark == 0) {
+		printf("rows=%u keys=%d found=%ld mismatches=%ld\n", test_rows, keys, found, mismatches);
+	};
+
+	exit(EXIT_SUCCESS);
+};
+#undef DEBUG_function_name
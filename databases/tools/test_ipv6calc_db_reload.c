@@ -0,0 +1,358 @@
+/*
+ * Project    : ipv6calc
+ * File       : databases/tools/test_ipv6calc_db_reload.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Test reload of replaced database files while lookups are running in
+ *  concurrent threads (see libipv6calc_db_wrapper_reload): the merged
+ *  database is replaced by an identical copy and reloaded repeatedly,
+ *  results of the lookups must not change, released handle sets must not
+ *  be used anymore (run with valgrind/sanitizer for full coverage).
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <arpa/inet.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "ipv6calccommands.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcoptions.h"
+
+#include "libipaddr.h"
+#include "libipv6addr.h"
+#include "libipv4addr.h"
+
+#include "../lib/libipv6calc_db_wrapper.h"
+#include "../lib/libipv6calc_db_wrapper_Merged.h"
+
+#define PROGRAM_NAME "test_ipv6calc_db_reload"
+#define PROGRAM_COPYRIGHT "(P) & (C) 2019-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
+
+#ifdef SUPPORT_DB_MERGED
+
+#define TEST_ADDRESSES		1024	// half IPv4, half IPv6
+#define TEST_THREADS		4
+#define TEST_RELOADS		50
+#define TEST_BATCH		16	// lookups per read lock
+
+#define TEST_ATTRIBUTES		(IPV6CALC_DB_ATTR_CC | IPV6CALC_DB_ATTR_AS | IPV6CALC_DB_ATTR_GEONAMEID)
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+static ipv6calc_ipaddr test_ipaddr[TEST_ADDRESSES];
+static ipv6calc_ipv4addr test_ipv4addr[TEST_ADDRESSES / 2];
+static ipv6calc_ipv6addr test_ipv6addr[TEST_ADDRESSES / 2];
+static s_ipv6calc_db_attributes test_expected[TEST_ADDRESSES];
+static int test_expected_found[TEST_ADDRESSES];
+
+static int test_stop = 0;
+static long int test_lookups = 0;
+static long int test_mismatches = 0;
+
+
+/* display info */
+void printversion(void) {
+	fprintf(stderr, "%s: version %s\n", PROGRAM_NAME, PACKAGE_VERSION);
+};
+
+void printcopyright(void) {
+	fprintf(stderr, "%s\n", PROGRAM_COPYRIGHT);
+};
+
+static void printhelp(void) {
+	printversion();
+	printcopyright();
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Usage: %s [options]\n", PROGRAM_NAME);
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Replaces and reloads the merged database (see --db-merged-dir) %d times\n", TEST_RELOADS);
+	fprintf(stderr, "   while %d threads run lookups, results must not change\n", TEST_THREADS);
+	fprintf(stderr, "\n");
+};
+
+
+/*
+ * lookup of an address (CountryCode/ASN/GeonameID and Registry)
+ *
+ * in : i = index of address
+ * mod: recordp
+ * out: found attributes
+ */
+static int test_lookup(const int i, s_ipv6calc_db_attributes *recordp) {
+	int found;
+
+	libipv6calc_db_wrapper_attributes_clear(recordp);
+	found = libipv6calc_db_wrapper_all_by_addr(&test_ipaddr[i], TEST_ATTRIBUTES, recordp);
+
+	if (i < TEST_ADDRESSES / 2) {
+		recordp->registry = libipv6calc_db_wrapper_registry_num_by_ipv4addr_db(&test_ipv4addr[i]);
+	} else {
+		recordp->registry = libipv6calc_db_wrapper_registry_num_by_ipv6addr_db(&test_ipv6addr[i - TEST_ADDRESSES / 2]);
+	};
+
+	return(found);
+};
+
+
+/*
+ * compare lookup result with expected one
+ *
+ * in : i = index of address, found, recordp
+ * out: 0 = equal
+ */
+static int test_compare(const int i, const int found, const s_ipv6calc_db_attributes *recordp) {
+	if ((found != test_expected_found[i])
+	    || (recordp->cc_index != test_expected[i].cc_index)
+	    || (recordp->as_num32 != test_expected[i].as_num32)
+	    || (recordp->GeonameID != test_expected[i].GeonameID)
+	    || (recordp->registry != test_expected[i].registry)
+	    || (recordp->data_source_cc != test_expected[i].data_source_cc)
+	    || (recordp->data_source_as != test_expected[i].data_source_as)
+	    || (recordp->data_source_GeonameID != test_expected[i].data_source_GeonameID)
+	) {
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * reader thread: lookups in batches under a read lock, compare with expected results
+ */
+static void *test_reader(void *arg) {
+	s_ipv6calc_db_attributes record;
+	long int lookups = 0, mismatches = 0;
+	int i = (int) (long) arg, b, found;
+
+	while (__atomic_load_n(&test_stop, __ATOMIC_SEQ_CST) == 0) {
+		libipv6calc_db_wrapper_read_lock();
+		for (b = 0; b < TEST_BATCH; b++) {
+			i = (i + 7) % TEST_ADDRESSES;
+			found = test_lookup(i, &record);
+			lookups++;
+			mismatches += test_compare(i, found, &record);
+		};
+		libipv6calc_db_wrapper_read_unlock();
+	};
+
+	__atomic_add_fetch(&test_lookups, lookups, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&test_mismatches, mismatches, __ATOMIC_SEQ_CST);
+	return(NULL);
+};
+
+
+/*
+ * replace file by a copy (new inode)
+ *
+ * in : filename, content, size
+ * out: 0 = ok
+ */
+static int test_replace(const char *filename, const char *content, const size_t size) {
+	char tempfile[NI_MAXHOST + 8];
+	FILE *fp;
+
+	snprintf(tempfile, sizeof(tempfile), "%s.new", filename);
+
+	fp = fopen(tempfile, "w");
+	if (fp == NULL) {
+		fprintf(stderr, "ERROR : can't create file: %s\n", tempfile);
+		return(1);
+	};
+
+	if (fwrite(content, 1, size, fp) != size) {
+		fprintf(stderr, "ERROR : can't write file: %s\n", tempfile);
+		fclose(fp);
+		return(1);
+	};
+
+	fclose(fp);
+
+	if (rename(tempfile, filename) != 0) {
+		fprintf(stderr, "ERROR : can't rename file: %s\n", tempfile);
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/* main */
+#define DEBUG_function_name "test_ipv6calc_db_reload/main"
+int main(int argc, char *argv[]) {
+	/* check compatibility */
+#ifdef SHARED_LIBRARY
+	IPV6CALC_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+	IPV6CALC_DB_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
+#endif // SHARED_LIBRARY
+
+	int i, f, lop, result, r, retry, reloads = 0, merged = 0;
+	char filename[NI_MAXHOST];
+	char *content;
+	long int size;
+	FILE *fp;
+	pthread_t threads[TEST_THREADS];
+
+	/* options */
+	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
+	char   shortopts[NI_MAXHOST] = "";
+	int    longopts_maxentries = 0;
+
+	/* add options */
+	ipv6calc_options_add_common_basic(shortopts, sizeof(shortopts), longopts, &longopts_maxentries);
+
+	/* Fetch the command-line arguments. */
+	while ((i = getopt_long(argc, argv, shortopts, longopts, &lop)) != EOF) {
+		/* catch common options */
+		result = ipv6calcoptions_common_basic(i, optarg, longopts);
+		if (result == 0) {
+			// found
+			continue;
+		};
+
+		printhelp();
+		exit(EXIT_FAILURE);
+	};
+
+	if (optind != argc) {
+		printhelp();
+		exit(EXIT_FAILURE);
+	};
+
+	/* read database file, written back as replacement */
+	snprintf(filename, sizeof(filename), "%s/%s", merged_db_dir, MERGED_DB_FILE);
+
+	fp = fopen(filename, "r");
+	if (fp == NULL) {
+		fprintf(stderr, "ERROR : can't open merged database: %s\n", filename);
+		exit(EXIT_FAILURE);
+	};
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	rewind(fp);
+
+	content = malloc((size > 0) ? size : 1);
+	if ((content == NULL) || (size <= 0) || (fread(content, 1, size, fp) != (size_t) size)) {
+		fprintf(stderr, "ERROR : can't read merged database: %s\n", filename);
+		exit(EXIT_FAILURE);
+	};
+	fclose(fp);
+
+	/* initialise database wrapper */
+	result = libipv6calc_db_wrapper_init("");
+	if (result != 0) {
+		exit(EXIT_FAILURE);
+	};
+
+	/* pseudo-random addresses and expected results */
+	srand(31);
+	for (i = 0; i < TEST_ADDRESSES; i++) {
+		if (i < TEST_ADDRESSES / 2) {
+			ipv6calc_ipv4addr *ipv4addrp = &test_ipv4addr[i];
+
+			ipv4addr_clearall(ipv4addrp);
+			ipv4addr_setdword(ipv4addrp, ((uint32_t) (1 + (rand() % 223)) << 24) | (rand() & 0xffffff));
+			ipv4addr_settype(ipv4addrp, 1);
+			ipv4addrp->flag_valid = 1;
+			CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, test_ipaddr[i]);
+		} else {
+			ipv6calc_ipv6addr *ipv6addrp = &test_ipv6addr[i - TEST_ADDRESSES / 2];
+
+			ipv6addr_clearall(ipv6addrp);
+			ipv6addr_setdword(ipv6addrp, 0, 0x20000000 | ((rand() & 0x1fff) << 16) | (rand() & 0xffff));
+			ipv6addr_setdword(ipv6addrp, 3, 1);
+			ipv6addr_settype(ipv6addrp);
+			ipv6addrp->flag_valid = 1;
+			CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, test_ipaddr[i]);
+		};
+
+		test_expected_found[i] = test_lookup(i, &test_expected[i]);
+	};
+
+	// features served by the merged database
+	for (f = 0; f < 32; f++) {
+		if (libipv6calc_db_wrapper_source_by_feature(f, 0) == IPV6CALC_DB_SOURCE_MERGED) {
+			merged++;
+		};
+	};
+
+	if (merged == 0) {
+		fprintf(stderr, "ERROR : merged database not used for lookups: %s\n", filename);
+		exit(EXIT_FAILURE);
+	};
+
+	/* lookups in threads */
+	for (i = 0; i < TEST_THREADS; i++) {
+		if (pthread_create(&threads[i], NULL, test_reader, (void *) (long) (i * TEST_ADDRESSES / TEST_THREADS)) != 0) {
+			fprintf(stderr, "ERROR : can't create thread\n");
+			exit(EXIT_FAILURE);
+		};
+	};
+
+	/* replace and reload database while lookups are running */
+	for (r = 0; r < TEST_RELOADS; r++) {
+		usleep(10000);
+
+		if (test_replace(filename, content, size) != 0) {
+			break;
+		};
+
+		// refused while the previous handle set is still in use
+		for (retry = 0; retry < 1000; retry++) {
+			result = libipv6calc_db_wrapper_reload();
+			if (result > 0) {
+				reloads++;
+				break;
+			};
+			usleep(1000);
+		};
+	};
+
+	__atomic_store_n(&test_stop, 1, __ATOMIC_SEQ_CST);
+
+	for (i = 0; i < TEST_THREADS; i++) {
+		pthread_join(threads[i], NULL);
+	};
+
+	/* results after last reload */
+	for (i = 0; i < TEST_ADDRESSES; i++) {
+		s_ipv6calc_db_attributes record;
+
+		result = test_lookup(i, &record);
+		test_mismatches += test_compare(i, result, &record);
+	};
+
+	libipv6calc_db_wrapper_cleanup();
+	free(content);
+
+	printf("reloads=%d/%d lookups=%ld mismatches=%ld merged-features=%d\n", reloads, TEST_RELOADS, test_lookups, test_mismatches, merged);
+
+	if ((reloads != TEST_RELOADS) || (test_mismatches != 0) || (test_lookups == 0)) {
+		fprintf(stderr, "ERROR : reload while lookups are running failed\n");
+		exit(EXIT_FAILURE);
+	};
+
+	exit(EXIT_SUCCESS);
+};
+#undef DEBUG_function_name
+
+#else // SUPPORT_DB_MERGED
+
+long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
+
+int main(void) {
+	fprintf(stderr, "%s: support for Merged database not compiled-in\n", PROGRAM_NAME);
+	exit(EXIT_FAILURE);
+};
+
+#endif // SUPPORT_DB_MERGED
@@ -14,6 +14,7 @@
 #include <stdlib.h> 
 #include <getopt.h> 
 #include <unistd.h>
+#include <signal.h>
 
 #include "config.h"
 
@@ -32,6 +33,9 @@
 #include "libeui64.h"
 
 #include "showinfo.h"
+#include "ipv6calcserver.h"
+#include "ipv6calcbatch.h"
+#include "ipv6calcaggregate.h"
 
 #include "librfc1884.h"
 #include "librfc1886.h"
@@ -80,10 +84,37 @@ int feature_zeroize = 1; // always supported
 int feature_anon    = 1; // always supported
 int feature_kp      = 0; // will be checked later
 int feature_kg      = 0; // will be checked later
+static int feature_checked = 0;
 
 /* showinfo machine readable filter */
 char showinfo_machine_readable_filter[32] = "";
 int showinfo_machine_readable_filter_used = 0;
+uint32_t showinfo_fields = SHOWINFO_FIELD_ALL;
+
+
+/*
+ * check database dependent features
+ *  triggers database wrapper initialization, therefore only called where needed
+ */
+static void ipv6calc_check_features(void) {
+	if (feature_checked == 1) {
+		return;
+	};
+
+	/* check for KeepTypeAsnCC support */
+	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
+	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
+		feature_kp = 1;
+	};
+
+	/* check for KeepTypeGeonameID support */
+	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV4_REQ_DB) == 1) \
+	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV6_REQ_DB) == 1)) {
+		feature_kg = 1;
+	};
+
+	feature_checked = 1;
+};
 
 
 /**************************************************/
@@ -98,7 +129,7 @@ int main(int argc, char *argv[]) {
 	char resultstring[NI_MAXHOST] = "";
 	char resultstring2[NI_MAXHOST] = "";
 	char resultstring3[NI_MAXHOST] = "";
-	int retval = 1, i, j, lop, result;
+	int retval = 1, i, j, lop, result, flag_parsed;
 	extern int optopt;
 	uint32_t command = 0;
 	int bit_start = 0, bit_end = 0, force_prefix = 0;
@@ -168,6 +199,12 @@ int main(int argc, char *argv[]) {
 	int linecounter = 0;
 	int flush_mode = 0;
 
+	/* server mode */
+	char server_socket[NI_MAXHOST] = "";
+	int server_mode = 0;
+	int server_timeout = IPV6CALC_SERVER_TIMEOUT_DEFAULT;
+	int sorted_batch = 0;
+
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
 	char   shortopts[NI_MAXHOST] = "";
@@ -421,6 +458,47 @@ int main(int argc, char *argv[]) {
 				};
 				break;
 
+			case CMD_server:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'server' selected");
+				if (strlen(optarg) >= IPV6CALC_SERVER_SOCKET_MAX) {
+					fprintf(stderr, " Argument of option 'server' is too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				snprintf(server_socket, sizeof(server_socket), "%s", optarg);
+				server_mode = 1;
+				break;
+
+			case CMD_server_timeout:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'server-timeout' selected");
+				if ((atoi(optarg) >= 1) && (atoi(optarg) <= 3600)) {
+					server_timeout = atoi(optarg);
+				} else {
+					fprintf(stderr, " Argument of option 'server-timeout' is out of range (1-3600): %d\n", atoi(optarg));
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_sorted_batch:
+				DEBUGPRINT_NA(DEBUG_ipv6calc_general, "special option 'sorted-batch' selected");
+				sorted_batch = 1;
+				break;
+
+			case CMD_filter_file:
+				DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Got filter file: %s", optarg);
+
+				result = libipv6calc_filter_parse_file(optarg, &filter_master);
+
+				if (result != 0) {
+					exit(EXIT_FAILURE);
+				};
+
+				if (action == ACTION_undefined) {
+					// autodefine action
+					action = ACTION_filter;
+					action_given = 1;
+				};
+				break;
+
 			/* test command */
 			case CMD_test_prefix:
 			case CMD_test_ge:
@@ -614,6 +692,17 @@ int main(int argc, char *argv[]) {
 				formatoptions |= (FORMATOPTION_mr_match_token_suffix | FORMATOPTION_machinereadable);
 				break;
 
+			case FORMATOPTION_NUM_mr_json + FORMATOPTION_NUM_HEAD:
+				formatoptions |= (FORMATOPTION_mr_json | FORMATOPTION_machinereadable);
+				break;
+
+			case FORMATOPTION_NUM_mr_fields + FORMATOPTION_NUM_HEAD:
+				if (showinfo_fields_parse(optarg, &showinfo_fields) != 0) {
+					exit(EXIT_FAILURE);
+				};
+				formatoptions |= (FORMATOPTION_mr_fields | FORMATOPTION_machinereadable);
+				break;
+
 			case 'm':	
 			case FORMATOPTION_NUM_machinereadable + FORMATOPTION_NUM_HEAD:
 				formatoptions |= FORMATOPTION_machinereadable;
@@ -723,33 +812,31 @@ int main(int argc, char *argv[]) {
 		formatoptions |= FORMATOPTION_quiet;
 	};
 
-	/* initialise database wrapper */
-	result = libipv6calc_db_wrapper_init("");
+	/* initialise database wrapper, deferred to first database usage except in server mode (children inherit opened databases) */
+	if (server_mode == 1) {
+		result = libipv6calc_db_wrapper_init("");
+	} else {
+		result = libipv6calc_db_wrapper_init_lazy("");
+	};
 	if (result != 0) {
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "db_wrapper_init failed, result=%d", result);
 		exit(EXIT_FAILURE);
 	};
 
-	/* check for KeepTypeAsnCC support */
-	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
-	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
-		feature_kp = 1;
-	};
-
-	/* check for KeepTypeGeonameID support */
-	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV4_REQ_DB) == 1) \
-	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEGEONAMEID_IPV6_REQ_DB) == 1)) {
-		feature_kg = 1;
-	};
-
 	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Debug value:%08lx command:%08lx inputtype:%08lx outputtype:%08lx action:%08lx formatoptions:%08lx", (unsigned long) ipv6calc_debug, (unsigned long) command, (unsigned long) inputtype, (unsigned long) outputtype, (unsigned long) action, (unsigned long) formatoptions); // ipv6calc_debug usage ok
 
 	/* do work depending on selection */
 	if ((command & CMD_printversion) != 0) {
+		ipv6calc_check_features();
+
 		if ((command & CMD_printversion_verbose) != 0) {
 			printversion_verbose(((command & CMD_printversion_verbose2) !=0) ? LEVEL_VERBOSE2 : LEVEL_VERBOSE);
 		} else {
 			printversion();
+			if ((command & CMD_printhelp) == 0) {
+				fprintf(stderr, "\n");
+				libipv6calc_db_wrapper_print_init_cost();
+			};
 		};
 
 		if ((command & CMD_printhelp) != 0) {
@@ -832,7 +919,27 @@ int main(int argc, char *argv[]) {
 		};
 	};
 
-	if (argc > 0) {
+	if (server_mode == 1) {
+		if (argc > 0) {
+			fprintf(stderr, "Additional input found in server mode\n");
+			exit(EXIT_FAILURE);
+		};
+
+		ipv6calc_check_features();
+
+		result = ipv6calcserver_run(server_socket, server_timeout);
+		if (result != 0) {
+			/* parent, server loop finished */
+			libipv6calc_db_wrapper_cleanup();
+			exit((result > 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+		};
+
+		/* child, serve client connection like pipe input */
+		input_is_pipe = 1;
+		flush_mode = 1;
+		formatoptions |= FORMATOPTION_quiet; // force quiet mode
+		DEBUGPRINT_NA(DEBUG_ipv6calc_general, "Input is a server connection");
+	} else if (argc > 0) {
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Got input: %s", argv[0]);
 	} else {
 		if (isatty (STDIN_FILENO)) {
@@ -843,6 +950,50 @@ int main(int argc, char *argv[]) {
 		};
 	};
 
+	if (sorted_batch == 1) {
+		if ((input_is_pipe != 1) || (server_mode == 1) || (action != ACTION_addr_to_countrycode)) {
+			fprintf(stderr, "Option 'sorted-batch' is only supported in pipe mode with action 'addr2cc'\n");
+			exit(EXIT_FAILURE);
+		};
+
+		/* reload replaced database files on request, checked between blocks */
+		libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+
+		result = ipv6calcbatch_addr_to_countrycode(formatoptions, flush_mode);
+		libipv6calc_db_wrapper_cleanup();
+		exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+	};
+
+	if (action == ACTION_aggregate) {
+		if ((server_mode == 1) || ((input_is_pipe != 1) && (argc == 0))) {
+			fprintf(stderr, "Action 'aggregate' requires input from stdin or arguments\n");
+			exit(EXIT_FAILURE);
+		};
+
+		result = ipv6calcaggregate(formatoptions, argc, argv);
+		exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+	};
+
+	if ((action == ACTION_union) || (action == ACTION_intersection) || (action == ACTION_difference)) {
+		if (server_mode == 1) {
+			fprintf(stderr, "Prefix list operations are not supported in server mode\n");
+			exit(EXIT_FAILURE);
+		};
+
+		result = ipv6calcaggregate_setop(formatoptions, action, argc, argv);
+		exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+	};
+
+	if ((action == ACTION_range_to_prefix) || (action == ACTION_prefix_to_range)) {
+		if ((server_mode == 1) || ((input_is_pipe != 1) && (argc == 0))) {
+			fprintf(stderr, "Range/prefix conversion requires input from stdin or arguments\n");
+			exit(EXIT_FAILURE);
+		};
+
+		result = ipv6calcaggregate_convert(formatoptions, action, argc, argv);
+		exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+	};
+
 	/***** input type handling *****/
 	DEBUGPRINT_NA(DEBUG_ipv6calc_general, "Start of input type handling");
 
@@ -871,6 +1022,7 @@ PIPE_input:
 
 		if (charptr == NULL) {
 			/* end of input */
+			libipv6calc_filter_free(&filter_master);
 			exit(retval);
 		};
 
@@ -878,6 +1030,26 @@ PIPE_input:
 
 		if (linecounter == 1) {
 			DEBUGPRINT_NA(DEBUG_ipv6calc_general, "Ok, proceeding stdin...");
+			/* reload replaced database files on request */
+			libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+		};
+
+		libipv6calc_db_wrapper_reload_check();
+
+		if (((server_mode == 1) || ((formatoptions & FORMATOPTION_mr_json) != 0)) && (linecounter > 1)) {
+			/* client or JSON stream may contain mixed input, redo autodetection for each query */
+			if (inputtype_given == 0) {
+				inputtype = FORMAT_undefined;
+			};
+			if (outputtype_given == 0) {
+				outputtype = FORMAT_undefined;
+			};
+			ipv6addr.flag_valid = 0;
+			ipv4addr.flag_valid = 0;
+			macaddr.flag_valid = 0;
+			eui64addr.flag_valid = 0;
+			asn_valid = 0;
+			resultstring[0] = '\0';
 		};
 		
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "Line: %d", linecounter);
@@ -957,6 +1129,7 @@ PIPE_input:
 	};
 
 	/* autodetection */
+	flag_parsed = 0;
 	if ((inputtype == FORMAT_undefined || inputtype == FORMAT_auto) && inputc > 0) {
 		DEBUGPRINT_NA(DEBUG_ipv6calc_general, "call input type autodetection");
 		/* no input type specified or automatic selected */
@@ -964,7 +1137,11 @@ PIPE_input:
 			fprintf(stderr, "no input type specified, try autodetection...");
 		};
 		
-		inputtype = libipv6calc_autodetectinput(input1);
+		/* common address notations are parsed in the same pass */
+		inputtype = libipv6calc_autodetectinput_parse(input1, &ipv4addr, &ipv6addr, &macaddr, &flag_parsed);
+		if (flag_parsed == 1) {
+			resultstring[0] = '\0';
+		};
 
 		DEBUGPRINT_WA(DEBUG_ipv6calc_general, "call input type autodetection resulted in 0x%08x", inputtype);
 
@@ -1029,13 +1206,19 @@ PIPE_input:
 
 	/* check formatoptions for validity */
 	DEBUGPRINT_WA(DEBUG_ipv6calc_general, "check format option of output type: 0x%08lx", (unsigned long) outputtype);
+
+	/* machine readable options are handled by showinfo, independent from output type (pipe mode) */
+	uint32_t formatoptions_check = formatoptions & ~FORMATOPTION_quiet;
+	if (command == CMD_showinfo) {
+		formatoptions_check &= ~FORMATOPTION_mr_showinfo;
+	};
 		
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_outputformatoptionmap); i++) {
 		if (outputtype != ipv6calc_outputformatoptionmap[i][0]) {
 			continue;
 		};
 
-		if ( (ipv6calc_outputformatoptionmap[i][1] & (formatoptions & ~FORMATOPTION_quiet) ) == (formatoptions & ~FORMATOPTION_quiet ) ) {
+		if ( (ipv6calc_outputformatoptionmap[i][1] & formatoptions_check) == formatoptions_check ) {
 			/* all options valid */
 			break;
 		};
@@ -1115,7 +1298,7 @@ PIPE_input:
 
 	switch (inputtype) {
 		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(input1, resultstring, sizeof(resultstring), &ipv6addr);
+			retval = (flag_parsed == 1) ? 0 : addr_to_ipv6addrstruct(input1, resultstring, sizeof(resultstring), &ipv6addr);
 			argc--;
 			break;
 
@@ -1125,7 +1308,7 @@ PIPE_input:
 			break;
 
 		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(input1, resultstring, sizeof(resultstring), &ipv4addr);
+			retval = (flag_parsed == 1) ? 0 : addr_to_ipv4addrstruct(input1, resultstring, sizeof(resultstring), &ipv4addr);
 			argc--;
 			break;
 			
@@ -1145,7 +1328,7 @@ PIPE_input:
 			break;
 			
 		case FORMAT_mac:
-			retval = mac_to_macaddrstruct(input1, resultstring, sizeof(resultstring), &macaddr);
+			retval = (flag_parsed == 1) ? 0 : mac_to_macaddrstruct(input1, resultstring, sizeof(resultstring), &macaddr);
 			argc--;
 			break;
 
@@ -1973,6 +2156,8 @@ PIPE_input:
 	
 	/* catch showinfo */	
 	if (command == CMD_showinfo) {
+		ipv6calc_check_features();
+
 		// change anonymization method depending on support
 		if (feature_kp == 1) {
 			result = libipv6calc_anon_set_by_name(&ipv6calc_anon_set, "keep-type-asn-cc");
@@ -2173,12 +2358,18 @@ RESULT_print:
 	};
 
 	if (input_is_pipe == 1) {
+		if (server_mode == 1) {
+			/* terminate answer */
+			fprintf(stdout, "\n");
+		};
 		if (flush_mode == 1) {
 			fflush(stdout);
 		};
 		goto PIPE_input;
 	};
 
+	libipv6calc_filter_free(&filter_master);
+
 	libipv6calc_db_wrapper_cleanup();
 
 	exit(retval);
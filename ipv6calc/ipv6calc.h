@@ -21,6 +21,9 @@
 #define ANONPRESET_DEFAULT "anonymize-standard"
 
 #define DEBUG_ipv6calc_general      0x00000001l
+#define DEBUG_ipv6calc_server       0x00000002l
+#define DEBUG_ipv6calc_batch        0x00000004l
+#define DEBUG_ipv6calc_aggregate    0x00000008l
 
 #endif
 
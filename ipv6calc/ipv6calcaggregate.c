@@ -0,0 +1,570 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcaggregate.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Aggregation of IPv4/IPv6 address and prefix lists
+ *
+ *  Addresses and prefixes are stored as binary ranges per protocol,
+ *  radix sorted, overlapping and adjacent ranges are merged in linear
+ *  time and each resulting range is printed as minimal list of prefixes
+ *
+ *  Union, intersection and difference of two prefix list files are
+ *  calculated by linear merge of the normalized range sets
+ *
+ *  Conversion of address ranges into prefixes and vice versa is
+ *  streamed line by line
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "libipv6calcset.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcaggregate.h"
+#include "libipv4addr.h"
+#include "libipv6addr.h"
+#include "librfc1884.h"
+
+
+/*
+ * parse address or prefix into key
+ *
+ * in : token
+ * out: key (words), words (1: IPv4, 4: IPv6), length (-1: address without prefix length)
+ * out: resultstring = reason in case of error
+ * ret: 0=ok, 1=error
+ */
+static int ipv6calcaggregate_parse(const char *token, uint32_t *key, int *words, int *length, char *resultstring, const size_t resultstring_length) {
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint32_t inputtype;
+	int flag_parsed, retval, i;
+
+	resultstring[0] = '\0';
+
+	/* common address notations are parsed in the same pass, type information is not needed */
+	inputtype = libipv6calc_autodetectinput_parse_untyped(token, &ipv4addr, &ipv6addr, NULL, &flag_parsed);
+
+	switch (inputtype) {
+		case FORMAT_ipv4addr:
+			retval = (flag_parsed == 1) ? 0 : addr_to_ipv4addrstruct(token, resultstring, resultstring_length, &ipv4addr);
+			if (retval != 0) {
+				return(1);
+			};
+			key[0] = ipv4addr_getdword(&ipv4addr);
+			*words = 1;
+			*length = (ipv4addr.flag_prefixuse == 1) ? (int) ipv4addr.prefixlength : -1;
+			return(0);
+
+		case FORMAT_ipv6addr:
+			retval = (flag_parsed == 1) ? 0 : addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
+			if (retval != 0) {
+				return(1);
+			};
+			for (i = 0; i < 4; i++) {
+				key[i] = ipv6addr_getdword(&ipv6addr, i);
+			};
+			*words = 4;
+			*length = (ipv6addr.flag_prefixuse == 1) ? (int) ipv6addr.prefixlength : -1;
+			return(0);
+
+		default:
+			snprintf(resultstring, resultstring_length, "Unsupported input type (need to be IPv4/IPv6 address or prefix): %s", token);
+			return(1);
+	};
+};
+
+
+/*
+ * parse address or prefix and add it to the range set of its protocol
+ *
+ * in : token
+ * mod: set4, set6
+ * out: resultstring = reason in case of error
+ * ret: 0=ok, 1=error
+ */
+static int ipv6calcaggregate_add(const char *token, s_ipv6calc_rangeset *set4, s_ipv6calc_rangeset *set6, char *resultstring, const size_t resultstring_length) {
+	uint32_t key[4];
+	int words, length;
+
+	if (ipv6calcaggregate_parse(token, key, &words, &length, resultstring, resultstring_length) != 0) {
+		return(1);
+	};
+
+	if (length < 0) {
+		length = words * 32;
+	};
+
+	return(libipv6calc_rangeset_add_prefix((words == 1) ? set4 : set6, key, length));
+};
+
+
+/*
+ * read addresses and prefixes (one per line, '#' starts a comment)
+ *  and add them to the range sets
+ *
+ * in : stream, name = file name for error messages (NULL: stdin)
+ * mod: set4, set6
+ * ret: 0=ok, 1=error
+ */
+static int ipv6calcaggregate_read(FILE *stream, const char *name, s_ipv6calc_rangeset *set4, s_ipv6calc_rangeset *set6) {
+	char linebuffer[IPV6CALC_AGGREGATE_LINEBUFFER];
+	char resultstring[NI_MAXHOST];
+	char *token, *cptr;
+	long int linecounter = 0;
+
+	while (fgets(linebuffer, sizeof(linebuffer), stream) != NULL) {
+		linecounter++;
+
+		/* strip comment */
+		cptr = strchr(linebuffer, '#');
+		if (cptr != NULL) {
+			*cptr = '\0';
+		};
+
+		token = strtok_r(linebuffer, " \t\r\n", &cptr);
+		if (token == NULL) {
+			/* empty line */
+			continue;
+		};
+
+		if (ipv6calcaggregate_add(token, set4, set6, resultstring, sizeof(resultstring)) != 0) {
+			if (name != NULL) {
+				fprintf(stderr, "File %s line %ld: %s\n", name, linecounter, (strlen(resultstring) > 0) ? resultstring : token);
+			} else {
+				fprintf(stderr, "Line %ld: %s\n", linecounter, (strlen(resultstring) > 0) ? resultstring : token);
+			};
+			return(1);
+		};
+	};
+
+	if (ferror(stream)) {
+		fprintf(stderr, "Error reading %s\n", (name != NULL) ? name : "stdin");
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * append decimal number (0-999) without printf
+ *
+ * in : p = buffer position, value
+ * ret: position behind number
+ */
+static char *ipv6calcaggregate_put_decimal(char *p, unsigned int value) {
+	if (value >= 100) {
+		*p++ = '0' + value / 100;
+		value %= 100;
+		*p++ = '0' + value / 10;
+	} else if (value >= 10) {
+		*p++ = '0' + value / 10;
+	};
+	*p++ = '0' + value % 10;
+
+	return(p);
+};
+
+
+/*
+ * format address or prefix given as key
+ *
+ * in : key, words (1: IPv4, 4: IPv6), length (-1: address without prefix length), formatoptions
+ * out: buffer (min. NI_MAXHOST)
+ * ret: length of string
+ */
+static size_t ipv6calcaggregate_format(char *buffer, const size_t buffer_length, const uint32_t *key, const int words, const int length, const uint32_t formatoptions) {
+	ipv6calc_ipv6addr ipv6addr;
+	char *cptr;
+	int i;
+
+	if (words == 1) {
+		/* IPv4 printed directly, called for nearly each input entry in worst case */
+		cptr = buffer;
+		for (i = 24; i >= 0; i -= 8) {
+			cptr = ipv6calcaggregate_put_decimal(cptr, (key[0] >> i) & 0xff);
+			if (i > 0) {
+				*cptr++ = '.';
+			};
+		};
+		if (length >= 0) {
+			*cptr++ = '/';
+			cptr = ipv6calcaggregate_put_decimal(cptr, length);
+		};
+		*cptr = '\0';
+		return(cptr - buffer);
+	};
+
+	ipv6addr_clearall(&ipv6addr);
+	for (i = 0; i < 4; i++) {
+		ipv6addr_setdword(&ipv6addr, (unsigned int) i, key[i]);
+	};
+	if (length >= 0) {
+		ipv6addr.prefixlength = length;
+		ipv6addr.flag_prefixuse = 1;
+	};
+	ipv6addr.flag_valid = 1;
+	if ((key[2] != 0) || (key[3] != 0)) {
+		/* type selects notation with included IPv4 address, needs non-zero IID */
+		ipv6addr_settype(&ipv6addr);
+	};
+
+	if ((formatoptions & (FORMATOPTION_printuncompressed | FORMATOPTION_printfulluncompressed)) != 0) {
+		libipv6addr_ipv6addrstruct_to_uncompaddr(&ipv6addr, buffer, buffer_length, formatoptions);
+	} else {
+		librfc1884_ipv6addrstruct_to_compaddr(&ipv6addr, buffer, buffer_length, formatoptions);
+	};
+
+	return(strlen(buffer));
+};
+
+
+/*
+ * print normalized range set as list of prefixes
+ *
+ * in : rangeset, formatoptions
+ */
+static void ipv6calcaggregate_print(const s_ipv6calc_rangeset *rangeset, const uint32_t formatoptions) {
+	char resultstring[NI_MAXHOST];
+	uint32_t keys[IPV6CALC_RANGESET_PREFIXES_MAX * 4], r;
+	uint8_t lengths[IPV6CALC_RANGESET_PREFIXES_MAX];
+	const uint32_t *range;
+	size_t l;
+	int words = rangeset->words, n, p;
+
+	for (r = 0; r < rangeset->count; r++) {
+		range = rangeset->ranges + (size_t) r * 2 * words;
+
+		n = libipv6calc_range_to_prefixes(range, range + words, words, keys, lengths);
+
+		for (p = 0; p < n; p++) {
+			l = ipv6calcaggregate_format(resultstring, sizeof(resultstring) - 1, keys + p * words, words, lengths[p], formatoptions);
+			resultstring[l++] = '\n';
+			fwrite(resultstring, 1, l, stdout);
+		};
+	};
+};
+
+
+/*
+ * aggregate addresses and prefixes (from arguments or stdin)
+ *  into minimal prefix list, IPv4 printed before IPv6
+ *
+ * in : formatoptions, argc/argv = input (stdin if argc == 0)
+ * out: 0=ok, 1=error (invalid input, nothing printed)
+ */
+int ipv6calcaggregate(const uint32_t formatoptions, const int argc, char *argv[]) {
+	char resultstring[NI_MAXHOST];
+	s_ipv6calc_rangeset *set4, *set6;
+	int result = 0, i;
+
+	set4 = libipv6calc_rangeset_new(1);
+	set6 = libipv6calc_rangeset_new(4);
+
+	if ((set4 == NULL) || (set6 == NULL)) {
+		result = 1;
+		goto END_ipv6calcaggregate;
+	};
+
+	if (argc > 0) {
+		for (i = 0; i < argc; i++) {
+			if (ipv6calcaggregate_add(argv[i], set4, set6, resultstring, sizeof(resultstring)) != 0) {
+				if (strlen(resultstring) > 0) {
+					fprintf(stderr, "%s\n", resultstring);
+				};
+				result = 1;
+				goto END_ipv6calcaggregate;
+			};
+		};
+	} else {
+		if (ipv6calcaggregate_read(stdin, NULL, set4, set6) != 0) {
+			result = 1;
+			goto END_ipv6calcaggregate;
+		};
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_aggregate, "Input: IPv4=%u IPv6=%u", set4->count, set6->count);
+
+	if ((libipv6calc_rangeset_normalize(set4) != 0) || (libipv6calc_rangeset_normalize(set6) != 0)) {
+		result = 1;
+		goto END_ipv6calcaggregate;
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_aggregate, "Ranges: IPv4=%u IPv6=%u", set4->count, set6->count);
+
+	ipv6calcaggregate_print(set4, formatoptions);
+	ipv6calcaggregate_print(set6, formatoptions);
+
+END_ipv6calcaggregate:
+	libipv6calc_rangeset_free(set4);
+	libipv6calc_rangeset_free(set6);
+
+	return(result);
+};
+
+
+/*
+ * union, intersection or difference of two prefix list files
+ *  result as minimal prefix list, IPv4 printed before IPv6
+ *
+ * in : formatoptions, action, argc/argv = 2 file names ("-" = stdin)
+ * out: 0=ok, 1=error (nothing printed)
+ */
+int ipv6calcaggregate_setop(const uint32_t formatoptions, const uint32_t action, const int argc, char *argv[]) {
+	s_ipv6calc_rangeset *set4[2] = { NULL, NULL }, *set6[2] = { NULL, NULL };
+	s_ipv6calc_rangeset *result4 = NULL, *result6 = NULL;
+	FILE *stream;
+	int result = 1, operation, i;
+
+	switch (action) {
+		case ACTION_union:
+			operation = IPV6CALC_RANGESET_OP_UNION;
+			break;
+		case ACTION_intersection:
+			operation = IPV6CALC_RANGESET_OP_INTERSECTION;
+			break;
+		case ACTION_difference:
+			operation = IPV6CALC_RANGESET_OP_DIFFERENCE;
+			break;
+		default:
+			fprintf(stderr, "Unsupported action for prefix list operation\n");
+			return(1);
+	};
+
+	if ((argc != 2) || ((strcmp(argv[0], "-") == 0) && (strcmp(argv[1], "-") == 0))) {
+		fprintf(stderr, "Prefix list operation requires 2 file names (one of them can be '-' for stdin)\n");
+		return(1);
+	};
+
+	for (i = 0; i < 2; i++) {
+		set4[i] = libipv6calc_rangeset_new(1);
+		set6[i] = libipv6calc_rangeset_new(4);
+		if ((set4[i] == NULL) || (set6[i] == NULL)) {
+			goto END_ipv6calcaggregate_setop;
+		};
+
+		if (strcmp(argv[i], "-") == 0) {
+			stream = stdin;
+		} else {
+			stream = fopen(argv[i], "r");
+			if (stream == NULL) {
+				fprintf(stderr, "Can't open file: %s\n", argv[i]);
+				goto END_ipv6calcaggregate_setop;
+			};
+		};
+
+		result = ipv6calcaggregate_read(stream, (stream == stdin) ? NULL : argv[i], set4[i], set6[i]);
+
+		if (stream != stdin) {
+			fclose(stream);
+		};
+
+		if (result != 0) {
+			goto END_ipv6calcaggregate_setop;
+		};
+		result = 1;
+
+		DEBUGPRINT_WA(DEBUG_ipv6calc_aggregate, "Input %s: IPv4=%u IPv6=%u", argv[i], set4[i]->count, set6[i]->count);
+
+		if ((libipv6calc_rangeset_normalize(set4[i]) != 0) || (libipv6calc_rangeset_normalize(set6[i]) != 0)) {
+			goto END_ipv6calcaggregate_setop;
+		};
+	};
+
+	result4 = libipv6calc_rangeset_combine(set4[0], set4[1], operation);
+	result6 = libipv6calc_rangeset_combine(set6[0], set6[1], operation);
+	if ((result4 == NULL) || (result6 == NULL)) {
+		goto END_ipv6calcaggregate_setop;
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_aggregate, "Ranges: IPv4=%u IPv6=%u", result4->count, result6->count);
+
+	ipv6calcaggregate_print(result4, formatoptions);
+	ipv6calcaggregate_print(result6, formatoptions);
+	result = 0;
+
+END_ipv6calcaggregate_setop:
+	for (i = 0; i < 2; i++) {
+		libipv6calc_rangeset_free(set4[i]);
+		libipv6calc_rangeset_free(set6[i]);
+	};
+	libipv6calc_rangeset_free(result4);
+	libipv6calc_rangeset_free(result6);
+
+	return(result);
+};
+
+
+/*
+ * convert one input line: range "first - last" into prefixes or prefix into range
+ *
+ * in : line (modified), action, formatoptions
+ * out: resultstring = reason in case of error
+ * ret: 0=ok, 1=error
+ */
+static int ipv6calcaggregate_convert_line(char *line, const uint32_t action, const uint32_t formatoptions, char *resultstring, const size_t resultstring_length) {
+	char outputbuffer[NI_MAXHOST * 2 + 4];
+	char *token[2] = { NULL, NULL }, *cptr;
+	uint32_t first[4], last[4], keys[IPV6CALC_RANGESET_PREFIXES_MAX * 4];
+	uint8_t lengths[IPV6CALC_RANGESET_PREFIXES_MAX];
+	int words[2], length[2], tokens, n, p, i;
+	size_t l;
+
+	resultstring[0] = '\0';
+
+	/* strip comment */
+	cptr = strchr(line, '#');
+	if (cptr != NULL) {
+		*cptr = '\0';
+	};
+
+	/* tokens separated by blanks and/or one '-' (range) */
+	cptr = line;
+	for (tokens = 0; ; tokens++) {
+		cptr += strspn(cptr, " \t\r\n");
+		if ((tokens == 1) && (*cptr == '-') && (action == ACTION_range_to_prefix)) {
+			cptr++;
+			cptr += strspn(cptr, " \t\r\n");
+		};
+		if (*cptr == '\0') {
+			break;
+		};
+		if (tokens == 2) {
+			snprintf(resultstring, resultstring_length, "Unexpected content: %s", cptr);
+			return(1);
+		};
+
+		token[tokens] = cptr;
+		cptr += strcspn(cptr, (action == ACTION_range_to_prefix) ? " \t\r\n-" : " \t\r\n");
+		if (*cptr != '\0') {
+			*cptr++ = '\0';
+		};
+	};
+
+	if (tokens == 0) {
+		/* empty line */
+		return(0);
+	};
+
+	if (action == ACTION_prefix_to_range) {
+		if (tokens != 1) {
+			snprintf(resultstring, resultstring_length, "Unexpected content: %s", token[1]);
+			return(1);
+		};
+
+		if (ipv6calcaggregate_parse(token[0], first, &words[0], &length[0], resultstring, resultstring_length) != 0) {
+			return(1);
+		};
+
+		libipv6calc_prefix_to_range(first, (length[0] < 0) ? words[0] * 32 : length[0], words[0], first, last);
+
+		l = ipv6calcaggregate_format(outputbuffer, NI_MAXHOST, first, words[0], -1, formatoptions);
+		memcpy(outputbuffer + l, " - ", 3);
+		l += 3;
+		l += ipv6calcaggregate_format(outputbuffer + l, NI_MAXHOST, last, words[0], -1, formatoptions);
+		outputbuffer[l++] = '\n';
+		fwrite(outputbuffer, 1, l, stdout);
+		return(0);
+	};
+
+	/* range to prefix */
+	if (tokens != 2) {
+		snprintf(resultstring, resultstring_length, "Range need to be given as 'first - last': %s", token[0]);
+		return(1);
+	};
+
+	if ((ipv6calcaggregate_parse(token[0], first, &words[0], &length[0], resultstring, resultstring_length) != 0) \
+	    || (ipv6calcaggregate_parse(token[1], last, &words[1], &length[1], resultstring, resultstring_length) != 0)) {
+		return(1);
+	};
+
+	if ((words[0] != words[1]) || (length[0] >= 0) || (length[1] >= 0)) {
+		snprintf(resultstring, resultstring_length, "Begin and end of range need to be addresses of same protocol: %s - %s", token[0], token[1]);
+		return(1);
+	};
+
+	for (i = 0; (i < words[0]) && (first[i] == last[i]); i++);
+	if ((i < words[0]) && (first[i] > last[i])) {
+		snprintf(resultstring, resultstring_length, "Begin of range is behind end: %s - %s", token[0], token[1]);
+		return(1);
+	};
+
+	n = libipv6calc_range_to_prefixes(first, last, words[0], keys, lengths);
+
+	for (p = 0; p < n; p++) {
+		l = ipv6calcaggregate_format(outputbuffer, NI_MAXHOST, keys + p * words[0], words[0], lengths[p], formatoptions);
+		outputbuffer[l++] = '\n';
+		fwrite(outputbuffer, 1, l, stdout);
+	};
+
+	return(0);
+};
+
+
+/*
+ * convert address ranges into prefixes or prefixes into address ranges
+ *  (from arguments or stdin, streamed line by line)
+ *
+ * in : formatoptions, action, argc/argv = input (stdin if argc == 0)
+ * out: 0=ok, 1=error (conversion stopped)
+ */
+int ipv6calcaggregate_convert(const uint32_t formatoptions, const uint32_t action, const int argc, char *argv[]) {
+	char linebuffer[IPV6CALC_AGGREGATE_LINEBUFFER];
+	char resultstring[NI_MAXHOST];
+	long int linecounter = 0;
+	size_t l = 0, a;
+	int i;
+
+	if (argc > 0) {
+		if (action == ACTION_range_to_prefix) {
+			/* range can be split into several arguments */
+			for (i = 0; i < argc; i++) {
+				a = strlen(argv[i]);
+				if (l + a + 2 > sizeof(linebuffer)) {
+					fprintf(stderr, "Arguments are too long\n");
+					return(1);
+				};
+				if (i > 0) {
+					linebuffer[l++] = ' ';
+				};
+				memcpy(linebuffer + l, argv[i], a);
+				l += a;
+			};
+			linebuffer[l] = '\0';
+
+			if (ipv6calcaggregate_convert_line(linebuffer, action, formatoptions, resultstring, sizeof(resultstring)) != 0) {
+				fprintf(stderr, "%s\n", resultstring);
+				return(1);
+			};
+			return(0);
+		};
+
+		for (i = 0; i < argc; i++) {
+			snprintf(linebuffer, sizeof(linebuffer), "%s", argv[i]);
+			if (ipv6calcaggregate_convert_line(linebuffer, action, formatoptions, resultstring, sizeof(resultstring)) != 0) {
+				fprintf(stderr, "%s\n", resultstring);
+				return(1);
+			};
+		};
+		return(0);
+	};
+
+	while (fgets(linebuffer, sizeof(linebuffer), stdin) != NULL) {
+		linecounter++;
+
+		if (ipv6calcaggregate_convert_line(linebuffer, action, formatoptions, resultstring, sizeof(resultstring)) != 0) {
+			fprintf(stderr, "Line %ld: %s\n", linecounter, resultstring);
+			return(1);
+		};
+	};
+
+	return(0);
+};
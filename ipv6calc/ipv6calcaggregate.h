@@ -0,0 +1,23 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcaggregate.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for ipv6calc prefix list aggregation, operations and conversion
+ */
+
+
+#ifndef _ipv6calcaggregate_h_
+
+#define _ipv6calcaggregate_h_
+
+/* input line buffer */
+#define IPV6CALC_AGGREGATE_LINEBUFFER	16384
+
+extern int ipv6calcaggregate(const uint32_t formatoptions, const int argc, char *argv[]);
+extern int ipv6calcaggregate_setop(const uint32_t formatoptions, const uint32_t action, const int argc, char *argv[]);
+extern int ipv6calcaggregate_convert(const uint32_t formatoptions, const uint32_t action, const int argc, char *argv[]);
+
+#endif
@@ -0,0 +1,278 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcbatch.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Sorted batch mode for ipv6calc pipe lookups
+ *
+ *  A block of input lines is parsed, the binary addresses are tagged with
+ *  their line position and radix sorted, resolved in ascending order
+ *  (sequential sweep over the database ranges, duplicates resolved once)
+ *  and the results are printed in input order
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "ipv6calc.h"
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "libipv6calcset.h"
+#include "ipv6calctypes.h"
+#include "ipv6calcbatch.h"
+#include "libipv4addr.h"
+#include "libipv6addr.h"
+#include "librfc1886.h"
+#include "librfc1924.h"
+#include "librfc2874.h"
+
+#include "../databases/lib/libipv6calc_db_wrapper.h"
+
+
+/*
+ * resolve block and print results in input order
+ *
+ * in : formatoptions, amount of lines and entries in block
+ * mod: entries (sorted)
+ */
+static void ipv6calcbatch_addr_to_countrycode_block(const uint32_t formatoptions, const uint32_t lines, s_ipv6calc_batch_ipv4 *ipv4p, s_ipv6calc_batch_ipv4 *ipv4_tempp, const uint32_t count_ipv4, s_ipv6calc_batch_ipv6 *ipv6p, s_ipv6calc_batch_ipv6 *ipv6_tempp, const uint32_t count_ipv6, uint16_t *resultp) {
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	uint16_t cc_index = COUNTRYCODE_INDEX_MAX;
+	uint32_t i;
+	int has_cc;
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_batch, "Block: lines=%u IPv4=%u IPv6=%u", lines, count_ipv4, count_ipv6);
+
+	/* on failure entries stay unsorted, results are still correct */
+	libipv6calc_radix_sort(ipv4p, ipv4_tempp, count_ipv4, sizeof(s_ipv6calc_batch_ipv4), 1);
+	libipv6calc_radix_sort(ipv6p, ipv6_tempp, count_ipv6, sizeof(s_ipv6calc_batch_ipv6), 4);
+
+	if (count_ipv4 > 0) {
+		has_cc = libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_CC);
+
+		for (i = 0; i < count_ipv4; i++) {
+			if ((i == 0)
+			    || (ipv4p[i].addr != ipv4p[i - 1].addr)
+			    || (ipv4p[i].typeinfo != ipv4p[i - 1].typeinfo)
+			    || (ipv4p[i].typeinfo2 != ipv4p[i - 1].typeinfo2)
+			) {
+				DEBUGPRINT_WA(DEBUG_ipv6calc_batch, "Lookup IPv4: %08x", ipv4p[i].addr);
+				cc_index = COUNTRYCODE_INDEX_MAX;
+				if (has_cc == 1) {
+					ipv4addr_clearall(&ipv4addr);
+					ipv4addr_setdword(&ipv4addr, ipv4p[i].addr);
+					ipv4addr.typeinfo = ipv4p[i].typeinfo;
+					ipv4addr.typeinfo2 = ipv4p[i].typeinfo2;
+					ipv4addr.flag_typeinfo = 1;
+					ipv4addr.flag_valid = 1;
+					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
+				};
+			};
+			resultp[ipv4p[i].pos] = cc_index;
+		};
+	};
+
+	if (count_ipv6 > 0) {
+		has_cc = libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_CC);
+
+		for (i = 0; i < count_ipv6; i++) {
+			if ((i == 0)
+			    || (memcmp(ipv6p[i].addr, ipv6p[i - 1].addr, sizeof(ipv6p[i].addr)) != 0)
+			    || (ipv6p[i].typeinfo != ipv6p[i - 1].typeinfo)
+			    || (ipv6p[i].typeinfo2 != ipv6p[i - 1].typeinfo2)
+			) {
+				DEBUGPRINT_WA(DEBUG_ipv6calc_batch, "Lookup IPv6: %08x%08x%08x%08x", ipv6p[i].addr[0], ipv6p[i].addr[1], ipv6p[i].addr[2], ipv6p[i].addr[3]);
+				cc_index = COUNTRYCODE_INDEX_MAX;
+				if (has_cc == 1) {
+					ipv6addr_clearall(&ipv6addr);
+					ipv6addr_setdword(&ipv6addr, 0, ipv6p[i].addr[0]);
+					ipv6addr_setdword(&ipv6addr, 1, ipv6p[i].addr[1]);
+					ipv6addr_setdword(&ipv6addr, 2, ipv6p[i].addr[2]);
+					ipv6addr_setdword(&ipv6addr, 3, ipv6p[i].addr[3]);
+					ipv6addr.typeinfo = ipv6p[i].typeinfo;
+					ipv6addr.typeinfo2 = ipv6p[i].typeinfo2;
+					ipv6addr.flag_typeinfo = 1;
+					ipv6addr.flag_valid = 1;
+					cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
+				};
+			};
+			resultp[ipv6p[i].pos] = cc_index;
+		};
+	};
+
+	for (i = 0; i < lines; i++) {
+		if ((resultp[i] == COUNTRYCODE_INDEX_UNKNOWN) || (resultp[i] == COUNTRYCODE_INDEX_MAX)) {
+			fprintf(stdout, "--%s\n"
+			    , ((formatoptions & FORMATOPTION_quiet) != 0) ? "" : ((resultp[i] == COUNTRYCODE_INDEX_UNKNOWN) ? " (unknown)" : " (no-usable-database)")
+			);
+		} else {
+			fprintf(stdout, "%c%c\n", COUNTRYCODE_INDEX_TO_CHAR1(resultp[i]), COUNTRYCODE_INDEX_TO_CHAR2(resultp[i]));
+		};
+	};
+};
+
+
+/*
+ * sorted batch mode for action 'addr2cc', reads stdin
+ *
+ * in : formatoptions, flush_mode (flush after each block)
+ * out: 0=ok, 1=error (invalid input, results of previous lines are printed)
+ */
+int ipv6calcbatch_addr_to_countrycode(const uint32_t formatoptions, const int flush_mode) {
+	char linebuffer[IPV6CALC_BATCH_LINEBUFFER];
+	char resultstring[IPV6CALC_BATCH_LINEBUFFER];
+	char *charptr, *cptr;
+	s_ipv6calc_batch_ipv4 *ipv4p, *ipv4_tempp;
+	s_ipv6calc_batch_ipv6 *ipv6p, *ipv6_tempp;
+	uint16_t *resultp;
+	uint32_t lines = 0, count_ipv4 = 0, count_ipv6 = 0, inputtype;
+	long int linecounter = 0;
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	int retval, result = 0, proto, flag_parsed;
+
+	ipv4p      = malloc(sizeof(s_ipv6calc_batch_ipv4) * IPV6CALC_BATCH_LINES);
+	ipv4_tempp = malloc(sizeof(s_ipv6calc_batch_ipv4) * IPV6CALC_BATCH_LINES);
+	ipv6p      = malloc(sizeof(s_ipv6calc_batch_ipv6) * IPV6CALC_BATCH_LINES);
+	ipv6_tempp = malloc(sizeof(s_ipv6calc_batch_ipv6) * IPV6CALC_BATCH_LINES);
+	resultp    = malloc(sizeof(uint16_t) * IPV6CALC_BATCH_LINES);
+
+	if ((ipv4p == NULL) || (ipv4_tempp == NULL) || (ipv6p == NULL) || (ipv6_tempp == NULL) || (resultp == NULL)) {
+		fprintf(stderr, "Can't allocate memory for sorted batch mode\n");
+		result = 1;
+		goto END_ipv6calcbatch;
+	};
+
+	while (fgets(linebuffer, sizeof(linebuffer), stdin) != NULL) {
+		linecounter++;
+
+		charptr = strtok_r(linebuffer, " \t\n", &cptr);
+
+		if (charptr == NULL) {
+			fprintf(stderr, "Line contains no token: %ld\n", linecounter);
+			continue;
+		};
+
+		ipv4addr_clearall(&ipv4addr);
+		ipv6addr_clearall(&ipv6addr);
+		resultstring[0] = '\0';
+		proto = 0;
+
+		/* common address notations are parsed in the same pass */
+		inputtype = libipv6calc_autodetectinput_parse(charptr, &ipv4addr, &ipv6addr, NULL, &flag_parsed);
+
+		switch (inputtype) {
+			case FORMAT_ipv4addr:
+				retval = (flag_parsed == 1) ? 0 : addr_to_ipv4addrstruct(charptr, resultstring, sizeof(resultstring), &ipv4addr);
+				proto = 4;
+				break;
+
+			case FORMAT_ipv4hex:
+				retval = addrhex_to_ipv4addrstruct(charptr, resultstring, sizeof(resultstring), &ipv4addr, 0);
+				proto = 4;
+				break;
+
+			case FORMAT_ipv4revhex:
+				retval = addrhex_to_ipv4addrstruct(charptr, resultstring, sizeof(resultstring), &ipv4addr, 1);
+				proto = 4;
+				break;
+
+			case FORMAT_ipv6addr:
+				retval = (flag_parsed == 1) ? 0 : addr_to_ipv6addrstruct(charptr, resultstring, sizeof(resultstring), &ipv6addr);
+				proto = 6;
+				break;
+
+			case FORMAT_ipv6literal:
+				retval = addrliteral_to_ipv6addrstruct(charptr, resultstring, sizeof(resultstring), &ipv6addr);
+				proto = 6;
+				break;
+
+			case FORMAT_base85:
+				retval = base85_to_ipv6addrstruct(charptr, resultstring, sizeof(resultstring), &ipv6addr);
+				proto = 6;
+				break;
+
+			case FORMAT_revnibbles_int:
+			case FORMAT_revnibbles_arpa:
+				retval = librfc1886_nibblestring_to_ipv6addrstruct(charptr, &ipv6addr, resultstring, sizeof(resultstring));
+				proto = 6;
+				break;
+
+			case FORMAT_bitstring:
+				retval = librfc2874_bitstring_to_ipv6addrstruct(charptr, &ipv6addr, resultstring, sizeof(resultstring));
+				proto = 6;
+				break;
+
+			case FORMAT_undefined:
+			case FORMAT_auto_noresult:
+				snprintf(resultstring, sizeof(resultstring), " Input-type isn't autodetected");
+				retval = -1;
+				break;
+
+			default:
+				snprintf(resultstring, sizeof(resultstring), "Unsupported input type for 'addr2cc' (need to be IPv4/IPv6 address)!");
+				retval = -1;
+				break;
+		};
+
+		if (retval != 0) {
+			// finish lines before like in line-by-line mode
+			ipv6calcbatch_addr_to_countrycode_block(formatoptions, lines, ipv4p, ipv4_tempp, count_ipv4, ipv6p, ipv6_tempp, count_ipv6, resultp);
+			fflush(stdout);
+			if (strlen(resultstring) > 0) {
+				fprintf(stderr, "%s\n", resultstring);
+			};
+			result = 1;
+			goto END_ipv6calcbatch;
+		};
+
+		if (proto == 4) {
+			ipv4addr_settype(&ipv4addr, 1);
+			ipv4p[count_ipv4].addr = ipv4addr_getdword(&ipv4addr);
+			ipv4p[count_ipv4].typeinfo = ipv4addr.typeinfo;
+			ipv4p[count_ipv4].typeinfo2 = ipv4addr.typeinfo2;
+			ipv4p[count_ipv4].pos = lines;
+			count_ipv4++;
+		} else {
+			ipv6addr_settype(&ipv6addr);
+			ipv6p[count_ipv6].addr[0] = ipv6addr_getdword(&ipv6addr, 0);
+			ipv6p[count_ipv6].addr[1] = ipv6addr_getdword(&ipv6addr, 1);
+			ipv6p[count_ipv6].addr[2] = ipv6addr_getdword(&ipv6addr, 2);
+			ipv6p[count_ipv6].addr[3] = ipv6addr_getdword(&ipv6addr, 3);
+			ipv6p[count_ipv6].typeinfo = ipv6addr.typeinfo;
+			ipv6p[count_ipv6].typeinfo2 = ipv6addr.typeinfo2;
+			ipv6p[count_ipv6].pos = lines;
+			count_ipv6++;
+		};
+
+		lines++;
+
+		if (lines == IPV6CALC_BATCH_LINES) {
+			ipv6calcbatch_addr_to_countrycode_block(formatoptions, lines, ipv4p, ipv4_tempp, count_ipv4, ipv6p, ipv6_tempp, count_ipv6, resultp);
+			if (flush_mode == 1) {
+				fflush(stdout);
+			};
+			lines = 0;
+			count_ipv4 = 0;
+			count_ipv6 = 0;
+
+			/* reload replaced database files between blocks */
+			libipv6calc_db_wrapper_reload_check();
+		};
+	};
+
+	ipv6calcbatch_addr_to_countrycode_block(formatoptions, lines, ipv4p, ipv4_tempp, count_ipv4, ipv6p, ipv6_tempp, count_ipv6, resultp);
+
+END_ipv6calcbatch:
+	free(ipv4p);
+	free(ipv4_tempp);
+	free(ipv6p);
+	free(ipv6_tempp);
+	free(resultp);
+
+	return(result);
+};
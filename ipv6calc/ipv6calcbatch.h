@@ -0,0 +1,39 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcbatch.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for ipv6calc sorted batch mode
+ */
+
+
+#ifndef _ipv6calcbatch_h_
+
+#define _ipv6calcbatch_h_
+
+/* amount of lines sorted and resolved at once */
+#define IPV6CALC_BATCH_LINES		262144
+
+/* input line buffer */
+#define IPV6CALC_BATCH_LINEBUFFER	16384
+
+/* sort entry, address words have to be first */
+typedef struct {
+	uint32_t addr;
+	uint32_t typeinfo;
+	uint32_t typeinfo2;
+	uint32_t pos;		// line in block
+} s_ipv6calc_batch_ipv4;
+
+typedef struct {
+	uint32_t addr[4];
+	uint32_t typeinfo;
+	uint32_t typeinfo2;
+	uint32_t pos;		// line in block
+} s_ipv6calc_batch_ipv6;
+
+extern int ipv6calcbatch_addr_to_countrycode(const uint32_t formatoptions, const int flush_mode);
+
+#endif
@@ -16,6 +16,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calcoptions.h"
 #include "ipv6calchelp.h"
+#include "ipv6calcserver.h"
 #include "config.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
@@ -102,6 +103,12 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 
 	fprintf(stderr, "  [-q|--quiet]               : be more quiet (auto-enabled in pipe mode)\n");
 	fprintf(stderr, "  [-f|--flush]               : flush each line in pipe mode\n");
+	fprintf(stderr, "  [--server <socket>]        : serve pipe mode queries on Unix domain socket\n");
+	fprintf(stderr, "                               (each answer terminated by an empty line)\n");
+	fprintf(stderr, "  [--server-timeout <sec>]   : close idle server connection after given seconds\n");
+	fprintf(stderr, "                               (default: %d)\n", IPV6CALC_SERVER_TIMEOUT_DEFAULT);
+	fprintf(stderr, "  [--sorted-batch]           : pipe mode with '-A addr2cc': resolve blocks of input\n");
+	fprintf(stderr, "                               sorted by address, print results in input order\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " Usage with new style options:\n");
 	fprintf(stderr, "  [--in|-I <input type>]   : specify input  type\n");
@@ -118,6 +125,10 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 	fprintf(stderr, "  Available action types:  [-m] -A|--action -?|-h|--help\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, "  Special filter action :  -E -?|-h|--help\n");
+	fprintf(stderr, "  Filter file           :  --filter-file <file>\n");
+	fprintf(stderr, "                           (one prefix, [^]db.cc=<CC> or [^]db.asn=<ASN> per line,\n");
+	fprintf(stderr, "                            '^' for may-not-have, entries of a kind are or'ed,\n");
+	fprintf(stderr, "                            also with address must-have of '-E')\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " Other usage:\n");
 	fprintf(stderr, "  --showinfo|-i [--machine_readable|-m] : show information about input data\n");
@@ -128,6 +139,9 @@ void ipv6calc_printhelp(const struct option longopts[], const s_ipv6calc_longopt
 	fprintf(stderr, "  --showinfo|-i --mrmt <TOKENPREFIX>    : Machine Readable Match Token Prefix\n");
 	fprintf(stderr, "  --showinfo|-i --mrmts <TOKENSUFFIX>   : Machine Readable Match Token Suffix\n");
 	fprintf(stderr, "  --showinfo|-i --mrtvo <TOKEN>         : Machine Readable Token Value Only\n");
+	fprintf(stderr, "  --showinfo|-i --mrjson                : Machine Readable JSON, one record per line\n");
+	fprintf(stderr, "  --showinfo|-i --fields|--mrfields <GROUP,...>\n");
+	fprintf(stderr, "                                        : Machine Readable Field groups (skip lookups of others)\n");
 	fprintf(stderr, "  --showinfo|-i --show-tokens           : show available tokens (aka types) on '-m'\n");
 
 	printhelp_shortcut_options(longopts, longopts_shortopts_map);
@@ -108,6 +108,9 @@ static struct option ipv6calc_longopts[] = {
 	{ "mrstpa"               , 1, NULL, FORMATOPTION_NUM_mr_select_token_pa + FORMATOPTION_NUM_HEAD },
 	{ "mrmt"                 , 1, NULL, FORMATOPTION_NUM_mr_match_token  + FORMATOPTION_NUM_HEAD },
 	{ "mrmts"                , 1, NULL, FORMATOPTION_NUM_mr_match_token_suffix  + FORMATOPTION_NUM_HEAD },
+	{ "mrjson"               , 0, NULL, FORMATOPTION_NUM_mr_json         + FORMATOPTION_NUM_HEAD },
+	{ "mrfields"             , 1, NULL, FORMATOPTION_NUM_mr_fields       + FORMATOPTION_NUM_HEAD },
+	{ "fields"               , 1, NULL, FORMATOPTION_NUM_mr_fields       + FORMATOPTION_NUM_HEAD },
 	
 	{ "printmirrored"        , 0, NULL, FORMATOPTION_NUM_printmirrored + FORMATOPTION_NUM_HEAD },
 
@@ -132,6 +135,16 @@ static struct option ipv6calc_longopts[] = {
 	{ "test_le"		, 1, NULL, CMD_test_le },
 	{ "test_lt"		, 1, NULL, CMD_test_lt },
 
+	/* server mode */
+	{ "server"		, 1, NULL, CMD_server },
+	{ "server-timeout"	, 1, NULL, CMD_server_timeout },
+
+	/* sorted batch mode */
+	{ "sorted-batch"	, 0, NULL, CMD_sorted_batch },
+
+	/* filter file */
+	{ "filter-file"		, 1, NULL, CMD_filter_file },
+
 }; 
 
 
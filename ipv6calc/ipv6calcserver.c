@@ -0,0 +1,277 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcserver.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Server mode for ipv6calc: keep databases opened and answer queries
+ *  received over a Unix domain socket
+ *
+ *  Protocol: newline-delimited, same input as in pipe mode, each answer
+ *   is terminated by an empty line, connection is closed on error
+ *
+ *  Each accepted connection is served by a forked child which inherits
+ *  the already initialized database wrapper, database files accessed by
+ *  file offset are reopened in the child. Up to IPV6CALC_SERVER_CHILDREN_MAX
+ *  connections are served in parallel, finished children are reaped each
+ *  time accept() returns (SIGCHLD interrupts it). A connection is closed
+ *  if the client sends nothing within the read timeout.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <sys/time.h>
+
+#include "ipv6calc.h"
+#include "ipv6calcserver.h"
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+
+#include "../databases/lib/libipv6calc_db_wrapper.h"
+
+
+static volatile sig_atomic_t ipv6calcserver_stop = 0;
+
+
+/*
+ * signal handler for terminating the server loop
+ */
+static void ipv6calcserver_signal_stop(int signum) {
+	ipv6calcserver_stop = signum;
+};
+
+
+/*
+ * signal handler for finished children, only interrupts accept() with EINTR,
+ * reaping is done in the server loop (a flag set here could be missed by a
+ * check placed before the blocking accept())
+ */
+static void ipv6calcserver_signal_child(int signum) {
+	if (signum == 0) { }; // make compiler happy (avoid unused "...")
+};
+
+
+/*
+ * reap finished children
+ *
+ * in : block = 1: wait for at least one child
+ * mod: children = number of running children
+ */
+static void ipv6calcserver_reap(int *children, const int block) {
+	pid_t pid;
+	int status;
+
+	while (*children > 0) {
+		pid = waitpid(-1, &status, (block == 1) ? 0 : WNOHANG);
+		if (pid < 0) {
+			if ((errno == EINTR) && (ipv6calcserver_stop == 0)) {
+				continue;
+			};
+			break;
+		};
+
+		if (pid == 0) {
+			/* no more finished children */
+			break;
+		};
+
+		(*children)--;
+		DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Child finished: pid=%d status=%d running=%d", (int) pid, status, *children);
+
+		/* one finished child is enough to continue */
+		if (block == 1) {
+			break;
+		};
+	};
+};
+
+
+/*
+ * run server loop on given Unix domain socket
+ *
+ * in : socket_path
+ * in : timeout = read timeout of a connection in seconds
+ * out: 0 = running in child, stdin/stdout are connected to the client
+ *      1 = server terminated by signal (parent)
+ *     -1 = error (parent)
+ */
+int ipv6calcserver_run(const char *socket_path, const int timeout) {
+	struct sockaddr_un addr;
+	struct sigaction sa;
+	struct stat st;
+	struct timeval tv;
+	int fd_listen, fd_conn, children = 0;
+	long int connections = 0;
+	pid_t pid;
+
+	DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Start server on socket: %s", socket_path);
+
+	if (strlen(socket_path) >= IPV6CALC_SERVER_SOCKET_MAX) {
+		fprintf(stderr, "Server socket path too long: %s\n", socket_path);
+		return(-1);
+	};
+
+	/* remove stale socket from previous run, but nothing else */
+	if (lstat(socket_path, &st) == 0) {
+		if (! S_ISSOCK(st.st_mode)) {
+			fprintf(stderr, "Server socket path exists and is not a socket: %s\n", socket_path);
+			return(-1);
+		};
+		if (unlink(socket_path) != 0) {
+			fprintf(stderr, "Can't remove stale server socket: %s (%s)\n", socket_path, strerror(errno));
+			return(-1);
+		};
+		DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Stale socket removed: %s", socket_path);
+	};
+
+	fd_listen = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd_listen < 0) {
+		fprintf(stderr, "Can't create server socket (%s)\n", strerror(errno));
+		return(-1);
+	};
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", socket_path);
+
+	if (bind(fd_listen, (struct sockaddr *) &addr, sizeof(addr)) != 0) {
+		fprintf(stderr, "Can't bind server socket: %s (%s)\n", socket_path, strerror(errno));
+		close(fd_listen);
+		return(-1);
+	};
+
+	if (listen(fd_listen, 64) != 0) {
+		fprintf(stderr, "Can't listen on server socket: %s (%s)\n", socket_path, strerror(errno));
+		close(fd_listen);
+		unlink(socket_path);
+		return(-1);
+	};
+
+	/* terminate loop on INT/TERM, accept() has to return with EINTR */
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = ipv6calcserver_signal_stop;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+
+	/* reap finished children, no SA_RESTART: accept() has to return with EINTR */
+	sa.sa_handler = ipv6calcserver_signal_child;
+	sa.sa_flags = SA_NOCLDSTOP;
+	sigaction(SIGCHLD, &sa, NULL);
+
+	/* a vanishing client must not terminate the server */
+	signal(SIGPIPE, SIG_IGN);
+
+	/* reload replaced database files on request before serving next client */
+	libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "%s: server listening on socket: %s\n", PROGRAM_NAME, socket_path);
+	};
+
+	/* everything buffered so far must not be duplicated into children */
+	fflush(stdout);
+	fflush(stderr);
+
+	while (ipv6calcserver_stop == 0) {
+		/* reached on start and after every return of accept(), also on EINTR */
+		ipv6calcserver_reap(&children, 0);
+
+		if (children >= IPV6CALC_SERVER_CHILDREN_MAX) {
+			/* limit reached, wait for a finished child before accepting next connection */
+			DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Maximum of running children reached: %d", children);
+			ipv6calcserver_reap(&children, 1);
+			continue;
+		};
+
+		fd_conn = accept(fd_listen, NULL, NULL);
+		if (fd_conn < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			};
+			fprintf(stderr, "Can't accept on server socket: %s (%s)\n", socket_path, strerror(errno));
+			break;
+		};
+
+		connections++;
+		DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Connection accepted: %ld", connections);
+
+		/* idle client must not block a child forever */
+		tv.tv_sec = timeout;
+		tv.tv_usec = 0;
+		if (setsockopt(fd_conn, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) != 0) {
+			fprintf(stderr, "Can't set read timeout on client connection (%s)\n", strerror(errno));
+			close(fd_conn);
+			continue;
+		};
+
+		/* children inherit the databases, reload replaced ones before */
+		libipv6calc_db_wrapper_reload_check();
+
+		pid = fork();
+		if (pid < 0) {
+			fprintf(stderr, "Can't fork server child (%s)\n", strerror(errno));
+			close(fd_conn);
+			continue;
+		};
+
+		if (pid == 0) {
+			/* child: serve this connection via stdin/stdout */
+			close(fd_listen);
+			signal(SIGINT, SIG_DFL);
+			signal(SIGTERM, SIG_DFL);
+			signal(SIGPIPE, SIG_DFL);
+			signal(SIGCHLD, SIG_DFL);
+
+			if ((dup2(fd_conn, STDIN_FILENO) < 0) || (dup2(fd_conn, STDOUT_FILENO) < 0)) {
+				fprintf(stderr, "Can't redirect stdin/stdout to client connection (%s)\n", strerror(errno));
+				exit(EXIT_FAILURE);
+			};
+			close(fd_conn);
+
+			/* children run in parallel, file offsets must not be shared */
+			if (libipv6calc_db_wrapper_reopen() != 0) {
+				fprintf(stderr, "Can't reopen databases in server child\n");
+				exit(EXIT_FAILURE);
+			};
+
+			DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Child serving connection: %ld", connections);
+			return(0);
+		};
+
+		/* parent */
+		close(fd_conn);
+		children++;
+
+		DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Connection passed to child: %ld (pid=%d running=%d)", connections, (int) pid, children);
+	};
+
+	close(fd_listen);
+	unlink(socket_path);
+
+	/* running children finish their connections on their own (limited by read timeout) */
+	ipv6calcserver_reap(&children, 0);
+	if (children > 0) {
+		DEBUGPRINT_WA(DEBUG_ipv6calc_server, "Children still serving connections: %d", children);
+	};
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "%s: server stopped after %ld connection(s)\n", PROGRAM_NAME, connections);
+	};
+
+	if (ipv6calcserver_stop == 0) {
+		return(-1);
+	};
+
+	return(1);
+};
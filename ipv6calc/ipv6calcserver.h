@@ -0,0 +1,27 @@
+/*
+ * Project    : ipv6calc
+ * File       : ipv6calcserver.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for ipv6calc server mode (Unix domain socket)
+ */
+
+
+#ifndef _ipv6calcserver_h_
+
+#define _ipv6calcserver_h_
+
+/* maximum length of a Unix domain socket path (sun_path) */
+#define IPV6CALC_SERVER_SOCKET_MAX	108
+
+/* maximum number of connections served in parallel */
+#define IPV6CALC_SERVER_CHILDREN_MAX	16
+
+/* default read timeout of a connection in seconds */
+#define IPV6CALC_SERVER_TIMEOUT_DEFAULT	30
+
+#endif
+
+extern int ipv6calcserver_run(const char *socket_path, const int timeout);
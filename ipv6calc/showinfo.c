@@ -35,10 +35,225 @@
 #include "../databases/lib/libipv6calc_db_wrapper_DBIP2.h"
 #include "../databases/lib/libipv6calc_db_wrapper_External.h"
 #include "../databases/lib/libipv6calc_db_wrapper_BuiltIn.h"
+#include "../databases/lib/libipv6calc_db_wrapper_Merged.h"
 
 /* from anonymizer */
 extern s_ipv6calc_anon_set ipv6calc_anon_set;
 
+/* field groups of machine readable output */
+static const struct {
+	const uint32_t number;
+	const char *token;
+	const char *explanation;
+} showinfo_fields_list[] = {
+	{ SHOWINFO_FIELD_ADDR       , "ADDR"       , "address, source, prefix length, SLA" },
+	{ SHOWINFO_FIELD_TYPE       , "TYPE"       , "address type and scope" },
+	{ SHOWINFO_FIELD_IID        , "IID"        , "interface identifier and its type" },
+	{ SHOWINFO_FIELD_IID        , "IID_TYPE"   , "(alias for IID)" },
+	{ SHOWINFO_FIELD_ANON       , "ANON"       , "anonymized address" },
+	{ SHOWINFO_FIELD_REGISTRY   , "REGISTRY"   , "registry" },
+	{ SHOWINFO_FIELD_AS         , "AS"         , "Autonomous System Number" },
+	{ SHOWINFO_FIELD_AS         , "ASN"        , "(alias for AS)" },
+	{ SHOWINFO_FIELD_CC         , "CC"         , "CountryCode" },
+	{ SHOWINFO_FIELD_GEONAMEID  , "GEONAMEID"  , "GeonameID" },
+	{ SHOWINFO_FIELD_IEEE       , "IEEE"       , "IEEE vendor (OUI)" },
+	{ SHOWINFO_FIELD_INFO       , "INFO"       , "database and program information" },
+	{ SHOWINFO_FIELD_GEOIP      , "GEOIP"      , "GeoIP (legacy) records" },
+	{ SHOWINFO_FIELD_GEOIP2     , "GEOIP2"     , "GeoIP (MaxMindDB) records" },
+	{ SHOWINFO_FIELD_IP2LOCATION, "IP2LOCATION", "IP2Location records" },
+	{ SHOWINFO_FIELD_DBIP       , "DBIP"       , "db-ip.com records" },
+	{ SHOWINFO_FIELD_DBIP2      , "DBIP2"      , "db-ip.com (MaxMindDB) records" },
+	{ SHOWINFO_FIELD_EXTERNAL   , "EXTERNAL"   , "External database records" },
+	{ SHOWINFO_FIELD_GEO        , "GEO"        , "all geolocation provider records" },
+	{ SHOWINFO_FIELD_ALL        , "ALL"        , "all of above" },
+};
+
+/* record buffer for JSON output, reused for each record */
+static char showinfo_record[SHOWINFO_RECORD_MAX];
+static size_t showinfo_record_length = 0;
+
+
+/*
+ * parse comma separated list of field groups
+ *
+ * in : list
+ * mod: *fields_p = mask of field groups
+ * ret: ==0: ok, !=0: error
+ */
+int showinfo_fields_parse(const char *list, uint32_t *fields_p) {
+	char tempstring[NI_MAXHOST];
+	char *token, *cptr, **ptrptr;
+	int i, found;
+
+	ptrptr = &cptr;
+
+	if (strlen(list) >= sizeof(tempstring)) {
+		fprintf(stderr, " Argument of option 'fields' is too long: %s\n", list);
+		return(1);
+	};
+
+	snprintf(tempstring, sizeof(tempstring), "%s", list);
+
+	*fields_p = 0;
+
+	token = strtok_r(tempstring, ",", ptrptr);
+	while (token != NULL) {
+		found = 0;
+		for (i = 0; i < MAXENTRIES_ARRAY(showinfo_fields_list); i++) {
+			if (strcasecmp(token, showinfo_fields_list[i].token) == 0) {
+				*fields_p |= showinfo_fields_list[i].number;
+				found = 1;
+				break;
+			};
+		};
+
+		if (found == 0) {
+			fprintf(stderr, " Unsupported field group of option 'fields': %s\n", token);
+			fprintf(stderr, " Supported field groups:");
+			for (i = 0; i < MAXENTRIES_ARRAY(showinfo_fields_list); i++) {
+				fprintf(stderr, " %s", showinfo_fields_list[i].token);
+			};
+			fprintf(stderr, "\n");
+			return(1);
+		};
+
+		token = strtok_r(NULL, ",", ptrptr);
+	};
+
+	DEBUGPRINT_WA(DEBUG_showinfo, "field groups selected: 0x%04x", (unsigned int) *fields_p);
+
+	return(0);
+};
+
+
+/*
+ * return field group of a token
+ */
+static uint32_t showinfo_field_by_token(const char *token) {
+	size_t len = strlen(token);
+
+#define TOKEN_HAS_PREFIX(p)	(strncmp(token, p, sizeof(p) - 1) == 0)
+#define TOKEN_HAS_SUFFIX(p)	((len >= sizeof(p) - 1) && (strcmp(token + len - (sizeof(p) - 1), p) == 0))
+
+	if (TOKEN_HAS_PREFIX("IPV6CALC_") || TOKEN_HAS_SUFFIX("_DATABASE_INFO")) {
+		return(SHOWINFO_FIELD_INFO);
+	};
+
+	if (TOKEN_HAS_PREFIX("GEOIP_")) {
+		return(SHOWINFO_FIELD_GEOIP);
+	} else if (TOKEN_HAS_PREFIX("GEOIP2_")) {
+		return(SHOWINFO_FIELD_GEOIP2);
+	} else if (TOKEN_HAS_PREFIX("IP2LOCATION_")) {
+		return(SHOWINFO_FIELD_IP2LOCATION);
+	} else if (TOKEN_HAS_PREFIX("DBIP_")) {
+		return(SHOWINFO_FIELD_DBIP);
+	} else if (TOKEN_HAS_PREFIX("DBIP2_")) {
+		return(SHOWINFO_FIELD_DBIP2);
+	} else if (TOKEN_HAS_PREFIX("EXTERNAL_")) {
+		return(SHOWINFO_FIELD_EXTERNAL);
+	};
+
+	if (TOKEN_HAS_SUFFIX("_ANON")) {
+		return(SHOWINFO_FIELD_ANON);
+	};
+
+	if (strstr(token, "_REGISTRY") != NULL) {
+		return(SHOWINFO_FIELD_REGISTRY);
+	};
+
+	if ((strstr(token, "AS_NUM") != NULL) || (strstr(token, "_AS_SOURCE") != NULL)) {
+		return(SHOWINFO_FIELD_AS);
+	};
+
+	if (strstr(token, "_COUNTRYCODE") != NULL) {
+		return(SHOWINFO_FIELD_CC);
+	};
+
+	if (strstr(token, "_GEONAME_ID") != NULL) {
+		return(SHOWINFO_FIELD_GEONAMEID);
+	};
+
+	if (strcmp(token, "OUI") == 0) {
+		return(SHOWINFO_FIELD_IEEE);
+	};
+
+	if ((strcmp(token, "IID") == 0) || (strcmp(token, "EUI64_SCOPE") == 0)) {
+		return(SHOWINFO_FIELD_IID);
+	};
+
+	if (TOKEN_HAS_SUFFIX("_TYPE") || TOKEN_HAS_SUFFIX("_SCOPE")) {
+		return(SHOWINFO_FIELD_TYPE);
+	};
+
+	return(SHOWINFO_FIELD_ADDR);
+};
+
+
+/*
+ * append one key/value pair to JSON record buffer
+ */
+static void printout_json(const char *token, const char *additional, const char *value) {
+	char *p = showinfo_record + showinfo_record_length;
+	char *p_end = showinfo_record + sizeof(showinfo_record) - 3; // keep space for "}\n"
+	const char *c;
+	int n;
+
+	n = snprintf(p, (size_t) (p_end - p), "%c\"%s%s\":\"", (showinfo_record_length == 0) ? '{' : ',', token, (additional != NULL) ? additional : "");
+	if ((n < 0) || (n >= (p_end - p))) {
+		goto TOO_LONG;
+	};
+	p += n;
+
+	for (c = value; *c != '\0'; c++) {
+		if ((p_end - p) < 7) {
+			goto TOO_LONG;
+		};
+
+		if ((*c == '"') || (*c == '\\')) {
+			*p++ = '\\';
+			*p++ = *c;
+		} else if ((unsigned char) *c < 0x20) {
+			p += snprintf(p, 7, "\\u%04x", (unsigned int) (unsigned char) *c);
+		} else {
+			*p++ = *c;
+		};
+	};
+
+	if ((p_end - p) < 1) {
+		goto TOO_LONG;
+	};
+	*p++ = '"';
+
+	showinfo_record_length = (size_t) (p - showinfo_record);
+	return;
+
+TOO_LONG:
+	/* drop incomplete key/value pair */
+	fprintf(stderr, "JSON record too long, skip token: %s%s\n", token, (additional != NULL) ? additional : "");
+	return;
+};
+
+
+/*
+ * finish record, JSON record is written with one call
+ */
+static void printrecordend(const uint32_t formatoptions) {
+	if ((formatoptions & FORMATOPTION_mr_json) == 0) {
+		return;
+	};
+
+	if (showinfo_record_length == 0) {
+		showinfo_record[showinfo_record_length++] = '{';
+	};
+
+	showinfo_record[showinfo_record_length++] = '}';
+	showinfo_record[showinfo_record_length++] = '\n';
+
+	fwrite(showinfo_record, 1, showinfo_record_length, stdout);
+
+	showinfo_record_length = 0;
+};
+
 /*
  * show available types on machine readable format
  */
@@ -140,6 +355,9 @@ void showinfo_availabletypes(void) {
 #endif
 #ifdef SUPPORT_BUILTIN
 	fprintf(stderr, " BUILTIN_DATABASE_INFO=.. .    : Information about the used databases\n");
+#endif
+#ifdef SUPPORT_DB_MERGED
+	fprintf(stderr, " MERGED_DATABASE_INFO=.. .     : Information about the used databases\n");
 #endif
 	fprintf(stderr, " IPV6CALC_NAME=name            : Name of ipv6calc\n");
 	fprintf(stderr, " IPV6CALC_VERSION=x.y.z        : Version of ipv6calc\n");
@@ -156,6 +374,12 @@ void showinfo_availabletypes(void) {
 	fprintf(stderr, "         even in case of no/empty output: --mrstpa <TOKEN>\n");
 	fprintf(stderr, "       matching tokens can be selected using --mrmt <TOKEN>\n");
 	fprintf(stderr, "       value of a specific token can be displayed using --mrtvo <TOKEN>\n");
+	fprintf(stderr, "       output as JSON (one record per line) using --mrjson\n");
+	fprintf(stderr, "       field groups can be selected using --mrfields <GROUP>[,<GROUP>...]\n");
+	fprintf(stderr, "         (database lookups of not selected field groups are skipped)\n");
+	for (i = 0; i < MAXENTRIES_ARRAY(showinfo_fields_list); i++) {
+		fprintf(stderr, "         %-10s: %s\n", showinfo_fields_list[i].token, showinfo_fields_list[i].explanation);
+	};
 };
 
 /*
@@ -164,6 +388,11 @@ void showinfo_availabletypes(void) {
 static void printout(const char *token, const char *value, const uint32_t formatoptions) {
 	int quote = 0;
 
+	if ((formatoptions & FORMATOPTION_mr_fields) && ((showinfo_fields & showinfo_field_by_token(token)) == 0)) {
+		// skip not selected field group
+		return;
+	};
+
 	if (formatoptions & FORMATOPTION_mr_select_token) {
 		// skip not matching token (equal)
 		if (strcmp(showinfo_machine_readable_filter, token) != 0) return;
@@ -184,6 +413,11 @@ static void printout(const char *token, const char *value, const uint32_t format
 		if (strlen(c) != strlen(showinfo_machine_readable_filter)) return; // found but not the suffix
 	};
 
+	if ((formatoptions & FORMATOPTION_mr_json) != 0) {
+		printout_json(token, "", value);
+		return;
+	};
+
 	/* automatic quoting disabled
 	if (strstr(value, " ") != NULL) {
 		quote = 1;
@@ -214,6 +448,11 @@ static void printout(const char *token, const char *value, const uint32_t format
 static void printout2(const char *token, const char *additional, const char *value, const uint32_t formatoptions) {
 	int quote = 0;
 
+	if ((formatoptions & FORMATOPTION_mr_fields) && ((showinfo_fields & showinfo_field_by_token(token)) == 0)) {
+		// skip not selected field group
+		return;
+	};
+
 	if (formatoptions & FORMATOPTION_mr_select_token) {
 		// skip in case additional is not empty
 		if ((additional != NULL) && (strlen(additional) > 0)) return;
@@ -240,6 +479,11 @@ static void printout2(const char *token, const char *additional, const char *val
 		if (strlen(c) != strlen(showinfo_machine_readable_filter)) return; // found but not the suffix
 	};
 
+	if ((formatoptions & FORMATOPTION_mr_json) != 0) {
+		printout_json(token, additional, value);
+		return;
+	};
+
 	/* automatic quoting disabled
 	if (strstr(value, " ") != NULL) {
 		quote = 1;
@@ -276,6 +520,10 @@ static void printfooter(const uint32_t formatoptions) {
 		printout(showinfo_machine_readable_filter, "", formatoptions);
 	};
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_INFO)) {
+		return;
+	};
+
 #if defined SUPPORT_IP2LOCATION || defined SUPPORT_GEOIP || defined SUPPORT_DBIP || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2 || defined SUPPORT_GEOIP2
 	char *string;
 #endif
@@ -357,6 +605,17 @@ static void printfooter(const uint32_t formatoptions) {
 	};
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+	string = libipv6calc_db_wrapper_Merged_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		if ( (formatoptions & FORMATOPTION_machinereadable) != 0 ) {
+			printout("MERGED_DATABASE_INFO", string, formatoptions);
+		} else {
+			fprintf(stdout, "Merged database: %s\n", string);
+		};
+	};
+#endif
+
 	if ( (formatoptions & FORMATOPTION_machinereadable) != 0 ) {
 		printout("IPV6CALC_NAME"     , PROGRAM_NAME, formatoptions);
 		printout("IPV6CALC_VERSION"  , PACKAGE_VERSION, formatoptions);
@@ -501,6 +760,10 @@ static void print_ip2location(const ipv6calc_ipaddr *ipaddrp, const uint32_t for
 
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_IP2LOCATION)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_IP2LOCATION] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "IP2Location support not active");
 		return;
@@ -520,6 +783,10 @@ static void print_ip2location(const ipv6calc_ipaddr *ipaddrp, const uint32_t for
 static void print_geoip(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_GEOIP)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "GeoIP (legacy) support not active");
 		return;
@@ -542,6 +809,10 @@ static void print_geoip(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatopt
 static void print_geoip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_GEOIP2)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_GEOIP2] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "GeoIP (MaxMindDB) support not active");
 		return;
@@ -565,6 +836,10 @@ static void print_geoip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatop
 static void print_dbip(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_DBIP)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_DBIP] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "DBIP support not active");
 		return;
@@ -588,6 +863,10 @@ static void print_dbip(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatopti
 static void print_dbip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_DBIP2)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_DBIP2] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "DBIP2 support not active");
 		return;
@@ -611,6 +890,10 @@ static void print_dbip2(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatopt
 static void print_external(const ipv6calc_ipaddr *ipaddrp, const uint32_t formatoptions, const char *additionalstring) {
 	DEBUGPRINT_NA(DEBUG_showinfo, "Called");
 
+	if (! SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_EXTERNAL)) {
+		return;
+	};
+
 	if (wrapper_features_by_source[IPV6CALC_DB_SOURCE_EXTERNAL] == 0) {
 		DEBUGPRINT_NA(DEBUG_showinfo, "External DB support not active");
 		return;
@@ -674,7 +957,7 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 
 	ipv4addr_copy(ipv4addr_anon_ptr, ipv4addrp); /* copy structure */
 
-	if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) {
+	if (((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) && SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_ANON)) {
 		retval_anon = libipv4addr_anonymize(ipv4addr_anon_ptr, ipv6calc_anon_set.mask_ipv4, ipv6calc_anon_set.method);
 
 		if (retval_anon == 0) {
@@ -743,126 +1026,134 @@ static void print_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t fo
 	};	
 
 	if ((ipv4addrp->typeinfo & (IPV4_ADDR_GLOBAL)) != 0) {
-		/* get AS Information */
-		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, &data_source);
-		if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) {
-			if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) == 1) {
-				as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source);
+		if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_AS)) {
+			/* get AS Information */
+			data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+			as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, &data_source);
+			if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) == 0) {
+				if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) == 1) {
+					as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source);
+				};
 			};
-		};
 
-		if (as_num32 != ASNUM_AS_UNKNOWN) {
-			if ( machinereadable != 0 ) {
-				snprintf(tempstring, sizeof(tempstring), "%u", as_num32);
-				printout2("IPV4_AS_NUM", embeddedipv4string, tempstring, formatoptions);
+			if (as_num32 != ASNUM_AS_UNKNOWN) {
+				if ( machinereadable != 0 ) {
+					snprintf(tempstring, sizeof(tempstring), "%u", as_num32);
+					printout2("IPV4_AS_NUM", embeddedipv4string, tempstring, formatoptions);
 
-				if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
-					for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
-						if (data_source == data_sources[i].number) {
-							printout2("IPV4_AS_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
-							break;
+					if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+						for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+							if (data_source == data_sources[i].number) {
+								printout2("IPV4_AS_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
+								break;
+							};
 						};
 					};
-				};
-			} else {
-				if (strlen(embeddedipv4string) > 0) {
-					fprintf(stdout, "Autonomous System Number (32-bit) for %s: %d\n", embeddedipv4string, as_num32);
 				} else {
-					fprintf(stdout, "Autonomous System Number (32-bit): %d\n", as_num32);
+					if (strlen(embeddedipv4string) > 0) {
+						fprintf(stdout, "Autonomous System Number (32-bit) for %s: %d\n", embeddedipv4string, as_num32);
+					} else {
+						fprintf(stdout, "Autonomous System Number (32-bit): %d\n", as_num32);
+					};
 				};
+			} else {
+				DEBUGPRINT_NA(DEBUG_showinfo, "Skip AS print: as_num32=ASNUM_AS_UNKNOWN");
 			};
-		} else {
-			DEBUGPRINT_NA(DEBUG_showinfo, "Skip AS print: as_num32=ASNUM_AS_UNKNOWN");
 		};
 
-		/* get CountryCode Information */
-		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, &data_source);
+		if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_CC)) {
+			/* get CountryCode Information */
+			data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+			cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, &data_source);
 
-		if (cc_index < COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN) {
-			libipv6calc_db_wrapper_country_code_by_cc_index(tempstring2, sizeof(tempstring2), cc_index);
-			if ( machinereadable != 0 ) {
-				printout2("IPV4_COUNTRYCODE", embeddedipv4string, tempstring2, formatoptions);
+			if (cc_index < COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN) {
+				libipv6calc_db_wrapper_country_code_by_cc_index(tempstring2, sizeof(tempstring2), cc_index);
+				if ( machinereadable != 0 ) {
+					printout2("IPV4_COUNTRYCODE", embeddedipv4string, tempstring2, formatoptions);
 
-				if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
-					for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
-						if (data_source == data_sources[i].number) {
-							printout2("IPV4_COUNTRYCODE_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
-							break;
+					if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+						for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+							if (data_source == data_sources[i].number) {
+								printout2("IPV4_COUNTRYCODE_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
+								break;
+							};
 						};
 					};
-				};
-			} else {
-				if (strlen(embeddedipv4string) > 0) {
-					fprintf(stdout, "Country Code for %s: %s\n", embeddedipv4string, tempstring2);
 				} else {
-					fprintf(stdout, "Country Code: %s\n", tempstring2);
+					if (strlen(embeddedipv4string) > 0) {
+						fprintf(stdout, "Country Code for %s: %s\n", embeddedipv4string, tempstring2);
+					} else {
+						fprintf(stdout, "Country Code: %s\n", tempstring2);
+					};
 				};
+			} else {
+				DEBUGPRINT_NA(DEBUG_showinfo, "Skip CountryCode print: cc_index>=COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN");
 			};
-		} else {
-			DEBUGPRINT_NA(DEBUG_showinfo, "Skip CountryCode print: cc_index>=COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN");
 		};
 
-		// get GeonameID
-		unsigned int GeonameID_type;
-		uint32_t GeonameID = libipv4addr_GeonameID_by_addr(ipv4addrp, &data_source, &GeonameID_type);
-		if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
-			if ( machinereadable != 0 ) {
-				snprintf(tempstring, sizeof(tempstring), "%u", GeonameID);
-				printout2("IPV4_GEONAME_ID", embeddedipv4string, tempstring, formatoptions);
-				if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
-					for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
-						if (data_source == data_sources[i].number) {
-							printout2("IPV4_GEONAME_ID_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
-							break;
+		if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_GEONAMEID)) {
+			// get GeonameID
+			unsigned int GeonameID_type;
+			uint32_t GeonameID = libipv4addr_GeonameID_by_addr(ipv4addrp, &data_source, &GeonameID_type);
+			if (GeonameID != IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+				if ( machinereadable != 0 ) {
+					snprintf(tempstring, sizeof(tempstring), "%u", GeonameID);
+					printout2("IPV4_GEONAME_ID", embeddedipv4string, tempstring, formatoptions);
+					if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+						for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+							if (data_source == data_sources[i].number) {
+								printout2("IPV4_GEONAME_ID_SOURCE" , embeddedipv4string, data_sources[i].name, formatoptions);
+								break;
+							};
 						};
 					};
-				};
-				if (GeonameID_type != IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN) {
-					for (i = 0; i < MAXENTRIES_ARRAY(geonameid_types); i++ ) {
-						if (GeonameID_type == geonameid_types[i].number) {
-							printout2("IPV4_GEONAME_ID_TYPE" , embeddedipv4string, geonameid_types[i].name, formatoptions);
-							break;
+					if (GeonameID_type != IPV6CALC_DB_GEO_GEONAMEID_TYPE_UNKNOWN) {
+						for (i = 0; i < MAXENTRIES_ARRAY(geonameid_types); i++ ) {
+							if (GeonameID_type == geonameid_types[i].number) {
+								printout2("IPV4_GEONAME_ID_TYPE" , embeddedipv4string, geonameid_types[i].name, formatoptions);
+								break;
+							};
 						};
 					};
-				};
-			} else {
-				if (strlen(embeddedipv4string) > 0) {
-					fprintf(stdout, "GeonameID %s: %u\n", embeddedipv4string, GeonameID);
 				} else {
-					fprintf(stdout, "GeonameID: %u\n", GeonameID);
+					if (strlen(embeddedipv4string) > 0) {
+						fprintf(stdout, "GeonameID %s: %u\n", embeddedipv4string, GeonameID);
+					} else {
+						fprintf(stdout, "GeonameID: %u\n", GeonameID);
+					};
 				};
 			};
 		};
 	};
 
 
-	DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_REGISTRY)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
 
-	if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
-		registry = libipv4addr_registry_num_by_addr(ipv4addrp);
-		snprintf(tempstring2, sizeof(tempstring2), "%s", libipv6calc_registry_string_by_num(registry));
-	} else {
-		libipv6calc_db_wrapper_registry_string_by_ipv4addr(ipv4addrp, tempstring, sizeof(tempstring));
-		snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
+		if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
+			registry = libipv4addr_registry_num_by_addr(ipv4addrp);
+			snprintf(tempstring2, sizeof(tempstring2), "%s", libipv6calc_registry_string_by_num(registry));
+		} else {
+			libipv6calc_db_wrapper_registry_string_by_ipv4addr(ipv4addrp, tempstring, sizeof(tempstring));
+			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
 
-		DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
-		r = libipv6calc_db_wrapper_info_by_ipv4addr(ipv4addrp, tempstring3, sizeof(tempstring3));
-		if (r == 0) {
-			// info found, append to registry
-			snprintf(tempstring, sizeof(tempstring), "%s", tempstring2);
-			snprintf(tempstring2, sizeof(tempstring2), "%s(%s)", tempstring, tempstring3);
+			DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
+			r = libipv6calc_db_wrapper_info_by_ipv4addr(ipv4addrp, tempstring3, sizeof(tempstring3));
+			if (r == 0) {
+				// info found, append to registry
+				snprintf(tempstring, sizeof(tempstring), "%s", tempstring2);
+				snprintf(tempstring2, sizeof(tempstring2), "%s(%s)", tempstring, tempstring3);
+			};
 		};
-	};
 
-	if (machinereadable != 0) {
-		printout2("IPV4_REGISTRY", embeddedipv4string, tempstring2, formatoptions);
-	} else {
-		if (strlen(embeddedipv4string) > 0) {
-			fprintf(stdout, "IPv4 registry for %s: %s\n", embeddedipv4string, tempstring2);
+		if (machinereadable != 0) {
+			printout2("IPV4_REGISTRY", embeddedipv4string, tempstring2, formatoptions);
 		} else {
-			fprintf(stdout, "IPv4 registry: %s\n", tempstring2);
+			if (strlen(embeddedipv4string) > 0) {
+				fprintf(stdout, "IPv4 registry for %s: %s\n", embeddedipv4string, tempstring2);
+			} else {
+				fprintf(stdout, "IPv4 registry: %s\n", tempstring2);
+			};
 		};
 	};
 
@@ -921,11 +1212,13 @@ static void print_asn(const uint32_t asn, const uint32_t formatoptions) {
 		fprintf(stdout, "Autonomous System Number: %s\n", helpstring);
 	};
 
-	registry = libipv6calc_db_wrapper_registry_num_by_as_num32(asn);	
-	if ( machinereadable != 0 ) {
-		printout("AS_NUM_REGISTRY", libipv6calc_registry_string_by_num(registry), formatoptions);
-	} else {
-		fprintf(stdout, "Registry of Autonomous System Number: %s\n", libipv6calc_registry_string_by_num(registry));
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_REGISTRY)) {
+		registry = libipv6calc_db_wrapper_registry_num_by_as_num32(asn);	
+		if ( machinereadable != 0 ) {
+			printout("AS_NUM_REGISTRY", libipv6calc_registry_string_by_num(registry), formatoptions);
+		} else {
+			fprintf(stdout, "Registry of Autonomous System Number: %s\n", libipv6calc_registry_string_by_num(registry));
+		};
 	};
 	
 	return;
@@ -989,13 +1282,15 @@ static void print_eui48(const ipv6calc_macaddr *macaddrp, const uint32_t formato
 		};
 	};
 	
-	/* vendor string */
-	result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), macaddrp);
-	if (result == 0) {
-		if ( machinereadable != 0 ) {
-			printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
-		} else {
-			fprintf(stdout, "OUI is: %s\n", helpstring);
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_IEEE)) {
+		/* vendor string */
+		result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), macaddrp);
+		if (result == 0) {
+			if ( machinereadable != 0 ) {
+				printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
+			} else {
+				fprintf(stdout, "OUI is: %s\n", helpstring);
+			};
 		};
 	};
 
@@ -1058,12 +1353,14 @@ static void print_eui64(const ipv6calc_eui64addr *eui64addrp, const uint32_t for
 		macaddr.addr[i] = eui64addrp->addr[i];
 	};
 
-	result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), &macaddr);
-	if (result == 0) {
-		if ( machinereadable != 0 ) {
-			printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
-		} else {
-			fprintf(stdout, "OUI is: %s\n", tempstring);
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_IEEE)) {
+		result = libipv6calc_db_wrapper_ieee_vendor_string_by_macaddr(helpstring, sizeof(helpstring), &macaddr);
+		if (result == 0) {
+			if ( machinereadable != 0 ) {
+				printout("OUI", helpstring, formatoptions | FORMATOPTION_mr_quote_default);
+			} else {
+				fprintf(stdout, "OUI is: %s\n", tempstring);
+			};
 		};
 	};
 	
@@ -1125,7 +1422,7 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 
 	CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
 
-	if ((ipv6addrp->typeinfo & (IPV6_ADDR_ANONYMIZED_PREFIX | IPV6_ADDR_ANONYMIZED_IID)) == 0 ) {
+	if (((ipv6addrp->typeinfo & (IPV6_ADDR_ANONYMIZED_PREFIX | IPV6_ADDR_ANONYMIZED_IID)) == 0) && SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_ANON)) {
 		ipv6addr_copy(ipv6addr_anon_ptr, ipv6addrp); /* copy structure */
 
 		retval_anon = libipv6addr_anonymize(ipv6addr_anon_ptr, &ipv6calc_anon_set);
@@ -1194,80 +1491,84 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 
 	if (((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU)) != 0) \
 	    && ((ipv6addrp->typeinfo2 & (IPV6_ADDR_TYPE2_ANONYMIZED_GEONAMEID)) == 0)) {
-		/* CountryCode */
-		DEBUGPRINT_NA(DEBUG_showinfo, "get country code");
-		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, &data_source);
+		if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_CC)) {
+			/* CountryCode */
+			DEBUGPRINT_NA(DEBUG_showinfo, "get country code");
+			data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+			cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, &data_source);
 
-		if (cc_index > COUNTRYCODE_INDEX_MAX) {
-			if ( machinereadable != 0 ) {
-				fprintf(stderr, "Error getting CountryCode for IPv6 address\n");
-			};
-		} else {
-			if (cc_index < COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN) {
-				libipv6calc_db_wrapper_country_code_by_cc_index(tempstring2, sizeof(tempstring2),cc_index);
+			if (cc_index > COUNTRYCODE_INDEX_MAX) {
 				if ( machinereadable != 0 ) {
-					printout("IPV6_COUNTRYCODE" , tempstring2, formatoptions);
-
-					if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
-						for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
-							if (data_source == data_sources[i].number) {
-								printout("IPV6_COUNTRYCODE_SOURCE" , data_sources[i].name, formatoptions);
-								break;
+					fprintf(stderr, "Error getting CountryCode for IPv6 address\n");
+				};
+			} else {
+				if (cc_index < COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(tempstring2, sizeof(tempstring2),cc_index);
+					if ( machinereadable != 0 ) {
+						printout("IPV6_COUNTRYCODE" , tempstring2, formatoptions);
+
+						if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+							for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+								if (data_source == data_sources[i].number) {
+									printout("IPV6_COUNTRYCODE_SOURCE" , data_sources[i].name, formatoptions);
+									break;
+								};
 							};
 						};
+					} else {
+						fprintf(stdout, "Country Code: %s\n", tempstring2);
 					};
 				} else {
-					fprintf(stdout, "Country Code: %s\n", tempstring2);
+					DEBUGPRINT_NA(DEBUG_showinfo, "Skip CountryCode print: cc_index>=COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN");
 				};
-			} else {
-				DEBUGPRINT_NA(DEBUG_showinfo, "Skip CountryCode print: cc_index>=COUNTRYCODE_INDEX_UNKNOWN_REGISTRY_MAP_MIN");
 			};
 		};
 
-		/* AS */
-		DEBUGPRINT_NA(DEBUG_showinfo, "get AS number/text");
-		data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
-		as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, &data_source);
+		if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_AS)) {
+			/* AS */
+			DEBUGPRINT_NA(DEBUG_showinfo, "get AS number/text");
+			data_source = IPV6CALC_DB_SOURCE_UNKNOWN;
+			as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, &data_source);
 
-		if ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) == 0) {
-			if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) == 1) {
-				as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source);
+			if ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) == 0) {
+				if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) == 1) {
+					as_num32 = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, &data_source);
+				};
 			};
-		};
 
-		if ((as_num32 == 0) && (machinereadable == 0)) {
-			// fprintf(stderr, "Error getting AS number from IPv6 address\n");
-		} else {
-			if (as_num32 != ASNUM_AS_UNKNOWN) {
-				if ( machinereadable != 0 ) {
-					if (as_num32 == 0) {
-						snprintf(tempstring, sizeof(tempstring), "(unknown)");
-					} else {
-						snprintf(tempstring, sizeof(tempstring), "%d", as_num32);
-					};
-					printout("IPV6_AS_NUM" ,tempstring, formatoptions);
-
-					if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
-						for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
-							if (data_source == data_sources[i].number) {
-								printout("IPV6_AS_SOURCE" , data_sources[i].name, formatoptions);
-								break;
+			if ((as_num32 == 0) && (machinereadable == 0)) {
+				// fprintf(stderr, "Error getting AS number from IPv6 address\n");
+			} else {
+				if (as_num32 != ASNUM_AS_UNKNOWN) {
+					if ( machinereadable != 0 ) {
+						if (as_num32 == 0) {
+							snprintf(tempstring, sizeof(tempstring), "(unknown)");
+						} else {
+							snprintf(tempstring, sizeof(tempstring), "%d", as_num32);
+						};
+						printout("IPV6_AS_NUM" ,tempstring, formatoptions);
+
+						if (data_source != IPV6CALC_DB_SOURCE_UNKNOWN) {
+							for (i = 0; i < MAXENTRIES_ARRAY(data_sources); i++ ) {
+								if (data_source == data_sources[i].number) {
+									printout("IPV6_AS_SOURCE" , data_sources[i].name, formatoptions);
+									break;
+								};
 							};
 						};
+					} else {
+						fprintf(stdout, "ASN for address: %d\n", as_num32);
 					};
 				} else {
-					fprintf(stdout, "ASN for address: %d\n", as_num32);
+					DEBUGPRINT_NA(DEBUG_showinfo, "Skip AS print: as_num32=ASNUM_AS_UNKNOWN");
 				};
-			} else {
-				DEBUGPRINT_NA(DEBUG_showinfo, "Skip AS print: as_num32=ASNUM_AS_UNKNOWN");
 			};
 		};
 	};
 
 
 	/* GeonameID */
-	if (((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU)) != 0)
+	if (((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_AGU)) != 0) && SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_GEONAMEID)
 	    && ! (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) && (((ipv6addrp->typeinfo2 & IPV6_ADDR_TYPE2_ANONYMIZED_GEONAMEID)) == 0))) {
 		// get GeonameID
 		unsigned int GeonameID_type;
@@ -1300,28 +1601,30 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 
 
 	/* IPv6 Registry */
-	DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
-	if (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) \
-		&& ((ipv6addrp->typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4_IN_PREFIX) == 0)) {
-		registry = libipv6addr_registry_num_by_addr(ipv6addrp);
-		snprintf(tempstring2, sizeof(tempstring2), "%s", libipv6calc_registry_string_by_num(registry));
-	} else {
-		libipv6calc_db_wrapper_registry_string_by_ipv6addr(ipv6addrp, tempstring, sizeof(tempstring));
-		snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_REGISTRY)) {
+		DEBUGPRINT_NA(DEBUG_showinfo, "get registry");
+		if (((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX) != 0) \
+			&& ((ipv6addrp->typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4_IN_PREFIX) == 0)) {
+			registry = libipv6addr_registry_num_by_addr(ipv6addrp);
+			snprintf(tempstring2, sizeof(tempstring2), "%s", libipv6calc_registry_string_by_num(registry));
+		} else {
+			libipv6calc_db_wrapper_registry_string_by_ipv6addr(ipv6addrp, tempstring, sizeof(tempstring));
+			snprintf(tempstring2, sizeof(tempstring2), "%s", tempstring);
 
-		DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
-		r = libipv6calc_db_wrapper_info_by_ipv6addr(ipv6addrp, tempstring3, sizeof(tempstring3));
-		if (r == 0) {
-			// info found, append to registry
-			snprintf(tempstring, sizeof(tempstring), "%s", tempstring2);
-			snprintf(tempstring2, sizeof(tempstring2), "%s(%s)", tempstring, tempstring3);
+			DEBUGPRINT_NA(DEBUG_showinfo, "try to get additional information");
+			r = libipv6calc_db_wrapper_info_by_ipv6addr(ipv6addrp, tempstring3, sizeof(tempstring3));
+			if (r == 0) {
+				// info found, append to registry
+				snprintf(tempstring, sizeof(tempstring), "%s", tempstring2);
+				snprintf(tempstring2, sizeof(tempstring2), "%s(%s)", tempstring, tempstring3);
+			};
 		};
-	};
 
-	if ( machinereadable != 0 ) {
-		printout("IPV6_REGISTRY", tempstring2, formatoptions);
-	} else {
-		fprintf(stdout, "Registry for address: %s\n", tempstring2);
+		if ( machinereadable != 0 ) {
+			printout("IPV6_REGISTRY", tempstring2, formatoptions);
+		} else {
+			fprintf(stdout, "Registry for address: %s\n", tempstring2);
+		};
 	};
 
 
@@ -1343,10 +1646,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 				fprintf(stdout, "Address type is 6to4 and included IPv4 address is: %s\n", helpstring);
 			};
 
-			/* get registry string */
-			retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
+			/* get registry string (machine readable output contains registry of embedded IPv4 address already) */
 			if ( machinereadable != 0 ) {
 			} else {
+				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
 				fprintf(stdout, "IPv4 registry of 6to4 address: %s\n", helpstring);
 			};
 		};
@@ -1381,11 +1684,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 					fprintf(stdout, "Address type is Teredo and included IPv4 server address is: %s and client port: %u\n", helpstring, (unsigned int) port);
 				};
 
-				/* get registry string */
-				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr2, helpstring, sizeof(helpstring));
-				
+				/* get registry string (machine readable output contains registry of embedded IPv4 address already) */
 				if ( machinereadable != 0 ) {
 				} else {
+					retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr2, helpstring, sizeof(helpstring));
 					fprintf(stdout, "IPv4 registry of Teredo server address: %s\n", helpstring);
 				};
 			};
@@ -1411,10 +1713,10 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 				fprintf(stdout, "Address type is IPv6 Rapid Deployment and included IPv4 address is: %s\n", helpstring);
 			};
 
-			/* get registry string */
-			retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
+			/* get registry string (machine readable output contains registry of embedded IPv4 address already) */
 			if ( machinereadable != 0 ) {
 			} else {
+				retval = libipv6calc_db_wrapper_registry_string_by_ipv4addr(&ipv4addr, helpstring, sizeof(helpstring));
 				fprintf(stdout, "IPv4 registry of IPv6 Rapid Deployment address: %s\n", helpstring);
 			};
 		};
@@ -1662,49 +1964,53 @@ int showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp1, const uint32_t format
 	};
 END:
 
-	i = libipv6calc_db_wrapper_registry_num_by_ipv6addr(ipv6addrp);
-	if ((i != IPV6_ADDR_REGISTRY_RESERVED) && (i != IPV6_ADDR_REGISTRY_6BONE)) {
-		if (((ipv6addrp->typeinfo & IPV6_NEW_ADDR_AGU) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID | IPV6_ADDR_ANONYMIZED_PREFIX)) == 0)) {
+	/* geolocation provider records */
+	if (SHOWINFO_FIELD_SELECTED(formatoptions, SHOWINFO_FIELD_GEO)) {
+		i = libipv6calc_db_wrapper_registry_num_by_ipv6addr(ipv6addrp);
+		if ((i != IPV6_ADDR_REGISTRY_RESERVED) && (i != IPV6_ADDR_REGISTRY_6BONE)) {
+			if (((ipv6addrp->typeinfo & IPV6_NEW_ADDR_AGU) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID | IPV6_ADDR_ANONYMIZED_PREFIX)) == 0)) {
 
-			if (((ipv6addrp->typeinfo2 & IPV6_ADDR_TYPE2_ANON_MASKED_PREFIX) != 0)\
-				&& (ipv6addrp->prefix2length < 48)\
-				// prefix partially anonymized including NLAs
-			) {
-			} else {
+				if (((ipv6addrp->typeinfo2 & IPV6_ADDR_TYPE2_ANON_MASKED_PREFIX) != 0)\
+					&& (ipv6addrp->prefix2length < 48)\
+					// prefix partially anonymized including NLAs
+				) {
+				} else {
 #ifdef SUPPORT_IP2LOCATION
-			/* IP2Location information */
-			print_ip2location(&ipaddr, formatoptions, "");
+				/* IP2Location information */
+				print_ip2location(&ipaddr, formatoptions, "");
 #endif
 
 #ifdef SUPPORT_GEOIP
-			/* GeoIP information */
-			print_geoip(&ipaddr, formatoptions, "");
+				/* GeoIP information */
+				print_geoip(&ipaddr, formatoptions, "");
 #endif
 
 #ifdef SUPPORT_GEOIP2
-			/* GeoIP (MaxMindDB) information */
-			print_geoip2(&ipaddr, formatoptions, "");
+				/* GeoIP (MaxMindDB) information */
+				print_geoip2(&ipaddr, formatoptions, "");
 #endif
 
 #ifdef SUPPORT_DBIP
-			/* db-ip.com information */
-			print_dbip(&ipaddr, formatoptions, "");
+				/* db-ip.com information */
+				print_dbip(&ipaddr, formatoptions, "");
 #endif
 
 #ifdef SUPPORT_DBIP2
-			/* db-ip.com (MaxMindDB) information */
-			print_dbip2(&ipaddr, formatoptions, "");
+				/* db-ip.com (MaxMindDB) information */
+				print_dbip2(&ipaddr, formatoptions, "");
 #endif
 
 #ifdef SUPPORT_EXTERNAL
-			/* External DB information */
-			print_external(&ipaddr, formatoptions, "");
+				/* External DB information */
+				print_external(&ipaddr, formatoptions, "");
 #endif
-			}; // IPV6_ADDR_TYPE2_ANON_MASKED_PREFIX
+				}; // IPV6_ADDR_TYPE2_ANON_MASKED_PREFIX
+			};
 		};
 	};
 
 	printfooter(formatoptions);
+	printrecordend(formatoptions);
 	retval = 0;
 	return (retval);
 };
@@ -1722,6 +2028,7 @@ int showinfo_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t formato
 	print_ipv4addr(ipv4addrp, formatoptions, "");
 
 	printfooter(formatoptions);
+	printrecordend(formatoptions);
 	retval = 0;
 	return (retval);
 };
@@ -1738,6 +2045,7 @@ int showinfo_eui48(const ipv6calc_macaddr *macaddrp, const uint32_t formatoption
 
 	print_eui48(macaddrp, formatoptions);
 	printfooter(formatoptions);
+	printrecordend(formatoptions);
 
 	retval = 0;
 	return (retval);
@@ -1755,6 +2063,7 @@ int showinfo_eui64(const ipv6calc_eui64addr *eui64addrp, const uint32_t formatop
 
 	print_eui64(eui64addrp, formatoptions);
 	printfooter(formatoptions);
+	printrecordend(formatoptions);
 
 	retval = 0;
 	return (retval);
@@ -1772,6 +2081,7 @@ int showinfo_asn(const uint32_t asn, const uint32_t formatoptions) {
 
 	print_asn(asn, formatoptions);
 	printfooter(formatoptions);
+	printrecordend(formatoptions);
 
 	retval = 0;
 	return (retval);
@@ -97,6 +97,31 @@
 
 #define IPV6CALC_OUTPUT_VERSION	21
 
+/* field groups of machine readable output (--fields|--mrfields) */
+#define SHOWINFO_FIELD_ADDR		0x00001	// address, source, prefix length, SLA
+#define SHOWINFO_FIELD_TYPE		0x00002	// *_TYPE, *_SCOPE
+#define SHOWINFO_FIELD_IID		0x00004	// IID, EUI64_SCOPE
+#define SHOWINFO_FIELD_ANON		0x00008	// *_ANON
+#define SHOWINFO_FIELD_REGISTRY		0x00010	// *_REGISTRY
+#define SHOWINFO_FIELD_AS		0x00020	// *_AS_NUM, *_AS_SOURCE
+#define SHOWINFO_FIELD_CC		0x00040	// *_COUNTRYCODE, *_COUNTRYCODE_SOURCE
+#define SHOWINFO_FIELD_GEONAMEID	0x00080	// *_GEONAME_ID*
+#define SHOWINFO_FIELD_IEEE		0x00100	// OUI
+#define SHOWINFO_FIELD_INFO		0x00200	// *_DATABASE_INFO, IPV6CALC_*
+#define SHOWINFO_FIELD_GEOIP		0x01000	// GEOIP_*
+#define SHOWINFO_FIELD_GEOIP2		0x02000	// GEOIP2_*
+#define SHOWINFO_FIELD_IP2LOCATION	0x04000	// IP2LOCATION_*
+#define SHOWINFO_FIELD_DBIP		0x08000	// DBIP_*
+#define SHOWINFO_FIELD_DBIP2		0x10000	// DBIP2_*
+#define SHOWINFO_FIELD_EXTERNAL		0x20000	// EXTERNAL_*
+#define SHOWINFO_FIELD_GEO		(SHOWINFO_FIELD_GEOIP | SHOWINFO_FIELD_GEOIP2 | SHOWINFO_FIELD_IP2LOCATION | SHOWINFO_FIELD_DBIP | SHOWINFO_FIELD_DBIP2 | SHOWINFO_FIELD_EXTERNAL)
+#define SHOWINFO_FIELD_ALL		0x3f3ff
+
+#define SHOWINFO_FIELD_SELECTED(formatoptions, field)	((((formatoptions) & FORMATOPTION_mr_fields) == 0) || ((showinfo_fields & (field)) != 0))
+
+/* maximum length of one JSON record (--mrjson) */
+#define SHOWINFO_RECORD_MAX	65536
+
 /* prototypes */
 extern int  showinfo_ipv6addr(const ipv6calc_ipv6addr *ipv6addrp, const uint32_t formatoptions);
 extern int  showinfo_ipv4addr(const ipv6calc_ipv4addr *ipv4addrp, const uint32_t formatoptions);
@@ -104,3 +129,6 @@ extern int  showinfo_eui48(const ipv6calc_macaddr *macaddrp, const uint32_t form
 extern int  showinfo_eui64(const ipv6calc_eui64addr *eui64addrp, const uint32_t formatoptions);
 extern int  showinfo_asn(const uint32_t asn, const uint32_t formatoptions);
 extern void showinfo_availabletypes(void);
+extern int  showinfo_fields_parse(const char *list, uint32_t *fields_p);
+
+extern uint32_t showinfo_fields;
@@ -610,6 +610,28 @@ done || exit 1
 echo "INFO  : $test successful"
 
 
+test="run 'ipv6calc' input autodetection tests (same result as given input type)"
+echo "INFO  : $test"
+testscenarios_auto_good | while read input type; do
+	info="INFO  : test './ipv6calc -q -i -m \"$input\"' vs. './ipv6calc --in $type -q -i -m \"$input\"'"
+	[ "$verbose" = "1" ] && echo "$info"
+	output_auto="$(./ipv6calc -q -i -m "$input" 2>&1)"
+	output_type="$(./ipv6calc --in $type -q -i -m "$input" 2>&1)"
+	if [ "$output_auto" != "$output_type" ]; then
+		[ "$verbose" = "1" ] || echo "$info"
+		echo "Result not matching!"
+		echo "autodetected input type:"
+		echo "$output_auto"
+		echo "given input type:"
+		echo "$output_type"
+		exit 1
+	fi
+	[ "$verbose" = "1" ] || echo -n "."
+done || exit 1
+[ "$verbose" = "1" ] || echo
+echo "INFO  : $test successful"
+
+
 test="run 'ipv6calc' pipe tests (1)"
 echo "INFO  : $test"
 testscenarios_pipe | while IFS="," read input arguments result; do
@@ -0,0 +1,286 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_aggregate.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc action 'aggregate'
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+dir="`mktemp -d /tmp/ipv6calc-aggregate-test.XXXXXX`"
+trap 'rm -rf "$dir"' EXIT
+
+# input=expected output (space separated)
+testscenarios_aggregate() {
+	cat <<END | grep -v "^#"
+192.0.2.0/25 192.0.2.128/25=192.0.2.0/24
+192.0.2.1 192.0.2.2 192.0.2.3 192.0.2.4=192.0.2.1/32 192.0.2.2/31 192.0.2.4/32
+192.0.2.0/24 192.0.2.77 192.0.2.64/26=192.0.2.0/24
+10.0.0.0/9 10.128.0.0/9 11.0.0.0/8=10.0.0.0/7
+10.0.0.7/24=10.0.0.0/24
+0.0.0.0/1 128.0.0.0/1=0.0.0.0/0
+255.255.255.254 255.255.255.255 255.255.255.252/31=255.255.255.252/30
+0.0.0.1 255.255.255.255=0.0.0.1/32 255.255.255.255/32
+2001:db8::/33 2001:db8:8000::/33=2001:db8::/32
+2001:db8::1 2001:db8::2 2001:db8::3=2001:db8::1/128 2001:db8::2/127
+2001:db8::/32 2001:db8:1::/48 2001:db9::/32=2001:db8::/31
+::/1 8000::/1=::/0
+ffff:ffff:ffff:ffff:ffff:ffff:ffff:fffe ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff=ffff:ffff:ffff:ffff:ffff:ffff:ffff:fffe/127
+2001:db8::/64 10.0.0.0/8 2001:db8:0:1::/64=10.0.0.0/8 2001:db8::/63
+END
+}
+
+test="run 'ipv6calc' aggregate tests..."
+echo "INFO  : $test"
+
+testscenarios_aggregate | while IFS="=" read input expected; do
+	[ "$verbose" = "1" ] && echo "INFO  : test: $input"
+	if ! ./ipv6calc -A aggregate $input >"$dir/result"; then
+		echo "ERROR : exit code <> 0 for: $input"
+		exit 1
+	fi
+	result="`tr '\n' ' ' <"$dir/result" | sed 's/ $//'`"
+	if [ "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result for: $input"
+		echo "ERROR : expected: $expected"
+		echo "ERROR : result  : $result"
+		exit 1
+	fi
+
+	# same result in pipe mode
+	result="`echo "$input" | tr ' ' '\n' | ./ipv6calc -A aggregate | tr '\n' ' ' | sed 's/ $//'`"
+	if [ "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result in pipe mode for: $input"
+		echo "ERROR : expected: $expected"
+		echo "ERROR : result  : $result"
+		exit 1
+	fi
+done || exit 1
+
+[ "$verbose" = "1" ] && echo "INFO  : check list with gap in reverse order, comments and empty lines"
+{
+	echo "# list with a gap at 10.1.2.7"
+	echo ""
+	awk 'BEGIN { for (i = 1023; i >= 0; i--) { if (i != 519) { printf "10.1.%d.%d # entry %d\n", int(i / 256), i % 256, i } } }'
+} >"$dir/input"
+cat <<END >"$dir/expected"
+10.1.0.0/23
+10.1.2.0/30
+10.1.2.4/31
+10.1.2.6/32
+10.1.2.8/29
+10.1.2.16/28
+10.1.2.32/27
+10.1.2.64/26
+10.1.2.128/25
+10.1.3.0/24
+END
+if ! ./ipv6calc -A aggregate <"$dir/input" >"$dir/result"; then
+	echo "ERROR : aggregation of list failed"
+	exit 1
+fi
+if ! cmp -s "$dir/expected" "$dir/result"; then
+	echo "ERROR : unexpected result of list aggregation"
+	[ "$verbose" = "1" ] && diff -u "$dir/expected" "$dir/result"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check result of pseudo-random list is stable on aggregation"
+awk 'BEGIN { srand(48); for (i = 0; i < 5000; i++) { if (i % 3) { printf "%d.%d.%d.%d/%d\n", 10 + int(rand() * 2), int(rand() * 4), int(rand() * 256), int(rand() * 256), 22 + int(rand() * 11) } else { printf "2001:db8:%x:%x::/%d\n", int(rand() * 4), int(rand() * 65536), 48 + int(rand() * 17) } } }' >"$dir/input"
+if ! ./ipv6calc -A aggregate <"$dir/input" >"$dir/result"; then
+	echo "ERROR : aggregation of pseudo-random list failed"
+	exit 1
+fi
+if ! ./ipv6calc -A aggregate <"$dir/result" >"$dir/result2"; then
+	echo "ERROR : aggregation of result failed"
+	exit 1
+fi
+if ! cmp -s "$dir/result" "$dir/result2"; then
+	echo "ERROR : aggregation of result is not stable"
+	[ "$verbose" = "1" ] && diff -u "$dir/result" "$dir/result2"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check stop on invalid input (nothing printed)"
+output="`printf '10.0.0.0/8\ninvalid-input\n' | ./ipv6calc -A aggregate 2>/dev/null`"
+if [ $? -eq 0 ]; then
+	echo "ERROR : aggregate didn't fail on invalid input"
+	exit 1
+fi
+if [ -n "$output" ]; then
+	echo "ERROR : aggregate printed result on invalid input"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check prefix list operations"
+cat <<END >"$dir/list1"
+# allocations
+10.0.0.0/8
+192.0.2.0/24
+198.51.100.0/24
+2001:db8::/32
+END
+cat <<END >"$dir/list2"
+# routes
+10.0.0.0/9
+10.128.0.0/10
+192.0.2.128/25
+203.0.113.0/24
+2001:db8:8000::/33
+2001:db9::/32
+END
+for operation in union intersection difference; do
+	case $operation in
+	    union)
+		expected="10.0.0.0/8 192.0.2.0/24 198.51.100.0/24 203.0.113.0/24 2001:db8::/31"
+		;;
+	    intersection)
+		expected="10.0.0.0/9 10.128.0.0/10 192.0.2.128/25 2001:db8:8000::/33"
+		;;
+	    difference)
+		expected="10.192.0.0/10 192.0.2.0/25 198.51.100.0/24 2001:db8::/33"
+		;;
+	esac
+
+	[ "$verbose" = "1" ] && echo "INFO  : test: $operation"
+	if ! ./ipv6calc -A $operation "$dir/list1" "$dir/list2" >"$dir/result"; then
+		echo "ERROR : exit code <> 0 for: $operation"
+		exit 1
+	fi
+	result="`tr '\n' ' ' <"$dir/result" | sed 's/ $//'`"
+	if [ "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result for: $operation"
+		echo "ERROR : expected: $expected"
+		echo "ERROR : result  : $result"
+		exit 1
+	fi
+
+	# second list from stdin
+	result="`./ipv6calc -A $operation "$dir/list1" - <"$dir/list2" | tr '\n' ' ' | sed 's/ $//'`"
+	if [ "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result with stdin for: $operation"
+		echo "ERROR : expected: $expected"
+		echo "ERROR : result  : $result"
+		exit 1
+	fi
+done
+
+[ "$verbose" = "1" ] && echo "INFO  : check prefix list operations are consistent on pseudo-random lists"
+awk 'BEGIN { srand(49); for (i = 0; i < 3000; i++) { if (i % 3) { printf "10.%d.%d.%d/%d\n", int(rand() * 4), int(rand() * 256), int(rand() * 256), 24 + int(rand() * 9) } else { printf "2001:db8:%x:%x::/%d\n", int(rand() * 4), int(rand() * 65536), 46 + int(rand() * 19) } } }' >"$dir/list1"
+awk 'BEGIN { srand(50); for (i = 0; i < 3000; i++) { if (i % 3) { printf "10.%d.%d.%d/%d\n", int(rand() * 4), int(rand() * 256), int(rand() * 256), 24 + int(rand() * 9) } else { printf "2001:db8:%x:%x::/%d\n", int(rand() * 4), int(rand() * 65536), 46 + int(rand() * 19) } } }' >"$dir/list2"
+for operation in union intersection difference; do
+	if ! ./ipv6calc -A $operation "$dir/list1" "$dir/list2" >"$dir/$operation"; then
+		echo "ERROR : exit code <> 0 for: $operation of pseudo-random lists"
+		exit 1
+	fi
+done
+# (list1 - list2) + (list1 & list2) = list1
+cat "$dir/difference" "$dir/intersection" | ./ipv6calc -A aggregate >"$dir/result"
+./ipv6calc -A aggregate <"$dir/list1" >"$dir/expected"
+if ! cmp -s "$dir/expected" "$dir/result"; then
+	echo "ERROR : difference and intersection don't cover first list"
+	exit 1
+fi
+# (list1 - list2) & list2 = empty
+if [ -n "`./ipv6calc -A intersection "$dir/difference" "$dir/list2"`" ]; then
+	echo "ERROR : difference overlaps second list"
+	exit 1
+fi
+# list1 + list2 = aggregate of both
+cat "$dir/list1" "$dir/list2" | ./ipv6calc -A aggregate >"$dir/expected"
+if ! cmp -s "$dir/expected" "$dir/union"; then
+	echo "ERROR : union differs from aggregate of both lists"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check range/prefix conversion"
+# action|input|expected output (space separated)
+cat <<END | while IFS="|" read action input expected; do
+range2prefix|192.0.2.1 - 192.0.2.6|192.0.2.1/32 192.0.2.2/31 192.0.2.4/31 192.0.2.6/32
+range2prefix|10.0.0.0-10.255.255.255|10.0.0.0/8
+range2prefix|0.0.0.0 255.255.255.255|0.0.0.0/0
+range2prefix|255.255.255.255 - 255.255.255.255|255.255.255.255/32
+range2prefix|2001:db8:: - 2001:db8:1::ffff|2001:db8::/48 2001:db8:1::/112
+range2prefix|:: - ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff|::/0
+range2prefix|2001:db8::1 - 2001:db8::2|2001:db8::1/128 2001:db8::2/128
+prefix2range|192.0.2.77/24|192.0.2.0 - 192.0.2.255
+prefix2range|192.0.2.77|192.0.2.77 - 192.0.2.77
+prefix2range|0.0.0.0/0|0.0.0.0 - 255.255.255.255
+prefix2range|2001:db8::/33|2001:db8:: - 2001:db8:7fff:ffff:ffff:ffff:ffff:ffff
+prefix2range|::/0|:: - ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff
+END
+	[ "$verbose" = "1" ] && echo "INFO  : test: $action $input"
+	result="`echo "$input" | ./ipv6calc -A $action | tr '\n' ' ' | sed 's/ $//'`"
+	if [ "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result for: $action $input"
+		echo "ERROR : expected: $expected"
+		echo "ERROR : result  : $result"
+		exit 1
+	fi
+	if [ "$action" = "range2prefix" ]; then
+		result="`./ipv6calc -A $action $input | tr '\n' ' ' | sed 's/ $//'`"
+		if [ "$result" != "$expected" ]; then
+			echo "ERROR : unexpected result with arguments for: $action $input"
+			echo "ERROR : expected: $expected"
+			echo "ERROR : result  : $result"
+			exit 1
+		fi
+	fi
+done || exit 1
+
+[ "$verbose" = "1" ] && echo "INFO  : check range/prefix conversion round trip on pseudo-random list"
+if ! ./ipv6calc -A prefix2range <"$dir/list1" >"$dir/ranges"; then
+	echo "ERROR : prefix2range of pseudo-random list failed"
+	exit 1
+fi
+if ! ./ipv6calc -A range2prefix <"$dir/ranges" >"$dir/prefixes"; then
+	echo "ERROR : range2prefix of pseudo-random list failed"
+	exit 1
+fi
+if [ "`wc -l <"$dir/list1"`" -ne "`wc -l <"$dir/prefixes"`" ]; then
+	echo "ERROR : prefix2range/range2prefix round trip changed number of prefixes"
+	exit 1
+fi
+./ipv6calc -A aggregate <"$dir/list1" >"$dir/expected"
+./ipv6calc -A aggregate <"$dir/prefixes" >"$dir/result"
+if ! cmp -s "$dir/expected" "$dir/result"; then
+	echo "ERROR : prefix2range/range2prefix round trip changed prefixes"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check range conversion stops on invalid range"
+for input in "10.0.0.5 - 10.0.0.1" "10.0.0.1 - ::1" "10.0.0.0/8 - 10.0.0.1" "10.0.0.1"; do
+	if echo "$input" | ./ipv6calc -A range2prefix >/dev/null 2>&1; then
+		echo "ERROR : range2prefix didn't fail on: $input"
+		exit 1
+	fi
+done
+
+[ "$verbose" = "1" ] && echo "INFO  : check prefix list operations fail on missing file"
+if ./ipv6calc -A union "$dir/list1" "$dir/missing" >/dev/null 2>&1; then
+	echo "ERROR : union didn't fail on missing file"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
@@ -0,0 +1,115 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_builtin_ipv4_packed.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc built-in IPv4 registry lookup (packed table has to match reference tables)
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+
+header="../databases/ipv4-assignment/dbipv4addr_assignment.h"
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+if [ ! -f "$header" ]; then
+	echo "Header file '$header' missing"
+	exit 1
+fi
+
+if ! ./ipv6calc -v 2>&1 | grep -qw "DB_IPV4_REG"; then
+	echo "NOTICE: 'ipv6calc' has no built-in IPv4 registry database compiled in - skip test"
+	exit 0
+fi
+
+# bypass a merged database (if supported), it could shadow the built-in tables
+options_merged=""
+if ./ipv6calc -v 2>&1 | grep -qw "Merged"; then
+	options_merged="--db-merged-disable"
+fi
+
+dir="`mktemp -d /tmp/ipv6calc-builtin-ipv4-packed-test.XXXXXX`"
+trap 'rm -rf "$dir"' EXIT
+
+test="run 'ipv6calc' built-in IPv4 packed registry table tests..."
+echo "INFO  : $test"
+
+# addresses at range boundaries with expected registry out of reference tables (assignment, fallback IANA)
+perl -e '
+	my %tables;
+	my $table;
+	while (<>) {
+		if (/^static const s_ipv4addr_assignment (\w+)\[\] = \{/) { $table = $1; $tables{$table} = []; next; };
+		if (defined $table && /^\};/) { undef $table; next; };
+		if (defined $table && /^\s*\{ 0x([0-9a-f]{8}), 0x([0-9a-f]{8}), REGISTRY_(\w+)\s*\}/) {
+			push @{$tables{$table}}, [ hex($1), hex($2), $3 ];
+		};
+	};
+	die "reference tables not found" if (! defined $tables{"dbipv4addr_assignment"} || ! defined $tables{"dbipv4addr_assignment_iana"});
+
+	my %addrs;
+	for my $name (keys %tables) {
+		for my $entry (@{$tables{$name}}) {
+			for my $ipv4 ($$entry[0] - 1, $$entry[0], $$entry[1], $$entry[1] + 1) {
+				# 240.0.0.0/4 is decoded as anonymized address
+				$addrs{$ipv4} = 1 if ($ipv4 >= 0 && $ipv4 < 0xf0000000);
+			};
+		};
+	};
+
+	sub lookup($$) {
+		my ($list, $ipv4) = @_;
+		my ($min, $max) = (0, scalar(@$list) - 1);
+		while ($min <= $max) {
+			my $i = int(($min + $max) / 2);
+			if ($$list[$i]->[1] < $ipv4) { $min = $i + 1; } elsif ($$list[$i]->[0] > $ipv4) { $max = $i - 1; } else { return $$list[$i]->[2]; };
+		};
+		return undef;
+	};
+
+	for my $ipv4 (sort { $a <=> $b } keys %addrs) {
+		my $registry = lookup($tables{"dbipv4addr_assignment"}, $ipv4);
+		$registry = lookup($tables{"dbipv4addr_assignment_iana"}, $ipv4) if (! defined $registry || $registry eq "UNKNOWN");
+		$registry = "UNKNOWN" if (! defined $registry);
+		printf "%d.%d.%d.%d %s\n", $ipv4 >> 24, ($ipv4 >> 16) & 0xff, ($ipv4 >> 8) & 0xff, $ipv4 & 0xff, $registry;
+	};
+' "$header" >"$dir/expected" || exit 1
+
+[ "$verbose" = "1" ] && echo "INFO  : compare registry of `wc -l <"$dir/expected"` addresses with reference tables"
+
+if ! cut -d ' ' -f 1 "$dir/expected" | ./ipv6calc -q -m -i $options_merged 2>/dev/null | awk -F= '$1 == "IPV4" { addr = $2 } $1 == "IPV4_REGISTRY" { sub(/\(.*/, "", $2); print addr " " $2 }' >"$dir/result"; then
+	echo "ERROR : lookup of addresses failed"
+	exit 1
+fi
+
+if [ "`wc -l <"$dir/expected"`" -ne "`wc -l <"$dir/result"`" ]; then
+	echo "ERROR : number of results differs from number of addresses"
+	exit 1
+fi
+
+# reserved ranges are handled before database lookup, registry info is stripped
+if ! paste -d ' ' "$dir/expected" "$dir/result" | awk '$1 != $3 || ($4 !~ /^reserved/ && $2 != $4) { print; err = 1 } END { exit err }' >"$dir/diff"; then
+	echo "ERROR : result of packed table differs from reference tables"
+	[ "$verbose" = "1" ] && head -20 "$dir/diff"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
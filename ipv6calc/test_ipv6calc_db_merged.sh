@@ -0,0 +1,182 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_db_merged.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc merged database (creation and lookup)
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+if ! ./ipv6calc -v 2>&1 | grep -qw "Merged"; then
+	echo "NOTICE: support for Merged database not compiled-in, skip tests"
+	exit 0
+fi
+
+merged_create="../databases/tools/ipv6calc-db-merged-create"
+if [ ! -x "$merged_create" ]; then
+	echo "Binary '$merged_create' missing or not executable"
+	exit 1
+fi
+
+reload_test="../databases/tools/test_ipv6calc_db_reload"
+if [ ! -x "$reload_test" ]; then
+	echo "Binary '$reload_test' missing or not executable"
+	exit 1
+fi
+
+dir="`mktemp -d /tmp/ipv6calc-merged-test.XXXXXX`"
+trap 'rm -rf "$dir"' EXIT
+
+# $1: 4 or 6 (pipe mode requires same address type on all lines)
+testscenarios_merged() {
+	if [ "$1" = "4" ]; then
+		cat <<END | grep -v "^#"
+1.2.3.4
+8.8.8.8
+193.0.0.1
+200.1.2.3
+41.1.2.3
+10.1.2.3
+END
+		# pseudo-random addresses
+		awk 'BEGIN { srand(31); for (i = 0; i < 200; i++) { printf "%d.%d.%d.%d\n", 1 + int(rand() * 223), int(rand() * 256), int(rand() * 256), int(rand() * 256); } }'
+	else
+		cat <<END | grep -v "^#"
+2001:db8::1
+2a01::1
+2001:4860::1
+2c0f:f000::1
+2400::1
+2800::1
+3ffe:ffff::1
+2002:0808:0808::1
+END
+		# pseudo-random global addresses
+		awk 'BEGIN { srand(31); for (i = 0; i < 200; i++) { printf "%x:%x::1\n", 8192 + int(rand() * 8192), int(rand() * 65536); } }'
+	fi
+}
+
+# filter lines depending on used database
+filter_output() {
+	grep -v -E "^(IPV6CALC_CAPABILITIES|[A-Z0-9]+_DATABASE_INFO)="
+}
+
+test="run 'ipv6calc' merged database tests..."
+echo "INFO  : $test"
+
+[ "$verbose" = "1" ] && echo "INFO  : create merged database: $dir/ipv6calc-merged.db"
+if ! $merged_create -q "$dir/ipv6calc-merged.db"; then
+	echo "ERROR : creation of merged database failed"
+	exit 1
+fi
+
+for proto in 4 6; do
+	[ "$verbose" = "1" ] && echo "INFO  : compare showinfo for IPv$proto addresses"
+	output_merged="`testscenarios_merged $proto | ./ipv6calc -m -i -q --db-merged-dir "$dir"`"
+	if ! echo "$output_merged" | grep -q "^MERGED_DATABASE_INFO="; then
+		echo "ERROR : merged database not used for IPv$proto"
+		exit 1
+	fi
+
+	output_merged="`echo "$output_merged" | filter_output`"
+	output_sources="`testscenarios_merged $proto | ./ipv6calc -m -i -q --db-merged-disable | filter_output`"
+	if [ "$output_merged" != "$output_sources" ]; then
+		echo "ERROR : result of showinfo with merged database differs from sources for IPv$proto"
+		[ "$verbose" = "1" ] && echo "$output_sources" >"$dir/sources" && echo "$output_merged" >"$dir/merged" && diff -u "$dir/sources" "$dir/merged"
+		exit 1
+	fi
+done
+
+# database priorization differing from creation must not change results
+priorization="BuiltIn:DBIP2:GeoIP2"
+if ! ./ipv6calc -q --db-priorization "$priorization" 8.8.8.8 >/dev/null 2>&1; then
+	echo "NOTICE: database priorization not supported, skip merged database priorization tests"
+else
+	[ "$verbose" = "1" ] && echo "INFO  : check merged database with database priorization: $priorization"
+	for proto in 4 6; do
+		output_merged="`testscenarios_merged $proto | ./ipv6calc -m -i -q --db-merged-dir "$dir" --db-priorization "$priorization"`" || exit 1
+		output_sources="`testscenarios_merged $proto | ./ipv6calc -m -i -q --db-merged-disable --db-priorization "$priorization"`" || exit 1
+		if [ "`echo "$output_merged" | filter_output`" != "`echo "$output_sources" | filter_output`" ]; then
+			echo "ERROR : result of showinfo with merged database differs from sources for IPv$proto with database priorization: $priorization"
+			exit 1
+		fi
+	done
+fi
+
+# merged database created with different priorization must not be used
+#  patch source order of all features (header offset 56, 32 x uint32) to BuiltIn before GeoIP2
+[ "$verbose" = "1" ] && echo "INFO  : check merged database created with different priorization"
+cp "$dir/ipv6calc-merged.db" "$dir/ipv6calc-merged.db.orig"
+if [ "`dd if="$dir/ipv6calc-merged.db" bs=1 skip=20 count=1 2>/dev/null | od -An -tx1 | tr -d ' '`" = "04" ]; then
+	offset=56	# little endian
+else
+	offset=59	# big endian
+fi
+for f in 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31; do
+	printf '\027' | dd of="$dir/ipv6calc-merged.db" bs=1 seek=`expr $offset + $f \* 4` conv=notrunc 2>/dev/null
+done
+output="`./ipv6calc -m -i --db-merged-dir "$dir" 8.8.8.8 2>&1 >/dev/null`"
+if ! echo "$output" | grep -q "Merged database not used for .* (created with different database priorization)"; then
+	echo "ERROR : merged database created with different priorization used"
+	[ "$verbose" = "1" ] && echo "$output"
+	exit 1
+fi
+if [ "`./ipv6calc -m -i -q --db-merged-dir "$dir" 8.8.8.8 | filter_output`" != "`./ipv6calc -m -i -q --db-merged-disable 8.8.8.8 | filter_output`" ]; then
+	echo "ERROR : result of showinfo with merged database created with different priorization differs from sources"
+	exit 1
+fi
+mv "$dir/ipv6calc-merged.db.orig" "$dir/ipv6calc-merged.db"
+
+# replaced database has to be reloaded by long running pipe
+[ "$verbose" = "1" ] && echo "INFO  : check reload of replaced merged database"
+output="`(echo 8.8.8.8; sleep 2; cp "$dir/ipv6calc-merged.db" "$dir/ipv6calc-merged.db.new"; mv "$dir/ipv6calc-merged.db.new" "$dir/ipv6calc-merged.db"; echo 8.8.4.4) | ./ipv6calc -m -i --db-merged-dir "$dir" --db-reload-interval 1 2>&1 >/dev/null`"
+if ! echo "$output" | grep -q "^Reloaded database files: 1$"; then
+	echo "ERROR : replaced merged database not reloaded"
+	[ "$verbose" = "1" ] && echo "$output"
+	exit 1
+fi
+
+# replaced database has to be reloaded while lookups are running in threads
+[ "$verbose" = "1" ] && echo "INFO  : check reload of replaced merged database while lookups are running"
+if ! output="`$reload_test -q --db-merged-dir "$dir" 2>&1`"; then
+	echo "ERROR : reload of merged database while lookups are running failed"
+	echo "$output"
+	exit 1
+fi
+[ "$verbose" = "1" ] && echo "$output"
+
+# broken database has to be ignored
+head -c 1000 "$dir/ipv6calc-merged.db" >"$dir/ipv6calc-merged.db.broken"
+mv "$dir/ipv6calc-merged.db.broken" "$dir/ipv6calc-merged.db"
+output="`./ipv6calc -m -i -q --db-merged-dir "$dir" 8.8.8.8 2>/dev/null`"
+if echo "$output" | grep -q "^MERGED_DATABASE_INFO="; then
+	echo "ERROR : broken merged database used"
+	exit 1
+fi
+if [ "`echo "$output" | filter_output`" != "`./ipv6calc -m -i -q --db-merged-disable 8.8.8.8 2>/dev/null | filter_output`" ]; then
+	echo "ERROR : result of showinfo with broken merged database differs from sources"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
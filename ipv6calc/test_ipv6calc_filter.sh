@@ -87,6 +87,56 @@ if [ $? -ne 0 ]; then
 	exit 1
 fi
 
+test="run 'ipv6calc' filter file tests..."
+echo "INFO  : $test"
+
+filterfile=$(mktemp) || exit 1
+trap "rm -f $filterfile" EXIT
+
+# large list of prefixes: 10.<i>.<j>.0/24 and 2001:db8:<i>:<j>::/64 for even j, negated subnets inside
+{
+	echo "# filter file test"
+	for i in $(seq 0 15); do
+		for j in $(seq 0 2 254); do
+			echo "10.$i.$j.0/24"
+			printf "2001:db8:%x:%x::/64\n" $i $j
+		done
+		echo "^10.$i.100.128/25"
+		printf "^2001:db8:%x:64::/96\n" $i
+	done
+	echo "192.0.2.1"
+	echo "^2001:db8:f:2::1"
+} >$filterfile
+
+input="10.0.0.1 10.15.254.1 10.3.100.1 192.0.2.1 2001:db8::1 2001:db8:f:fe::1 2001:db8:3:64:1::1 2001:db8:f:2::2"
+input="$input 10.0.1.1 10.16.0.1 10.3.100.129 192.0.2.2 2001:db8:0:1::1 2001:db8:10::1 2001:db8:3:64::1 2001:db8:f:2::1"
+expected="10.0.0.1 10.15.254.1 10.3.100.1 192.0.2.1 2001:db8::1 2001:db8:f:fe::1 2001:db8:3:64:1::1 2001:db8:f:2::2"
+
+output="`echo $input | tr ' ' '\n' | ./ipv6calc -A filter --filter-file $filterfile | tr '\n' ' '`"
+if [ "$output" != "$expected " ]; then
+	echo "ERROR : filter file result not matching"
+	echo "ERROR : result  : $output"
+	echo "ERROR : expected: $expected"
+	exit 1
+fi
+
+# combination with filter expression: must-have entries are or'ed, may-not-have entries from file still apply
+output="`echo $input | tr ' ' '\n' | ./ipv6calc -A filter --filter-file $filterfile -E ipv4.addr=lt=10.4.0.0,ipv6.addr=gt=2001:db8:f:: | tr '\n' ' '`"
+if [ "$output" != "$expected 10.0.1.1 2001:db8:10::1 " ]; then
+	echo "ERROR : filter file combined with expression result not matching: $output"
+	exit 1
+fi
+
+# invalid entry has to be detected
+echo "2001:db8::/32 invalid" >$filterfile
+echo "2001:db8::1" | ./ipv6calc -A filter --filter-file $filterfile >/dev/null 2>&1
+if [ $? -eq 0 ]; then
+	echo "ERROR : invalid entry in filter file not detected"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
+
 test="run 'ipv6calc' test_prefix tests..."
 echo "INFO  : $test"
 
@@ -0,0 +1,222 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_server.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc server mode (Unix domain socket)
+#  and optional local client benchmark: -B [-n <count>]
+
+verbose=0
+benchmark=0
+count=1000
+while getopts "VBn:h\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    B)
+		benchmark=1
+		;;
+	    n)
+		count=$OPTARG
+		;;
+	    *)
+		echo "$0 [-V] [-B [-n <count>]]"
+		echo "    -V           verbose"
+		echo "    -B           run local client benchmark (server vs. binary call)"
+		echo "    -n <count>   number of queries for benchmark (default: $count)"
+		exit 1
+		;;
+	esac
+done
+
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+if ! perl -MIO::Socket::UNIX -MTime::HiRes -e '1' 2>/dev/null; then
+	echo "NOTICE: skip server tests, required Perl modules missing: IO::Socket::UNIX Time::HiRes"
+	exit 0
+fi
+
+socket="`mktemp -u /tmp/ipv6calc-server-test.XXXXXX`"
+server_pid=""
+
+# query server
+#  $1: socket
+#  $2: mode: single (one connection per query) or session (one connection for all queries)
+#  stdin: queries, one per line
+#  stdout: answers, each terminated by an empty line
+server_query() {
+	perl -MIO::Socket::UNIX -e '
+		my ($socket, $mode) = @ARGV;
+		my $conn;
+		while (my $query = <STDIN>) {
+			if ((! defined $conn) || ($mode eq "single")) {
+				$conn = IO::Socket::UNIX->new(Type => SOCK_STREAM(), Peer => $socket) || die "connect: $!";
+			};
+			print $conn $query;
+			$conn->flush();
+			shutdown($conn, 1) if ($mode eq "single");
+			while (my $line = <$conn>) {
+				print $line;
+				last if ($line eq "\n");
+			};
+			undef $conn if ($mode eq "single");
+		};
+	' "$@"
+}
+
+server_start() {
+	./ipv6calc "$@" --server $socket &
+	server_pid=$!
+	for i in 1 2 3 4 5 6 7 8 9 10; do
+		[ -S "$socket" ] && return 0
+		sleep 0.2
+	done
+	echo "ERROR : server not started: ./ipv6calc $*"
+	return 1
+}
+
+server_stop() {
+	[ -z "$server_pid" ] && return 0
+	kill -TERM $server_pid
+	wait $server_pid
+	rc=$?
+	server_pid=""
+	if [ -e "$socket" ]; then
+		echo "ERROR : server socket not removed: $socket"
+		return 1
+	fi
+	return $rc
+}
+
+trap 'server_stop >/dev/null 2>&1' EXIT
+
+testscenarios_server() {
+	cat <<END | grep -v "^#"
+2001:db8::1
+3ffe:ffff::1
+1.2.3.4
+::1
+10.1.2.3
+2002:0102:0304::1
+00:11:22:33:44:55
+END
+}
+
+test="run 'ipv6calc' server tests..."
+echo "INFO  : $test"
+
+server_start -m -i -q || exit 1
+
+# note: like in pipe mode, *_DATABASE_INFO is cumulative within a session
+for mode in single session; do
+	[ "$verbose" = "1" ] && echo "INFO  : test showinfo server ($mode)"
+	output_server="`testscenarios_server | server_query $socket $mode`"
+	output_direct="`testscenarios_server | while read input; do ./ipv6calc -m -i -q $input; echo; done`"
+	if [ "$mode" = "session" ]; then
+		output_server="`echo "$output_server" | grep -v "_DATABASE_INFO="`"
+		output_direct="`echo "$output_direct" | grep -v "_DATABASE_INFO="`"
+	fi
+	if [ "$output_server" != "$output_direct" ]; then
+		echo "ERROR : result of showinfo server ($mode) differs from direct call"
+		[ "$verbose" = "1" ] && diff -u <(echo "$output_direct") <(echo "$output_server")
+		exit 1
+	fi
+done
+
+# server has to survive a client sending garbage
+echo "not-an-address" | server_query $socket single >/dev/null 2>&1
+output="`echo "2001:db8::1" | server_query $socket single | grep '^IPV6='`"
+if [ "$output" != "IPV6=2001:0db8:0000:0000:0000:0000:0000:0001" ]; then
+	echo "ERROR : showinfo server not answering after invalid query: $output"
+	exit 1
+fi
+
+# finished children must be reaped, more connections than the child limit have to be served
+output="`perl -e 'for (my $i = 0; $i < 64; $i++) { print "2001:db8::1\n"; }' | server_query $socket single | grep -c '^IPV6='`"
+if [ "$output" != "64" ]; then
+	echo "ERROR : showinfo server answered only $output of 64 connections"
+	exit 1
+fi
+
+# an idle client must neither block other clients nor keep its connection forever
+perl -MIO::Socket::UNIX -e '
+	my $conn = IO::Socket::UNIX->new(Type => SOCK_STREAM(), Peer => $ARGV[0]) || die "connect: $!";
+	sleep 5;
+' $socket &
+idle_pid=$!
+sleep 0.5
+start=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+output="`echo "2001:db8::1" | server_query $socket single | grep '^IPV6='`"
+end=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+kill $idle_pid 2>/dev/null
+wait $idle_pid 2>/dev/null
+if [ "$output" != "IPV6=2001:0db8:0000:0000:0000:0000:0000:0001" ]; then
+	echo "ERROR : showinfo server not answering while another client is idle: $output"
+	exit 1
+fi
+if ! echo "$start $end" | awk '{ exit ($2 - $1 < 2) ? 0 : 1 }'; then
+	echo "ERROR : showinfo server blocked by idle client"
+	exit 1
+fi
+
+server_stop || exit 1
+
+server_start -q --server-timeout 1 -A anonymize || exit 1
+output="`perl -MIO::Socket::UNIX -e '
+	my $conn = IO::Socket::UNIX->new(Type => SOCK_STREAM(), Peer => $ARGV[0]) || die "connect: $!";
+	local $SIG{ALRM} = sub { print "no-timeout\n"; exit 0; };
+	alarm 5;
+	my $line = <$conn>;
+	alarm 0;
+	print "closed\n" if (! defined $line);
+' $socket`"
+if [ "$output" != "closed" ]; then
+	echo "ERROR : idle server connection not closed after read timeout: $output"
+	exit 1
+fi
+server_stop || exit 1
+
+server_start -q -A anonymize || exit 1
+output="`echo "2001:db8:1:2:3:4:5:6" | server_query $socket session`"
+output_direct="`echo "2001:db8:1:2:3:4:5:6" | ./ipv6calc -A anonymize; echo`"
+if [ "$output" != "$output_direct" ]; then
+	echo "ERROR : result of anonymize server differs from direct call: $output"
+	exit 1
+fi
+server_stop || exit 1
+
+echo "INFO  : $test successful"
+
+if [ "$benchmark" = "1" ]; then
+	echo "INFO  : run 'ipv6calc' server benchmark with $count queries"
+
+	start=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+	i=0
+	while [ $i -lt $count ]; do
+		./ipv6calc -m -i -q 2001:db8::1 >/dev/null
+		i=$[ $i + 1 ]
+	done
+	end=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+	echo "$start $end $count" | awk '{ printf "INFO  : binary call            : %8.1f queries/s\n", $3 / ($2 - $1) }'
+
+	server_start -m -i -q || exit 1
+
+	for mode in single session; do
+		start=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		perl -e 'for (my $i = 0; $i < $ARGV[0]; $i++) { print "2001:db8::1\n"; }' $count | server_query $socket $mode >/dev/null
+		end=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		echo "$start $end $count $mode" | awk '{ printf "INFO  : server (%-7s)         : %8.1f queries/s\n", $4, $3 / ($2 - $1) }'
+	done
+
+	server_stop || exit 1
+fi
+
+exit 0
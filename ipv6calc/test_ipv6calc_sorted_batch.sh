@@ -0,0 +1,88 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_sorted_batch.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc sorted batch mode (result has to match line-by-line mode)
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+dir="`mktemp -d /tmp/ipv6calc-sorted-batch-test.XXXXXX`"
+trap 'rm -rf "$dir"' EXIT
+
+testscenarios_sorted_batch() {
+	cat <<END | grep -v "^#"
+8.8.8.8
+2001:db8::1
+193.0.0.1
+2a01::1
+8.8.8.8
+10.1.2.3
+2001:4860::1
+c0000201
+2001:db8::1
+1.2.3.4 second-token
+END
+	# pseudo-random mixed addresses including duplicates
+	awk 'BEGIN { srand(33); for (i = 0; i < 2000; i++) { if (i % 3) { printf "%d.%d.%d.%d\n", int(rand() * 224), int(rand() * 4), int(rand() * 256), int(rand() * 256); } else { printf "%x:%x::%x\n", 8192 + int(rand() * 8192), int(rand() * 4), int(rand() * 65536); } } }'
+}
+
+test="run 'ipv6calc' sorted batch mode tests..."
+echo "INFO  : $test"
+
+testscenarios_sorted_batch >"$dir/input"
+
+[ "$verbose" = "1" ] && echo "INFO  : compare addr2cc results of sorted batch mode with line-by-line mode"
+if ! ./ipv6calc -A addr2cc <"$dir/input" >"$dir/line"; then
+	echo "ERROR : line-by-line mode failed"
+	exit 1
+fi
+if ! ./ipv6calc -A addr2cc --sorted-batch <"$dir/input" >"$dir/batch"; then
+	echo "ERROR : sorted batch mode failed"
+	exit 1
+fi
+if ! cmp -s "$dir/line" "$dir/batch"; then
+	echo "ERROR : result of sorted batch mode differs from line-by-line mode"
+	[ "$verbose" = "1" ] && diff -u "$dir/line" "$dir/batch"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check stop on invalid input (lines before have to be printed)"
+output="`printf '8.8.8.8\n2001:db8::1\ninvalid-input\n1.2.3.4\n' | ./ipv6calc -A addr2cc --sorted-batch 2>/dev/null`"
+if [ $? -eq 0 ]; then
+	echo "ERROR : sorted batch mode didn't fail on invalid input"
+	exit 1
+fi
+if [ "`echo "$output" | wc -l`" -ne 2 ]; then
+	echo "ERROR : sorted batch mode didn't print results of lines before invalid input"
+	exit 1
+fi
+
+[ "$verbose" = "1" ] && echo "INFO  : check refusal of unsupported action"
+if echo "8.8.8.8" | ./ipv6calc -A anonymize --sorted-batch >/dev/null 2>&1; then
+	echo "ERROR : sorted batch mode accepted unsupported action"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
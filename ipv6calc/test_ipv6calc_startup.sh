@@ -0,0 +1,101 @@
+#!/bin/sh
+#
+# Project    : ipv6calc
+# File       : test_ipv6calc_startup.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GPLv2
+#
+# Test patterns for ipv6calc startup (lazy database initialization)
+#  and optional startup benchmark: -B [-n <count>]
+
+verbose=0
+benchmark=0
+count=200
+while getopts "VBn:h\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    B)
+		benchmark=1
+		;;
+	    n)
+		count=$OPTARG
+		;;
+	    *)
+		echo "$0 [-V] [-B [-n <count>]]"
+		echo "    -V           verbose"
+		echo "    -B           run startup benchmark"
+		echo "    -n <count>   number of calls for benchmark (default: $count)"
+		exit 1
+		;;
+	esac
+done
+
+
+if [ ! -x ./ipv6calc ]; then
+	echo "Binary './ipv6calc' missing or not executable"
+	exit 1
+fi
+
+testscenarios_startup() {
+	cat <<END | grep -v "^#"
+# input options																	# expected result
+-q --in ipv6addr --out ipv6addr --printuncompressed 2001:db8::1							=2001:db8:0:0:0:0:0:1
+-q --in ipv6addr --out ipv6addr --printfulluncompressed 2001:db8::1						=2001:0db8:0000:0000:0000:0000:0000:0001
+-q --in ipv4addr --out ipv6addr --action conv6to4 1.2.3.4							=2002:102:304::
+-q --in mac --out eui64 00:11:22:33:44:55									=211:22ff:fe33:4455
+-q -A anonymize --anonymize-preset zeroize-standard 2001:db8:1:2:3:4:5:6					=2001:db8:1:0:3:4::
+END
+}
+
+test="run 'ipv6calc' startup tests..."
+echo "INFO  : $test"
+
+testscenarios_startup | while read line; do
+	options="`echo "$line" | awk -F= '{ print $1 }' | sed 's/[\t ]*$//'`"
+	expected="`echo "$line" | awk -F= '{ print $2 }'`"
+	[ "$verbose" = "1" ] && echo "INFO  : test: ./ipv6calc $options"
+	result="`./ipv6calc $options`"
+	if [ $? -ne 0 -o "$result" != "$expected" ]; then
+		echo "ERROR : unexpected result for: ./ipv6calc $options"
+		echo "ERROR : result  : $result"
+		echo "ERROR : expected: $expected"
+		exit 1
+	fi
+done || exit 1
+
+# database usage triggers deferred initialization
+output="`./ipv6calc -m -i -q 2001:db8::1 | grep '^IPV6CALC_FEATURES='`"
+if [ -z "$output" ]; then
+	echo "ERROR : showinfo misses IPV6CALC_FEATURES"
+	exit 1
+fi
+
+# initialization cost is reported in version output
+if ! ./ipv6calc -v 2>&1 | grep -q "^Database initialization cost:"; then
+	echo "ERROR : version output misses database initialization cost"
+	exit 1
+fi
+
+echo "INFO  : $test successful"
+
+if [ "$benchmark" = "1" ]; then
+	echo "INFO  : run 'ipv6calc' startup benchmark with $count calls"
+
+	[ "$verbose" = "1" ] && ./ipv6calc -v 2>&1 | sed -n '/^Database initialization cost:/,/^$/p'
+
+	for options in "-q --in ipv6addr --out ipv6addr --printuncompressed 2001:db8::1" "-q -m -i 2001:db8::1"; do
+		start=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		i=0
+		while [ $i -lt $count ]; do
+			./ipv6calc $options >/dev/null
+			i=$[ $i + 1 ]
+		done
+		end=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		echo "$start $end $count $options" | awk '{ printf "INFO  : %8.3f msec/call: ", ($2 - $1) * 1000 / $3; for (i = 4; i <= NF; i++) printf "%s ", $i; printf "\n" }'
+	done
+fi
+
+exit 0
@@ -9,19 +9,30 @@
 
 verbose=0
 grepopt="-q"
-while getopts "Vh\?" opt; do
+benchmark=0
+count=10000
+while getopts "VBn:h\?" opt; do
 	case $opt in
 	    V)
 		verbose=1
 		grepopt=""
 		;;
+	    B)
+		benchmark=1
+		;;
+	    n)
+		count=$OPTARG
+		;;
 	    *)
-		echo "$0 [-V]"
-		echo "    -V   verbose"
+		echo "$0 [-V] [-B [-n <count>]]"
+		echo "    -V           verbose"
+		echo "    -B           run benchmark of field selection (pipe mode)"
+		echo "    -n <count>   number of addresses for benchmark (default: $count)"
 		exit 1
 		;;
 	esac
 done
+shift $[ $OPTIND - 1 ]
 
 
 source ./test_scenarios.sh
@@ -235,6 +246,67 @@ done || exit 1
 [ "$verbose" = "1" ] || echo
 echo "INFO  : $test successful"
 
+test="test showinfo JSON"
+if perl -MJSON::PP -e '1' 2>/dev/null; then
+	echo "INFO  : $test"
+	addresses="`testscenarios_showinfo | grep -v '|' | awk '{ print $1 }' | sort -u`"
+	for address in $addresses; do
+		[ "$verbose" = "1" ] && echo "INFO: test JSON: $address"
+		output_mr="`./ipv6calc -q -i -m --mrqvn $address | sort -u`"
+		output_json="`./ipv6calc -q -i --mrjson $address | perl -MJSON::PP -ne '$r = decode_json($_); foreach (keys %$r) { print $_ . "=" . $r->{$_} . "\n" }' | sort -u`"
+		if [ "$output_mr" != "$output_json" ]; then
+			[ "$verbose" = "1" ] || echo
+			echo "ERROR: JSON output differs from machine readable output for $address"
+			diff -u <(echo "$output_mr") <(echo "$output_json")
+			exit 1
+		fi
+		[ "$verbose" = "1" ] || echo -n "."
+	done
+	[ "$verbose" = "1" ] || echo
+
+	# one record per input line in pipe mode, also for mixed input
+	count_in="`echo "$addresses" | wc -l`"
+	count_out="`echo "$addresses" | ./ipv6calc -q -i --mrjson | perl -MJSON::PP -ne 'decode_json($_); print' | wc -l`"
+	if [ "$count_in" != "$count_out" ]; then
+		echo "ERROR: JSON pipe mode returned $count_out records for $count_in input lines"
+		exit 1
+	fi
+
+	# field group selection
+	output="`echo "$addresses" | ./ipv6calc -q -i --mrjson --mrfields REGISTRY | perl -MJSON::PP -ne '$r = decode_json($_); print "$_\n" foreach (keys %$r)' | grep -v '_REGISTRY'`"
+	if [ -n "$output" ]; then
+		echo "ERROR: JSON output contains not selected fields: $output"
+		exit 1
+	fi
+
+	# --fields is an alias of --mrfields
+	if [ "`echo "$addresses" | ./ipv6calc -q -i --mrjson --fields REGISTRY`" != "`echo "$addresses" | ./ipv6calc -q -i --mrjson --mrfields REGISTRY`" ]; then
+		echo "ERROR: JSON output differs between --fields and --mrfields"
+		exit 1
+	fi
+	echo "INFO  : $test successful"
+else
+	echo "NOTICE: $test skipped, required Perl module missing: JSON::PP"
+fi
+
+if [ "$benchmark" = "1" ]; then
+	echo "INFO  : run showinfo field selection benchmark with $count addresses (pipe mode)"
+	input="`mktemp /tmp/ipv6calc-showinfo-benchmark.XXXXXX`"
+	perl -e 'for (my $i = 0; $i < $ARGV[0]; $i++) { if ($i % 2) { printf "%d.%d.%d.%d\n", 11 + $i % 200, ($i >> 8) & 0xff, $i & 0xff, 1 } else { printf "2a01:%x:%x::%x\n", $i & 0xffff, $i >> 16, $i } }' $count >$input
+	for fields in "" ALL ADDR TYPE ANON REGISTRY AS CC GEONAMEID GEO INFO CC,ASN,REGISTRY,IID_TYPE; do
+		if [ -n "$fields" ]; then
+			options="--mrjson --mrfields $fields"
+		else
+			options="--mrjson"
+		fi
+		start=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		./ipv6calc -q -i $options <$input >/dev/null || exit 1
+		end=`perl -MTime::HiRes -e 'print Time::HiRes::time()'`
+		echo "$start $end $count ${fields:-(all)}" | awk '{ printf "INFO  : fields %-26s: %9.1f addresses/s\n", $4, $3 / ($2 - $1) }'
+	done
+	rm -f $input
+fi
+
 if [ "$1" = "minimal" ]; then
 	echo "NOTICE: GeoIP/IP2Location/DBIP tests skipped (option 'minimal' used)"
 	exit 0
@@ -9,10 +9,12 @@
  */
 
 #include <stdio.h>
+#include <ctype.h>
 #include <string.h>
 #include <stdlib.h> 
 #include <getopt.h> 
 #include <unistd.h>
+#include <signal.h>
 
 #include "ipv6loganon.h"
 #include "libipv6calcdebug.h"
@@ -38,6 +40,7 @@
 #include "librfc3056.h"
 #include "libeui64.h"
 #include "libieee.h"
+#include "libipv6calcstream.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
 
@@ -45,6 +48,7 @@
 
 long int ipv6calc_debug = 0; // ipv6calc_debug usage ok
 int flag_nocache = 0;
+int flag_alltokens = 0;
 
 /* anonymization default values */
 s_ipv6calc_anon_set ipv6calc_anon_set;
@@ -61,8 +65,13 @@ int feature_kg      = 0; // will be checked later
 
 
 /* prototypes */
-static int anonymizetoken(char *result, const size_t resultstring_length, const char *token);
-static void lineparser();
+static int anonymizetoken(char *result, const size_t resultstring_length, const char *token, const uint32_t inputtype_given);
+static int lineparser(s_ipv6calc_stream_input *inputp);
+static int linescanner(s_ipv6calc_stream_output *outputp, char *line, const size_t linelength);
+static void charclass_init(void);
+static int fileworker(s_ipv6calc_stream_input *inputp, FILE *output);
+static void anonymize_ipv6addr_memo(ipv6calc_ipv6addr *ipv6addrp);
+static void memo_flush(void);
 
 
 /* LRU cache */
@@ -76,12 +85,57 @@ static char     cache_lru_key_token[CACHE_LRU_SIZE][NI_MAXHOST];
 static char     cache_lru_value[CACHE_LRU_SIZE][NI_MAXHOST];
 static long int cache_lru_statistics[CACHE_LRU_SIZE];
 
+
+/* IPv6 prefix and interface identifier memo (direct-mapped)
+ *  used for methods where anonymized prefix depends only on the prefix and the
+ *  anonymized IID only on the IID, hit even if the full address is not in LRU
+ */
+
+#define MEMO_BITS	12
+#define MEMO_SIZE	(1 << MEMO_BITS)
+#define MEMO_INDEX(a, b, c)	((((a) * 0x9e3779b1u) ^ ((b) * 0x85ebca6bu) ^ ((c) * 0xc2b2ae35u)) >> (32 - MEMO_BITS))
+
+typedef struct {
+	uint32_t key[2];	// prefix
+	uint32_t value[2];	// anonymized prefix
+	uint32_t typeinfo_anon;	// IPV6_ADDR_ANONYMIZED_PREFIX
+	int      valid;
+} s_memo_prefix;
+
+typedef struct {
+	uint32_t key[2];	// interface identifier
+	uint32_t typeinfo;	// type of IID is part of the key
+	uint32_t typeinfo2;
+	uint32_t value[2];	// anonymized interface identifier
+	uint32_t typeinfo_anon;	// IPV6_ADDR_ANONYMIZED_IID
+	int      valid;
+} s_memo_iid;
+
+static s_memo_prefix memo_prefix[MEMO_SIZE];
+static s_memo_iid    memo_iid[MEMO_SIZE];
+
+static long int memo_prefix_hit = 0;
+static long int memo_prefix_miss = 0;
+static long int memo_iid_hit = 0;
+static long int memo_iid_miss = 0;
+
 char	file_out[NI_MAXHOST] = "";
 int	file_out_flag = 0;
 int	file_out_flush = 0;
 char	file_out_mode[NI_MAXHOST] = "";
 FILE	*FILE_OUT;
 
+/* one output file per input file */
+char	file_out_suffix[NI_MAXHOST] = "";
+int	jobs = 1;
+
+/* character classes of address scanner */
+#define CHARCLASS_XDIGIT	0x1	// hex digit
+#define CHARCLASS_SEPARATOR	0x2	// ':' or '.'
+#define CHARCLASS_WORD		0x4	// alphanumeric or '_'
+
+static unsigned char charclass[256];
+
 
 void printversion_verbose(const int level) {
 	printversion();
@@ -100,6 +154,7 @@ int main(int argc,char *argv[]) {
 
 	int i, lop, result;
 	uint32_t command = 0;
+	s_ipv6calc_stream_input input;
 
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
@@ -194,6 +249,23 @@ int main(int argc,char *argv[]) {
 				};
 				break;
 
+			case 'o':
+				if (strlen(optarg) < sizeof(file_out_suffix)) {
+					snprintf(file_out_suffix, sizeof(file_out_suffix), "%s", optarg);
+				} else {
+					fprintf(stderr, " Output file suffix too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case 'j':
+				jobs = atoi(optarg);
+				if (jobs < 1) {
+					fprintf(stderr, " Number of jobs too small: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
 			case 'c':
 				cache_lru_limit = atoi(optarg);
 				if (cache_lru_limit > CACHE_LRU_SIZE) {
@@ -210,6 +282,10 @@ int main(int argc,char *argv[]) {
 				flag_nocache = 1;
 				break;
 
+			case 't':
+				flag_alltokens = 1;
+				break;
+
 			default:
 				ipv6loganon_printinfo();
 				exit(EXIT_FAILURE);
@@ -265,10 +341,41 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
+	/* reload replaced database files on request */
+	libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+
+	if (flag_alltokens == 1) {
+		charclass_init();
+	};
+
+	if (strlen(file_out_suffix) > 0) {
+		if (file_out_flag != 0) {
+			fprintf(stderr, "Output file suffix can't be combined with output file\n");
+			exit(EXIT_FAILURE);
+		};
+
+		if (argc == 0) {
+			fprintf(stderr, "Output file suffix requires input files\n");
+			exit(EXIT_FAILURE);
+		};
+
+		/* children inherit the databases, database files accessed by file offset are reopened */
+		if (libipv6calc_stream_files_run(argv, argc, file_out_suffix, "w", jobs, fileworker, libipv6calc_db_wrapper_reopen) != 0) {
+			exit(EXIT_FAILURE);
+		};
+
+		libipv6calc_db_wrapper_cleanup();
+
+		exit(EXIT_SUCCESS);
+	} else if (jobs > 1) {
+		fprintf(stderr, "Parallel processing requires output file suffix\n");
+		exit(EXIT_FAILURE);
+	};
+
 	if (file_out_flag == 1) {
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Output file specified: %s", file_out);
 
-		FILE_OUT = fopen(file_out, file_out_mode);
+		FILE_OUT = libipv6calc_stream_open(file_out, file_out_mode);
 		if (! FILE_OUT) {
 			fprintf(stderr, "Can't open Output file: %s\n", file_out);
 			exit(EXIT_FAILURE);
@@ -278,41 +385,59 @@ int main(int argc,char *argv[]) {
 		};
 	};
 
-	lineparser();
+	/* input files given as arguments, otherwise stdin */
+	libipv6calc_stream_input_init(&input, argv, argc);
+
+	result = lineparser(&input);
 
 	if (file_out_flag == 2) {
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Output file is closed now: %s", file_out);
 		fflush(FILE_OUT);
-		fclose(FILE_OUT);
+		if (fclose(FILE_OUT) != 0) {
+			fprintf(stderr, "Error writing output file: %s\n", file_out);
+			exit(EXIT_FAILURE);
+		};
 	} else {
 		fflush(stdout);
 	};
 
 	libipv6calc_db_wrapper_cleanup();
 
+	if ((input.error != 0) || (result != 0)) {
+		exit(EXIT_FAILURE);
+	};
+
 	exit(EXIT_SUCCESS);
 };
 
 
 /*
  * Line parser
+ *  the anonymized first token is written directly into the output buffer,
+ *  followed by the untouched rest of the line
+ *
+ * ret: 0 = ok, 1 = write error
  */
-static void lineparser(void) {
+static int lineparser(s_ipv6calc_stream_input *inputp) {
 	char linebuffer[LINEBUFFER];
-	char token[LINEBUFFER];
-	char resultstring[LINEBUFFER];
-	char *charptr, *cptr, **ptrptr;
+	char *charptr, *token, *rest, *result;
+	s_ipv6calc_stream_output output;
+	size_t linelength, tokenlength, restlength, resultlength;
 	int linecounter = 0, retval, i;
 
-	ptrptr = &cptr;
-	
+	if (libipv6calc_stream_output_init(&output, (file_out_flag == 2) ? FILE_OUT : stdout) != 0) {
+		libipv6calc_stream_output_close(&output);
+		fprintf(stderr, "Error writing output\n");
+		return(1);
+	};
+
 	if (ipv6calc_quiet == 0) {
 		fprintf(stderr, "Expecting log lines on stdin\n");
 	};
 
 	while (1 == 1) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
+		/* read line from input */
+		charptr = libipv6calc_stream_input_gets(linebuffer, LINEBUFFER, inputp);
 		
 		if (charptr == NULL) {
 			/* end of input */
@@ -326,69 +451,103 @@ static void lineparser(void) {
 				fprintf(stderr, "Ok, proceeding stdin...\n");
 			};
 		};
+
+		if (libipv6calc_db_wrapper_reload_check() > 0) {
+			/* results of reloaded databases can differ, flush cache */
+			DEBUGPRINT_NA(DEBUG_ipv6loganon_cache, "LRU cache: flush after database reload");
+			cache_lru_max = 0;
+			cache_lru_last = 0;
+			memo_flush();
+		};
 	
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Line number: %d", linecounter);
 
-		if (strlen(linebuffer) >= LINEBUFFER) {
+		linelength = strlen(linebuffer);
+
+		if (linelength >= LINEBUFFER) {
 			fprintf(stderr, "Line too long: %d\n", linecounter);
 			continue;
 		};
 		
-		if (strlen(linebuffer) == 0) {
+		if (linelength == 0) {
 			fprintf(stderr, "Line empty: %d\n", linecounter);
 			continue;
 		};
 		
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Got line: '%s'", linebuffer);
 
-		/* look for first token */
-		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
+		if (flag_alltokens == 1) {
+			/* anonymize addresses anywhere in line */
+			if (linescanner(&output, linebuffer, linelength) != 0) {
+				break;
+			};
+
+			if (file_out_flush == 1) {
+				if (libipv6calc_stream_output_flush(&output) != 0) {
+					break;
+				};
+			};
+			continue;
+		};
+
+		/* look for first token (span without separators), rest of line starts behind following separator */
+		token = linebuffer + strspn(linebuffer, " \t\n");
+		tokenlength = strcspn(token, " \t\n");
 		
-		if ( charptr == NULL ) {
+		if (tokenlength == 0) {
 			fprintf(stderr, "Line contains no token: %d\n", linecounter);
 			continue;
 		};
 
-		if ( strlen(charptr) >=  LINEBUFFER) {
-			fprintf(stderr, "Line too strange: %d\n", linecounter);
-			continue;
+		rest = token + tokenlength;
+		if (*rest != '\0') {
+			/* terminate token */
+			*rest = '\0';
+			rest++;
 		};
+		restlength = linebuffer + linelength - rest;
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
 		DEBUGPRINT_WA(DEBUG_ipv6loganon_general, "Token 1: '%s'", token);
 		
-		/* call anonymizer now */
-		retval = anonymizetoken(resultstring, sizeof(resultstring), charptr);
+		/* reserve space for result, separator and rest of line */
+		result = libipv6calc_stream_output_reserve(&output, LINEBUFFER + 1 + restlength);
+		if (result == NULL) {
+			break;
+		};
+
+		/* call anonymizer now, result is stored in output buffer */
+		retval = anonymizetoken(result, LINEBUFFER, token, FORMAT_undefined);
 
 		if (retval != 0) {
 			continue;
 		};
 		
-		/* print result and rest of line, if available */
-		if (*ptrptr[0] != '\0') {
-			if (file_out_flag == 2) {
-				fprintf(FILE_OUT, "%s %s", resultstring, *ptrptr);
-			} else {
-				printf("%s %s", resultstring, *ptrptr);
-			};
+		/* append rest of line, if available */
+		resultlength = strlen(result);
+		if (restlength > 0) {
+			result[resultlength++] = ' ';
+			memcpy(result + resultlength, rest, restlength);
+			resultlength += restlength;
 		} else {
-			if (file_out_flag == 2) {
-				fprintf(FILE_OUT, "%s\n", resultstring);
-			} else {
-				printf("%s\n", resultstring);
-			};
+			result[resultlength++] = '\n';
+		};
+
+		if (libipv6calc_stream_output_write(&output, result, resultlength) != 0) {
+			break;
 		};
 
 		if (file_out_flush == 1) {
-			if (file_out_flag == 2) {
-				fflush(FILE_OUT);
-			} else {
-				fflush(stdout);
+			if (libipv6calc_stream_output_flush(&output) != 0) {
+				break;
 			};
 		};
 	};
 
+	if (libipv6calc_stream_output_close(&output) != 0) {
+		fprintf(stderr, "Error writing output\n");
+		return(1);
+	};
+
 	if (ipv6calc_quiet == 0) {
 		fprintf(stderr, "...finished\n");
 
@@ -397,18 +556,410 @@ static void lineparser(void) {
 			for (i = 0; i < cache_lru_limit; i++) {
 				fprintf(stderr, "Cache distance: %3d  hits: %8ld\n", i, cache_lru_statistics[i]);
 			};
+
+			fprintf(stderr, "Memo statistics:\n");
+			fprintf(stderr, "Prefix memo  hits: %8ld  misses: %8ld  hit rate: %5.1f%%\n", memo_prefix_hit, memo_prefix_miss, (memo_prefix_hit + memo_prefix_miss > 0) ? (100.0 * memo_prefix_hit / (memo_prefix_hit + memo_prefix_miss)) : 0.0);
+			fprintf(stderr, "IID memo     hits: %8ld  misses: %8ld  hit rate: %5.1f%%\n", memo_iid_hit, memo_iid_miss, (memo_iid_hit + memo_iid_miss > 0) ? (100.0 * memo_iid_hit / (memo_iid_hit + memo_iid_miss)) : 0.0);
 		};
 	};
-	return;
+	return(0);
+};
+
+
+/*
+ * File worker: proceed one input file into given output
+ */
+static int fileworker(s_ipv6calc_stream_input *inputp, FILE *output) {
+	FILE_OUT = output;
+	file_out_flag = 2;
+
+	return(lineparser(inputp));
+};
+
+
+/*
+ * flush prefix and IID memo
+ */
+static void memo_flush(void) {
+	int i;
+
+	DEBUGPRINT_NA(DEBUG_ipv6loganon_cache, "Memo: flush");
+
+	for (i = 0; i < MEMO_SIZE; i++) {
+		memo_prefix[i].valid = 0;
+		memo_iid[i].valid = 0;
+	};
+};
+
+
+/*
+ * anonymize IPv6 address using prefix and IID memo, only missing parts are calculated
+ *  caller has to check libipv6addr_anonymize_parts_independent before
+ *
+ * mod: ipv6addrp
+ */
+static void anonymize_ipv6addr_memo(ipv6calc_ipv6addr *ipv6addrp) {
+	ipv6calc_ipv6addr ipv6addr;
+	s_memo_prefix *pp;
+	s_memo_iid *ip;
+	int parts = 0;
+
+	pp = &memo_prefix[MEMO_INDEX(ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), 0)];
+	ip = &memo_iid[MEMO_INDEX(ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3), ipv6addrp->typeinfo)];
+
+	if ((pp->valid == 1) && (pp->key[0] == ipv6addr_getdword(ipv6addrp, 0)) && (pp->key[1] == ipv6addr_getdword(ipv6addrp, 1))) {
+		memo_prefix_hit++;
+	} else {
+		memo_prefix_miss++;
+		parts |= ANON_PART_PREFIX;
+	};
+
+	if ((ip->valid == 1) && (ip->key[0] == ipv6addr_getdword(ipv6addrp, 2)) && (ip->key[1] == ipv6addr_getdword(ipv6addrp, 3)) && (ip->typeinfo == ipv6addrp->typeinfo) && (ip->typeinfo2 == ipv6addrp->typeinfo2)) {
+		memo_iid_hit++;
+	} else {
+		memo_iid_miss++;
+		parts |= ANON_PART_IID;
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6loganon_cache, "Memo: addr=%08x %08x %08x %08x prefix=%s iid=%s", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3), ((parts & ANON_PART_PREFIX) != 0) ? "miss" : "hit", ((parts & ANON_PART_IID) != 0) ? "miss" : "hit");
+
+	if (parts != 0) {
+		ipv6addr_copy(&ipv6addr, ipv6addrp);
+
+		if (libipv6addr_anonymize_parts(&ipv6addr, &ipv6calc_anon_set, parts) != 0) {
+			/* not anonymized, result is not stored */
+			ipv6addr_copy(ipv6addrp, &ipv6addr);
+			return;
+		};
+
+		if ((parts & ANON_PART_PREFIX) != 0) {
+			pp->key[0] = ipv6addr_getdword(ipv6addrp, 0);
+			pp->key[1] = ipv6addr_getdword(ipv6addrp, 1);
+			pp->value[0] = ipv6addr_getdword(&ipv6addr, 0);
+			pp->value[1] = ipv6addr_getdword(&ipv6addr, 1);
+			pp->typeinfo_anon = ipv6addr.typeinfo & IPV6_ADDR_ANONYMIZED_PREFIX;
+			pp->valid = 1;
+		};
+
+		if ((parts & ANON_PART_IID) != 0) {
+			ip->key[0] = ipv6addr_getdword(ipv6addrp, 2);
+			ip->key[1] = ipv6addr_getdword(ipv6addrp, 3);
+			ip->typeinfo = ipv6addrp->typeinfo;
+			ip->typeinfo2 = ipv6addrp->typeinfo2;
+			ip->value[0] = ipv6addr_getdword(&ipv6addr, 2);
+			ip->value[1] = ipv6addr_getdword(&ipv6addr, 3);
+			ip->typeinfo_anon = ipv6addr.typeinfo & IPV6_ADDR_ANONYMIZED_IID;
+			ip->valid = 1;
+		};
+	};
+
+	ipv6addr_setdword(ipv6addrp, 0, pp->value[0]);
+	ipv6addr_setdword(ipv6addrp, 1, pp->value[1]);
+	ipv6addr_setdword(ipv6addrp, 2, ip->value[0]);
+	ipv6addr_setdword(ipv6addrp, 3, ip->value[1]);
+	ipv6addrp->typeinfo |= pp->typeinfo_anon | ip->typeinfo_anon;
+};
+
+
+/*
+ * initialize character classes of address scanner
+ */
+static void charclass_init(void) {
+	int c;
+
+	for (c = 0; c < 256; c++) {
+		charclass[c] = 0;
+		if (isxdigit(c)) {
+			charclass[c] |= CHARCLASS_XDIGIT;
+		};
+		if (isalnum(c) || (c == '_')) {
+			charclass[c] |= CHARCLASS_WORD;
+		};
+	};
+
+	charclass[(unsigned char) ':'] |= CHARCLASS_SEPARATOR;
+	charclass[(unsigned char) '.'] |= CHARCLASS_SEPARATOR;
+};
+
+
+/*
+ * find next ':' or '.', 8 bytes are checked at once
+ *
+ * in : ptr = start, end = end of data
+ * ret: pointer to separator, end if not found
+ */
+static const char *scan_separator(const char *ptr, const char *end) {
+	const uint64_t ones = 0x0101010101010101ULL, highs = 0x8080808080808080ULL;
+	uint64_t v, c, d;
+
+	while (end - ptr >= 8) {
+		memcpy(&v, ptr, sizeof(v));
+		c = v ^ (ones * ':');
+		d = v ^ (ones * '.');
+		if ((((c - ones) & ~c) | ((d - ones) & ~d)) & highs) {
+			/* at least one byte is a separator */
+			break;
+		};
+		ptr += 8;
+	};
+
+	while ((ptr < end) && (*ptr != ':') && (*ptr != '.')) {
+		ptr++;
+	};
+
+	return(ptr);
+};
+
+
+/*
+ * check for IPv4 address in dotted decimal notation (strict)
+ *
+ * in : string, length
+ * ret: 1 = valid, 0 = invalid
+ */
+static int scan_is_ipv4(const char *string, const size_t length) {
+	size_t pos = 0;
+	int part, digits, value;
+
+	for (part = 0; part < 4; part++) {
+		if (part > 0) {
+			if ((pos >= length) || (string[pos] != '.')) {
+				return(0);
+			};
+			pos++;
+		};
+
+		value = 0;
+		for (digits = 0; (pos < length) && isdigit((unsigned char) string[pos]); digits++, pos++) {
+			value = value * 10 + (string[pos] - '0');
+		};
+
+		if ((digits == 0) || (digits > 3) || (value > 255)) {
+			return(0);
+		};
+	};
+
+	return((pos == length) ? 1 : 0);
+};
+
+
+/*
+ * check for IPv6 address (strict, optional with IPv4 address at end)
+ *
+ * in : string, length
+ * ret: 1 = valid, 0 = invalid
+ */
+static int scan_is_ipv6(const char *string, const size_t length) {
+	size_t pos = 0, digits;
+	int groups = 0, doublecolon = 0;
+
+	if ((length < 3) || (length > 45)) {
+		return(0);
+	};
+
+	if (string[0] == ':') {
+		if (string[1] != ':') {
+			return(0);
+		};
+		doublecolon = 1;
+		pos = 2;
+	};
+
+	while (pos < length) {
+		for (digits = 0; (pos + digits < length) && ((charclass[(unsigned char) string[pos + digits]] & CHARCLASS_XDIGIT) != 0); digits++) {
+			if (digits > 4) {
+				return(0);
+			};
+		};
+
+		if ((digits == 0) || (digits > 4)) {
+			return(0);
+		};
+
+		if ((pos + digits < length) && (string[pos + digits] == '.')) {
+			/* IPv4 address at end */
+			if (scan_is_ipv4(string + pos, length - pos) == 0) {
+				return(0);
+			};
+			groups += 2;
+			break;
+		};
+
+		groups++;
+		pos += digits;
+
+		if (pos == length) {
+			break;
+		};
+
+		if (string[pos] != ':') {
+			return(0);
+		};
+		pos++;
+
+		if ((pos < length) && (string[pos] == ':')) {
+			if (doublecolon == 1) {
+				return(0);
+			};
+			doublecolon = 1;
+			pos++;
+		} else if (pos == length) {
+			/* single colon at end */
+			return(0);
+		};
+	};
+
+	if (doublecolon == 1) {
+		return((groups <= 7) ? 1 : 0);
+	};
+
+	return((groups == 8) ? 1 : 0);
+};
+
+
+/*
+ * anonymize one address found by scanner and append result
+ *  rest of line up to address is appended before
+ *
+ * mod: outputp = output
+ * in : copied = start of not yet appended part of line
+ * in : start, stop = address
+ * in : inputtype = type of address
+ * ret: new start of not yet appended part of line, NULL = write error
+ */
+static char *linescanner_address(s_ipv6calc_stream_output *outputp, char *copied, char *start, char *stop, const uint32_t inputtype) {
+	char *result, c;
+	int retval;
+
+	if (libipv6calc_stream_output_write(outputp, copied, start - copied) != 0) {
+		return(NULL);
+	};
+
+	result = libipv6calc_stream_output_reserve(outputp, NI_MAXHOST);
+	if (result == NULL) {
+		return(NULL);
+	};
+
+	/* terminate address temporary */
+	c = *stop;
+	*stop = '\0';
+	retval = anonymizetoken(result, NI_MAXHOST, start, inputtype);
+	*stop = c;
+
+	if (retval != 0) {
+		/* keep address, it's appended with rest of line */
+		return(start);
+	};
+
+	if (libipv6calc_stream_output_write(outputp, result, strlen(result)) != 0) {
+		return(NULL);
+	};
+
+	return(stop);
+};
+
+
+/*
+ * Line scanner: anonymize all IPv4/IPv6 addresses of a line
+ *  candidates are spans of hex digits, ':' and '.' around a ':' or '.'
+ *  without alphanumeric characters directly before or behind,
+ *  only valid addresses are passed to the anonymizer
+ *
+ * mod: outputp = output
+ * in : line, linelength
+ * ret: 0 = ok, -1 = write error
+ */
+static int linescanner(s_ipv6calc_stream_output *outputp, char *line, const size_t linelength) {
+	char *end = line + linelength;
+	char *ptr = line, *copied = line, *start, *stop, *segment, *segment_stop;
+
+	while (ptr < end) {
+		ptr = (char *) scan_separator(ptr, end);
+		if (ptr == end) {
+			break;
+		};
+
+		/* expand to span of address characters */
+		start = ptr;
+		while ((start > line) && ((charclass[(unsigned char) start[-1]] & (CHARCLASS_XDIGIT | CHARCLASS_SEPARATOR)) != 0)) {
+			start--;
+		};
+
+		stop = ptr;
+		while ((stop < end) && ((charclass[(unsigned char) *stop] & (CHARCLASS_XDIGIT | CHARCLASS_SEPARATOR)) != 0)) {
+			stop++;
+		};
+
+		ptr = stop;
+
+		/* dots and single colons at begin/end belong to surrounding text (e.g. "key:1.2.3.4") */
+		while ((start < stop) && (*start == '.')) {
+			start++;
+		};
+		if ((stop - start >= 2) && (start[0] == ':') && (start[1] != ':')) {
+			start++;
+		};
+		while ((stop > start) && (stop[-1] == '.')) {
+			stop--;
+		};
+		if ((stop - start >= 2) && (stop[-1] == ':') && (stop[-2] != ':')) {
+			stop--;
+		};
+
+		if (((start > line) && ((charclass[(unsigned char) start[-1]] & CHARCLASS_WORD) != 0))
+		    || ((stop < end) && ((charclass[(unsigned char) *stop] & CHARCLASS_WORD) != 0))) {
+			/* part of a word */
+			continue;
+		};
+
+		if (scan_is_ipv6(start, stop - start) == 1) {
+			copied = linescanner_address(outputp, copied, start, stop, FORMAT_ipv6addr);
+			if (copied == NULL) {
+				return(-1);
+			};
+			continue;
+		};
+
+		/* IPv4 addresses between colons (e.g. with port) */
+		segment = start;
+		while (segment < stop) {
+			segment_stop = segment;
+			while ((segment_stop < stop) && (*segment_stop != ':')) {
+				segment_stop++;
+			};
+
+			if (scan_is_ipv4(segment, segment_stop - segment) == 1) {
+				copied = linescanner_address(outputp, copied, segment, segment_stop, FORMAT_ipv4addr);
+				if (copied == NULL) {
+					return(-1);
+				};
+			};
+
+			segment = segment_stop + 1;
+		};
+	};
+
+	/* rest of line */
+	if (libipv6calc_stream_output_write(outputp, copied, end - copied) != 0) {
+		return(-1);
+	};
+
+	if ((linelength == 0) || (line[linelength - 1] != '\n')) {
+		if (libipv6calc_stream_output_write(outputp, "\n", 1) != 0) {
+			return(-1);
+		};
+	};
+
+	return(0);
 };
 
 
 /*
  * Anonymize token
  */
-static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token) {
+static int anonymizetoken(char *resultstring, const size_t resultstring_length, const char *token, const uint32_t inputtype_given) {
 	uint32_t inputtype = FORMAT_undefined;
-	int retval = 1, i;
+	int retval = 1, i, flag_parsed = 0;
 
 	/* used structures */
 	ipv6calc_ipv6addr  ipv6addr;
@@ -465,8 +1016,13 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 	ipv6addr.flag_valid = 0;
 	ipv4addr.flag_valid = 0;
 	
-	/* autodetection */
-	inputtype = libipv6calc_autodetectinput(token);
+	if (inputtype_given != FORMAT_undefined) {
+		/* already validated by caller */
+		inputtype = inputtype_given;
+	} else {
+		/* autodetection, common address notations are parsed in the same pass */
+		inputtype = libipv6calc_autodetectinput_parse(token, &ipv4addr, &ipv6addr, &macaddr, &flag_parsed);
+	};
 
 	DEBUGSECTION_BEGIN(DEBUG_ipv6loganon_general)
 		if (inputtype != FORMAT_undefined) {
@@ -483,22 +1039,26 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 	DEBUGSECTION_END
 
 	/* proceed input depending on type */	
-	switch (inputtype) {
-		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
-			break;
+	if (flag_parsed == 1) {
+		retval = 0;
+	} else {
+		switch (inputtype) {
+			case FORMAT_ipv6addr:
+				retval = addr_to_ipv6addrstruct(token, resultstring, resultstring_length, &ipv6addr);
+				break;
 
-		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(token, resultstring, resultstring_length, &ipv4addr);
-			break;
+			case FORMAT_ipv4addr:
+				retval = addr_to_ipv4addrstruct(token, resultstring, resultstring_length, &ipv4addr);
+				break;
 
-		case FORMAT_eui64:
-			retval = libeui64_addr_to_eui64addrstruct(token, resultstring, resultstring_length, &eui64addr);
-			break;
+			case FORMAT_eui64:
+				retval = libeui64_addr_to_eui64addrstruct(token, resultstring, resultstring_length, &eui64addr);
+				break;
 
-		case FORMAT_macaddr:
-			retval = addr_to_macaddrstruct(token, resultstring, resultstring_length, &macaddr);
-			break;
+			case FORMAT_macaddr:
+				retval = addr_to_macaddrstruct(token, resultstring, resultstring_length, &macaddr);
+				break;
+		};
 	};
 
 	if (retval != 0) {
@@ -514,7 +1074,11 @@ static int anonymizetoken(char *resultstring, const size_t resultstring_length,
 
 	if (ipv6addr.flag_valid == 1) {
 		/* anonymize IPv6 address according to settings */
-		libipv6addr_anonymize(&ipv6addr, &ipv6calc_anon_set);
+		if ((flag_nocache == 0) && (libipv6addr_anonymize_parts_independent(&ipv6addr, &ipv6calc_anon_set) == 1)) {
+			anonymize_ipv6addr_memo(&ipv6addr);
+		} else {
+			libipv6addr_anonymize(&ipv6addr, &ipv6calc_anon_set);
+		};
 
 		/* convert IPv6 address structure to string */
 		ipv6addrstruct_to_compaddr(&ipv6addr, resultstring, resultstring_length);
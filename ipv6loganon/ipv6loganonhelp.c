@@ -16,6 +16,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calccommands.h"
 #include "ipv6calchelp.h"
+#include "libipv6calcstream.h"
 #include "config.h"
 
 /* display info */
@@ -74,9 +75,16 @@ void ipv6loganon_printhelp(void) {
 	
 	printhelp_common(IPV6CALC_HELP_ALL);
 
-	fprintf(stderr, "  [-w|--write]               : write output to file instead of stdout\n");
-	fprintf(stderr, "  [-a|--append]              : append output to file instead of stdout\n");
+	fprintf(stderr, "  [-w|--write <file>]        : write output to file instead of stdout\n");
+	fprintf(stderr, "  [-a|--append <file>]       : append output to file instead of stdout\n");
+	fprintf(stderr, "                               compressed by suffix of file (.gz/.xz/.zst)\n");
+	fprintf(stderr, "  [-o|--output-suffix <suf>] : write output of each input file to own file\n");
+	fprintf(stderr, "                               named input file (without .gz/.xz/.zst) + suffix\n");
+	fprintf(stderr, "  [-j|--jobs <num>]          : proceed up to <num> input files concurrently\n");
+	fprintf(stderr, "                               (requires --output-suffix, default: 1)\n");
 	fprintf(stderr, "  [-f|--flush]               : flush output after each line\n");
+	fprintf(stderr, "  [-t|--all-tokens]          : anonymize IPv4/IPv6 addresses anywhere in line\n");
+	fprintf(stderr, "                               (default: first token only)\n");
 	fprintf(stderr, "  [-V|--verbose]             : be verbose\n");
 	fprintf(stderr, "  [-n|--nocache]             : disable caching\n");
 	fprintf(stderr, "  [-c|--cachelimit <value>]  : set cache limit\n");
@@ -86,7 +94,8 @@ void ipv6loganon_printhelp(void) {
 	printhelp_action_dispatcher(ACTION_anonymize, 1);
 
 	fprintf(stderr, "\n");
-	fprintf(stderr, " Takes data from stdin, outputs the processed data to stdout (default)\n");
+	fprintf(stderr, " Takes data from given files or stdin, outputs the processed data to stdout (default)\n");
+	libipv6calc_stream_printhelp();
 	fprintf(stderr, "\n");
 	fprintf(stderr, "\n");
 
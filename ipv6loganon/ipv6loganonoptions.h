@@ -20,7 +20,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6loganon_shortopts = "vh?nc:w:a:f";
+static char *ipv6loganon_shortopts = "vh?nc:w:a:fj:o:t";
 
 /* define long options */
 static struct option ipv6loganon_longopts[] = {
@@ -35,6 +35,9 @@ static struct option ipv6loganon_longopts[] = {
 	{"cachelimit", required_argument, 0, (int) 'c'},
 	{"write"     , required_argument, 0, (int) 'w'},
 	{"append"    , required_argument, 0, (int) 'a'},
+	{"output-suffix", required_argument, 0, (int) 'o'},
+	{"jobs"      , required_argument, 0, (int) 'j'},
+	{"all-tokens", no_argument      , 0, (int) 't'},
 };                
 
 #endif
@@ -135,6 +135,49 @@ END
 }
 
 
+testscenarios_alltokens() {
+# input|result (option -t)
+cat <<END | grep -v "^#"
+192.0.2.1 - - "GET / HTTP/1.1" "5.6.7.8, 2001:db8::1"|192.0.2.0 - - "GET / HTTP/1.1" "5.6.7.0, 2001:db8::9:a929:4291:c02d:5d15"
+{"ip":"2001:db8:1:2::3","xff":"[2001:db8::2]:443"}|{"ip":"2001:db8:1:9:a929:4291:c02d:5d15","xff":"[2001:db8::9:a929:4291:c02d:5d15]:443"}
+- - [10/Oct/2000:13:55:36 -0700] "http://10.1.2.3:8080/x" "Chrome/120.0.6099.109"|- - [10/Oct/2000:13:55:36 -0700] "http://10.1.2.0:8080/x" "Chrome/120.0.6099.109"
+host1.2.3.4.example.com mac 00:11:22:33:44:55 time 12:34:56 std::string|host1.2.3.4.example.com mac 00:11:22:33:44:55 time 12:34:56 std::string
+from 192.168.1.1. client:9.8.7.6 ::ffff:1.2.3.4 256.1.1.1 1.2.3|from 192.168.1.0. client:9.8.7.0 ::ffff:1.2.3.0 256.1.1.1 1.2.3
+fe80::210:a4ff:fe01:2345%eth0 1:2:3:4:5:6:7:8:9|fe80::a909:4291:4021:a4c%eth0 1:2:3:4:5:6:7:8:9
+END
+}
+
+run_loganon_alltokens_tests() {
+	test="run 'ipv6loganon' all tokens tests"
+	echo "INFO  : $test"
+	testscenarios_alltokens | while IFS="|" read input result; do
+		[ "$verbose" = "1" ] && echo "IN     : $input"
+		[ "$verbose" = "1" ] && echo "CHECK  : $result"
+		output="`echo "$input" | ./ipv6loganon -q -t`"
+		if [ $? -ne 0 ]; then
+			echo "Error executing 'ipv6loganon -t'!"
+			exit 1
+		fi
+		[ "$verbose" = "1" ] && echo "OUT    : $output"
+		if [ "$output" != "$result" ]; then
+			[ "$verbose" = "1" ] || echo "IN     : $input"
+			[ "$verbose" = "1" ] || echo "CHECK  : $result"
+			[ "$verbose" = "1" ] || echo "OUT    : $output"
+			echo "RESULT : fail"
+			exit 1
+		fi
+		[ "$verbose" = "1" ] || echo -n "."
+	done || return 1
+	[ "$verbose" = "1" ] || echo
+
+	# first token only lines have to result in same output
+	if [ "`testscenarios_standard | awk -F= '{ print $1 }' | sed 's/\W*$//g' | ./ipv6loganon -q -t`" != "`testscenarios_standard | awk -F= '{ print $2 }'`" ]; then
+		echo "ERROR : result of standard tests with option -t not matching"
+		return 1
+	fi
+	echo "INFO  : $test successful"
+}
+
 #set -x
 ## main ##
 echo "Run 'ipv6loganon' function tests..." >&2
@@ -439,6 +482,20 @@ run_loganon_options_kp_tests() {
 		exit 1
 	fi
 	echo "INFO  : test scenario with huge amount of addresses: OK"
+
+	echo "INFO  : test scenario prefix/IID memo (compare with option -n)..."
+	list="`perl -e '{ for ($i = 0; $i < 64; $i++) { for ($j = 0; $j < 64; $j++) { printf "2001:%x:%x::%x:%x\n2001:db8:%x::210:a4ff:fe01:%x\n", 1024 * ($i % 16), $i, $j, $i, $i, $j } } }'`"
+	result="`echo "$list" | ./ipv6loganon -q --anonymize-preset kp`"
+	if [ $? -ne 0 ]; then
+		echo "ERROR : exit code <> 0"
+		exit 1
+	fi
+	result_nocache="`echo "$list" | ./ipv6loganon -q -n --anonymize-preset kp`"
+	if [ "$result" != "$result_nocache" ]; then
+		echo "ERROR : result with prefix/IID memo doesn't match result without"
+		exit 1
+	fi
+	echo "INFO  : test scenario prefix/IID memo: OK"
 }
 
 
@@ -466,6 +523,12 @@ if [ $? -ne 0 ]; then
 	exit 1
 fi
 
+run_loganon_alltokens_tests
+if [ $? -ne 0 ]; then
+	echo "ERROR : run_loganon_alltokens_tests failed"
+	exit 1
+fi
+
 
 echo "All tests were successfully done!" >&2
 
@@ -0,0 +1,139 @@
+#!/bin/bash
+#
+# Project    : ipv6calc
+# File       : test_ipv6loganon_compression.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+#
+# Test program for "ipv6loganon" compressed input/output
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+if [ ! -x ./ipv6loganon ]; then
+	echo "Binary './ipv6loganon' missing or not executable"
+	exit 1
+fi
+
+supported="$(./ipv6loganon -h 2>&1 | grep "Supported compression")"
+
+if [ -z "$supported" ]; then
+	echo "NOTICE: compression support not compiled-in, skip test"
+	exit 0
+fi
+
+tmpdir=$(mktemp -d) || exit 1
+trap "rm -rf $tmpdir" EXIT
+
+# create input
+for i in $(seq 1 2000); do
+	echo "192.0.2.$[ $i % 256 ] - - IPv4 address $i"
+	echo "2001:0db8:0000:0000:81c0:0f3f:c807:$(printf "%04x" $i) - - IPv6 address/privacy IID $i"
+	echo "3ffe:ffff::210:a4ff:fe01:$(printf "%04x" $i) - - 6bone EUI-48 $i"
+done >$tmpdir/input
+
+./ipv6loganon -q <$tmpdir/input >$tmpdir/expected
+if [ $? -ne 0 ]; then
+	echo "ERROR : reference run failed"
+	exit 1
+fi
+
+cat $tmpdir/expected $tmpdir/expected >$tmpdir/expected2
+
+# anonymized again when read back in round-trip test
+./ipv6loganon -q <$tmpdir/expected2 >$tmpdir/expected2-anon
+if [ $? -ne 0 ]; then
+	echo "ERROR : reference run (round-trip) failed"
+	exit 1
+fi
+
+# compare file with expected result
+compare() {
+	if ! cmp -s "$1" "$2"; then
+		echo "ERROR : result not matching: $3"
+		[ "$verbose" = "1" ] && diff "$1" "$2" | head -20
+		exit 1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : result matching: $3"
+	return 0
+}
+
+for type in gzip:gz xz:xz zstd:zst; do
+	tool=${type%%:*}
+	suffix=${type##*:}
+
+	if ! echo "$supported" | grep -q " $tool("; then
+		echo "NOTICE: compression not supported: $tool"
+		continue
+	fi
+
+	echo "Run 'ipv6loganon' compression round-trip test: $tool"
+
+	# compressed output file (new and appended) read back as input
+	rm -f $tmpdir/roundtrip.$suffix
+	./ipv6loganon -q -w $tmpdir/roundtrip.$suffix <$tmpdir/input || exit 1
+	./ipv6loganon -q -a $tmpdir/roundtrip.$suffix $tmpdir/input || exit 1
+	./ipv6loganon -q $tmpdir/roundtrip.$suffix >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected2-anon "round-trip $tool"
+
+	if ! which $tool >/dev/null 2>&1; then
+		echo "NOTICE: compression tool missing, skip interoperability tests: $tool"
+		continue
+	fi
+
+	echo "Run 'ipv6loganon' compression interoperability tests: $tool"
+
+	$tool -c <$tmpdir/input >$tmpdir/input.$suffix
+
+	# compressed input file
+	./ipv6loganon -q $tmpdir/input.$suffix >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected "input $tool"
+
+	# compressed and plain input files
+	./ipv6loganon -q $tmpdir/input.$suffix $tmpdir/input >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected2 "input $tool + plain"
+
+	# concatenated compressed input file
+	cat $tmpdir/input.$suffix $tmpdir/input.$suffix >$tmpdir/input2.$suffix
+	./ipv6loganon -q $tmpdir/input2.$suffix >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected2 "input $tool concatenated"
+
+	# compressed output file
+	rm -f $tmpdir/output.$suffix
+	./ipv6loganon -q -w $tmpdir/output.$suffix <$tmpdir/input || exit 1
+	$tool -dc <$tmpdir/output.$suffix >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected "output $tool"
+
+	# appended compressed output file
+	./ipv6loganon -q -a $tmpdir/output.$suffix $tmpdir/input.$suffix || exit 1
+	$tool -dc <$tmpdir/output.$suffix >$tmpdir/output || exit 1
+	compare $tmpdir/output $tmpdir/expected2 "append $tool"
+
+	# truncated compressed input file has to be detected
+	head -c 1000 $tmpdir/input.$suffix >$tmpdir/truncated.$suffix
+	./ipv6loganon -q $tmpdir/truncated.$suffix >/dev/null 2>&1
+	if [ $? -eq 0 ]; then
+		echo "ERROR : truncated input not detected: $tool"
+		exit 1
+	fi
+done
+
+# missing input file has to be detected
+./ipv6loganon -q $tmpdir/missing >/dev/null 2>&1
+if [ $? -eq 0 ]; then
+	echo "ERROR : missing input file not detected"
+	exit 1
+fi
+
+echo "All tests were successfully done!"
@@ -0,0 +1,92 @@
+#!/bin/bash
+#
+# Project    : ipv6calc
+# File       : test_ipv6loganon_files.sh
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+#
+# Test program for "ipv6loganon" output per input file (sequential/parallel)
+
+verbose=0
+while getopts "Vh\?" opt; do
+	case $opt in
+	    V)
+		verbose=1
+		;;
+	    *)
+		echo "$0 [-V]"
+		echo "    -V   verbose"
+		exit 1
+		;;
+	esac
+done
+
+if [ ! -x ./ipv6loganon ]; then
+	echo "Binary './ipv6loganon' missing or not executable"
+	exit 1
+fi
+
+tmpdir=$(mktemp -d) || exit 1
+trap "rm -rf $tmpdir" EXIT
+
+# create input files and expected results
+files=""
+for f in 1 2 3 4 5; do
+	for i in $(seq 1 500); do
+		echo "192.0.$f.$[ $i % 256 ] - - IPv4 address $i"
+		echo "2001:db8:$f::$(printf "%x" $i) - - IPv6 address $i"
+		echo "3ffe:ffff::210:a4ff:fe0$f:$(printf "%04x" $i) - - 6bone EUI-48 $i"
+	done >$tmpdir/input$f.log
+
+	./ipv6loganon -q <$tmpdir/input$f.log >$tmpdir/expected$f
+	if [ $? -ne 0 ]; then
+		echo "ERROR : reference run failed"
+		exit 1
+	fi
+
+	files="$files $tmpdir/input$f.log"
+done
+
+# compare output files with expected results
+compare() {
+	for f in 1 2 3 4 5; do
+		if ! cmp -s $tmpdir/input$f.log$1 $tmpdir/expected$f; then
+			echo "ERROR : result not matching: $2 (file $f)"
+			exit 1
+		fi
+		rm -f $tmpdir/input$f.log$1
+	done
+	[ "$verbose" = "1" ] && echo "INFO  : result matching: $2"
+	return 0
+}
+
+echo "Run 'ipv6loganon' output per input file test (sequential)"
+./ipv6loganon -q -o .anon $files || exit 1
+compare .anon "sequential"
+
+for jobs in 2 5 8; do
+	echo "Run 'ipv6loganon' output per input file test (parallel: $jobs jobs)"
+	./ipv6loganon -q -j $jobs -o .anon $files || exit 1
+	compare .anon "parallel $jobs jobs"
+done
+
+# missing input file has to be detected, other files are proceeded
+./ipv6loganon -q -j 2 -o .anon $files $tmpdir/missing.log >/dev/null 2>&1
+if [ $? -eq 0 ]; then
+	echo "ERROR : missing input file not detected"
+	exit 1
+fi
+if [ -e $tmpdir/missing.log.anon ]; then
+	echo "ERROR : output file created for missing input file"
+	exit 1
+fi
+compare .anon "parallel with missing input file"
+
+# parallel processing without output suffix is not supported
+./ipv6loganon -q -j 2 $files >/dev/null 2>&1
+if [ $? -eq 0 ]; then
+	echo "ERROR : parallel processing without output suffix not rejected"
+	exit 1
+fi
+
+echo "All tests were successfully done!"
@@ -13,6 +13,7 @@
 #include <stdlib.h> 
 #include <getopt.h> 
 #include <unistd.h>
+#include <signal.h>
 
 #include "ipv6logconv.h"
 #include "libipv6calcdebug.h"
@@ -36,6 +37,7 @@
 #include "librfc3056.h"
 #include "libeui64.h"
 #include "libieee.h"
+#include "libipv6calcstream.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
 
@@ -52,23 +54,50 @@ int flag_nocache = 0;
 
 /* prototypes */
 static int converttoken(char *result, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown);
-static void lineparser(const long int outputtype);
+static int converttoken_uncached(char *result, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown);
+static void lineparser(const long int outputtype, s_ipv6calc_stream_input *inputp);
+static int fileworker(s_ipv6calc_stream_input *inputp, FILE *output);
 
 
-/* LRU cache */
+/* cache (direct-mapped, allocated on start)
+ *  key is hash of raw token bytes and output type, checked before input type
+ *  autodetection, so repeated tokens are neither autodetected nor parsed again
+ */
+
+#define CACHE_TOKEN_MAX	48	// longest IPv6 address in text form + '\0'
+#define CACHE_VALUE_MAX	96
 
-#define CACHE_LRU_SIZE 200
+typedef struct {
+	uint32_t generation;	// entry is valid if equal to cache_generation
+	uint32_t hash;
+	long int outputtype;
+	int      flag_skipunknown;
+	int      retval;
+	char     token[CACHE_TOKEN_MAX];
+	char     value[CACHE_VALUE_MAX];
+} s_cache_entry;
 
-static int      cache_lru_max = 0;
-static int      cache_lru_last = 0;
-static char     cache_lru_key_token[CACHE_LRU_SIZE][NI_MAXHOST];
-static long int cache_lru_key_outputtype[CACHE_LRU_SIZE];
-static char     cache_lru_value[CACHE_LRU_SIZE][NI_MAXHOST];
-static long int cache_lru_statistics[CACHE_LRU_SIZE];
+static s_cache_entry *cache = NULL;
+static uint32_t cache_generation = 1;
+static long int cache_hit = 0;
+static long int cache_miss = 0;
+
+int cache_size = CACHE_SIZE_DEFAULT;
 
 int feature_reg = 0;
 int feature_ieee = 0;
 
+char	file_out[NI_MAXHOST] = "";
+int	file_out_flag = 0;
+int	file_out_flush = 0;
+char	file_out_mode[NI_MAXHOST] = "";
+FILE	*FILE_OUT;
+
+/* one output file per input file */
+char	file_out_suffix[NI_MAXHOST] = "";
+int	jobs = 1;
+static long int fileworker_outputtype = FORMAT_undefined;
+
 /**************************************************/
 /* main */
 int main(int argc,char *argv[]) {
@@ -80,8 +109,9 @@ int main(int argc,char *argv[]) {
 
 	int i, lop, result;
 	unsigned long int command = 0;
+	s_ipv6calc_stream_input input;
 
-	cache_lru_limit = 20; /* optimum */
+	cache_size = CACHE_SIZE_DEFAULT;
 
 	/* new option style storage */	
 	uint32_t inputtype  = FORMAT_undefined, outputtype = FORMAT_undefined;
@@ -148,14 +178,14 @@ int main(int argc,char *argv[]) {
 				break;
 				
 			case 'c':
-				cache_lru_limit = atoi(optarg);
-				if (cache_lru_limit > CACHE_LRU_SIZE) {
-					cache_lru_limit = CACHE_LRU_SIZE;
-					fprintf(stderr, " Cache limit too big, built-in limit: %d\n", cache_lru_limit);
+				cache_size = atoi(optarg);
+				if (cache_size > CACHE_SIZE_MAX) {
+					cache_size = CACHE_SIZE_MAX;
+					fprintf(stderr, " Cache limit too big, built-in limit: %d\n", cache_size);
 				};
-				if (cache_lru_limit < 1) {
-					cache_lru_limit = 1;
-					fprintf(stderr, " Cache limit too small, take minimum: %d\n", cache_lru_limit);
+				if (cache_size < 1) {
+					cache_size = 1;
+					fprintf(stderr, " Cache limit too small, take minimum: %d\n", cache_size);
 				};
 				break;
 
@@ -163,6 +193,47 @@ int main(int argc,char *argv[]) {
 				flag_nocache = 1;
 				break;
 
+			case 'f':
+				file_out_flush = 1;
+				break;
+
+			case 'w':
+			case 'a':
+				if (strlen(optarg) < sizeof(file_out)) {
+					snprintf(file_out, sizeof(file_out), "%s", optarg);
+					file_out_flag = 1;
+				} else {
+					fprintf(stderr, " Output file too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+
+				switch (i) {
+					case 'w':
+						snprintf(file_out_mode, sizeof(file_out_mode), "%s", "w");
+						break;
+					case 'a':
+						snprintf(file_out_mode, sizeof(file_out_mode), "%s", "a");
+						break;	
+				};
+				break;
+
+			case 'o':
+				if (strlen(optarg) < sizeof(file_out_suffix)) {
+					snprintf(file_out_suffix, sizeof(file_out_suffix), "%s", optarg);
+				} else {
+					fprintf(stderr, " Output file suffix too long: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case 'j':
+				jobs = atoi(optarg);
+				if (jobs < 1) {
+					fprintf(stderr, " Number of jobs too small: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
 			case CMD_outputtype:
 				DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Got output string: %s", optarg);
 
@@ -239,24 +310,113 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
+	/* reload replaced database files on request */
+	libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+
+	if (flag_nocache == 0) {
+		/* round up to power of 2 for masking the hash */
+		for (i = 1; i < cache_size; i <<= 1);
+		cache_size = i;
+
+		cache = calloc(cache_size, sizeof(s_cache_entry));
+		if (cache == NULL) {
+			fprintf(stderr, "Can't allocate memory for cache entries: %d\n", cache_size);
+			exit(EXIT_FAILURE);
+		};
+
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Cache entries: %d", cache_size);
+	};
+
+	if (strlen(file_out_suffix) > 0) {
+		if (file_out_flag != 0) {
+			fprintf(stderr, "Output file suffix can't be combined with output file\n");
+			exit(EXIT_FAILURE);
+		};
+
+		if (argc == 0) {
+			fprintf(stderr, "Output file suffix requires input files\n");
+			exit(EXIT_FAILURE);
+		};
+
+		fileworker_outputtype = outputtype;
+
+		/* children inherit the databases, database files accessed by file offset are reopened */
+		if (libipv6calc_stream_files_run(argv, argc, file_out_suffix, "w", jobs, fileworker, libipv6calc_db_wrapper_reopen) != 0) {
+			exit(EXIT_FAILURE);
+		};
+
+		libipv6calc_db_wrapper_cleanup();
+
+		exit(EXIT_SUCCESS);
+	} else if (jobs > 1) {
+		fprintf(stderr, "Parallel processing requires output file suffix\n");
+		exit(EXIT_FAILURE);
+	};
+
+	if (file_out_flag == 1) {
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Output file specified: %s", file_out);
+
+		FILE_OUT = libipv6calc_stream_open(file_out, file_out_mode);
+		if (! FILE_OUT) {
+			fprintf(stderr, "Can't open Output file: %s\n", file_out);
+			exit(EXIT_FAILURE);
+		} else {
+			DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Output file opened successfully in %s mode: %s", (strcmp(file_out_mode, "a") == 0) ? "append" : "write", file_out);
+			file_out_flag = 2;
+		};
+	} else {
+		FILE_OUT = stdout;
+	};
+
+	/* input files given as arguments, otherwise stdin */
+	libipv6calc_stream_input_init(&input, argv, argc);
+
 	/* call lineparser */
-	lineparser(outputtype);
+	lineparser(outputtype, &input);
+
+	if (file_out_flag == 2) {
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_general, "Output file is closed now: %s", file_out);
+		fflush(FILE_OUT);
+		if (fclose(FILE_OUT) != 0) {
+			fprintf(stderr, "Error writing output file: %s\n", file_out);
+			exit(EXIT_FAILURE);
+		};
+	} else {
+		fflush(stdout);
+	};
 
 	libipv6calc_db_wrapper_cleanup();
 
+	if (input.error != 0) {
+		exit(EXIT_FAILURE);
+	};
+
 	exit(EXIT_SUCCESS);
 };
 
 
+/*
+ * File worker: proceed one input file into given output
+ */
+static int fileworker(s_ipv6calc_stream_input *inputp, FILE *output) {
+	FILE_OUT = output;
+	file_out_flag = 2;
+
+	lineparser(fileworker_outputtype, inputp);
+
+	return(0);
+};
+
+
 /*
  * Line parser
  */
-static void lineparser(const long int outputtype) {
+static void lineparser(const long int outputtype, s_ipv6calc_stream_input *inputp) {
 	char linebuffer[LINEBUFFER];
 	char token[LINEBUFFER];
 	char resultstring[LINEBUFFER];
 	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i;
+	int linecounter = 0, retval;
 
 	ptrptr = &cptr;
 	
@@ -265,8 +425,8 @@ static void lineparser(const long int outputtype) {
 	};
 
 	while (1 == 1) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
+		/* read line from input */
+		charptr = libipv6calc_stream_input_gets(linebuffer, LINEBUFFER, inputp);
 		
 		if (charptr == NULL) {
 			/* end of input */
@@ -280,6 +440,12 @@ static void lineparser(const long int outputtype) {
 				fprintf(stderr, "Ok, proceeding stdin...\n");
 			};
 		};
+
+		if (libipv6calc_db_wrapper_reload_check() > 0) {
+			/* results of reloaded databases can differ, flush cache */
+			DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "Cache: flush after database reload");
+			cache_generation++;
+		};
 		
 		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Line counter: %d", linecounter);
 
@@ -324,7 +490,7 @@ static void lineparser(const long int outputtype) {
 		};
 		
 		/* print result */
-		printf("%s", resultstring);
+		fprintf(FILE_OUT, "%s", resultstring);
 
 		if (outputtype == FORMAT_any) {
 			DEBUGPRINT_NA(DEBUG_ipv6logconv_processing, "Format is 'any', so look for next tokens");
@@ -349,7 +515,7 @@ static void lineparser(const long int outputtype) {
 			*/
 
 			/* skip this token */
-			printf(" %s", charptr);
+			fprintf(FILE_OUT, " %s", charptr);
 			
 			/* look for next token */
 			charptr = strtok_r(NULL, " \t\n", ptrptr);
@@ -366,14 +532,18 @@ static void lineparser(const long int outputtype) {
 			DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token 3: '%s'", charptr);
 			retval = converttoken(resultstring, sizeof(resultstring), token, FORMAT_ouitype, 0);
 			/* print result */
-			printf(" %s", resultstring);
+			fprintf(FILE_OUT, " %s", resultstring);
 		};
 
 END_line:
 		if ((*ptrptr != NULL) && (strlen(*ptrptr) > 0)) {
-			printf(" %s", *ptrptr);
+			fprintf(FILE_OUT, " %s", *ptrptr);
 		} else {;
-			printf("\n");
+			fprintf(FILE_OUT, "\n");
+		};
+
+		if (file_out_flush == 1) {
+			fflush(FILE_OUT);
 		};
 	};
 
@@ -382,9 +552,7 @@ END_line:
 
 		if (flag_nocache == 0) {
 			fprintf(stderr, "Cache statistics:\n");
-			for (i = 0; i < cache_lru_limit; i++) {
-				fprintf(stderr, "Cache distance: %3d  hits: %8ld\n", i, cache_lru_statistics[i]);
-			};
+			fprintf(stderr, "Cache entries: %8d  hits: %8ld  misses: %8ld  hit rate: %5.1f%%\n", cache_size, cache_hit, cache_miss, (cache_hit + cache_miss > 0) ? (100.0 * cache_hit / (cache_hit + cache_miss)) : 0.0);
 		};
 	};
 	return;
@@ -392,11 +560,67 @@ END_line:
 
 
 /*
- * Convert token
+ * Convert token using cache
  */
 static int converttoken(char *resultstring, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown) {
+	const unsigned char *cp;
+	uint32_t hash = 2166136261u;
+	size_t length;
+	s_cache_entry *entry;
+	int retval;
+
+	if (flag_nocache != 0) {
+		return(converttoken_uncached(resultstring, resultstring_length, token, outputtype, flag_skipunknown));
+	};
+
+	/* FNV-1a over raw token bytes, output type mixed in at the end */
+	for (cp = (const unsigned char *) token; *cp != '\0'; cp++) {
+		hash = (hash ^ *cp) * 16777619u;
+	};
+	length = cp - (const unsigned char *) token;
+
+	if (length >= CACHE_TOKEN_MAX) {
+		/* token too long for an entry, never cached */
+		return(converttoken_uncached(resultstring, resultstring_length, token, outputtype, flag_skipunknown));
+	};
+
+	hash = (hash ^ (uint32_t) outputtype ^ ((uint32_t) flag_skipunknown << 31)) * 16777619u;
+
+	entry = &cache[(hash ^ (hash >> 16)) & (cache_size - 1)];
+
+	if ((entry->generation == cache_generation) && (entry->hash == hash) && (entry->outputtype == outputtype) && (entry->flag_skipunknown == flag_skipunknown) && (memcmp(entry->token, token, length + 1) == 0)) {
+		cache_hit++;
+		snprintf(resultstring, resultstring_length, "%s", entry->value);
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Cache: hit key_token=%s key_outputtype=%lx value=%s", token, outputtype, resultstring);
+		return(entry->retval);
+	};
+
+	cache_miss++;
+
+	retval = converttoken_uncached(resultstring, resultstring_length, token, outputtype, flag_skipunknown);
+
+	/* store result, values too long for an entry are not cached */
+	if (strlen(resultstring) < CACHE_VALUE_MAX) {
+		entry->generation = cache_generation;
+		entry->hash = hash;
+		entry->outputtype = outputtype;
+		entry->flag_skipunknown = flag_skipunknown;
+		entry->retval = retval;
+		memcpy(entry->token, token, length + 1);
+		snprintf(entry->value, sizeof(entry->value), "%s", resultstring);
+		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Cache: fill key_token=%s key_outputtype=%lx value=%s", token, outputtype, resultstring);
+	};
+
+	return(retval);
+};
+
+
+/*
+ * Convert token
+ */
+static int converttoken_uncached(char *resultstring, const size_t resultstring_length, const char *token, const long int outputtype, const int flag_skipunknown) {
 	uint32_t inputtype = FORMAT_undefined;
-	int retval = 1, i, registry;
+	int retval = 1, i, registry, flag_parsed;
 	uint32_t typeinfo_test;
 	char tempstring[NI_MAXHOST];
 	ipv6calc_macaddr macaddr;
@@ -414,55 +638,13 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 		return (1);
 	};
 
-	/* use cache ? */
-	if (flag_nocache == 0 && cache_lru_max > 0) {
-		/* check last seen one first */
-		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: look for key=%s", token);
-
-		if (cache_lru_key_outputtype[cache_lru_last - 1] == outputtype) {
-			if (strcmp(cache_lru_key_token[cache_lru_last - 1], token) == 0) {
-				snprintf(resultstring, resultstring_length, "%s", cache_lru_value[cache_lru_last - 1]);
-				cache_lru_statistics[0]++;
-				DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit last line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, token, outputtype, resultstring);
-				return (0);
-			};
-		} else {
-			/* run backwards to first entry */
-			if (cache_lru_last > 1) {
-				for (i = cache_lru_last - 1; i > 0; i--) {
-					if (cache_lru_key_outputtype[i - 1] == outputtype) {
-						if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-							snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-							cache_lru_statistics[cache_lru_last - i]++;
-							DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit line=%d key_token=%s key_outputtype=%lx value=%s", i - 1, token, outputtype, resultstring);
-							return (0);
-						};
-					};
-				};
-			};
-			/* round robin */ 
-			if (cache_lru_last < cache_lru_max) {
-				for (i = cache_lru_max; i > cache_lru_last; i--) {
-					if (cache_lru_key_outputtype[i - 1] == outputtype) {
-						if (strcmp(cache_lru_key_token[i - 1], token) == 0) {
-							snprintf(resultstring, resultstring_length, "%s", cache_lru_value[i - 1]);
-							cache_lru_statistics[cache_lru_max - i + cache_lru_last]++;
-							DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: hit line=%d key_token=%s key_outputtype=%lx value=%s", i - 1, token, outputtype, resultstring);
-							return (0);
-						};
-					};
-				};
-			};
-		};
-	};
-
 
 	/* set addresses to invalid */
 	ipv6addr.flag_valid = 0;
 	ipv4addr.flag_valid = 0;
 	
-	/* autodetection */
-	inputtype = libipv6calc_autodetectinput(token);
+	/* autodetection, common address notations are parsed in the same pass */
+	inputtype = libipv6calc_autodetectinput_parse(token, &ipv4addr, &ipv6addr, NULL, &flag_parsed);
 
 	DEBUGSECTION_BEGIN(DEBUG_ipv6logconv_processing)
 		if (inputtype != FORMAT_undefined) {
@@ -479,14 +661,16 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 	DEBUGSECTION_END
 
 	/* proceed input depending on type */	
-	switch (inputtype) {
-		case FORMAT_ipv6addr:
-			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
-			break;
+	if (flag_parsed == 0) {
+		switch (inputtype) {
+			case FORMAT_ipv6addr:
+				retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+				break;
 
-		case FORMAT_ipv4addr:
-			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
-			break;
+			case FORMAT_ipv4addr:
+				retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+				break;
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "Token: '%s'", token);
@@ -701,26 +885,5 @@ static int converttoken(char *resultstring, const size_t resultstring_length, co
 			return (1);
 	};
 
-	/* use cache ? */
-	if (flag_nocache == 0) {
-		/* calculate pointer */
-		if (cache_lru_max < cache_lru_limit) {
-			cache_lru_last++;
-			cache_lru_max++;
-		} else {
-			if (cache_lru_last == cache_lru_limit) {
-				cache_lru_last = 1;
-			} else {
-				cache_lru_last++;
-			};
-		};
-
-		/* store key and value */
-		snprintf(cache_lru_key_token[cache_lru_last - 1], NI_MAXHOST - 1, "%s", token);
-		cache_lru_key_outputtype[cache_lru_last - 1] = outputtype;
-		snprintf(cache_lru_value[cache_lru_last - 1], NI_MAXHOST - 1, "%s", resultstring);
-		DEBUGPRINT_WA(DEBUG_ipv6logconv_processing, "LRU cache: fill line=%d key_token=%s key_outputtype=%lx value=%s", cache_lru_last - 1, cache_lru_key_token[cache_lru_last - 1], cache_lru_key_outputtype[cache_lru_last - 1], cache_lru_value[cache_lru_last - 1]);
-	};
-
 	return (0);
 };
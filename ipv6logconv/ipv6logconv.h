@@ -13,15 +13,16 @@
 #define PROGRAM_NAME "ipv6logconv"
 #define PROGRAM_COPYRIGHT "(P) & (C) 2002-" COPYRIGHT_YEAR " by Peter Bieringer <pb (at) bieringer.de>"
 
-/* LRU cache maximum size */
-#define CACHE_LRU_SIZE 200
+/* cache size (number of entries, power of 2) */
+#define CACHE_SIZE_DEFAULT	32768
+#define CACHE_SIZE_MAX		1048576
 
 
 #define DEBUG_ipv6logconv_general      0x00000001l
 #define DEBUG_ipv6logconv_processing   0x00000002l
 
 /* prototyping */
-int cache_lru_limit;
+extern int cache_size;
 
 extern int feature_reg;
 extern int feature_ieee;
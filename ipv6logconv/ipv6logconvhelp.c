@@ -16,6 +16,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calccommands.h"
 #include "ipv6calchelp.h"
+#include "libipv6calcstream.h"
 #include "config.h"
 
 /* display info */
@@ -67,9 +68,18 @@ void ipv6logconv_printhelp(void) {
 
 	fprintf(stderr, " Performance options:\n");
 	fprintf(stderr, "  [-n|--nocache]            : disable caching\n");
-	fprintf(stderr, "  [-c|--cachelimit <value>] : set cache limit\n");
-	fprintf(stderr, "                               default: %d\n", cache_lru_limit);
-	fprintf(stderr, "                               maximum: %d\n", CACHE_LRU_SIZE);
+	fprintf(stderr, "  [-c|--cachelimit <value>] : set number of cache entries\n");
+	fprintf(stderr, "                               default: %d\n", CACHE_SIZE_DEFAULT);
+	fprintf(stderr, "                               maximum: %d\n", CACHE_SIZE_MAX);
+	fprintf(stderr, " Input/output options:\n");
+	fprintf(stderr, "  [-w|--write <file>]       : write output to file instead of stdout\n");
+	fprintf(stderr, "  [-a|--append <file>]      : append output to file instead of stdout\n");
+	fprintf(stderr, "                              compressed by suffix of file (.gz/.xz/.zst)\n");
+	fprintf(stderr, "  [-f|--flush]              : flush output after each line\n");
+	fprintf(stderr, "  [-o|--output-suffix <suf>]: write output of each input file to own file\n");
+	fprintf(stderr, "                              named input file (without .gz/.xz/.zst) + suffix\n");
+	fprintf(stderr, "  [-j|--jobs <num>]         : proceed up to <num> input files concurrently\n");
+	fprintf(stderr, "                              (requires --output-suffix, default: 1)\n");
 	fprintf(stderr, " Output options:\n");
 	fprintf(stderr, "  [--out <output type>] : specify output type\n");
 	fprintf(stderr, "   addrtype       : Address type%s\n", (feature_reg == 0) ? "  (NOT-SUPPORTED)" : "");
@@ -81,7 +91,8 @@ void ipv6logconv_printhelp(void) {
 			fprintf(stderr, " NOT-SUPPORTED means either database missing or support not compiled-in\n");
 	};
 	fprintf(stderr, "\n");
-	fprintf(stderr, " Takes data from stdin, proceed it to stdout\n");
+	fprintf(stderr, " Takes data from given files or stdin, proceed it to stdout\n");
+	libipv6calc_stream_printhelp();
 	fprintf(stderr, "\n");
 
 	return;
@@ -20,7 +20,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6logconv_shortopts = "vfh?nc:";
+static char *ipv6logconv_shortopts = "vfh?nc:w:a:j:o:";
 
 /* define long options */
 static struct option ipv6logconv_longopts[] = {
@@ -38,6 +38,10 @@ static struct option ipv6logconv_longopts[] = {
 
 	/* options */
 	{ "out"       , 1, 0, CMD_outputtype },
+	{ "write"     , 1, 0, (int) 'w' },
+	{ "append"    , 1, 0, (int) 'a' },
+	{ "output-suffix", 1, 0, (int) 'o' },
+	{ "jobs"      , 1, 0, (int) 'j' },
 };                
 
 #endif
@@ -76,6 +76,9 @@ cat <<END_CACHE | grep -v "^#"
 195.226.187.50	- - "IPv4 address"
 3ffe:ffff::1	- - "IPv6 address/6bone test"
 3FFE:1a05:510:200:0:5EFE:8CAD:8108 - - 
+# token longer than a cache entry
+0000:0000:0000:0000:0000:ffff:195.226.187.50.unresolvable.example - -
+0000:0000:0000:0000:0000:ffff:195.226.187.50.unresolvable.example - -
 2.2.3.4 - -
 2.2.3.4 - -
 195.226.187.50	- - "IPv4 address"
@@ -96,7 +99,7 @@ END_CACHE
 ## main ##
 echo "Run 'ipv6logconv' function tests..." >&2
 
-if ./ipv6logconv -v | grep -w "CONV_REG" | grep -w "CONV_IEEE"; then
+if ./ipv6logconv -v 2>&1 | grep -w "CONV_REG" | grep -w "CONV_IEEE"; then
 	true
 else
 	echo "NOTICE : ipv6logconv tests skipped, at least one required database feature is missing"
@@ -134,6 +137,19 @@ else
 	echo
 fi
 
+echo "INFO  : compare results with and without cache..."
+for cachelimit in 2 32768; do
+	for outputtype in any addrtype ouitype ipv6addrtype; do
+		result_nocache="`(testscenarios_cache; testscenarios_cache) | grep -v "^#" | ./ipv6logconv --out $outputtype -q -n`"
+		result_cache="`(testscenarios_cache; testscenarios_cache) | grep -v "^#" | ./ipv6logconv --out $outputtype -q -c $cachelimit`"
+		if [ "$result_cache" != "$result_nocache" ]; then
+			echo "ERROR : result with cache (limit $cachelimit) not matching result without cache for output type: $outputtype"
+			exit 1
+		fi
+	done
+done
+echo "INFO  : compare results with and without cache: OK"
+
 echo "INFO  : test scenario with huge amount of addresses..."
 testscenario_hugelist ipv4 | awk '{ print $1 " token2 token3" }' | ./ipv6logconv -q --out any -q >/dev/null
 if [ $? -ne 0 ]; then
@@ -6,6 +6,8 @@
 # Copyright  : 2003 by Peter Bieringer <pb (at) bieringer.de>
 #
 # Collect ipv6logstats data
+#
+# Superseded by "ipv6logstats --collect", which is much faster on many files
 
 my $dir = "./examples-data";
 
@@ -14,6 +14,8 @@
 #include <getopt.h> 
 #include <unistd.h>
 #include <time.h>
+#include <signal.h>
+#include <pthread.h>
 
 #include "config.h"
 
@@ -30,6 +32,9 @@
 #include "libipv4addr.h"
 #include "libipv6addr.h"
 #include "libifinet6.h"
+#include "libipv6calcstream.h"
+#include "libipv6calcsketch.h"
+#include "librfc1884.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
 #include "../databases/lib/libipv6calc_db_wrapper_GeoIP.h"
@@ -42,6 +47,28 @@
 
 #define LINEBUFFER	16384
 
+/* lines parsed before database lookup of the block (IPv4 registry by interleaved search) */
+#define IPV6LOGSTATS_BLOCK_LINES	256
+
+/* parsed line */
+typedef struct {
+	uint32_t inputtype;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;	// IPv4 address or included IPv4 address
+	int ipv4addr_valid;
+	char token[NI_MAXHOST];
+	int stat_unknown;		// no address (inputtype undefined): 1 = counted as UNKNOWN
+	time_t logtime;			// timestamp of line (interval by log time), 0 = unknown
+	int registry;			// registry of IPv4 address, looked up for the whole block
+	int registry_valid;
+} s_ipv6logstats_entry;
+
+/* top prefixes of a protocol and prefix length */
+typedef struct {
+	int proto;
+	int length;
+} s_ipv6logstats_top_prefix;
+
 long int ipv6calc_debug = 0;	// ipv6calc_debug usage ok
 
 static int opt_unknown = 0;
@@ -51,6 +78,14 @@ static int opt_noheader = 0;
 static int opt_onlyheader = 0;
 static int opt_printdirection = 0; /* rows */
 static char opt_token[NI_MAXHOST] = "";
+static int opt_unique = 0;
+static int opt_unique_sketch = 0;
+static int opt_top_count = TOP_COUNT_DEFAULT;
+static int opt_interval = 0;
+static int opt_interval_logtime = 0;
+static int opt_binary = 0;
+static int opt_collect = 0;
+static int jobs = 1;
 
 char    file_out[NI_MAXHOST] = "";
 int     file_out_flag = 0;
@@ -61,71 +96,128 @@ int feature_as  = 0;
 int feature_reg = 0;
 
 static stat_entries ipv6logstats_statentries[] = {
-	{ STATS_ALL		, 0, "ALL" },
-	{ STATS_IPV4		, 0, "IPv4" },
-	{ STATS_IPV6		, 0, "IPv6" },
-	{ STATS_UNKNOWN		, 0, "UNKNOWN" },
-	{ STATS_IPV4_APNIC	, 0, "IPv4/APNIC" },
-	{ STATS_IPV4_ARIN	, 0, "IPv4/ARIN" },
-	{ STATS_IPV4_RIPENCC	, 0, "IPv4/RIPE" },
-	{ STATS_IPV4_LACNIC	, 0, "IPv4/LACNIC" },
-	{ STATS_IPV4_AFRINIC	, 0, "IPv4/AFRINIC" },
-	{ STATS_IPV4_UNKNOWN	, 0, "IPv4/UNKNOWN" },
-	{ STATS_IPV6_6BONE	, 0, "IPv6/6bone" },
-	{ STATS_IPV6_IANA	, 0, "IPv6/IANA" },
-	{ STATS_IPV6_APNIC	, 0, "IPv6/APNIC" },
-	{ STATS_IPV6_ARIN	, 0, "IPv6/ARIN" },
-	{ STATS_IPV6_RIPENCC    , 0, "IPv6/RIPE" },
-	{ STATS_IPV6_LACNIC	, 0, "IPv6/LACNIC" },
-	{ STATS_IPV6_AFRINIC	, 0, "IPv6/AFRINIC" },
-	{ STATS_IPV6_RESERVED	, 0, "IPv6/RESERVED" },
-	{ STATS_IPV6_UNKNOWN	, 0, "IPv6/UNKNOWN" },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_IANA    , 0, "IPv6/6to4/IANA"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_APNIC   , 0, "IPv6/6to4/APNIC"    },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_ARIN    , 0, "IPv6/6to4/ARIN"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_RIPENCC , 0, "IPv6/6to4/RIPE"     },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_LACNIC  , 0, "IPv6/6to4/LACNIC"   },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_AFRINIC , 0, "IPv6/6to4/AFRINIC"  },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_RESERVED, 0, "IPv6/6to4/RESERVED" },
-	{ STATS_IPV6_6TO4_BASE + REGISTRY_UNKNOWN , 0, "IPv6/6to4/UNKNOWN"  },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_IANA    , 0, "IPv6/Teredo/IANA"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_APNIC   , 0, "IPv6/Teredo/APNIC"    },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_ARIN    , 0, "IPv6/Teredo/ARIN"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RIPENCC , 0, "IPv6/Teredo/RIPE"     },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_LACNIC  , 0, "IPv6/Teredo/LACNIC"   },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_AFRINIC , 0, "IPv6/Teredo/AFRINIC"  },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RESERVED, 0, "IPv6/Teredo/RESERVED" },
-	{ STATS_IPV6_TEREDO_BASE + REGISTRY_UNKNOWN , 0, "IPv6/Teredo/UNKNOWN"  },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_IANA    , 0, "IPv6/NAT64/IANA"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_APNIC   , 0, "IPv6/NAT64/APNIC"    },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_ARIN    , 0, "IPv6/NAT64/ARIN"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_RIPENCC , 0, "IPv6/NAT64/RIPE"     },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_LACNIC  , 0, "IPv6/NAT64/LACNIC"   },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_AFRINIC , 0, "IPv6/NAT64/AFRINIC"  },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_RESERVED, 0, "IPv6/NAT64/RESERVED" },
-	{ STATS_IPV6_NAT64_BASE + REGISTRY_UNKNOWN , 0, "IPv6/NAT64/UNKNOWN"  },
-	{ STATS_IPV6_IID_GLOBAL, 0, "IPv6/IID/Global" },
-	{ STATS_IPV6_IID_RANDOM, 0, "IPv6/IID/Random" },
-	{ STATS_IPV6_IID_MANUAL, 0, "IPv6/IID/Manual" },
-	{ STATS_IPV6_IID_ISATAP, 0, "IPv6/IID/ISATAP" },
-	{ STATS_IPV6_IID_MANUAL, 0, "IPv6/IID/Unknown" },
-};
-
-/* stat by Country Code */
-static long unsigned int counter_country[COUNTRYCODE_INDEX_MAX];
-static long unsigned int counter_country_ipv4[COUNTRYCODE_INDEX_MAX];
-static long unsigned int counter_country_ipv6[COUNTRYCODE_INDEX_MAX];
-
-static long unsigned int counter_country_A46, counter_country_IPV4, counter_country_IPV6;
+	{ STATS_ALL		, "ALL" },
+	{ STATS_IPV4		, "IPv4" },
+	{ STATS_IPV6		, "IPv6" },
+	{ STATS_UNKNOWN		, "UNKNOWN" },
+	{ STATS_IPV4_APNIC	, "IPv4/APNIC" },
+	{ STATS_IPV4_ARIN	, "IPv4/ARIN" },
+	{ STATS_IPV4_RIPENCC	, "IPv4/RIPE" },
+	{ STATS_IPV4_LACNIC	, "IPv4/LACNIC" },
+	{ STATS_IPV4_AFRINIC	, "IPv4/AFRINIC" },
+	{ STATS_IPV4_UNKNOWN	, "IPv4/UNKNOWN" },
+	{ STATS_IPV6_6BONE	, "IPv6/6bone" },
+	{ STATS_IPV6_IANA	, "IPv6/IANA" },
+	{ STATS_IPV6_APNIC	, "IPv6/APNIC" },
+	{ STATS_IPV6_ARIN	, "IPv6/ARIN" },
+	{ STATS_IPV6_RIPENCC    , "IPv6/RIPE" },
+	{ STATS_IPV6_LACNIC	, "IPv6/LACNIC" },
+	{ STATS_IPV6_AFRINIC	, "IPv6/AFRINIC" },
+	{ STATS_IPV6_RESERVED	, "IPv6/RESERVED" },
+	{ STATS_IPV6_UNKNOWN	, "IPv6/UNKNOWN" },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_IANA    , "IPv6/6to4/IANA"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_APNIC   , "IPv6/6to4/APNIC"    },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_ARIN    , "IPv6/6to4/ARIN"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_RIPENCC , "IPv6/6to4/RIPE"     },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_LACNIC  , "IPv6/6to4/LACNIC"   },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_AFRINIC , "IPv6/6to4/AFRINIC"  },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_RESERVED, "IPv6/6to4/RESERVED" },
+	{ STATS_IPV6_6TO4_BASE + REGISTRY_UNKNOWN , "IPv6/6to4/UNKNOWN"  },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_IANA    , "IPv6/Teredo/IANA"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_APNIC   , "IPv6/Teredo/APNIC"    },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_ARIN    , "IPv6/Teredo/ARIN"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RIPENCC , "IPv6/Teredo/RIPE"     },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_LACNIC  , "IPv6/Teredo/LACNIC"   },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_AFRINIC , "IPv6/Teredo/AFRINIC"  },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_RESERVED, "IPv6/Teredo/RESERVED" },
+	{ STATS_IPV6_TEREDO_BASE + REGISTRY_UNKNOWN , "IPv6/Teredo/UNKNOWN"  },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_IANA    , "IPv6/NAT64/IANA"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_APNIC   , "IPv6/NAT64/APNIC"    },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_ARIN    , "IPv6/NAT64/ARIN"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_RIPENCC , "IPv6/NAT64/RIPE"     },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_LACNIC  , "IPv6/NAT64/LACNIC"   },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_AFRINIC , "IPv6/NAT64/AFRINIC"  },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_RESERVED, "IPv6/NAT64/RESERVED" },
+	{ STATS_IPV6_NAT64_BASE + REGISTRY_UNKNOWN , "IPv6/NAT64/UNKNOWN"  },
+	{ STATS_IPV6_IID_GLOBAL, "IPv6/IID/Global" },
+	{ STATS_IPV6_IID_RANDOM, "IPv6/IID/Random" },
+	{ STATS_IPV6_IID_MANUAL, "IPv6/IID/Manual" },
+	{ STATS_IPV6_IID_ISATAP, "IPv6/IID/ISATAP" },
+	{ STATS_IPV6_IID_MANUAL, "IPv6/IID/Unknown" },
+};
 
 /* stat by ASN (only 16-bit ASN supported, 32-bit ASNs are mapped to 23456 "AS_TRANS" */
 #define ASNUM_MAX     65536
-static long unsigned int counter_asn[ASNUM_MAX];
-static long unsigned int counter_asn_ipv4[ASNUM_MAX];
-static long unsigned int counter_asn_ipv6[ASNUM_MAX];
+
+/* counters of a statistic (one block, in interval mode one per interval) */
+typedef struct {
+	long unsigned int statentries[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+
+	/* stat by Country Code */
+	long unsigned int country[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv4[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_ipv6[COUNTRYCODE_INDEX_MAX];
+	long unsigned int country_A46, country_IPV4, country_IPV6;
+
+	/* stat by ASN */
+	long unsigned int asn[ASNUM_MAX];
+	long unsigned int asn_ipv4[ASNUM_MAX];
+	long unsigned int asn_ipv6[ASNUM_MAX];
+
+	/* unique clients (HyperLogLog sketches, allocated on first use) */
+	s_ipv6calc_hll *unique_statentries[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+	s_ipv6calc_hll *unique_country_ipv4[COUNTRYCODE_INDEX_MAX];
+	s_ipv6calc_hll *unique_country_ipv6[COUNTRYCODE_INDEX_MAX];
+	s_ipv6calc_hll *unique_asn_ipv4[ASNUM_MAX];
+	s_ipv6calc_hll *unique_asn_ipv6[ASNUM_MAX];
+	s_ipv6calc_hll *unique_ipv6_prefix48;
+
+	/* top prefixes (Space-Saving, memory bounded by top count) */
+	s_ipv6calc_topk *top_prefix[TOP_PREFIX_MAX];
+} s_ipv6logstats_counters;
+
+static s_ipv6logstats_counters counters_block[2];
+
+/* counters updated by lineparser */
+static s_ipv6logstats_counters *counters = &counters_block[0];
+
+/* top prefixes */
+static s_ipv6logstats_top_prefix top_prefix[TOP_PREFIX_MAX];
+static int top_prefix_count = 0;
+
+/* interval mode: counters of finished interval are handed over to the emitter thread */
+static pthread_mutex_t interval_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t interval_cond = PTHREAD_COND_INITIALIZER;
+static s_ipv6logstats_counters *counters_retired = NULL;
+static time_t interval_start = 0;
+static time_t interval_retired_start, interval_retired_end;
+static int interval_end_of_input = 0;
+
+/* collect mode: merged statistics of a key (token or interval start) */
+typedef struct {
+	char key[NI_MAXHOST];
+	long unsigned int statentries[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+	s_ipv6calc_hll *unique_statentries[MAXENTRIES_ARRAY(ipv6logstats_statentries)];
+} s_ipv6logstats_collect_record;
+
+/* collect mode: statistics read from a file */
+typedef struct {
+	char *filename;
+	s_ipv6logstats_collect_record *records;
+	int count;
+	int size;
+	int error;
+} s_ipv6logstats_collect_file;
+
+static pthread_mutex_t collect_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int collect_next, collect_files_count;
+
+/* collect mode: counters printed in row mode (like collect_ipv6logstats.pl) */
+static const char *collect_tokens[] = { "ALL", "IPv4", "IPv6" };
 
 /* prototypes */
-static void lineparser(void);
+static void lineparser(s_ipv6calc_stream_input *inputp);
+static int collect(char * const *filenames, const int count);
 
 
 /**************************************************/
@@ -137,8 +229,9 @@ int main(int argc,char *argv[]) {
 	IPV6CALC_DB_LIB_VERSION_CHECK_EXIT(IPV6CALC_PACKAGE_VERSION_NUMERIC, IPV6CALC_PACKAGE_VERSION_STRING)
 #endif // SHARED_LIBRARY
 
-	int i, lop, result;
+	int i, b, lop, result;
 	unsigned long int command = 0;
+	s_ipv6calc_stream_input input;
 
 	/* options */
 	struct option longopts[IPV6CALC_MAXLONGOPTIONS];
@@ -238,6 +331,72 @@ int main(int argc,char *argv[]) {
 				opt_simple = 1; // force simple mode in addition
 				break;
 
+			case 'U':
+				opt_unique = 1;
+				break;
+
+			case CMD_unique_sketch:
+				opt_unique = 1;
+				opt_unique_sketch = 1;
+				break;
+
+			case 'T':
+				if (top_prefix_count == TOP_PREFIX_MAX) {
+					fprintf(stderr, " Too many top prefixes given (max: %d)\n", TOP_PREFIX_MAX);
+					exit(EXIT_FAILURE);
+				};
+				if (strncasecmp(optarg, "ipv4/", 5) == 0) {
+					top_prefix[top_prefix_count].proto = 4;
+				} else if (strncasecmp(optarg, "ipv6/", 5) == 0) {
+					top_prefix[top_prefix_count].proto = 6;
+				} else {
+					fprintf(stderr, " Unsupported top prefix (expected: ipv4|ipv6/<length>): %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				top_prefix[top_prefix_count].length = atoi(optarg + 5);
+				if ((top_prefix[top_prefix_count].length < 1) || (top_prefix[top_prefix_count].length > ((top_prefix[top_prefix_count].proto == 4) ? 32 : 128))) {
+					fprintf(stderr, " Unsupported top prefix length: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				top_prefix_count++;
+				break;
+
+			case CMD_top_count:
+				opt_top_count = atoi(optarg);
+				if ((opt_top_count < 1) || (opt_top_count > TOP_COUNT_MAX)) {
+					fprintf(stderr, " Number of top prefixes out of range (1-%d): %s\n", TOP_COUNT_MAX, optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_interval:
+				opt_interval = atoi(optarg);
+				if ((opt_interval < 1) || (opt_interval > INTERVAL_MAX)) {
+					fprintf(stderr, " Interval out of range (1-%d seconds): %s\n", INTERVAL_MAX, optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
+			case CMD_interval_logtime:
+				opt_interval_logtime = 1;
+				break;
+
+			case CMD_binary:
+				opt_binary = 1;
+				break;
+
+			case CMD_collect:
+				opt_collect = 1;
+				break;
+
+			case 'j':
+				jobs = atoi(optarg);
+				if (jobs < 1) {
+					fprintf(stderr, " Number of jobs too small: %s\n", optarg);
+					exit(EXIT_FAILURE);
+				};
+				break;
+
 			case 'w':
 				if (strlen(optarg) < sizeof(file_out)) {
 					snprintf(file_out, sizeof(file_out), "%s", optarg);
@@ -257,6 +416,16 @@ int main(int argc,char *argv[]) {
 	argv += optind;
 	argc -= optind;
 
+	if ((opt_interval_logtime == 1) && (opt_interval == 0)) {
+		fprintf(stderr, " Option --interval-logtime requires --interval\n");
+		exit(EXIT_FAILURE);
+	};
+
+	if ((opt_binary == 1) && (opt_interval == 0) && (strlen(opt_token) == 0)) {
+		fprintf(stderr, " Option --binary requires -p|--prefix <token> or --interval\n");
+		exit(EXIT_FAILURE);
+	};
+
         /* initialise database wrapper */
 	result = libipv6calc_db_wrapper_init("*3*DB-Info: ");
 	if (result != 0) {
@@ -300,16 +469,43 @@ int main(int argc,char *argv[]) {
 		exit(EXIT_FAILURE);
 	};
 
+	if (opt_collect == 1) {
+		/* given files are statistics */
+		result = collect(argv, argc);
+		libipv6calc_db_wrapper_cleanup();
+		exit((result == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+	};
+
 	if (feature_reg == 0) {
 		fprintf(stderr, "Basic databases are missing for creating statistic\n");
 		exit(EXIT_FAILURE);
 	};
 
+	/* reload replaced database files on request */
+	libipv6calc_db_wrapper_reload_on_signal(SIGHUP);
+
+	for (i = 0; i < top_prefix_count; i++) {
+		/* interval mode: counters of next interval are filled while the finished one is printed */
+		for (b = 0; b < ((opt_interval > 0) ? 2 : 1); b++) {
+			counters_block[b].top_prefix[i] = libipv6calc_topk_new(opt_top_count * TOP_CAPACITY_FACTOR, top_prefix[i].length);
+			if (counters_block[b].top_prefix[i] == NULL) {
+				exit(EXIT_FAILURE);
+			};
+		};
+	};
+
+	/* input files given as arguments, otherwise stdin */
+	libipv6calc_stream_input_init(&input, argv, argc);
+
 	/* call lineparser */
-	lineparser();
+	lineparser(&input);
 
 	libipv6calc_db_wrapper_cleanup();
 
+	if (input.error != 0) {
+		exit(EXIT_FAILURE);
+	};
+
 	exit(EXIT_SUCCESS);
 };
 
@@ -322,7 +518,74 @@ static void stat_inc(int number) {
 	
 	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
 		if (number == ipv6logstats_statentries[i].number) {
-			ipv6logstats_statentries[i].counter++;
+			counters->statentries[i]++;
+			break;
+		};
+	};
+};
+
+
+/*
+ * Unique client statistics
+ */
+static void stat_unique_add(s_ipv6calc_hll **hllp, const uint64_t hash) {
+	if (*hllp == NULL) {
+		*hllp = libipv6calc_hll_new();
+		if (*hllp == NULL) {
+			exit(EXIT_FAILURE);
+		};
+	};
+
+	if (libipv6calc_hll_add(*hllp, hash) != 0) {
+		exit(EXIT_FAILURE);
+	};
+};
+
+static const s_ipv6calc_hll *stat_unique_by_number(const s_ipv6logstats_counters *countersp, const int number) {
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (number == ipv6logstats_statentries[i].number) {
+			return(countersp->unique_statentries[i]);
+		};
+	};
+
+	return(NULL);
+};
+
+static uint64_t stat_unique_estimate(const s_ipv6logstats_counters *countersp, const int i) {
+	if (ipv6logstats_statentries[i].number == STATS_ALL) {
+		/* clients of IPv4 and IPv6 are disjunct */
+		return(libipv6calc_hll_estimate_union(stat_unique_by_number(countersp, STATS_IPV4), stat_unique_by_number(countersp, STATS_IPV6)));
+	};
+
+	return(libipv6calc_hll_estimate(countersp->unique_statentries[i]));
+};
+
+static void stat_unique_print_sketch(const char *token, const s_ipv6calc_hll *hll) {
+	static char sketchstring[IPV6CALC_HLL_REGISTERS + 16];
+
+	if (hll == NULL) {
+		return;
+	};
+
+	if (libipv6calc_hll_to_string(hll, sketchstring, sizeof(sketchstring)) != 0) {
+		exit(EXIT_FAILURE);
+	};
+
+	printf("*4*HLL%s %s\n", token, sketchstring);
+};
+
+/* increment counter and add client to unique sketch */
+static void stat_inc_unique(int number, const uint64_t hash) {
+	int i;
+	
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (number == ipv6logstats_statentries[i].number) {
+			counters->statentries[i]++;
+			if (opt_unique == 1) {
+				stat_unique_add(&counters->unique_statentries[i], hash);
+			};
 			break;
 		};
 	};
@@ -332,7 +595,7 @@ static void stat_inc(int number) {
 /*
  * Country code statistics
  */
-static void stat_inc_country_code(uint16_t country_code, const int proto) {
+static void stat_inc_country_code(uint16_t country_code, const int proto, const uint64_t hash) {
 	int index = COUNTRYCODE_INDEX_UNKNOWN;
 
 	if (country_code < COUNTRYCODE_INDEX_MAX) {
@@ -344,26 +607,30 @@ static void stat_inc_country_code(uint16_t country_code, const int proto) {
 
 	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment CountryCode index: %d (%d)", index, country_code);
 
-	counter_country[index]++;
-	counter_country_A46++;
+	counters->country[index]++;
+	counters->country_A46++;
 
 	if (proto == 4) {
-		counter_country_ipv4[index]++;
-		counter_country_IPV4++;
+		counters->country_ipv4[index]++;
+		counters->country_IPV4++;
 	} else if (proto == 6) {
-		counter_country_ipv6[index]++;
-		counter_country_IPV6++;
+		counters->country_ipv6[index]++;
+		counters->country_IPV6++;
 	} else {
 		fprintf(stderr, "%s/%s: unexpected unsupported proto: %d\n", __FILE__, __func__, proto);
 		exit(1);
 	};
+
+	if (opt_unique == 1) {
+		stat_unique_add((proto == 4) ? &counters->unique_country_ipv4[index] : &counters->unique_country_ipv6[index], hash);
+	};
 };
 
 
 /*
  * AS Number statistics
  */
-static void stat_inc_asnum(const uint32_t as_num32, const int proto) {
+static void stat_inc_asnum(const uint32_t as_num32, const int proto, const uint64_t hash) {
 	unsigned int index = ASNUM_AS_UNKNOWN;
 
 	if (as_num32 < ASNUM_MAX) {
@@ -376,496 +643,310 @@ static void stat_inc_asnum(const uint32_t as_num32, const int proto) {
 
 	DEBUGPRINT_WA(DEBUG_ipv6logstats_general, "Increment ASN index: %d (%d)", index, as_num32);
 
-	counter_asn[index]++;
+	counters->asn[index]++;
 
 	if (proto == 4) {
-		counter_asn_ipv4[index]++;
+		counters->asn_ipv4[index]++;
 	} else if (proto == 6) {
-		counter_asn_ipv6[index]++;
+		counters->asn_ipv6[index]++;
+	};
+
+	if (opt_unique == 1) {
+		stat_unique_add((proto == 4) ? &counters->unique_asn_ipv4[index] : &counters->unique_asn_ipv6[index], hash);
 	};
 };
 
 
 /*
- * Line parser
+ * Print statistics
  */
-static void lineparser(void) {
-	char linebuffer[LINEBUFFER];
-	char token[LINEBUFFER];
-	char resultstring[LINEBUFFER];
-	char *charptr, *cptr, **ptrptr;
-	int linecounter = 0, retval, i, r;
-
-	uint32_t inputtype  = FORMAT_undefined;
-	ipv6calc_ipv6addr ipv6addr;
-	ipv6calc_ipv4addr ipv4addr;
-	int registry, stat_registry_base;
-
-	time_t timer;
-	struct tm* tm_info;
-
-	int index;
-	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
-	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
-	long unsigned int c_all, c_ipv4, c_ipv6;
-
-	int column_offset = 1;
+/*
+ * print header of column mode
+ */
+static void stat_print_column_header(void) {
+	int i, column_offset = 1;
 
-	// clear counters
-	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
-		counter_country[i] = 0;
-		counter_country_ipv4[i] = 0;
-		counter_country_ipv6[i] = 0;
+	if (opt_interval > 0) {
+		column_offset++;
+		if (opt_column_numbers == 1) {
+			printf("Interval(1) ");
+		} else {
+			printf("Interval ");
+		};
 	};
-
-	ptrptr = &cptr;
-	
-	if (opt_onlyheader == 0) {
-		if (ipv6calc_quiet == 0) {
-			fprintf(stderr, "Expecting log lines on stdin\n");
+	if (strlen(opt_token) > 0) {
+		column_offset++;
+		if (opt_onlyheader == 0) {
+			if (opt_column_numbers == 1) {
+				printf("Token(%d) ", column_offset - 1);
+			} else {
+				printf("Token ");
+			}
+		} else {
+			printf("%s ", opt_token);
 		};
 	};
-
-	while (opt_onlyheader == 0) {
-		/* read line from stdin */
-		charptr = fgets(linebuffer, LINEBUFFER, stdin);
-		
-		if (charptr == NULL) {
-			/* end of input */
-			break;
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (i > 0) {
+			printf(" ");
 		};
-
-		linecounter++;
-
-		stat_registry_base = 0;
-
-		if (linecounter == 1) {
-			if (ipv6calc_quiet == 0) {
-				fprintf(stderr, "Ok, proceeding stdin...\n");
-			};
+		if (opt_column_numbers == 1) {
+			printf("%s(%d)", ipv6logstats_statentries[i].token, i + column_offset);
+		} else {
+			printf("%s", ipv6logstats_statentries[i].token);
 		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
-
-		if (strlen(linebuffer) >= LINEBUFFER) {
-			fprintf(stderr, "Line too long: %d\n", linecounter);
-			continue;
+	};
+	if (opt_unique == 1) {
+		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+			if (opt_column_numbers == 1) {
+				printf(" Unique/%s(%d)", ipv6logstats_statentries[i].token, (int) (i + column_offset + MAXENTRIES_ARRAY(ipv6logstats_statentries)));
+			} else {
+				printf(" Unique/%s", ipv6logstats_statentries[i].token);
+			};
 		};
+	};
+	printf(" #Version(%d.%d)\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+};
 
-		/* remove trailing \n */
-		if (linebuffer[strlen(linebuffer) - 1] == '\n') {
-			linebuffer[strlen(linebuffer) - 1] = '\0';
-		};
 
-		
-		if (strlen(linebuffer) == 0) {
-			fprintf(stderr, "Line empty: %d\n", linecounter);
-			continue;
-		};
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
+/*
+ * print statistics of counters
+ *
+ * in : countersp = counters
+ * in : start, end = time interval (only used in interval mode)
+ */
+static void stat_print(const s_ipv6logstats_counters *countersp, const time_t start, const time_t end) {
+	char resultstring[LINEBUFFER];
+	char token[LINEBUFFER];
+	int i, e, r, index;
+	long unsigned int c_all, c_ipv4, c_ipv6;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+	s_ipv6calc_topk_entry *top_entries;
+	uint32_t top_entries_count;
 
-		/* look for first token (should be IP address) */
-		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
-		
-		if ( charptr == NULL ) {
-			fprintf(stderr, "Line contains no token: %d\n", linecounter);
-			continue;
-		};
+	time_t timer;
+	struct tm* tm_info;
 
-		if ( strlen(charptr) >=  LINEBUFFER) {
-			fprintf(stderr, "Line too strange: %d\n", linecounter);
-			continue;
-		};
+	if (opt_printdirection == 0) {
+		/* print in rows */
 
-		snprintf(token, sizeof(token), "%s", charptr);
-		
-		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
+		/* print version number */
+		printf("%-20s %d.%d\n", "*Version", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
 
-		stat_inc(STATS_ALL);
+		time(&timer);
+		tm_info = gmtime(&timer);
+		strftime(resultstring, sizeof(resultstring), "%Y:%m:%d %H:%M:%S%z %Z", tm_info);
 
-		/* get input type now */
-		inputtype = libipv6calc_autodetectinput(token);
+		printf("*DateTime: %s\n", resultstring);
+		printf("*UnixTime: %ju\n", (uintmax_t) timer);
 
-		/* check for proper type */
-		if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
-			/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
-			stat_inc(STATS_UNKNOWN);
-			continue;
+		if (opt_interval > 0) {
+			printf("*Interval: %ju %ju\n", (uintmax_t) start, (uintmax_t) end);
+		} else {
+			libipv6calc_db_wrapper_print_db_info(0, "*3*DB-Info: ");
 		};
 
-		/* fill related structure */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
-				break;
-
-			case FORMAT_ipv4addr:
-				retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
-				break;
-
-			default:
-				retval = 0;
-				break;
+		/* print version number */
+		if (strlen(opt_token) > 0) {
+			printf("%-20s %s\n", "*Token", opt_token);
 		};
 
-		if (retval != 0 ) {
-			fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
-			continue;
+		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+			printf("%-20s %lu\n", ipv6logstats_statentries[i].token, countersp->statentries[i]);
 		};
 
-		/* catch compat/mapped */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				if ((ipv6addr.typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
-					/* extract IPv4 address */
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
-
-					// remap
-					inputtype = FORMAT_ipv4addr;
-
-					// create text represenation
-					r = libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token, sizeof(token), 0);
+		if (opt_unique == 1) {
+			/* unique clients */
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+				if (countersp->statentries[i] > 0) {
+					printf("*3*Unique/%s  %ju\n", ipv6logstats_statentries[i].token, (uintmax_t) stat_unique_estimate(countersp, i));
 				};
-				break;
+			};
 
-			default:
-				// nothing to do
-				break;
+			if (countersp->unique_ipv6_prefix48 != NULL) {
+				printf("*3*Unique-prefix/IPv6/48  %ju\n", (uintmax_t) libipv6calc_hll_estimate(countersp->unique_ipv6_prefix48));
+			};
 		};
 
-		/* get information and fill statistics */
-		switch (inputtype) {
-			case FORMAT_ipv6addr:
-				/* is IPv6 address */
-				stat_inc(STATS_IPV6);
-
-				if ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
-					/* has public IPv4 address included */
-
-					// get IPv4 address (in case of Teredo the client IP)
-					r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
-					if (r != 0) {
-						continue;
-					};
-
-					if (opt_simple != 1) {
-						cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-						as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr, NULL);
-						if (feature_cc == 1) {
-							stat_inc_country_code(cc_index, 4);
-						};
+		if (feature_cc == 1) {
+			/* country_code / proto */
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (countersp->country[index] > 0) {
+					DEBUGPRINT_WA(DEBUG_ipv6logstats_summary, "CC-Index: %d", index);
 
-						if (feature_as == 1) {
-							stat_inc_asnum(as_num32, 4);
-						};
-					};
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
 
-					registry = libipv4addr_registry_num_by_addr(&ipv4addr);
+					printf("*3*CC-code-proto/%s/ALL   %lu\n", resultstring, countersp->country[index]);
+					printf("*3*CC-code-proto/%s/IPv4  %lu\n", resultstring, countersp->country_ipv4[index]);
+					printf("*3*CC-code-proto/%s/IPv6  %lu\n", resultstring, countersp->country_ipv6[index]);
+					printf("*3*CC-code-proto-list/%s  %lu %lu %lu\n", resultstring, countersp->country[index], countersp->country_ipv4[index], countersp->country_ipv6[index]);
+				};
+			};
 
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
-						stat_registry_base = STATS_IPV6_6TO4_BASE;
+			/* proto / country_code */
+			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (countersp->country[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/ALL/%s   %lu\n", resultstring, countersp->country[index]);
+					c_all += countersp->country[index];
+				};
+			};
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (countersp->country_ipv4[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/IPv4/%s  %lu\n", resultstring, countersp->country_ipv4[index]);
+					c_ipv4 += countersp->country_ipv4[index];
+				};
+			};
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (countersp->country_ipv6[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+					printf("*3*CC-proto-code/IPv6/%s  %lu\n", resultstring, countersp->country_ipv6[index]);
+					c_ipv6 += countersp->country_ipv6[index];
+				};
+			};
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
-						stat_registry_base = STATS_IPV6_TEREDO_BASE;
+			if ((c_all + c_ipv4 + c_ipv6) > 0) {
+				printf("*3*CC-proto-code-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
+			};
 
-					} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
-						stat_registry_base = STATS_IPV6_NAT64_BASE;
+			if (opt_unique == 1) {
+				/* unique clients by country_code: ALL IPv4 IPv6 */
+				for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+					if (countersp->country[index] > 0) {
+						libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
+						printf("*3*CC-code-unique-list/%s  %ju %ju %ju\n", resultstring
+							, (uintmax_t) libipv6calc_hll_estimate_union(countersp->unique_country_ipv4[index], countersp->unique_country_ipv6[index])
+							, (uintmax_t) libipv6calc_hll_estimate(countersp->unique_country_ipv4[index])
+							, (uintmax_t) libipv6calc_hll_estimate(countersp->unique_country_ipv6[index]));
 					};
-
-					if (stat_registry_base > 0) {
-						switch (registry) {
-							case IPV4_ADDR_REGISTRY_IANA:
-								stat_inc(stat_registry_base + REGISTRY_IANA);
-								break;
-							case IPV4_ADDR_REGISTRY_APNIC:
-								stat_inc(stat_registry_base + REGISTRY_APNIC);
-								break;
-							case IPV4_ADDR_REGISTRY_ARIN:
-								stat_inc(stat_registry_base + REGISTRY_ARIN);
-								break;
-							case IPV4_ADDR_REGISTRY_RIPENCC:
-								stat_inc(stat_registry_base + REGISTRY_RIPENCC);
-								break;
-							case IPV4_ADDR_REGISTRY_LACNIC:
-								stat_inc(stat_registry_base + REGISTRY_LACNIC);
-								break;
-							case IPV4_ADDR_REGISTRY_AFRINIC:
-								stat_inc(stat_registry_base + REGISTRY_AFRINIC);
-								break;
-							case IPV4_ADDR_REGISTRY_RESERVED:
-								stat_inc(stat_registry_base + REGISTRY_RESERVED);
-								break;
-							default:
-								stat_inc(stat_registry_base + REGISTRY_UNKNOWN);
-								if (opt_unknown == 1) {
-									fprintf(stderr, "Unknown address: %s\n", token);
-								};
-								break;
-						};
-					} else {
-						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
-						};
-					};
-				} else {
-					if (opt_simple != 1) {
-						cc_index = libipv6addr_cc_index_by_addr(&ipv6addr, NULL);
-						as_num32 = libipv6addr_as_num32_by_addr(&ipv6addr, NULL);
-
-						if (feature_cc == 1) {
-							/* country code */
-							stat_inc_country_code(cc_index, 6);
-						};
-
-						if (feature_as == 1) {
-							/* asnum */
-							stat_inc_asnum(as_num32, 6);
-						};
-					};
-
-					registry = libipv6addr_registry_num_by_addr(&ipv6addr);
-
-					switch (registry) {
-						case IPV6_ADDR_REGISTRY_6BONE:
-							stat_inc(STATS_IPV6_6BONE);
-							break;
-						case IPV6_ADDR_REGISTRY_IANA:
-							stat_inc(STATS_IPV6_IANA);
-							break;
-						case IPV6_ADDR_REGISTRY_APNIC:
-							stat_inc(STATS_IPV6_APNIC);
-							break;
-						case IPV6_ADDR_REGISTRY_ARIN:
-							stat_inc(STATS_IPV6_ARIN);
-							break;
-						case IPV6_ADDR_REGISTRY_RIPENCC:
-							stat_inc(STATS_IPV6_RIPENCC);
-							break;
-						case IPV6_ADDR_REGISTRY_LACNIC:
-							stat_inc(STATS_IPV6_LACNIC);
-							break;
-						case IPV6_ADDR_REGISTRY_AFRINIC:
-							stat_inc(STATS_IPV6_AFRINIC);
-							break;
-						case IPV6_ADDR_REGISTRY_RESERVED:
-							stat_inc(STATS_IPV6_RESERVED);
-							break;
-						default:
-							stat_inc(STATS_IPV6_UNKNOWN);
-							if (opt_unknown == 1) {
-								fprintf(stderr, "Unknown address: %s\n", token);
-							};
-							break;
-					};
-
-					if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
-						if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
-							stat_inc(STATS_IPV6_IID_RANDOM);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
-							stat_inc(STATS_IPV6_IID_ISATAP);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
-							stat_inc(STATS_IPV6_IID_MANUAL);
-						} else if ((ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
-							stat_inc(STATS_IPV6_IID_GLOBAL);
-						} else {
-							stat_inc(STATS_IPV6_IID_UNKNOWN);
-						};
-					};
-				};
-				
-				break;
-
-			case FORMAT_ipv4addr:
-				/* is IPv4 address */
-				stat_inc(STATS_IPV4);
-
-				if (opt_simple != 1) {
-					cc_index = libipv4addr_cc_index_by_addr(&ipv4addr, NULL);
-					as_num32 = libipv4addr_as_num32_by_addr(&ipv4addr, NULL);
-
-					stat_inc_country_code(cc_index, 4);
-					stat_inc_asnum(as_num32, 4);
-				};
-
-				registry = libipv4addr_registry_num_by_addr(&ipv4addr);
-
-				switch (registry) {
-					case IPV4_ADDR_REGISTRY_IANA:
-						stat_inc(STATS_IPV4_IANA);
-						break;
-					case IPV4_ADDR_REGISTRY_APNIC:
-						stat_inc(STATS_IPV4_APNIC);
-						break;
-					case IPV4_ADDR_REGISTRY_ARIN:
-						stat_inc(STATS_IPV4_ARIN);
-						break;
-					case IPV4_ADDR_REGISTRY_RIPENCC:
-						stat_inc(STATS_IPV4_RIPENCC);
-						break;
-					case IPV4_ADDR_REGISTRY_LACNIC:
-						stat_inc(STATS_IPV4_LACNIC);
-						break;
-					case IPV4_ADDR_REGISTRY_AFRINIC:
-						stat_inc(STATS_IPV4_AFRINIC);
-						break;
-					case IPV4_ADDR_REGISTRY_RESERVED:
-						stat_inc(STATS_IPV4_RESERVED);
-						break;
-					default:
-						stat_inc(STATS_IPV4_UNKNOWN);
-						if (opt_unknown == 1) {
-							fprintf(stderr, "Unknown address: %s\n", token);
-						};
-						break;
-				};
-				
-				break;
-		};
-	};
-
-	if (opt_onlyheader == 0) {
-		if (ipv6calc_quiet == 0) {
-			fprintf(stderr, "...finished\n");
-		};
-	};
-
-	/* print result */
-	if (opt_printdirection == 0) {
-		/* print in rows */
-
-		/* print version number */
-		printf("%-20s %d.%d\n", "*Version", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
-
-		time(&timer);
-		tm_info = gmtime(&timer);
-		strftime(resultstring, sizeof(resultstring), "%Y:%m:%d %H:%M:%S%z %Z", tm_info);
-
-		printf("*DateTime: %s\n", resultstring);
-		printf("*UnixTime: %ju\n", (uintmax_t) timer);
-
-		libipv6calc_db_wrapper_print_db_info(0, "*3*DB-Info: ");
-
-		/* print version number */
-		if (strlen(opt_token) > 0) {
-			printf("%-20s %s\n", "*Token", opt_token);
-		};
-
-		for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
-			printf("%-20s %lu\n", ipv6logstats_statentries[i].token, ipv6logstats_statentries[i].counter);
-		};
-
-		if (feature_cc == 1) {
-			/* country_code / proto */
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country[index] > 0) {
-					DEBUGPRINT_WA(DEBUG_ipv6logstats_summary, "CC-Index: %d", index);
-
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-
-					printf("*3*CC-code-proto/%s/ALL   %lu\n", resultstring, counter_country[index]);
-					printf("*3*CC-code-proto/%s/IPv4  %lu\n", resultstring, counter_country_ipv4[index]);
-					printf("*3*CC-code-proto/%s/IPv6  %lu\n", resultstring, counter_country_ipv6[index]);
-					printf("*3*CC-code-proto-list/%s  %lu %lu %lu\n", resultstring, counter_country[index], counter_country_ipv4[index], counter_country_ipv6[index]);
-				};
-			};
-
-			/* proto / country_code */
-			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/ALL/%s   %lu\n", resultstring, counter_country[index]);
-					c_all += counter_country[index];
-				};
-			};
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country_ipv4[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/IPv4/%s  %lu\n", resultstring, counter_country_ipv4[index]);
-					c_ipv4 += counter_country_ipv4[index];
-				};
-			};
-			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
-				if (counter_country_ipv6[index] > 0) {
-					libipv6calc_db_wrapper_country_code_by_cc_index(resultstring, sizeof(resultstring), index);
-					printf("*3*CC-proto-code/IPv6/%s  %lu\n", resultstring, counter_country_ipv6[index]);
-					c_ipv6 += counter_country_ipv6[index];
-				};
-			};
-
-			if ((c_all + c_ipv4 + c_ipv6) > 0) {
-				printf("*3*CC-proto-code-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
-			};
-		};
+				};
+			};
+		};
 
 		if (feature_as == 1) {
 			/* ASN number / proto */
 			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-num-proto/%d/ALL   %lu\n", index, counter_asn[index]);
-					printf("*3*AS-num-proto/%d/IPv4  %lu\n", index, counter_asn_ipv4[index]);
-					printf("*3*AS-num-proto/%d/IPv6  %lu\n", index, counter_asn_ipv6[index]);
-					printf("*3*AS-num-proto-list/%d  %lu %lu %lu\n", index, counter_asn[index], counter_asn_ipv4[index], counter_asn_ipv6[index]);
+				if (countersp->asn[index] > 0) {
+					printf("*3*AS-num-proto/%d/ALL   %lu\n", index, countersp->asn[index]);
+					printf("*3*AS-num-proto/%d/IPv4  %lu\n", index, countersp->asn_ipv4[index]);
+					printf("*3*AS-num-proto/%d/IPv6  %lu\n", index, countersp->asn_ipv6[index]);
+					printf("*3*AS-num-proto-list/%d  %lu %lu %lu\n", index, countersp->asn[index], countersp->asn_ipv4[index], countersp->asn_ipv6[index]);
 				};
 			};
 
 			/* ASN proto / number */
 			c_all = 0; c_ipv4 = 0; c_ipv6 = 0;
 			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn[index] > 0) {
-					printf("*3*AS-proto-num/ALL/%d   %lu\n", index, counter_asn[index]);
-					c_all += counter_asn[index];
+				if (countersp->asn[index] > 0) {
+					printf("*3*AS-proto-num/ALL/%d   %lu\n", index, countersp->asn[index]);
+					c_all += countersp->asn[index];
 				};
 			};
 			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv4[index] > 0) {
-					printf("*3*AS-proto-num/IPv4/%d  %lu\n", index, counter_asn_ipv4[index]);
-					c_ipv4 += counter_asn_ipv4[index];
+				if (countersp->asn_ipv4[index] > 0) {
+					printf("*3*AS-proto-num/IPv4/%d  %lu\n", index, countersp->asn_ipv4[index]);
+					c_ipv4 += countersp->asn_ipv4[index];
 				};
 			};
 			for (index = 0; index < ASNUM_MAX; index++) {
-				if (counter_asn_ipv6[index] > 0) {
-					printf("*3*AS-proto-num/IPv6/%d  %lu\n", index, counter_asn_ipv6[index]);
-					c_ipv6 += counter_asn_ipv6[index];
+				if (countersp->asn_ipv6[index] > 0) {
+					printf("*3*AS-proto-num/IPv6/%d  %lu\n", index, countersp->asn_ipv6[index]);
+					c_ipv6 += countersp->asn_ipv6[index];
 				};
 			};
 
 			if ((c_all + c_ipv4 + c_ipv6) > 0) {
 				printf("*3*AS-proto-num-list/ALL  %lu %lu %lu\n", c_all, c_ipv4, c_ipv6);
 			};
+
+			if (opt_unique == 1) {
+				/* unique clients by ASN: ALL IPv4 IPv6 */
+				for (index = 0; index < ASNUM_MAX; index++) {
+					if (countersp->asn[index] > 0) {
+						printf("*3*AS-num-unique-list/%d  %ju %ju %ju\n", index
+							, (uintmax_t) libipv6calc_hll_estimate_union(countersp->unique_asn_ipv4[index], countersp->unique_asn_ipv6[index])
+							, (uintmax_t) libipv6calc_hll_estimate(countersp->unique_asn_ipv4[index])
+							, (uintmax_t) libipv6calc_hll_estimate(countersp->unique_asn_ipv6[index]));
+					};
+				};
+			};
 		};
-	} else {
-		/* print in columns */
-		if (opt_noheader == 0) {
-			if (strlen(opt_token) > 0) {
-				column_offset++;
-				if (opt_onlyheader == 0) {
-					if (opt_column_numbers == 1) {
-						printf("Token(1) ");
+
+		if (top_prefix_count > 0) {
+			/* top prefixes by requests: count and guaranteed count */
+			top_entries = malloc(sizeof(s_ipv6calc_topk_entry) * opt_top_count * TOP_CAPACITY_FACTOR);
+			if (top_entries == NULL) {
+				fprintf(stderr, "Can't allocate memory for top prefixes\n");
+				exit(EXIT_FAILURE);
+			};
+
+			for (i = 0; i < top_prefix_count; i++) {
+				top_entries_count = libipv6calc_topk_sorted(countersp->top_prefix[i], top_entries, opt_top_count);
+
+				for (e = 0; e < (int) top_entries_count; e++) {
+					if (top_prefix[i].proto == 4) {
+						ipv4addr_clearall(&ipv4addr);
+						ipv4addr_setdword(&ipv4addr, top_entries[e].key[0]);
+						ipv4addr.prefixlength = top_prefix[i].length;
+						ipv4addr.flag_prefixuse = 1;
+						libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token, sizeof(token), 0);
 					} else {
-						printf("Token ");
-					}
-				} else {
-					printf("%s ", opt_token);
+						ipv6addr_clearall(&ipv6addr);
+						for (r = 0; r < 4; r++) {
+							ipv6addr_setdword(&ipv6addr, r, top_entries[e].key[r]);
+						};
+						ipv6addr.prefixlength = top_prefix[i].length;
+						ipv6addr.flag_prefixuse = 1;
+						librfc1884_ipv6addrstruct_to_compaddr(&ipv6addr, token, sizeof(token), 0);
+					};
+
+					printf("*3*Top-proto-prefix-list/IPv%d/%s  %ju %ju\n", top_prefix[i].proto, token, (uintmax_t) top_entries[e].count, (uintmax_t) (top_entries[e].count - top_entries[e].error));
 				};
 			};
+
+			free(top_entries);
+		};
+
+		if (opt_unique_sketch == 1) {
+			/* sketches of unique clients, can be merged with the ones of other runs */
 			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
-				if (i > 0) {
-					printf(" ");
+				snprintf(resultstring, sizeof(resultstring), "/%s", ipv6logstats_statentries[i].token);
+				stat_unique_print_sketch(resultstring, countersp->unique_statentries[i]);
+			};
+
+			stat_unique_print_sketch("-prefix/IPv6/48", countersp->unique_ipv6_prefix48);
+
+			for (index = 0; index < COUNTRYCODE_INDEX_MAX; index++) {
+				if (countersp->country[index] > 0) {
+					libipv6calc_db_wrapper_country_code_by_cc_index(token, sizeof(token), index);
+					snprintf(resultstring, sizeof(resultstring), "-CC/%s/IPv4", token);
+					stat_unique_print_sketch(resultstring, countersp->unique_country_ipv4[index]);
+					snprintf(resultstring, sizeof(resultstring), "-CC/%s/IPv6", token);
+					stat_unique_print_sketch(resultstring, countersp->unique_country_ipv6[index]);
 				};
-				if (opt_column_numbers == 1) {
-					printf("%s(%d)", ipv6logstats_statentries[i].token, i + column_offset);
-				} else {
-					printf("%s", ipv6logstats_statentries[i].token);
+			};
+
+			for (index = 0; index < ASNUM_MAX; index++) {
+				if (countersp->asn[index] > 0) {
+					snprintf(resultstring, sizeof(resultstring), "-AS/%d/IPv4", index);
+					stat_unique_print_sketch(resultstring, countersp->unique_asn_ipv4[index]);
+					snprintf(resultstring, sizeof(resultstring), "-AS/%d/IPv6", index);
+					stat_unique_print_sketch(resultstring, countersp->unique_asn_ipv6[index]);
 				};
 			};
-			printf(" #Version(%d.%d)\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
+		};
+	} else {
+		/* print in columns */
+		if ((opt_interval == 0) && (opt_noheader == 0)) {
+			stat_print_column_header();
 		};
 		if (opt_onlyheader == 0) {
+			if (opt_interval > 0) {
+				printf("%ju ", (uintmax_t) start);
+			};
 			if (strlen(opt_token) > 0) {
 				printf("%s ", opt_token);
 			};
@@ -873,70 +954,1415 @@ static void lineparser(void) {
 				if (i > 0) {
 					printf(" ");
 				};
-				printf("%lu", ipv6logstats_statentries[i].counter);
+				printf("%lu", countersp->statentries[i]);
+			};
+			if (opt_unique == 1) {
+				for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+					printf(" %ju", (uintmax_t) stat_unique_estimate(countersp, i));
+				};
 			};
 
 			printf(" #%d.%d\n", STATS_VERSION_MAJOR, STATS_VERSION_MINOR);
 		};
 	};
+};
 
 
-	if (opt_printdirection == 0) {
-		/* print used database only in row mode */
+/*
+ * print used databases (only in row mode)
+ */
+static void stat_print_db_used(void) {
 
 #if defined SUPPORT_IP2LOCATION || defined SUPPORT_GEOIP || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP || defined SUPPORT_DBIP2 || defined SUPPORT_EXTERNAL || defined SUPPORT_BUILTIN
-		char *string;
+	char *string;
 #endif
 
 #ifdef SUPPORT_IP2LOCATION
-		string = libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_IP2Location_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_GEOIP
-		string = libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_GeoIP_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_GEOIP2
-		string = libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_GeoIP2_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_DBIP
-		string = libipv6calc_db_wrapper_DBIP_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_DBIP_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_DBIP2
-		string = libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_DBIP2_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_EXTERNAL
-		string = libipv6calc_db_wrapper_External_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_External_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
 
 #ifdef SUPPORT_BUILTIN
-		string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
-		if ((string != NULL) && (strlen(string) > 0)) {
-			printf("*3*DB-Used: %s\n", string);
-		};
+	string = libipv6calc_db_wrapper_BuiltIn_wrapper_db_info_used();
+	if ((string != NULL) && (strlen(string) > 0)) {
+		printf("*3*DB-Used: %s\n", string);
+	};
 #endif
+};
+
+
+/*
+ * print statistics of counters in binary form (read by collect mode)
+ *  record: magic, version major and minor (1 byte each), key length (2 bytes), key,
+ *  number of entries (2 bytes), entries: statistic number (4 bytes) and counter (8 bytes),
+ *  numbers in network byte order
+ *
+ * in : countersp = counters
+ * in : start = start of interval, used as key if no token is given
+ */
+static void stat_print_binary(const s_ipv6logstats_counters *countersp, const time_t start) {
+	static unsigned char record[sizeof(STATS_BINARY_MAGIC) - 1 + 6 + NI_MAXHOST + MAXENTRIES_ARRAY(ipv6logstats_statentries) * STATS_BINARY_ENTRY_SIZE];
+	char key[NI_MAXHOST];
+	size_t length, key_length;
+	int i, b;
+
+	if (strlen(opt_token) > 0) {
+		snprintf(key, sizeof(key), "%s", opt_token);
+	} else {
+		snprintf(key, sizeof(key), "%ju", (uintmax_t) start);
 	};
+	key_length = strlen(key);
 
-	return;
+	memcpy(record, STATS_BINARY_MAGIC, sizeof(STATS_BINARY_MAGIC) - 1);
+	length = sizeof(STATS_BINARY_MAGIC) - 1;
+
+	record[length++] = STATS_VERSION_MAJOR;
+	record[length++] = STATS_VERSION_MINOR;
+	record[length++] = (key_length >> 8) & 0xff;
+	record[length++] = key_length & 0xff;
+	memcpy(record + length, key, key_length);
+	length += key_length;
+
+	record[length++] = (MAXENTRIES_ARRAY(ipv6logstats_statentries) >> 8) & 0xff;
+	record[length++] = MAXENTRIES_ARRAY(ipv6logstats_statentries) & 0xff;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		for (b = 3; b >= 0; b--) {
+			record[length++] = (ipv6logstats_statentries[i].number >> (b * 8)) & 0xff;
+		};
+		for (b = 7; b >= 0; b--) {
+			record[length++] = ((uint64_t) countersp->statentries[i] >> (b * 8)) & 0xff;
+		};
+	};
+
+	if (fwrite(record, 1, length, stdout) != length) {
+		fprintf(stderr, "Error writing binary statistics\n");
+		exit(EXIT_FAILURE);
+	};
+};
+
+
+/*
+ * clear counters for reuse
+ *
+ * mod: countersp = counters
+ */
+static void stat_clear(s_ipv6logstats_counters *countersp) {
+	s_ipv6calc_topk *top[TOP_PREFIX_MAX];
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		libipv6calc_hll_free(countersp->unique_statentries[i]);
+	};
+
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		libipv6calc_hll_free(countersp->unique_country_ipv4[i]);
+		libipv6calc_hll_free(countersp->unique_country_ipv6[i]);
+	};
+
+	for (i = 0; i < ASNUM_MAX; i++) {
+		libipv6calc_hll_free(countersp->unique_asn_ipv4[i]);
+		libipv6calc_hll_free(countersp->unique_asn_ipv6[i]);
+	};
+
+	libipv6calc_hll_free(countersp->unique_ipv6_prefix48);
+
+	/* top-k counters are kept allocated */
+	memcpy(top, countersp->top_prefix, sizeof(top));
+	memset(countersp, 0, sizeof(s_ipv6logstats_counters));
+	memcpy(countersp->top_prefix, top, sizeof(top));
+
+	for (i = 0; i < top_prefix_count; i++) {
+		libipv6calc_topk_clear(countersp->top_prefix[i]);
+	};
+};
+
+
+/*
+ * Interval mode
+ */
+/*
+ * rotate counters at end of interval, interval_mutex has to be locked
+ *  counters of the finished interval are handed over to the emitter thread,
+ *  counting continues in the other counter block
+ *
+ * in : end = end of finished interval
+ */
+static void stat_interval_rotate(const time_t end) {
+	/* wait until emitter is done with the previous interval */
+	while (counters_retired != NULL) {
+		pthread_cond_wait(&interval_cond, &interval_mutex);
+	};
+
+	counters_retired = counters;
+	interval_retired_start = interval_start;
+	interval_retired_end = end;
+
+	counters = (counters == &counters_block[0]) ? &counters_block[1] : &counters_block[0];
+	interval_start = end;
+
+	pthread_cond_broadcast(&interval_cond);
+};
+
+
+/*
+ * emitter thread: prints and clears counters of finished intervals,
+ *  rotates counters at the end of wall clock intervals
+ */
+static void *stat_interval_emitter(void *arg) {
+	s_ipv6logstats_counters *countersp;
+	struct timespec deadline;
+	time_t start, end;
+
+	pthread_mutex_lock(&interval_mutex);
+
+	while (1 == 1) {
+		if (counters_retired != NULL) {
+			countersp = counters_retired;
+			start = interval_retired_start;
+			end = interval_retired_end;
+
+			/* input is processed meanwhile */
+			pthread_mutex_unlock(&interval_mutex);
+
+			if (opt_binary == 1) {
+				stat_print_binary(countersp, start);
+			} else {
+				stat_print(countersp, start, end);
+			};
+			fflush(stdout);
+			stat_clear(countersp);
+
+			pthread_mutex_lock(&interval_mutex);
+			counters_retired = NULL;
+			pthread_cond_broadcast(&interval_cond);
+			continue;
+		};
+
+		if (interval_end_of_input == 1) {
+			break;
+		};
+
+		if (opt_interval_logtime == 1) {
+			/* rotation is triggered by lineparser */
+			pthread_cond_wait(&interval_cond, &interval_mutex);
+			continue;
+		};
+
+		if (time(NULL) >= interval_start + opt_interval) {
+			stat_interval_rotate(interval_start + opt_interval);
+			continue;
+		};
+
+		deadline.tv_sec = interval_start + opt_interval;
+		deadline.tv_nsec = 0;
+		pthread_cond_timedwait(&interval_cond, &interval_mutex, &deadline);
+	};
+
+	pthread_mutex_unlock(&interval_mutex);
+
+	return(arg);
+};
+
+
+/*
+ * Line parser
+ */
+/*
+ * time of line from timestamp in common log format, e.g. [10/Oct/2000:13:55:36 -0700]
+ *
+ * in : string = remaining line behind address
+ * ret: seconds since epoch, 0 = no timestamp found
+ */
+static time_t lineparser_logtime(const char *string) {
+	static const char *months = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	const char *cptr;
+	char month[4];
+	int day, month_index, year, hour, minute, second, zone;
+	long int era, yoe, doy, doe;
+
+	if (string == NULL) {
+		return(0);
+	};
+
+	cptr = strchr(string, '[');
+	if (cptr == NULL) {
+		return(0);
+	};
+
+	if (sscanf(cptr, "[%2d/%3c/%4d:%2d:%2d:%2d %5d]", &day, month, &year, &hour, &minute, &second, &zone) != 7) {
+		return(0);
+	};
+	month[3] = '\0';
+
+	cptr = strstr(months, month);
+	if ((cptr == NULL) || (((cptr - months) % 3) != 0) || (year < 1970)) {
+		return(0);
+	};
+	month_index = (cptr - months) / 3;
+
+	/* days since epoch of civil date, year starts on 1st of March */
+	if (month_index < 2) {
+		year--;
+	};
+	era = year / 400;
+	yoe = year - era * 400;
+	doy = (153 * ((month_index + 10) % 12) + 2) / 5 + day - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+
+	return((time_t) ((era * 146097 + doe - 719468) * 86400 + hour * 3600 + minute * 60 + second - ((zone / 100) * 3600 + (zone % 100) * 60)));
+};
+
+
+/*
+ * parse address of a line
+ *
+ * in : token = first token of line (buffer of LINEBUFFER size, can be modified)
+ * in : linecounter
+ * mod: entryp = parsed line
+ */
+static void lineparser_parse(char *token, const int linecounter, s_ipv6logstats_entry *entryp) {
+	char resultstring[LINEBUFFER];
+	uint32_t inputtype;
+	ipv6calc_ipv6addr ipv6addr;
+	ipv6calc_ipv4addr ipv4addr;
+	int retval, r, flag_parsed;
+
+	/* get input type now, common address notations are parsed in the same pass */
+	inputtype = libipv6calc_autodetectinput_parse(token, &ipv4addr, &ipv6addr, NULL, &flag_parsed);
+
+	/* check for proper type */
+	if ((inputtype != FORMAT_ipv4addr) && (inputtype != FORMAT_ipv6addr)) {
+		/* fprintf(stderr, "Token 1 (address) is not an IP address in line: %d\n", linecounter); */
+		entryp->stat_unknown = 1;
+		return;
+	};
+
+	/* fill related structure */
+	switch ((flag_parsed == 1) ? FORMAT_undefined : inputtype) {
+		case FORMAT_ipv6addr:
+			retval = addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr);
+			break;
+
+		case FORMAT_ipv4addr:
+			retval = addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr);
+			break;
+
+		default:
+			retval = 0;
+			break;
+	};
+
+	if (retval != 0 ) {
+		fprintf(stderr, "Problem during address parsing on line %d (skipped): %s\n", linecounter, resultstring);
+		return;
+	};
+
+	/* catch compat/mapped */
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			if ((ipv6addr.typeinfo & (IPV6_ADDR_COMPATv4 | IPV6_ADDR_MAPPED)) != 0) {
+				/* extract IPv4 address */
+				r = libipv6addr_get_included_ipv4addr(&ipv6addr, &ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r != 0) {
+					return;
+				};
+
+				// remap
+				inputtype = FORMAT_ipv4addr;
+
+				// create text represenation
+				r = libipv4addr_ipv4addrstruct_to_string(&ipv4addr, token, LINEBUFFER, 0);
+			};
+			break;
+
+		default:
+			// nothing to do
+			break;
+	};
+
+	/* store for lookup of block */
+	entryp->inputtype = inputtype;
+	snprintf(entryp->token, sizeof(entryp->token), "%s", token);
+
+	switch (inputtype) {
+		case FORMAT_ipv6addr:
+			entryp->ipv6addr = ipv6addr;
+
+			if ((ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
+				// get IPv4 address (in case of Teredo the client IP)
+				r = libipv6addr_get_included_ipv4addr(&ipv6addr, &entryp->ipv4addr, IPV6_ADDR_SELECT_IPV4_DEFAULT);
+				if (r == 0) {
+					entryp->ipv4addr_valid = 1;
+				};
+			};
+			break;
+
+		case FORMAT_ipv4addr:
+			entryp->ipv4addr = ipv4addr;
+			entryp->ipv4addr_valid = 1;
+			break;
+	};
+};
+
+
+/*
+ * get database attributes of IPv4 address of a parsed line
+ *
+ * in : entryp = parsed line
+ * in : db_attributes_selector = database attributes to retrieve
+ * mod: db_attributesp = database attributes
+ */
+static void lineparser_ipv4_attributes(const s_ipv6logstats_entry *entryp, const int db_attributes_selector, s_ipv6calc_db_attributes *db_attributesp) {
+	int selector = db_attributes_selector;
+
+	if (entryp->registry_valid != 1) {
+		libipv4addr_all_by_addr(&entryp->ipv4addr, db_attributes_selector, db_attributesp);
+		return;
+	};
+
+	/* registry is already retrieved by block lookup */
+	selector &= ~IPV6CALC_DB_ATTR_REGISTRY;
+
+	if (selector != 0) {
+		libipv4addr_all_by_addr(&entryp->ipv4addr, selector, db_attributesp);
+	} else {
+		libipv6calc_db_wrapper_attributes_clear(db_attributesp);
+	};
+
+	db_attributesp->registry = entryp->registry;
+};
+
+
+/*
+ * get IPv4 registry of all parsed lines of a block at once
+ *
+ * mod: entries = parsed lines
+ * in : count = number of parsed lines
+ * in : db_attributes_selector = database attributes to retrieve
+ */
+static void lineparser_block_registry(s_ipv6logstats_entry *entries, const int count, const int db_attributes_selector) {
+	ipv6calc_ipv4addr ipv4addr_list[IPV6LOGSTATS_BLOCK_LINES];
+	int registry_list[IPV6LOGSTATS_BLOCK_LINES];
+	int index_list[IPV6LOGSTATS_BLOCK_LINES];
+	int i, n = 0;
+
+	if ((db_attributes_selector & IPV6CALC_DB_ATTR_REGISTRY) == 0) {
+		return;
+	};
+
+	if (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY) != 1) {
+		return;
+	};
+
+	for (i = 0; i < count; i++) {
+		if (entries[i].ipv4addr_valid != 1) {
+			continue;
+		};
+
+		if ((entries[i].inputtype == FORMAT_ipv6addr) && ((entries[i].ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) == 0)) {
+			continue;
+		};
+
+		if ((entries[i].ipv4addr.typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
+			/* registry of anonymized address is not retrieved from database */
+			continue;
+		};
+
+		ipv4addr_list[n] = entries[i].ipv4addr;
+		index_list[n] = i;
+		n++;
+	};
+
+	if (n == 0) {
+		return;
+	};
+
+	DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Block lookup of IPv4 registry: %d of %d lines", n, count);
+
+	libipv6calc_db_wrapper_registry_num_by_ipv4addr_batch(ipv4addr_list, registry_list, n);
+
+	for (i = 0; i < n; i++) {
+		entries[index_list[i]].registry = registry_list[i];
+		entries[index_list[i]].registry_valid = 1;
+	};
+};
+
+
+/*
+ * fill statistics of a parsed line
+ *
+ * in : entryp = parsed line
+ * in : db_attributes_selector = database attributes to retrieve
+ */
+static void lineparser_count(const s_ipv6logstats_entry *entryp, const int db_attributes_selector) {
+	int registry, stat_registry_base, i;
+	uint16_t cc_index = COUNTRYCODE_INDEX_UNKNOWN;
+	uint32_t as_num32 = ASNUM_AS_UNKNOWN;
+	uint32_t words[4], words_prefix48[2];
+	uint64_t hash = 0;
+	s_ipv6calc_db_attributes db_attributes;
+	time_t window;
+
+	stat_registry_base = 0;
+
+	if ((opt_interval_logtime == 1) && (entryp->logtime > 0)) {
+		window = entryp->logtime - (entryp->logtime % opt_interval);
+
+		if (interval_start == 0) {
+			interval_start = window;
+		} else if (window > interval_start) {
+			/* intervals without lines are skipped */
+			stat_interval_rotate(interval_start + opt_interval);
+			interval_start = window;
+		};
+	};
+
+	stat_inc(STATS_ALL);
+
+	if (entryp->inputtype == FORMAT_undefined) {
+		if (entryp->stat_unknown == 1) {
+			stat_inc(STATS_UNKNOWN);
+		};
+		return;
+	};
+
+	if ((opt_unique == 1) || (top_prefix_count > 0)) {
+		if (entryp->inputtype == FORMAT_ipv6addr) {
+			for (i = 0; i < 4; i++) {
+				words[i] = ipv6addr_getdword(&entryp->ipv6addr, i);
+			};
+		} else {
+			words[0] = ipv4addr_getdword(&entryp->ipv4addr);
+			words[1] = 0;
+			words[2] = 0;
+			words[3] = 0;
+		};
+	};
+
+	if (opt_unique == 1) {
+		/* client is identified by its address */
+		if (entryp->inputtype == FORMAT_ipv6addr) {
+			hash = libipv6calc_sketch_hash(words, 4);
+
+			/* sites by /48 prefix */
+			words_prefix48[0] = words[0];
+			words_prefix48[1] = words[1] & 0xffff0000u;
+			stat_unique_add(&counters->unique_ipv6_prefix48, libipv6calc_sketch_hash(words_prefix48, 2));
+		} else {
+			hash = libipv6calc_sketch_hash(words, 1);
+		};
+	};
+
+	for (i = 0; i < top_prefix_count; i++) {
+		if ((top_prefix[i].proto == 6) == (entryp->inputtype == FORMAT_ipv6addr)) {
+			libipv6calc_topk_add(counters->top_prefix[i], words);
+		};
+	};
+
+	/* get information and fill statistics */
+	switch (entryp->inputtype) {
+		case FORMAT_ipv6addr:
+			/* is IPv6 address */
+			stat_inc_unique(STATS_IPV6, hash);
+
+			if ((entryp->ipv6addr.typeinfo & IPV6_ADDR_HAS_PUBLIC_IPV4) != 0) {
+				/* has public IPv4 address included */
+
+				if (entryp->ipv4addr_valid != 1) {
+					return;
+				};
+
+				lineparser_ipv4_attributes(entryp, db_attributes_selector, &db_attributes);
+
+				if (opt_simple != 1) {
+					cc_index = db_attributes.cc_index;
+					as_num32 = db_attributes.as_num32;
+					if (feature_cc == 1) {
+						stat_inc_country_code(cc_index, 4, hash);
+					};
+
+					if (feature_as == 1) {
+						stat_inc_asnum(as_num32, 4, hash);
+					};
+				};
+
+				registry = db_attributes.registry;
+
+				if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_6TO4) != 0) {
+					stat_registry_base = STATS_IPV6_6TO4_BASE;
+
+				} else if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_TEREDO) != 0) {
+					stat_registry_base = STATS_IPV6_TEREDO_BASE;
+
+				} else if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_NAT64) != 0) {
+					stat_registry_base = STATS_IPV6_NAT64_BASE;
+				};
+
+				if (stat_registry_base > 0) {
+					switch (registry) {
+						case IPV4_ADDR_REGISTRY_IANA:
+							stat_inc_unique(stat_registry_base + REGISTRY_IANA, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_APNIC:
+							stat_inc_unique(stat_registry_base + REGISTRY_APNIC, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_ARIN:
+							stat_inc_unique(stat_registry_base + REGISTRY_ARIN, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_RIPENCC:
+							stat_inc_unique(stat_registry_base + REGISTRY_RIPENCC, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_LACNIC:
+							stat_inc_unique(stat_registry_base + REGISTRY_LACNIC, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_AFRINIC:
+							stat_inc_unique(stat_registry_base + REGISTRY_AFRINIC, hash);
+							break;
+						case IPV4_ADDR_REGISTRY_RESERVED:
+							stat_inc_unique(stat_registry_base + REGISTRY_RESERVED, hash);
+							break;
+						default:
+							stat_inc_unique(stat_registry_base + REGISTRY_UNKNOWN, hash);
+							if (opt_unknown == 1) {
+								fprintf(stderr, "Unknown address: %s\n", entryp->token);
+							};
+							break;
+					};
+				} else {
+					if (opt_unknown == 1) {
+						fprintf(stderr, "Unknown address: %s\n", entryp->token);
+					};
+				};
+			} else {
+				libipv6addr_all_by_addr(&entryp->ipv6addr, db_attributes_selector, &db_attributes);
+
+				if (opt_simple != 1) {
+					cc_index = db_attributes.cc_index;
+					as_num32 = db_attributes.as_num32;
+
+					if (feature_cc == 1) {
+						/* country code */
+						stat_inc_country_code(cc_index, 6, hash);
+					};
+
+					if (feature_as == 1) {
+						/* asnum */
+						stat_inc_asnum(as_num32, 6, hash);
+					};
+				};
+
+				registry = db_attributes.registry;
+
+				switch (registry) {
+					case IPV6_ADDR_REGISTRY_6BONE:
+						stat_inc_unique(STATS_IPV6_6BONE, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_IANA:
+						stat_inc_unique(STATS_IPV6_IANA, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_APNIC:
+						stat_inc_unique(STATS_IPV6_APNIC, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_ARIN:
+						stat_inc_unique(STATS_IPV6_ARIN, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_RIPENCC:
+						stat_inc_unique(STATS_IPV6_RIPENCC, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_LACNIC:
+						stat_inc_unique(STATS_IPV6_LACNIC, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_AFRINIC:
+						stat_inc_unique(STATS_IPV6_AFRINIC, hash);
+						break;
+					case IPV6_ADDR_REGISTRY_RESERVED:
+						stat_inc_unique(STATS_IPV6_RESERVED, hash);
+						break;
+					default:
+						stat_inc_unique(STATS_IPV6_UNKNOWN, hash);
+						if (opt_unknown == 1) {
+							fprintf(stderr, "Unknown address: %s\n", entryp->token);
+						};
+						break;
+				};
+
+				if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_IID) == IPV6_NEW_ADDR_IID) {
+					if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_RANDOM) != 0) {
+						stat_inc_unique(STATS_IPV6_IID_RANDOM, hash);
+					} else if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_ISATAP) != 0) {
+						stat_inc_unique(STATS_IPV6_IID_ISATAP, hash);
+					} else if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_LOCAL) != 0) {
+						stat_inc_unique(STATS_IPV6_IID_MANUAL, hash);
+					} else if ((entryp->ipv6addr.typeinfo & IPV6_NEW_ADDR_IID_GLOBAL) != 0) {
+						stat_inc_unique(STATS_IPV6_IID_GLOBAL, hash);
+					} else {
+						stat_inc_unique(STATS_IPV6_IID_UNKNOWN, hash);
+					};
+				};
+			};
+		
+			break;
+
+		case FORMAT_ipv4addr:
+			/* is IPv4 address */
+			stat_inc_unique(STATS_IPV4, hash);
+
+			lineparser_ipv4_attributes(entryp, db_attributes_selector, &db_attributes);
+
+			if (opt_simple != 1) {
+				cc_index = db_attributes.cc_index;
+				as_num32 = db_attributes.as_num32;
+
+				stat_inc_country_code(cc_index, 4, hash);
+				stat_inc_asnum(as_num32, 4, hash);
+			};
+
+			registry = db_attributes.registry;
+
+			switch (registry) {
+				case IPV4_ADDR_REGISTRY_IANA:
+					stat_inc_unique(STATS_IPV4_IANA, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_APNIC:
+					stat_inc_unique(STATS_IPV4_APNIC, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_ARIN:
+					stat_inc_unique(STATS_IPV4_ARIN, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_RIPENCC:
+					stat_inc_unique(STATS_IPV4_RIPENCC, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_LACNIC:
+					stat_inc_unique(STATS_IPV4_LACNIC, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_AFRINIC:
+					stat_inc_unique(STATS_IPV4_AFRINIC, hash);
+					break;
+				case IPV4_ADDR_REGISTRY_RESERVED:
+					stat_inc_unique(STATS_IPV4_RESERVED, hash);
+					break;
+				default:
+					stat_inc_unique(STATS_IPV4_UNKNOWN, hash);
+					if (opt_unknown == 1) {
+						fprintf(stderr, "Unknown address: %s\n", entryp->token);
+					};
+					break;
+			};
+		
+			break;
+	};
+};
+
+
+/*
+ * fill statistics of parsed lines of a block
+ *
+ * mod: entries = parsed lines
+ * in : count = number of parsed lines
+ * in : db_attributes_selector = database attributes to retrieve
+ */
+static void lineparser_block(s_ipv6logstats_entry *entries, const int count, const int db_attributes_selector) {
+	int i;
+
+	lineparser_block_registry(entries, count, db_attributes_selector);
+
+	if (opt_interval > 0) {
+		/* counters are not rotated while a block is counted */
+		pthread_mutex_lock(&interval_mutex);
+	};
+
+	for (i = 0; i < count; i++) {
+		lineparser_count(&entries[i], db_attributes_selector);
+	};
+
+	if (opt_interval > 0) {
+		pthread_mutex_unlock(&interval_mutex);
+	};
+};
+
+
+static void lineparser(s_ipv6calc_stream_input *inputp) {
+	char linebuffer[LINEBUFFER];
+	char token[LINEBUFFER];
+	char *charptr, *cptr, **ptrptr;
+	int linecounter = 0, i;
+
+	int db_attributes_selector;
+
+	static s_ipv6logstats_entry entries[IPV6LOGSTATS_BLOCK_LINES];
+	int entries_count = 0, block_lines = IPV6LOGSTATS_BLOCK_LINES;
+
+	pthread_t emitter;
+	time_t logtime = 0, window;
+
+	// clear counters
+	for (i = 0; i < COUNTRYCODE_INDEX_MAX; i++) {
+		counters->country[i] = 0;
+		counters->country_ipv4[i] = 0;
+		counters->country_ipv6[i] = 0;
+	};
+
+	ptrptr = &cptr;
+
+	/* retrieve all required database attributes of an address at once */
+	db_attributes_selector = IPV6CALC_DB_ATTR_REGISTRY;
+	if (opt_simple != 1) {
+		db_attributes_selector |= IPV6CALC_DB_ATTR_CC | IPV6CALC_DB_ATTR_AS;
+	};
+	
+	if (opt_onlyheader == 0) {
+		if (ipv6calc_quiet == 0) {
+			fprintf(stderr, "Expecting log lines on stdin\n");
+		};
+	};
+
+	if (opt_interval > 0) {
+		/* information, which is not related to an interval, is printed only once */
+		if (opt_binary == 1) {
+			/* no header */
+		} else if (opt_printdirection == 0) {
+			libipv6calc_db_wrapper_print_db_info(0, "*3*DB-Info: ");
+		} else if (opt_noheader == 0) {
+			stat_print_column_header();
+		};
+		fflush(stdout);
+
+		if (opt_onlyheader == 0) {
+			if (opt_interval_logtime == 0) {
+				time(&interval_start);
+				interval_start -= interval_start % opt_interval;
+			};
+
+			if (pthread_create(&emitter, NULL, stat_interval_emitter, NULL) != 0) {
+				fprintf(stderr, "Can't create thread for interval statistics\n");
+				exit(EXIT_FAILURE);
+			};
+		};
+
+		if (opt_interval_logtime == 0) {
+			/* lines are counted in the interval of arrival */
+			block_lines = 1;
+		};
+	};
+
+	while (opt_onlyheader == 0) {
+		/* read line from input */
+		charptr = libipv6calc_stream_input_gets(linebuffer, LINEBUFFER, inputp);
+	
+		if (charptr == NULL) {
+			/* end of input */
+			break;
+		};
+
+		linecounter++;
+
+		libipv6calc_db_wrapper_reload_check();
+
+		if (linecounter == 1) {
+			if (ipv6calc_quiet == 0) {
+				fprintf(stderr, "Ok, proceeding stdin...\n");
+			};
+		};
+	
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Line counter: %d", linecounter);
+
+		if (strlen(linebuffer) >= LINEBUFFER) {
+			fprintf(stderr, "Line too long: %d\n", linecounter);
+			continue;
+		};
+
+		/* remove trailing \n */
+		if (linebuffer[strlen(linebuffer) - 1] == '\n') {
+			linebuffer[strlen(linebuffer) - 1] = '\0';
+		};
+
+	
+		if (strlen(linebuffer) == 0) {
+			fprintf(stderr, "Line empty: %d\n", linecounter);
+			continue;
+		};
+	
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Got line: '%s'", linebuffer);
+
+		/* look for first token (should be IP address) */
+		charptr = strtok_r(linebuffer, " \t\n", ptrptr);
+	
+		if ( charptr == NULL ) {
+			fprintf(stderr, "Line contains no token: %d\n", linecounter);
+			continue;
+		};
+
+		if ( strlen(charptr) >=  LINEBUFFER) {
+			fprintf(stderr, "Line too strange: %d\n", linecounter);
+			continue;
+		};
+
+		snprintf(token, sizeof(token), "%s", charptr);
+	
+		DEBUGPRINT_WA(DEBUG_ipv6logstats_processing, "Token 1: '%s'", token);
+
+		if (opt_interval_logtime == 1) {
+			/* lines without timestamp belong to the interval of the previous line */
+			window = lineparser_logtime(cptr);
+			if (window > 0) {
+				logtime = window;
+			};
+		};
+
+		/* store for statistics, counted as ALL only until an address is stored */
+		entries[entries_count].inputtype = FORMAT_undefined;
+		entries[entries_count].stat_unknown = 0;
+		entries[entries_count].ipv4addr_valid = 0;
+		entries[entries_count].registry_valid = 0;
+		entries[entries_count].logtime = logtime;
+
+		lineparser_parse(token, linecounter, &entries[entries_count]);
+
+		entries_count++;
+
+		if (entries_count == block_lines) {
+			lineparser_block(entries, entries_count, db_attributes_selector);
+			entries_count = 0;
+		};
+	};
+
+	if (entries_count > 0) {
+		/* rest of input */
+		lineparser_block(entries, entries_count, db_attributes_selector);
+	};
+
+	if (opt_onlyheader == 0) {
+		if (ipv6calc_quiet == 0) {
+			fprintf(stderr, "...finished\n");
+		};
+	};
+
+	if (opt_interval > 0) {
+		if (opt_onlyheader == 0) {
+			/* last interval ends with input */
+			pthread_mutex_lock(&interval_mutex);
+			if (opt_interval_logtime == 0) {
+				stat_interval_rotate(time(NULL));
+			} else if (interval_start > 0) {
+				stat_interval_rotate(interval_start + opt_interval);
+			};
+			interval_end_of_input = 1;
+			pthread_cond_broadcast(&interval_cond);
+			pthread_mutex_unlock(&interval_mutex);
+
+			pthread_join(emitter, NULL);
+		};
+	} else if (opt_binary == 1) {
+		stat_print_binary(counters, 0);
+	} else {
+		/* print result */
+		stat_print(counters, 0, 0);
+	};
+
+	if ((opt_printdirection == 0) && (opt_binary == 0)) {
+		/* print used database only in row mode */
+		stat_print_db_used();
+	};
+
+	return;
+};
+
+
+/*
+ * Collect mode: merge statistics of many files by key (token or interval start)
+ */
+/*
+ * get index of statistic token
+ *
+ * ret: index, -1 = unknown token
+ */
+static int collect_index_by_token(const char *token) {
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (strcmp(token, ipv6logstats_statentries[i].token) == 0) {
+			return(i);
+		};
+	};
+
+	return(-1);
+};
+
+
+/*
+ * get index of statistic number
+ *
+ * ret: index, -1 = unknown number
+ */
+static int collect_index_by_number(const int number) {
+	int i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+		if (number == ipv6logstats_statentries[i].number) {
+			return(i);
+		};
+	};
+
+	return(-1);
+};
+
+
+/*
+ * append new record to file
+ *
+ * mod: filep
+ * in : key
+ * ret: record, NULL = out of memory
+ */
+static s_ipv6logstats_collect_record *collect_record_new(s_ipv6logstats_collect_file *filep, const char *key) {
+	s_ipv6logstats_collect_record *records;
+
+	if (filep->count == filep->size) {
+		records = realloc(filep->records, sizeof(s_ipv6logstats_collect_record) * (filep->size + COLLECT_RECORDS_CHUNK));
+		if (records == NULL) {
+			fprintf(stderr, "Can't allocate memory for statistics of file: %s\n", filep->filename);
+			return(NULL);
+		};
+		filep->records = records;
+		filep->size += COLLECT_RECORDS_CHUNK;
+	};
+
+	memset(&filep->records[filep->count], 0, sizeof(s_ipv6logstats_collect_record));
+	snprintf(filep->records[filep->count].key, sizeof(filep->records[filep->count].key), "%s", key);
+
+	return(&filep->records[filep->count++]);
+};
+
+
+/*
+ * read statistics in binary form (records behind magic)
+ *
+ * in : file
+ * mod: filep
+ * ret: 0 = ok, 1 = error
+ */
+static int collect_read_binary(FILE *file, s_ipv6logstats_collect_file *filep) {
+	unsigned char buffer[STATS_BINARY_ENTRY_SIZE];
+	char key[NI_MAXHOST];
+	s_ipv6logstats_collect_record *recordp;
+	int i, e, length, count;
+	uint64_t value;
+
+	while (1 == 1) {
+		/* magic */
+		length = fread(buffer, 1, sizeof(STATS_BINARY_MAGIC) - 1, file);
+		if (length == 0) {
+			/* end of file on record boundary */
+			return(0);
+		};
+		if ((length != sizeof(STATS_BINARY_MAGIC) - 1) || (memcmp(buffer, STATS_BINARY_MAGIC, sizeof(STATS_BINARY_MAGIC) - 1) != 0)) {
+			break;
+		};
+
+		/* version and key length */
+		if (fread(buffer, 1, 4, file) != 4) {
+			break;
+		};
+		if (buffer[0] != STATS_VERSION_MAJOR) {
+			fprintf(stderr, "Unsupported version of binary statistics: %d.%d (file: %s)\n", buffer[0], buffer[1], filep->filename);
+			return(1);
+		};
+		length = (buffer[2] << 8) | buffer[3];
+		if ((length == 0) || (length >= (int) sizeof(key)) || (fread(key, 1, length, file) != (size_t) length)) {
+			break;
+		};
+		key[length] = '\0';
+
+		recordp = collect_record_new(filep, key);
+		if (recordp == NULL) {
+			return(1);
+		};
+
+		/* entries */
+		if (fread(buffer, 1, 2, file) != 2) {
+			break;
+		};
+		count = (buffer[0] << 8) | buffer[1];
+
+		for (e = 0; e < count; e++) {
+			if (fread(buffer, 1, STATS_BINARY_ENTRY_SIZE, file) != STATS_BINARY_ENTRY_SIZE) {
+				break;
+			};
+
+			i = collect_index_by_number((buffer[0] << 24) | (buffer[1] << 16) | (buffer[2] << 8) | buffer[3]);
+			if (i < 0) {
+				/* unknown statistic number of other version */
+				continue;
+			};
+
+			value = 0;
+			for (length = 4; length < STATS_BINARY_ENTRY_SIZE; length++) {
+				value = (value << 8) | buffer[length];
+			};
+			recordp->statentries[i] += value;
+		};
+
+		if (e < count) {
+			break;
+		};
+	};
+
+	fprintf(stderr, "Broken binary statistics in file: %s\n", filep->filename);
+	return(1);
+};
+
+
+/*
+ * read statistics in row form, a new statistic starts with "*Version"
+ *
+ * in : file
+ * mod: filep
+ * ret: 0 = ok, 1 = error
+ */
+static int collect_read_rows(FILE *file, s_ipv6logstats_collect_file *filep) {
+	char linebuffer[LINEBUFFER];
+	char key[NI_MAXHOST] = "";
+	char *name, *value, *cptr;
+	s_ipv6logstats_collect_record *recordp = NULL;
+	int i;
+
+	while (fgets(linebuffer, sizeof(linebuffer), file) != NULL) {
+		/* split into name and value */
+		name = strtok_r(linebuffer, " \t\n", &cptr);
+		value = strtok_r(NULL, " \t\n", &cptr);
+		if ((name == NULL) || (value == NULL)) {
+			continue;
+		};
+
+		if (name[0] == '*') {
+			if (strcmp(name, "*Version") == 0) {
+				key[0] = '\0';
+				recordp = NULL;
+			} else if (strcmp(name, "*Token") == 0) {
+				snprintf(key, sizeof(key), "%s", value);
+			} else if ((strcmp(name, "*Interval:") == 0) && (key[0] == '\0')) {
+				/* statistics of interval without token */
+				snprintf(key, sizeof(key), "%s", value);
+			} else if ((opt_unique == 1) && (strncmp(name, "*4*HLL/", 7) == 0)) {
+				i = collect_index_by_token(name + 7);
+				if (i < 0) {
+					continue;
+				};
+
+				if (recordp == NULL) {
+					if (key[0] == '\0') {
+						break;
+					};
+					recordp = collect_record_new(filep, key);
+					if (recordp == NULL) {
+						return(1);
+					};
+				};
+
+				if (recordp->unique_statentries[i] == NULL) {
+					recordp->unique_statentries[i] = libipv6calc_hll_new();
+					if (recordp->unique_statentries[i] == NULL) {
+						return(1);
+					};
+				};
+
+				if (libipv6calc_hll_merge_string(recordp->unique_statentries[i], value) != 0) {
+					fprintf(stderr, "Broken sketch '%s' in file: %s\n", name, filep->filename);
+					return(1);
+				};
+			};
+			continue;
+		};
+
+		i = collect_index_by_token(name);
+		if (i < 0) {
+			/* unknown statistic token of other version */
+			continue;
+		};
+
+		if (recordp == NULL) {
+			if (key[0] == '\0') {
+				break;
+			};
+			recordp = collect_record_new(filep, key);
+			if (recordp == NULL) {
+				return(1);
+			};
+		};
+
+		recordp->statentries[i] += strtoul(value, NULL, 10);
+	};
+
+	if (key[0] == '\0') {
+		fprintf(stderr, "Missing '*Token' in statistics file: %s\n", filep->filename);
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * read statistics of a file, form is autodetected
+ *
+ * mod: filep
+ */
+static void collect_read_file(s_ipv6logstats_collect_file *filep) {
+	FILE *file;
+	int c;
+
+	file = libipv6calc_stream_open(filep->filename, "r");
+	if (file == NULL) {
+		filep->error = 1;
+		return;
+	};
+
+	c = getc(file);
+	if (c != EOF) {
+		ungetc(c, file);
+
+		if (c == STATS_BINARY_MAGIC[0]) {
+			filep->error = collect_read_binary(file, filep);
+		} else {
+			filep->error = collect_read_rows(file, filep);
+		};
+	};
+
+	if (ferror(file)) {
+		fprintf(stderr, "Error reading statistics file: %s\n", filep->filename);
+		filep->error = 1;
+	};
+
+	if (file != stdin) {
+		fclose(file);
+	};
+};
+
+
+/*
+ * worker thread: reads files until all are taken
+ */
+static void *collect_worker(void *arg) {
+	s_ipv6logstats_collect_file *files = arg;
+	int f;
+
+	while (1 == 1) {
+		pthread_mutex_lock(&collect_mutex);
+		f = collect_next++;
+		pthread_mutex_unlock(&collect_mutex);
+
+		if (f >= collect_files_count) {
+			break;
+		};
+
+		collect_read_file(&files[f]);
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * sort records by key
+ */
+static int collect_record_compare(const void *a, const void *b) {
+	const s_ipv6logstats_collect_record * const *ra = a, * const *rb = b;
+
+	return(strcmp((*ra)->key, (*rb)->key));
+};
+
+
+/*
+ * print merged record
+ */
+static void collect_print_record(const s_ipv6logstats_collect_record *recordp) {
+	int i;
+
+	memcpy(counters->statentries, recordp->statentries, sizeof(counters->statentries));
+	memcpy(counters->unique_statentries, recordp->unique_statentries, sizeof(counters->unique_statentries));
+
+	if (opt_printdirection == 0) {
+		/* selected counters (compatible with collect_ipv6logstats.pl) */
+		printf("%s ", recordp->key);
+		for (i = 0; i < MAXENTRIES_ARRAY(collect_tokens); i++) {
+			printf("%lu ", counters->statentries[collect_index_by_token(collect_tokens[i])]);
+		};
+		if (opt_unique == 1) {
+			for (i = 0; i < MAXENTRIES_ARRAY(collect_tokens); i++) {
+				printf("%ju ", (uintmax_t) stat_unique_estimate(counters, collect_index_by_token(collect_tokens[i])));
+			};
+		};
+		printf("\n");
+	} else {
+		/* all counters like column mode, key is printed as token */
+		snprintf(opt_token, sizeof(opt_token), "%s", recordp->key);
+		stat_print(counters, 0, 0);
+	};
+
+	/* sketches are owned by record */
+	memset(counters->unique_statentries, 0, sizeof(counters->unique_statentries));
+};
+
+
+/*
+ * collect statistics of files, merge them by key and print them sorted by key
+ *
+ * in : filenames, count
+ * ret: 0 = ok, 1 = error
+ */
+static int collect(char * const *filenames, const int count) {
+	s_ipv6logstats_collect_file *files;
+	s_ipv6logstats_collect_record **records, *recordp;
+	pthread_t *threads;
+	int f, r, i, threads_count, records_count = 0, keys = 0, result = 0;
+
+	if (count == 0) {
+		fprintf(stderr, "Missing statistics files\n");
+		return(1);
+	};
+
+	files = calloc(count, sizeof(s_ipv6logstats_collect_file));
+	threads = calloc(jobs, sizeof(pthread_t));
+	if ((files == NULL) || (threads == NULL)) {
+		fprintf(stderr, "Can't allocate memory for statistics files\n");
+		return(1);
+	};
+
+	for (f = 0; f < count; f++) {
+		files[f].filename = filenames[f];
+	};
+
+	/* files are read concurrently */
+	collect_files_count = count;
+	collect_next = 0;
+
+	for (threads_count = 0; (threads_count < jobs) && (threads_count < count); threads_count++) {
+		if (pthread_create(&threads[threads_count], NULL, collect_worker, files) != 0) {
+			fprintf(stderr, "Can't create thread for reading statistics files\n");
+			break;
+		};
+	};
+
+	if (threads_count == 0) {
+		/* proceed without threads */
+		collect_worker(files);
+	};
+
+	for (i = 0; i < threads_count; i++) {
+		pthread_join(threads[i], NULL);
+	};
+
+	for (f = 0; f < count; f++) {
+		if (files[f].error != 0) {
+			result = 1;
+		};
+		records_count += files[f].count;
+	};
+
+	/* merge records of same key */
+	records = malloc(sizeof(s_ipv6logstats_collect_record *) * (records_count + 1));
+	if (records == NULL) {
+		fprintf(stderr, "Can't allocate memory for statistics\n");
+		return(1);
+	};
+
+	records_count = 0;
+	for (f = 0; f < count; f++) {
+		for (r = 0; r < files[f].count; r++) {
+			records[records_count++] = &files[f].records[r];
+		};
+	};
+
+	qsort(records, records_count, sizeof(s_ipv6logstats_collect_record *), collect_record_compare);
+
+	if ((opt_printdirection == 1) && (opt_noheader == 0) && (records_count > 0)) {
+		snprintf(opt_token, sizeof(opt_token), "%s", records[0]->key);
+		stat_print_column_header();
+	};
+	opt_noheader = 1;
+
+	for (r = 0; r < records_count; r++) {
+		recordp = records[r];
+
+		while ((r + 1 < records_count) && (strcmp(recordp->key, records[r + 1]->key) == 0)) {
+			r++;
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+				recordp->statentries[i] += records[r]->statentries[i];
+
+				if (records[r]->unique_statentries[i] == NULL) {
+					continue;
+				};
+
+				if (recordp->unique_statentries[i] == NULL) {
+					recordp->unique_statentries[i] = records[r]->unique_statentries[i];
+				} else {
+					if (libipv6calc_hll_merge(recordp->unique_statentries[i], records[r]->unique_statentries[i]) != 0) {
+						exit(EXIT_FAILURE);
+					};
+					libipv6calc_hll_free(records[r]->unique_statentries[i]);
+				};
+				records[r]->unique_statentries[i] = NULL;
+			};
+		};
+
+		collect_print_record(recordp);
+		keys++;
+	};
+
+	if (ipv6calc_quiet == 0) {
+		fprintf(stderr, "Collected statistics of %d keys from %d files\n", keys, count);
+	};
+
+	/* cleanup */
+	for (f = 0; f < count; f++) {
+		for (r = 0; r < files[f].count; r++) {
+			for (i = 0; i < MAXENTRIES_ARRAY(ipv6logstats_statentries); i++) {
+				libipv6calc_hll_free(files[f].records[r].unique_statentries[i]);
+			};
+		};
+		free(files[f].records);
+	};
+	free(records);
+	free(threads);
+	free(files);
+
+	return(result);
 };
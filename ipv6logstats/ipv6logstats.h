@@ -51,6 +51,22 @@
 #define STATS_IPV6_IID_ISATAP		0x103
 #define STATS_IPV6_IID_UNKNOWN		0x10f
 
+/* top prefixes */
+#define TOP_PREFIX_MAX		8
+#define TOP_COUNT_DEFAULT	100
+#define TOP_COUNT_MAX		100000
+#define TOP_CAPACITY_FACTOR	10	// tracked prefixes per printed one
+
+/* time intervals */
+#define INTERVAL_MAX		86400
+
+/* binary form of statistics */
+#define STATS_BINARY_MAGIC	"\0IPV6LS"	// 8 bytes including terminating \0
+#define STATS_BINARY_ENTRY_SIZE	12		// statistic number (4 bytes) + counter (8 bytes)
+
+/* collect mode */
+#define COLLECT_RECORDS_CHUNK	64
+
 #define DEBUG_ipv6logstats_general	0x00000001l
 #define DEBUG_ipv6logstats_summary	0x00000002l
 #define DEBUG_ipv6logstats_processing	0x00000004l
@@ -58,7 +74,6 @@
 /* labels statistic numbers */
 typedef struct {
 	const int	number;
-	long unsigned int counter;
 	const char *token;
 } stat_entries;
 
@@ -15,6 +15,7 @@
 #include "ipv6calctypes.h"
 #include "ipv6calccommands.h"
 #include "ipv6calchelp.h"
+#include "libipv6calcstream.h"
 #include "config.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
@@ -74,7 +75,8 @@ void ipv6logstats_printhelp(void) {
 	fprintf(stderr, "\n");
 
 	fprintf(stderr, " Takes web server log data (or any other data which has IPv4/v6 address in first column)\n");
-	fprintf(stderr, "   from stdin and print statistics table/list (depending on option) to stdout\n");
+	fprintf(stderr, "   from given files or stdin and print statistics table/list (depending on option) to stdout\n");
+	libipv6calc_stream_printhelp();
 
 	printhelp_common(IPV6CALC_HELP_ALL);
 
@@ -85,8 +87,26 @@ void ipv6logstats_printhelp(void) {
 	fprintf(stderr, "  [-o|--onlyheader]          : print only header in columns mode (1)\n");
 	fprintf(stderr, "  [-p|--prefix <token>]      : print token as prefix (1)\n");
 	fprintf(stderr, "  [-s|--simple]              : disable extended statistic (CountryCode/ASN)\n");
+	fprintf(stderr, "  [-U|--unique]              : estimate number of unique clients (HyperLogLog)\n");
+	fprintf(stderr, "  [--unique-sketch]          : print sketches of unique clients for merging (2)\n");
+	fprintf(stderr, "  [-T|--top-prefix ipv4|ipv6/<length>]\n");
+	fprintf(stderr, "                             : print top prefixes of given length by requests (2)\n");
+	fprintf(stderr, "                               (can be given multiple times, max. %d)\n", TOP_PREFIX_MAX);
+	fprintf(stderr, "  [--top-count <number>]     : number of printed top prefixes (default: %d)\n", TOP_COUNT_DEFAULT);
+	fprintf(stderr, "  [--interval <seconds>]     : print statistics of each time interval while reading (max. %d)\n", INTERVAL_MAX);
+	fprintf(stderr, "  [--interval-logtime]       : intervals by timestamp of log line instead of wall clock\n");
+	fprintf(stderr, "  [--binary]                 : print statistics in compact binary form (for --collect)\n");
+	fprintf(stderr, "\n");
+	fprintf(stderr, " Collect statistics printed before (rows or binary) from given files, merged by\n");
+	fprintf(stderr, "   token or interval start, and print a table sorted by it (e.g. for gnuplot/gri):\n");
+	fprintf(stderr, "  --collect [-c [-n] [-N]] [-U] [-j|--jobs <num>] <file> ...\n");
+	fprintf(stderr, "                             : default: token ALL IPv4 IPv6 (like collect_ipv6logstats.pl)\n");
+	fprintf(stderr, "                               -c: all counters like columns mode\n");
+	fprintf(stderr, "                               -U: unique clients by merged sketches (--unique-sketch)\n");
+	fprintf(stderr, "                               -j: read up to <num> files concurrently\n");
 	fprintf(stderr, "\n");
 	fprintf(stderr, " (1) unsupported for CountryCode & ASN statistics\n");
+	fprintf(stderr, " (2) only in row mode\n");
 	fprintf(stderr, "\n");
 
 	return;
@@ -20,7 +20,7 @@
 /* Options */
 
 /* define short options */
-static char *ipv6logstats_shortopts = "vh?uNosncp:w:";
+static char *ipv6logstats_shortopts = "vh?uNosncUp:w:T:j:";
 
 /* define long options */
 static struct option ipv6logstats_longopts[] = {
@@ -38,6 +38,15 @@ static struct option ipv6logstats_longopts[] = {
 	{"simple"	, 0, 0, (int) 's'},
 	{"write"	, 1, 0, (int) 'O'},
 	{"column-numbers", 1, 0, (int) 'N'},
+	{"unique"	, 0, 0, (int) 'U'},
+	{"unique-sketch", 0, 0, CMD_unique_sketch },
+	{"top-prefix"	, 1, 0, (int) 'T'},
+	{"top-count"	, 1, 0, CMD_top_count },
+	{"interval"	, 1, 0, CMD_interval },
+	{"interval-logtime", 0, 0, CMD_interval_logtime },
+	{"binary"	, 0, 0, CMD_binary },
+	{"collect"	, 0, 0, CMD_collect },
+	{"jobs"		, 1, 0, (int) 'j'},
 };                
 
 #endif
@@ -235,6 +235,113 @@ testscenarios_match | while read ip match; do
 done || exit 1
 echo "INFO  : $test successful"
 
+test="run 'ipv6logstats' unique clients test"
+echo "INFO  : $test"
+result="`printf "1.2.3.4\n1.2.3.4\n8.8.8.8\n2001:db8::1\n2001:db8::1\n2001:db8::2\n" | ./ipv6logstats -q -U 2>/dev/null | grep '^\*3\*Unique/\(ALL\|IPv4\|IPv6\) ' | awk '{ printf "%s ", $2 }'`"
+if [ "$result" != "4 2 2 " ]; then
+	echo "ERROR : unexpected result of unique clients (ALL IPv4 IPv6): $result"
+	exit 1
+fi
+# estimation of 20000 unique clients (each 2 times) has to be within 5%
+result="`perl -e '{ for ($i = 0; $i < 40000; $i++) { printf "10.%d.%d.1\n", ($i % 20000) >> 8, ($i % 20000) & 0xff } }' | ./ipv6logstats -q -U 2>/dev/null | grep '^\*3\*Unique/IPv4 ' | awk '{ print $2 }'`"
+if [ -z "$result" ] || [ $result -lt 19000 -o $result -gt 21000 ]; then
+	echo "ERROR : estimation of unique clients out of range: $result (expected: 20000)"
+	exit 1
+fi
+[ "$verbose" = "1" ] && echo "INFO  : estimation of 20000 unique clients: $result"
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' top prefixes test"
+echo "INFO  : $test"
+testscenario_top() {
+	perl -e '{ srand(45); for ($i = 0; $i < 20000; $i++) {
+		printf "%d.%d.%d.%d\n", 11 + rand(200), rand(256), rand(256), rand(256);
+		printf "10.1.1.%d\n", rand(256) if ($i % 2 == 0);
+		printf "10.2.2.%d\n", rand(256) if ($i % 4 == 0);
+		printf "10.3.3.%d\n", rand(256) if ($i % 8 == 0);
+		printf "2001:db8:%x:%x::1\n", rand(65536), rand(65536);
+		printf "2001:db8:0:%x::1\n", rand(65536) if ($i % 3 == 0);
+	} }'
+}
+result="`testscenario_top | ./ipv6logstats -q -s -T ipv4/24 -T ipv6/48 --top-count 3 2>/dev/null | grep '^\*3\*Top-proto-prefix-list/' | awk '{ printf "%s ", $1 }'`"
+result_expected="*3*Top-proto-prefix-list/IPv4/10.1.1.0/24 *3*Top-proto-prefix-list/IPv4/10.2.2.0/24 *3*Top-proto-prefix-list/IPv4/10.3.3.0/24 *3*Top-proto-prefix-list/IPv6/2001:db8::/48 "
+case "$result" in
+    "$result_expected"*)
+	;;
+    *)
+	echo "ERROR : unexpected top prefixes: $result"
+	echo "ERROR : expected (begin)       : $result_expected"
+	exit 1
+	;;
+esac
+[ "$verbose" = "1" ] && echo "INFO  : top prefixes: $result"
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' interval by log time test"
+echo "INFO  : $test"
+testscenario_interval() {
+	perl -e '{ for ($i = 0; $i < 600; $i++) {
+		$s = int($i / 2);
+		printf "%s - - [10/Oct/2000:13:%02d:%02d +0000] \"GET / HTTP/1.1\" 200 1\n", ($i % 2 == 0) ? "192.0.2." . ($i % 200) : "2001:db8::" . ($i % 200), 55 + int($s / 60), $s % 60;
+	} }'
+}
+result="`testscenario_interval | ./ipv6logstats -q -s -c -n --interval 60 --interval-logtime 2>/dev/null | awk '{ printf "%s/%s/%s/%s ", $1, $2, $3, $4 }'`"
+result_expected="971186100/120/60/60 971186160/120/60/60 971186220/120/60/60 971186280/120/60/60 971186340/120/60/60 "
+if [ "$result" != "$result_expected" ]; then
+	echo "ERROR : unexpected interval statistics: $result"
+	echo "ERROR : expected                      : $result_expected"
+	exit 1
+fi
+[ "$verbose" = "1" ] && echo "INFO  : interval statistics: $result"
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' collect test"
+echo "INFO  : $test"
+result="`./ipv6logstats -q --collect examples-data/data-20030[1-3].txt examples-data/data-200301.txt 2>/dev/null | tr '\n' '/'`"
+result_expected="200301 5282 5170 112 /200302 9194 9163 31 /200303 12345 12334 11 /"
+if [ "$result" != "$result_expected" ]; then
+	echo "ERROR : unexpected collected statistics: $result"
+	echo "ERROR : expected                       : $result_expected"
+	exit 1
+fi
+for format in "" "--binary"; do
+	result="`testscenario_interval | ./ipv6logstats -q -s --interval 60 --interval-logtime $format 2>/dev/null | ./ipv6logstats -q --collect -c -n - 2>/dev/null | awk '{ printf "%s/%s/%s/%s ", $1, $2, $3, $4 }'`"
+	result_expected="971186100/120/60/60 971186160/120/60/60 971186220/120/60/60 971186280/120/60/60 971186340/120/60/60 "
+	if [ "$result" != "$result_expected" ]; then
+		echo "ERROR : unexpected collected interval statistics ($format): $result"
+		echo "ERROR : expected                                  : $result_expected"
+		exit 1
+	fi
+done
+echo "INFO  : $test successful"
+
+test="run 'ipv6logstats' lookup interleave test"
+echo "INFO  : $test"
+testscenario_interleave() {
+	perl -e '{ srand(34); for ($i = 0; $i < 3000; $i++) {
+		printf "%d.%d.%d.%d\n", 1 + rand(223), rand(256), rand(256), rand(256);
+		printf "2002:%x:%x::1\n", rand(65536), rand(65536) if ($i % 3 == 0);
+		printf "2001:db8:%x::1\n", rand(65536) if ($i % 5 == 0);
+	} }'
+}
+result_expected="`testscenario_interleave | ./ipv6logstats -q -s --db-lookup-interleave 1 2>/dev/null | grep -v 'Time:'`"
+for interleave in 8 16 32 64; do
+	result="`testscenario_interleave | ./ipv6logstats -q -s --db-lookup-interleave $interleave 2>/dev/null | grep -v 'Time:'`"
+	if [ -z "$result" ] || [ "$result" != "$result_expected" ]; then
+		echo "ERROR : unexpected statistics with lookup interleave: $interleave"
+		exit 1
+	fi
+done
+if [ -x ../databases/tools/test_ipv6calc_db_lookup_batch ]; then
+	if ! result="`../databases/tools/test_ipv6calc_db_lookup_batch -q -n 100000 -k 20000 2>&1`"; then
+		echo "ERROR : interleaved lookups differ from key by key lookups"
+		echo "$result"
+		exit 1
+	fi
+	[ "$verbose" = "1" ] && echo "INFO  : $result"
+fi
+echo "INFO  : $test successful"
+
 echo "INFO  : test scenario with huge amount of addresses..."
 if [ "$verbose" = "1" ]; then
 	testscenario_hugelist ipv4 | ./ipv6logstats -q >/dev/null
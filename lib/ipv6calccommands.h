@@ -97,7 +97,12 @@
 #define DB_dbip2_comm_to_free_switch_min_delta_months		0x0027110
 #define DB_dbip2_only_type		0x0027120
 
+#define DB_merged_disable		0x0028000
+#define DB_merged_dir			0x0028050
+
 #define DB_common_priorization		0x002fff0
+#define DB_common_reload_interval	0x002ffe0
+#define DB_common_lookup_interleave	0x002ffd0
 
 
 /* address anonymizer options */
@@ -125,6 +130,30 @@
 #define CMD_test_lt			0x0050040	// less than
 #define CMD_test_le			0x0050050	// less equal
 
+/* server mode */
+#define CMD_server			0x0060010
+#define CMD_server_timeout		0x0060011
+
+/* sorted batch mode */
+#define CMD_sorted_batch		0x0060030
+
+/* filter file */
+#define CMD_filter_file			0x0060040
+
+/* sketches of unique clients (ipv6logstats) */
+#define CMD_unique_sketch		0x0060050
+
+/* number of printed top prefixes (ipv6logstats) */
+#define CMD_top_count			0x0060060
+
+/* statistics of time intervals (ipv6logstats) */
+#define CMD_interval			0x0060070
+#define CMD_interval_logtime		0x0060071
+
+/* collect statistics (ipv6logstats) */
+#define CMD_collect			0x0060080
+#define CMD_binary			0x0060081
+
 /* no operations (dummy) */
 #define OPTION_NOOP			0xfffffff
 
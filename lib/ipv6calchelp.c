@@ -27,6 +27,7 @@
 #include "databases/lib/libipv6calc_db_wrapper_DBIP2.h"
 #include "databases/lib/libipv6calc_db_wrapper_BuiltIn.h"
 #include "databases/lib/libipv6calc_db_wrapper_External.h"
+#include "databases/lib/libipv6calc_db_wrapper_Merged.h"
 
 
 /* to be defined in each application */
@@ -387,6 +388,19 @@ void printhelp_common(const uint32_t help_features) {
 		fprintf(stderr, "  [--db-builtin-disable            ] : BuiltIn support disabled\n");
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+		fprintf(stderr, "\n");
+		fprintf(stderr, "  [--db-merged-disable             ] : Merged support disabled\n");
+		fprintf(stderr, "  [--db-merged-dir      <directory>] : Merged database directory (default: %s)\n", merged_db_dir);
+#endif
+
+		fprintf(stderr, "\n");
+		fprintf(stderr, "  [--db-reload-interval  <seconds> ] : check database files for replacement on disk\n");
+		fprintf(stderr, "                                         and reload them (default: 0=disabled)\n");
+		fprintf(stderr, "                                         (long running tools: also on SIGHUP)\n");
+		fprintf(stderr, "  [--db-lookup-interleave <number> ] : binary searches running interleaved on batch\n");
+		fprintf(stderr, "                                         lookups (1-%d, default: %d, 1=disabled)\n", IPV6CALC_DB_LOOKUP_INTERLEAVE_MAX, IPV6CALC_DB_LOOKUP_INTERLEAVE_DEFAULT);
+
 #if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION
 		fprintf(stderr, "\n");
 		fprintf(stderr, "  [--db-priorization <entry1>[:...]] : Database priorization order list (overwrites default)\n");
@@ -855,6 +869,64 @@ void printhelp_action_dispatcher(const uint32_t action, const int embedded) {
 			fprintf(stderr, "  -- (no-usable-database)\n");
 			fprintf(stderr, "\n");
 			break;
+
+		case ACTION_aggregate:
+			fprintf(stderr, " Aggregate IPv4/IPv6 addresses and prefixes into minimal list of prefixes\n");
+			fprintf(stderr, "  overlapping and adjacent entries are merged, IPv4 is printed before IPv6\n");
+			fprintf(stderr, "  input from stdin: one address or prefix per line, '#' starts a comment\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Examples:\n");
+			fprintf(stderr, "  ipv6calc -A aggregate 192.0.2.0/25 192.0.2.128/25 192.0.2.5 2001:db8::/33 2001:db8:8000::/33\n");
+			fprintf(stderr, "  192.0.2.0/24\n");
+			fprintf(stderr, "  2001:db8::/32\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, "  cat prefix-list.txt | ipv6calc -A aggregate\n");
+			fprintf(stderr, "\n");
+			break;
+
+		case ACTION_union:
+		case ACTION_intersection:
+		case ACTION_difference:
+			fprintf(stderr, " Calculate union, intersection or difference (first without second) of two\n");
+			fprintf(stderr, "  IPv4/IPv6 prefix list files, result as minimal list of prefixes\n");
+			fprintf(stderr, "  file format like for 'aggregate', '-' reads one of the lists from stdin\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Examples:\n");
+			fprintf(stderr, "  ipv6calc -A union allocations.txt routes.txt\n");
+			fprintf(stderr, "  ipv6calc -A intersection allocations.txt routes.txt\n");
+			fprintf(stderr, "  ipv6calc -A difference allocations.txt routes.txt\n");
+			fprintf(stderr, "  cat routes.txt | ipv6calc -A difference allocations.txt -\n");
+			fprintf(stderr, "\n");
+			break;
+
+		case ACTION_range_to_prefix:
+			fprintf(stderr, " Convert IPv4/IPv6 address ranges into minimal list of prefixes\n");
+			fprintf(stderr, "  range given as 'first - last' (also 'first-last' or 'first last'), '#' starts a comment\n");
+			fprintf(stderr, "  input from stdin is converted line by line\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Examples:\n");
+			fprintf(stderr, "  ipv6calc -A range2prefix 192.0.2.1 - 192.0.2.6\n");
+			fprintf(stderr, "  192.0.2.1/32\n");
+			fprintf(stderr, "  192.0.2.2/31\n");
+			fprintf(stderr, "  192.0.2.4/31\n");
+			fprintf(stderr, "  192.0.2.6/32\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, "  ipv6calc -A range2prefix 2001:db8:: - 2001:db8:1::ffff\n");
+			fprintf(stderr, "  2001:db8::/48\n");
+			fprintf(stderr, "  2001:db8:1::/112\n");
+			fprintf(stderr, "\n");
+			break;
+
+		case ACTION_prefix_to_range:
+			fprintf(stderr, " Convert IPv4/IPv6 prefixes into address ranges 'first - last'\n");
+			fprintf(stderr, "  input from stdin is converted line by line, '#' starts a comment\n");
+			fprintf(stderr, "\n");
+			fprintf(stderr, " Examples:\n");
+			fprintf(stderr, "  ipv6calc -A prefix2range 192.0.2.0/24 2001:db8::/33\n");
+			fprintf(stderr, "  192.0.2.0 - 192.0.2.255\n");
+			fprintf(stderr, "  2001:db8:: - 2001:db8:7fff:ffff:ffff:ffff:ffff:ffff\n");
+			fprintf(stderr, "\n");
+			break;
 	};
 };
 
@@ -185,6 +185,14 @@ void ipv6calc_options_add_common_basic(char *shortopts_p, const int shortopts_ma
 	ipv6calc_options_add(shortopts_p, shortopts_maxlen, longopts, maxentries_p, ipv6calc_shortopts_builtin, ipv6calc_longopts_builtin, MAXENTRIES_ARRAY(ipv6calc_longopts_builtin));
 #endif
 
+#ifdef SUPPORT_DB_MERGED
+	DEBUGPRINT_NA(DEBUG_ipv6calcoptions, "SUPPORT_DB_MERGED");
+	ipv6calc_options_add(shortopts_p, shortopts_maxlen, longopts, maxentries_p, ipv6calc_shortopts_merged, ipv6calc_longopts_merged, MAXENTRIES_ARRAY(ipv6calc_longopts_merged));
+#endif
+
+	DEBUGPRINT_NA(DEBUG_ipv6calcoptions, "DB_RELOAD");
+	ipv6calc_options_add(shortopts_p, shortopts_maxlen, longopts, maxentries_p, ipv6calc_shortopts_db_reload, ipv6calc_longopts_db_reload, MAXENTRIES_ARRAY(ipv6calc_longopts_db_reload));
+
 #if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION || defined SUPPORT_DBIP2 || defined SUPPORT_GEOIP2
 	DEBUGPRINT_NA(DEBUG_ipv6calcoptions, "DB_COMMON");
 	ipv6calc_options_add(shortopts_p, shortopts_maxlen, longopts, maxentries_p, ipv6calc_shortopts_db_common, ipv6calc_longopts_db_common, MAXENTRIES_ARRAY(ipv6calc_longopts_db_common));
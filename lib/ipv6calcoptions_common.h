@@ -180,6 +180,22 @@ static struct option ipv6calc_longopts_builtin[] = {
 };
 #endif // SUPPORT_BUILTIN
 
+#ifdef SUPPORT_DB_MERGED
+static char *ipv6calc_shortopts_merged = "";
+
+static struct option ipv6calc_longopts_merged[] = {
+	{"db-merged-disable"           , 0, NULL, DB_merged_disable     },
+	{"db-merged-dir"               , 1, NULL, DB_merged_dir         },
+};
+#endif // SUPPORT_DB_MERGED
+
+static char *ipv6calc_shortopts_db_reload = "";
+
+static struct option ipv6calc_longopts_db_reload[] = {
+	{"db-reload-interval"          , 1, NULL, DB_common_reload_interval },
+	{"db-lookup-interleave"        , 1, NULL, DB_common_lookup_interleave },
+};
+
 #if defined SUPPORT_EXTERNAL || defined SUPPORT_DBIP || defined SUPPORT_GEOIP || SUPPORT_IP2LOCATION || defined SUPPORT_MMDB || defined SUPPORT_GEOIP2 || defined SUPPORT_DBIP2
 static char *ipv6calc_shortopts_db_common = "";
 
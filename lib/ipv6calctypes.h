@@ -184,6 +184,8 @@ typedef struct {
 #define FORMATOPTION_NUM_mr_match_token		24	// 01000000
 #define FORMATOPTION_NUM_mr_quote_default	25	// 02000000 flag for controlling old quote behavior < 0.99.0
 #define FORMATOPTION_NUM_mr_match_token_suffix	26	// 04000000
+#define FORMATOPTION_NUM_mr_json		27	// 08000000
+#define FORMATOPTION_NUM_mr_fields		28	// 10000000
 
 #define FORMATOPTION_NUM_printembedded		31	// special
 
@@ -213,6 +215,11 @@ typedef struct {
 #define FORMATOPTION_mr_match_token		(uint32_t) (1 << FORMATOPTION_NUM_mr_match_token)
 #define FORMATOPTION_mr_quote_default		(uint32_t) (1 << FORMATOPTION_NUM_mr_quote_default) // flag for controlling old quote behavior < 0.99.0
 #define FORMATOPTION_mr_match_token_suffix	(uint32_t) (1 << FORMATOPTION_NUM_mr_match_token_suffix)
+#define FORMATOPTION_mr_json			(uint32_t) (1 << FORMATOPTION_NUM_mr_json)
+#define FORMATOPTION_mr_fields			(uint32_t) (1 << FORMATOPTION_NUM_mr_fields)
+
+/* machine readable options only used by showinfo */
+#define FORMATOPTION_mr_showinfo		(FORMATOPTION_mr_quote_always | FORMATOPTION_mr_quote_never | FORMATOPTION_mr_value_only | FORMATOPTION_mr_select_token | FORMATOPTION_mr_select_token_pa | FORMATOPTION_mr_match_token | FORMATOPTION_mr_quote_default | FORMATOPTION_mr_match_token_suffix | FORMATOPTION_mr_json | FORMATOPTION_mr_fields)
 
 #define FORMATOPTION_printembedded		(uint32_t) (1 << FORMATOPTION_NUM_printembedded)
 
@@ -277,6 +284,12 @@ typedef struct {
 #define ACTION_NUM_filter		15
 #define ACTION_NUM_test			16
 #define ACTION_NUM_addr_to_countrycode	17
+#define ACTION_NUM_aggregate		18
+#define ACTION_NUM_union		19
+#define ACTION_NUM_intersection		20
+#define ACTION_NUM_difference		21
+#define ACTION_NUM_range_to_prefix	22
+#define ACTION_NUM_prefix_to_range	23
 #define ACTION_NUM_undefined		31
 
 #define ACTION_auto			(uint32_t) 0x0
@@ -293,6 +306,12 @@ typedef struct {
 #define ACTION_filter			(uint32_t) (1 << ACTION_NUM_filter)
 #define ACTION_test			(uint32_t) (1 << ACTION_NUM_test)
 #define ACTION_addr_to_countrycode	(uint32_t) (1 << ACTION_NUM_addr_to_countrycode)
+#define ACTION_aggregate		(uint32_t) (1 << ACTION_NUM_aggregate)
+#define ACTION_union			(uint32_t) (1 << ACTION_NUM_union)
+#define ACTION_intersection		(uint32_t) (1 << ACTION_NUM_intersection)
+#define ACTION_difference		(uint32_t) (1 << ACTION_NUM_difference)
+#define ACTION_range_to_prefix		(uint32_t) (1 << ACTION_NUM_range_to_prefix)
+#define ACTION_prefix_to_range		(uint32_t) (1 << ACTION_NUM_prefix_to_range)
 #define ACTION_undefined		(uint32_t) (1 << ACTION_NUM_undefined)
 
 #define ANON_METHOD_ANONYMIZE		1
@@ -300,6 +319,10 @@ typedef struct {
 #define ANON_METHOD_KEEPTYPEASNCC	3
 #define ANON_METHOD_KEEPTYPEGEONAMEID	4
 
+/* parts of an IPv6 address to anonymize */
+#define ANON_PART_PREFIX		0x1
+#define ANON_PART_IID			0x2
+
 typedef struct {
 	const uint32_t number;
 	const char *token;
@@ -322,6 +345,12 @@ typedef struct {
 	{ ACTION_filter	              , "filter"          , "Filter addresses related to filter options", "" },
 	{ ACTION_test                 , "test"            , "Test address against given prefix or address", "" },
 	{ ACTION_addr_to_countrycode  , "addr2cc"         , "Converts IPv4/IPv6 address into Country Code", "" },
+	{ ACTION_aggregate            , "aggregate"       , "Aggregate IPv4/IPv6 addresses and prefixes from stdin into minimal prefix list", "" },
+	{ ACTION_union                , "union"           , "Union of two IPv4/IPv6 prefix list files as minimal prefix list", "" },
+	{ ACTION_intersection         , "intersection"    , "Intersection of two IPv4/IPv6 prefix list files as minimal prefix list", "" },
+	{ ACTION_difference           , "difference"      , "Difference of two IPv4/IPv6 prefix list files (first without second) as minimal prefix list", "" },
+	{ ACTION_range_to_prefix      , "range2prefix"    , "Converts IPv4/IPv6 address ranges 'first - last' into minimal prefix lists", "" },
+	{ ACTION_prefix_to_range      , "prefix2range"    , "Converts IPv4/IPv6 prefixes into address ranges 'first - last'", "" },
 };
 
 /* Possible action option map (required) */
@@ -337,6 +366,12 @@ typedef struct {
 	{ ACTION_prefix_mac_to_ipv6	, 0 , 0},
 	{ ACTION_anonymize		, 0 , 0},
 	{ ACTION_addr_to_countrycode	, 0 , 0},
+	{ ACTION_aggregate		, 0 , 0},
+	{ ACTION_union			, 0 , 0},
+	{ ACTION_intersection		, 0 , 0},
+	{ ACTION_difference		, 0 , 0},
+	{ ACTION_range_to_prefix	, 0 , 0},
+	{ ACTION_prefix_to_range	, 0 , 0},
 	{ ACTION_6rd_local_prefix	, CMD_6rd_prefix, 0},
 	{ ACTION_6rd_local_prefix	, CMD_6rd_relay_prefix, 1 },
 	{ ACTION_6rd_extract_ipv4	, CMD_6rd_prefixlength, 0},
@@ -367,6 +402,25 @@ typedef struct {
 } s_ipv6calc_anon_methods;
 
 
+/* database attributes retrieved at once (libipv6calc_db_wrapper_all_by_addr) */
+#define IPV6CALC_DB_ATTR_CC		0x01
+#define IPV6CALC_DB_ATTR_AS		0x02
+#define IPV6CALC_DB_ATTR_GEONAMEID	0x04
+#define IPV6CALC_DB_ATTR_REGISTRY	0x08
+#define IPV6CALC_DB_ATTR_ALL		(IPV6CALC_DB_ATTR_CC | IPV6CALC_DB_ATTR_AS | IPV6CALC_DB_ATTR_GEONAMEID | IPV6CALC_DB_ATTR_REGISTRY)
+
+typedef struct {
+	uint16_t	cc_index;
+	uint32_t	as_num32;
+	uint32_t	GeonameID;
+	unsigned int	GeonameID_type;
+	int		registry;
+	unsigned int	data_source_cc;
+	unsigned int	data_source_as;
+	unsigned int	data_source_GeonameID;
+} s_ipv6calc_db_attributes;
+
+
 /**** filter structures ****/
 #define IPV6CALC_FILTER_DB_CC_MAX	16
 #define IPV6CALC_FILTER_DB_ASN_MAX	16
@@ -374,6 +428,80 @@ typedef struct {
 #define IPV6CALC_FILTER_IPV4ADDR	16
 #define IPV6CALC_FILTER_IPV6ADDR	16
 
+/* prefix trie node (path-compressed binary trie, see libipv6calcset.c) */
+typedef struct {
+	uint32_t key[4];	// prefix, bits behind length are zero
+	uint32_t child[2];	// index of child node by next bit, 0 = none
+	uint8_t  length;	// prefix length
+	uint8_t  terminal;	// =1: prefix is member of set
+} s_ipv6calc_trie_node;
+
+/* prefix trie, keys up to 128 bit (IPv4: key[0] only) */
+typedef struct {
+	s_ipv6calc_trie_node *nodes;	// node 0 is root (length 0)
+	uint32_t nodes_used;
+	uint32_t nodes_size;
+	uint32_t prefixes;		// number of members
+} s_ipv6calc_trie;
+
+/* set of 32-bit numbers (bitset split in 65536 lazy allocated blocks of 65536 bits) */
+#define IPV6CALC_IDSET_BLOCKS		65536
+#define IPV6CALC_IDSET_BLOCK_WORDS	(65536 / 64)
+
+typedef struct {
+	uint64_t *blocks[IPV6CALC_IDSET_BLOCKS];
+	uint32_t members;
+} s_ipv6calc_idset;
+
+/* set of address ranges, keys up to 128 bit (IPv4: 1 word, IPv6: 4 words, most significant first) */
+#define IPV6CALC_RANGESET_INITIAL	1024
+#define IPV6CALC_RANGESET_PREFIXES_MAX	256	// max. prefixes covering one range (2 * 128 - 2)
+
+/* operations on two rangesets */
+#define IPV6CALC_RANGESET_OP_UNION		1
+#define IPV6CALC_RANGESET_OP_INTERSECTION	2
+#define IPV6CALC_RANGESET_OP_DIFFERENCE		3
+
+typedef struct {
+	uint32_t *ranges;	// per range: first[words] followed by last[words]
+	uint32_t count;		// number of ranges
+	uint32_t size;		// number of allocated ranges
+	int words;		// words per key
+	int normalized;		// =1: sorted, no overlapping or adjacent ranges
+} s_ipv6calc_rangeset;
+
+/**** sketch structures (see libipv6calcsketch.c) ****/
+
+/* HyperLogLog distinct counter, 2^12 registers (4 kByte, standard error ~1.6%) */
+#define IPV6CALC_HLL_PRECISION		12
+#define IPV6CALC_HLL_REGISTERS		(1 << IPV6CALC_HLL_PRECISION)
+#define IPV6CALC_HLL_SPARSE_MAX		128	// sparse entries before switching to registers
+
+typedef struct {
+	uint8_t  *registers;		// dense registers, NULL = sparse representation
+	uint32_t *sparse;		// sorted sparse entries (index << 8 | rank)
+	uint32_t sparse_used;
+	uint32_t sparse_size;
+} s_ipv6calc_hll;
+
+/* Space-Saving top-k counter of prefixes (keys up to 128 bit) */
+typedef struct {
+	uint32_t key[4];		// prefix, bits behind length are zero
+	uint64_t count;
+	uint64_t error;			// max. overestimation of count
+	uint32_t hash;
+	uint32_t slot;			// slot in hash table
+} s_ipv6calc_topk_entry;
+
+typedef struct {
+	s_ipv6calc_topk_entry *heap;	// min-heap by count
+	uint32_t *table;		// hash table: heap index + 1, 0 = empty
+	uint32_t table_mask;
+	uint32_t capacity;
+	uint32_t used;
+	int      length;		// prefix length of keys
+} s_ipv6calc_topk;
+
 /* DB CC (CountryCode) filter structure */
 typedef struct {
 	int active;
@@ -381,6 +509,8 @@ typedef struct {
 	int cc_may_not_have_max;
 	uint16_t cc_must_have[IPV6CALC_FILTER_DB_CC_MAX];
 	uint16_t cc_may_not_have[IPV6CALC_FILTER_DB_CC_MAX];
+	s_ipv6calc_idset *cc_must_have_set;		// from filter file, NULL = none
+	s_ipv6calc_idset *cc_may_not_have_set;		// from filter file, NULL = none
 } s_ipv6calc_filter_db_cc;
 
 
@@ -391,6 +521,8 @@ typedef struct {
 	int asn_may_not_have_max;
 	uint32_t asn_must_have[IPV6CALC_FILTER_DB_ASN_MAX];
 	uint32_t asn_may_not_have[IPV6CALC_FILTER_DB_ASN_MAX];
+	s_ipv6calc_idset *asn_must_have_set;		// from filter file, NULL = none
+	s_ipv6calc_idset *asn_may_not_have_set;		// from filter file, NULL = none
 } s_ipv6calc_filter_db_asn;
 
 
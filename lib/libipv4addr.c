@@ -19,6 +19,7 @@
 #include "ipv6calctypes.h"
 #include "libipv6calc.h"
 #include "libipv6calcdebug.h"
+#include "libipv6calcset.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
 
@@ -1087,6 +1088,8 @@ void ipv4addr_filter_clear(s_ipv6calc_filter_ipv4addr *filter) {
         filter->filter_addr.active = 0;
         filter->filter_addr.addr_must_have_max = 0;
         filter->filter_addr.addr_may_not_have_max = 0;
+	filter->filter_addr.trie_must_have = NULL;
+	filter->filter_addr.trie_may_not_have = NULL;
 
 	return;
 };
@@ -1347,6 +1350,12 @@ int ipv4addr_filter_check(const s_ipv6calc_filter_ipv4addr *filter) {
 				DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'addr/may_not_have'    : %s", resultstring);
 			};
 		};
+		if (filter->filter_addr.trie_must_have != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'addr/must_have' (file): %u prefixes", filter->filter_addr.trie_must_have->prefixes);
+		};
+		if (filter->filter_addr.trie_may_not_have != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'addr/may_not_have' (file): %u prefixes", filter->filter_addr.trie_may_not_have->prefixes);
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_libipv4addr, "ipv4 filter 'db.cc' active         : %d", filter->filter_db_cc.active);
@@ -1380,7 +1389,7 @@ int ipv4addr_filter_check(const s_ipv6calc_filter_ipv4addr *filter) {
  * ret: 0=match 1=not match
  */
 int ipv4addr_filter(const ipv6calc_ipv4addr *ipv4addrp, const s_ipv6calc_filter_ipv4addr *filter) {
-	int result = 0, r, i, t;
+	int result = 0, r, i, t, must_have = -1;
 
 	if (filter->active == 0) {
 		DEBUGPRINT_NA(DEBUG_libipv4addr, "no filter active (SKIP)");
@@ -1436,10 +1445,7 @@ int ipv4addr_filter(const ipv6calc_ipv4addr *ipv4addrp, const s_ipv6calc_filter_
 						break;
 				};
 			};
-			if (r == 0) {
-				/* no match */
-				result = 1;
-			};
+			must_have = r;
 		};
 		if (filter->filter_addr.addr_may_not_have_max > 0) {
 			DEBUGPRINT_NA(DEBUG_libipv4addr, "compare against ipv4addr/may_not_have");
@@ -1474,6 +1480,30 @@ int ipv4addr_filter(const ipv6calc_ipv4addr *ipv4addrp, const s_ipv6calc_filter_
 				result = 1;
 			};
 		};
+		if ((filter->filter_addr.trie_must_have != NULL) || (filter->filter_addr.trie_may_not_have != NULL)) {
+			/* prefixes from filter file: longest match */
+			uint32_t key[4] = { ipv4addr_getdword(ipv4addrp), 0, 0, 0 };
+
+			if ((filter->filter_addr.trie_must_have != NULL) && (must_have != 1)) {
+				/* addr= expression and prefixes are one must-have set, any has to match */
+				if (libipv6calc_trie_lookup(filter->filter_addr.trie_must_have, key, 32) >= 0) {
+					DEBUGPRINT_NA(DEBUG_libipv4addr, "match in ipv4addr/must_have prefixes");
+					must_have = 1;
+				} else {
+					must_have = 0;
+				};
+			};
+
+			if ((filter->filter_addr.trie_may_not_have != NULL) && (libipv6calc_trie_lookup(filter->filter_addr.trie_may_not_have, key, 32) >= 0)) {
+				DEBUGPRINT_NA(DEBUG_libipv4addr, "match in ipv4addr/may_not_have prefixes");
+				result = 1;
+			};
+		};
+
+		if (must_have == 0) {
+			/* no match */
+			result = 1;
+		};
 	};
 
 	if (filter->filter_db_cc.active > 0) {
@@ -1659,3 +1689,69 @@ uint32_t libipv4addr_GeonameID_by_addr(const ipv6calc_ipv4addr *ipv4addrp, unsig
 
 	return(GeonameID);
 };
+
+
+/*
+ * CountryCode index, AS number, GeonameID and registry of IPv4 address at once
+ *  (one lookup per database instead of one per attribute)
+ *
+ * in : *ipv4addrp = IPv4 address structure
+ *      attributes = IPV6CALC_DB_ATTR_*
+ * mod: *attributesp
+ */
+void libipv4addr_all_by_addr(const ipv6calc_ipv4addr *ipv4addrp, const int attributes, s_ipv6calc_db_attributes *attributesp) {
+	int attributes_db = 0;
+	ipv6calc_ipaddr ipaddr;
+
+	libipv6calc_db_wrapper_attributes_clear(attributesp);
+
+	if ((ipv4addrp->typeinfo & IPV4_ADDR_ANONYMIZED) != 0) {
+		DEBUGPRINT_NA(DEBUG_libipv4addr, "IPv4 is anonymized, retrieve attributes one by one");
+
+		if ((attributes & IPV6CALC_DB_ATTR_CC) != 0) {
+			attributesp->cc_index = libipv4addr_cc_index_by_addr(ipv4addrp, &attributesp->data_source_cc);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_AS) != 0) {
+			attributesp->as_num32 = libipv4addr_as_num32_by_addr(ipv4addrp, &attributesp->data_source_as);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+			attributesp->GeonameID = libipv4addr_GeonameID_by_addr(ipv4addrp, &attributesp->data_source_GeonameID, &attributesp->GeonameID_type);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) {
+			attributesp->registry = libipv4addr_registry_num_by_addr(ipv4addrp);
+		};
+
+		goto END_libipv4addr_all_by_addr;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_CC) != 0) \
+	    && ((ipv4addrp->typeinfo & IPV4_ADDR_RESERVED) == 0) \
+	    && ((ipv4addrp->typeinfo & IPV4_ADDR_GLOBAL) != 0) \
+	    && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_CC) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_CC;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_AS) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_AS) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_AS;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_GEONAMEID) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_GEONAMEID;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV4_TO_REGISTRY) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_REGISTRY;
+	};
+
+	if (attributes_db != 0) {
+		CONVERT_IPV4ADDRP_IPADDR(ipv4addrp, ipaddr);
+		libipv6calc_db_wrapper_all_by_addr(&ipaddr, attributes_db, attributesp);
+	};
+
+END_libipv4addr_all_by_addr:
+	DEBUGPRINT_WA(DEBUG_libipv4addr, "cc_index=%d as_num32=%u GeonameID=%u registry=%d", attributesp->cc_index, attributesp->as_num32, attributesp->GeonameID, attributesp->registry);
+	return;
+};
@@ -36,6 +36,8 @@ typedef struct {
         int addr_may_not_have_max;
         ipv6calc_ipv4addr ipv4addr_must_have[IPV6CALC_FILTER_IPV4ADDR];
         ipv6calc_ipv4addr ipv4addr_may_not_have[IPV6CALC_FILTER_IPV6ADDR];
+	s_ipv6calc_trie *trie_must_have;	// prefixes from filter file, NULL = none
+	s_ipv6calc_trie *trie_may_not_have;	// prefixes from filter file, NULL = none
 } s_ipv6calc_filter_addr_ipv4;
 
 /* IPv4 filter structure */
@@ -241,4 +243,5 @@ extern void ipv4addr_filter_clear(s_ipv6calc_filter_ipv4addr *filter);
 extern uint16_t libipv4addr_cc_index_by_addr(const ipv6calc_ipv4addr *ipv4addrp, unsigned int *data_source_ptr);
 extern uint32_t libipv4addr_as_num32_by_addr(const ipv6calc_ipv4addr *ipv4addrp, unsigned int *data_source_ptr);
 extern uint32_t libipv4addr_GeonameID_by_addr(const ipv6calc_ipv4addr *ipv4addrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr);
+extern void     libipv4addr_all_by_addr(const ipv6calc_ipv4addr *ipv4addrp, const int attributes, s_ipv6calc_db_attributes *attributesp);
 extern int libipv4addr_registry_num_by_addr(const ipv6calc_ipv4addr *ipv4addrp);
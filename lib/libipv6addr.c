@@ -26,6 +26,7 @@
 #include "libipv6calcdebug.h"
 #include "libieee.h"
 #include "libeui64.h"
+#include "libipv6calcset.h"
 
 #include "../databases/lib/libipv6calc_db_wrapper.h"
 
@@ -2070,6 +2071,53 @@ uint32_t ipv6addr_get_payload_anonymized_iid(const ipv6calc_ipv6addr *ipv6addrp,
  *      1:anonymization method not supported
  */
 int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set) {
+	return(libipv6addr_anonymize_parts(ipv6addrp, ipv6calc_anon_set, ANON_PART_PREFIX | ANON_PART_IID));
+};
+
+
+/*
+ * check whether anonymized prefix and interface identifier of an IPv6 address
+ * depend only on the prefix resp. interface identifier (and its type)
+ *  global unicast address without embedded IPv4 address and a method storing
+ *  database results in the prefix, which are assumed to not differ inside a /64
+ *
+ * in : *ipv6addrp = IPv6 address structure (with typeinfo)
+ *      *ipv6calc_anon_set = anonymization set structure
+ * ret: 1:parts are independent
+ */
+int libipv6addr_anonymize_parts_independent(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set) {
+	if ((ipv6calc_anon_set->method != ANON_METHOD_KEEPTYPEASNCC) && (ipv6calc_anon_set->method != ANON_METHOD_KEEPTYPEGEONAMEID)) {
+		return(0);
+	};
+
+	if ((ipv6addrp->flag_typeinfo == 0) || ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_AGU) == 0)) {
+		return(0);
+	};
+
+	if ((ipv6addrp->typeinfo & (IPV6_ADDR_ANYCAST | IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_ADDR_ULUA | IPV6_NEW_ADDR_ORCHID | IPV6_ADDR_HAS_PUBLIC_IPV4 | IPV6_ADDR_ANONYMIZED_PREFIX | IPV6_ADDR_ANONYMIZED_IID)) != 0) {
+		return(0);
+	};
+
+	if ((ipv6addrp->typeinfo2 & IPV6_ADDR_TYPE2_LISP) != 0) {
+		return(0);
+	};
+
+	return(1);
+};
+
+
+/*
+ * anonymize parts of IPv6 address
+ *  parts can be anonymized separately only in case of
+ *  libipv6addr_anonymize_parts_independent() returns 1
+ *
+ * in : *ipv6addrp = IPv6 address structure
+ *      *ipv6calc_anon_set = anonymization set structure
+ *      parts = ANON_PART_PREFIX and/or ANON_PART_IID
+ * ret: 0:anonymization ok
+ *      1:anonymization method not supported
+ */
+int libipv6addr_anonymize_parts(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set, const int parts) {
 	/* anonymize IPv4 address according to settings */
 	uint32_t iid[2];
 	char tempstring[NI_MAXHOST];
@@ -2098,7 +2146,7 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 
 	uint8_t bit_ul = 0;
 
-	DEBUGPRINT_WA(DEBUG_libipv6addr, "Called: addr=%08x %08x %08x %08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3));
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "Called: addr=%08x %08x %08x %08x parts=%d", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1), ipv6addr_getdword(ipv6addrp, 2), ipv6addr_getdword(ipv6addrp, 3), parts);
 
 	ipv6addr_settype(ipv6addrp);
 
@@ -2170,7 +2218,7 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 	};
 
 	/* prefix handling */
-	if ( ((ipv6addrp->typeinfo & (IPV6_ADDR_SITELOCAL | IPV6_ADDR_ULUA | IPV6_NEW_ADDR_AGU)) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID)) == 0) ) {
+	if ( ((parts & ANON_PART_PREFIX) != 0) && ((ipv6addrp->typeinfo & (IPV6_ADDR_SITELOCAL | IPV6_ADDR_ULUA | IPV6_NEW_ADDR_AGU)) != 0) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID)) == 0) ) {
 		/* prefix included */
 		DEBUGPRINT_WA(DEBUG_libipv6addr, "Prefix: pref=%08x %08x", ipv6addr_getdword(ipv6addrp, 0), ipv6addr_getdword(ipv6addrp, 1));
 
@@ -2347,7 +2395,7 @@ int libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_se
 
 InterfaceIdentifier:
 	/* interface identifier handling */
-	if ( ( ((ipv6addrp->typeinfo & (IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_NEW_ADDR_AGU | IPV6_ADDR_ULUA )) != 0) || ((ipv6addrp->typeinfo & (IPV6_ADDR_LOOPBACK | IPV6_NEW_ADDR_SOLICITED_NODE)) == (IPV6_ADDR_LOOPBACK | IPV6_NEW_ADDR_SOLICITED_NODE)) ) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID)) == 0) ) {
+	if ( ((parts & ANON_PART_IID) != 0) && ( ((ipv6addrp->typeinfo & (IPV6_ADDR_LINKLOCAL | IPV6_ADDR_SITELOCAL | IPV6_NEW_ADDR_AGU | IPV6_ADDR_ULUA )) != 0) || ((ipv6addrp->typeinfo & (IPV6_ADDR_LOOPBACK | IPV6_NEW_ADDR_SOLICITED_NODE)) == (IPV6_ADDR_LOOPBACK | IPV6_NEW_ADDR_SOLICITED_NODE)) ) && ((ipv6addrp->typeinfo & (IPV6_NEW_ADDR_TEREDO | IPV6_NEW_ADDR_ORCHID)) == 0) ) {
 		/* Interface identifier included */
 		if ((ipv6addrp->typeinfo & IPV6_NEW_ADDR_IID_EUI48) != 0) {
 			/* EUI-48 */
@@ -2658,6 +2706,8 @@ void ipv6addr_filter_clear(s_ipv6calc_filter_ipv6addr *filter) {
 	filter->filter_addr.active = 0;
 	filter->filter_addr.addr_must_have_max = 0;
 	filter->filter_addr.addr_may_not_have_max = 0;
+	filter->filter_addr.trie_must_have = NULL;
+	filter->filter_addr.trie_may_not_have = NULL;
 
 	return;
 };
@@ -2944,6 +2994,12 @@ int ipv6addr_filter_check(const s_ipv6calc_filter_ipv6addr *filter) {
 				DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'addr/may_not_have'     : %s", resultstring);
 			};
 		};
+		if (filter->filter_addr.trie_must_have != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'addr/must_have' (file) : %u prefixes", filter->filter_addr.trie_must_have->prefixes);
+		};
+		if (filter->filter_addr.trie_may_not_have != NULL) {
+			DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'addr/may_not_have' (file): %u prefixes", filter->filter_addr.trie_may_not_have->prefixes);
+		};
 	};
 
 	DEBUGPRINT_WA(DEBUG_libipv6addr, "ipv6 filter 'db.cc' active          : %d", filter->filter_db_cc.active);
@@ -2977,7 +3033,7 @@ int ipv6addr_filter_check(const s_ipv6calc_filter_ipv6addr *filter) {
  * ret: 0=match 1=not match
  */
 int ipv6addr_filter(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_filter_ipv6addr *filter) {
-	int result = 0, r, i, t;
+	int result = 0, r, i, t, must_have = -1;
 
 	if (filter->active == 0) {
 		DEBUGPRINT_NA(DEBUG_libipv6addr, "No filter active (SKIP)");
@@ -3053,11 +3109,8 @@ int ipv6addr_filter(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_filter_
 
 				DEBUGPRINT_WA(DEBUG_libipv6addr, "compare against ipv6addr/must_have result filter number: %d r=%d", i, r);
 			};
-			if (r == 0) {
-				/* no match */
-				result = 1;
-			};
-			DEBUGPRINT_WA(DEBUG_libipv6addr, "compare against ipv6addr/must_have result: r=%d result=%d", r, result);
+			must_have = r;
+			DEBUGPRINT_WA(DEBUG_libipv6addr, "compare against ipv6addr/must_have result: r=%d", r);
 		};
 		if (filter->filter_addr.addr_may_not_have_max > 0) {
 			DEBUGPRINT_NA(DEBUG_libipv6addr, "compare against ipv6addr/may_not_have");
@@ -3094,6 +3147,34 @@ int ipv6addr_filter(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_filter_
 				result = 1;
 			};
 		};
+		if ((filter->filter_addr.trie_must_have != NULL) || (filter->filter_addr.trie_may_not_have != NULL)) {
+			/* prefixes from filter file: longest match */
+			uint32_t key[4];
+
+			for (i = 0; i < 4; i++) {
+				key[i] = ipv6addr_getdword(ipv6addrp, i);
+			};
+
+			if ((filter->filter_addr.trie_must_have != NULL) && (must_have != 1)) {
+				/* addr= expression and prefixes are one must-have set, any has to match */
+				if (libipv6calc_trie_lookup(filter->filter_addr.trie_must_have, key, 128) >= 0) {
+					DEBUGPRINT_NA(DEBUG_libipv6addr, "match in ipv6addr/must_have prefixes");
+					must_have = 1;
+				} else {
+					must_have = 0;
+				};
+			};
+
+			if ((filter->filter_addr.trie_may_not_have != NULL) && (libipv6calc_trie_lookup(filter->filter_addr.trie_may_not_have, key, 128) >= 0)) {
+				DEBUGPRINT_NA(DEBUG_libipv6addr, "match in ipv6addr/may_not_have prefixes");
+				result = 1;
+			};
+		};
+
+		if (must_have == 0) {
+			/* no match */
+			result = 1;
+		};
 	};
 
 	if (filter->filter_db_cc.active > 0) {
@@ -3558,3 +3639,67 @@ uint32_t libipv6addr_GeonameID_by_addr(const ipv6calc_ipv6addr *ipv6addrp, unsig
 END_libipv6addr_GeonameID_by_addr:
 	return(GeonameID);
 };
+
+
+/*
+ * CountryCode index, AS number, GeonameID and registry of IPv6 address at once
+ *  (one lookup per database instead of one per attribute)
+ *
+ * in : *ipv6addrp = IPv6 address structure
+ *      attributes = IPV6CALC_DB_ATTR_*
+ * mod: *attributesp
+ */
+void libipv6addr_all_by_addr(const ipv6calc_ipv6addr *ipv6addrp, const int attributes, s_ipv6calc_db_attributes *attributesp) {
+	int attributes_db = 0;
+	ipv6calc_ipaddr ipaddr;
+
+	libipv6calc_db_wrapper_attributes_clear(attributesp);
+
+	if (((ipv6addrp->typeinfo & (IPV6_ADDR_ANONYMIZED_PREFIX | IPV6_ADDR_ANONYMIZED_IID | IPV6_ADDR_HAS_PUBLIC_IPV4_IN_IID | IPV6_ADDR_HAS_PUBLIC_IPV4_IN_PREFIX | IPV6_NEW_ADDR_6BONE | IPV6_NEW_ADDR_ORCHID)) != 0)
+	    || ((ipv6addrp->typeinfo2 & (IPV6_ADDR_TYPE2_LISP | IPV6_ADDR_TYPE2_ANON_MASKED_PREFIX)) != 0)) {
+		DEBUGPRINT_NA(DEBUG_libipv6addr, "special address type, retrieve attributes one by one");
+
+		if ((attributes & IPV6CALC_DB_ATTR_CC) != 0) {
+			attributesp->cc_index = libipv6addr_cc_index_by_addr(ipv6addrp, &attributesp->data_source_cc);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_AS) != 0) {
+			attributesp->as_num32 = libipv6addr_as_num32_by_addr(ipv6addrp, &attributesp->data_source_as);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
+			attributesp->GeonameID = libipv6addr_GeonameID_by_addr(ipv6addrp, &attributesp->data_source_GeonameID, &attributesp->GeonameID_type);
+		};
+
+		if ((attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) {
+			attributesp->registry = libipv6addr_registry_num_by_addr(ipv6addrp);
+		};
+
+		goto END_libipv6addr_all_by_addr;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_CC) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_CC) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_CC;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_AS) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_AS) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_AS;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_GEONAMEID) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_GEONAMEID) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_GEONAMEID;
+	};
+
+	if (((attributes & IPV6CALC_DB_ATTR_REGISTRY) != 0) && (libipv6calc_db_wrapper_has_features(IPV6CALC_DB_IPV6_TO_REGISTRY) == 1)) {
+		attributes_db |= IPV6CALC_DB_ATTR_REGISTRY;
+	};
+
+	if (attributes_db != 0) {
+		CONVERT_IPV6ADDRP_IPADDR(ipv6addrp, ipaddr);
+		libipv6calc_db_wrapper_all_by_addr(&ipaddr, attributes_db, attributesp);
+	};
+
+END_libipv6addr_all_by_addr:
+	DEBUGPRINT_WA(DEBUG_libipv6addr, "cc_index=%d as_num32=%u GeonameID=%u registry=%d", attributesp->cc_index, attributesp->as_num32, attributesp->GeonameID, attributesp->registry);
+	return;
+};
@@ -230,6 +230,8 @@ typedef struct {
         int addr_may_not_have_max;
         ipv6calc_ipv6addr ipv6addr_must_have[IPV6CALC_FILTER_IPV4ADDR];
         ipv6calc_ipv6addr ipv6addr_may_not_have[IPV6CALC_FILTER_IPV6ADDR];
+	s_ipv6calc_trie *trie_must_have;	// prefixes from filter file, NULL = none
+	s_ipv6calc_trie *trie_may_not_have;	// prefixes from filter file, NULL = none
 } s_ipv6calc_filter_addr_ipv6;
 
 /* IPv6 filter structure */
@@ -466,6 +468,8 @@ extern int  tokenlsb64_to_ipv6addrstruct(const char *addrstring, char *resultstr
 extern int  libipv6addr_ipv6addrstruct_to_tokenlsb64(const ipv6calc_ipv6addr *ipv6addrp, char *resultstring, const size_t resultstring_length, const uint32_t formatoptions);
 
 extern int      libipv6addr_anonymize(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set);
+extern int      libipv6addr_anonymize_parts(ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set, const int parts);
+extern int      libipv6addr_anonymize_parts_independent(const ipv6calc_ipv6addr *ipv6addrp, const s_ipv6calc_anon_set *ipv6calc_anon_set);
 extern uint32_t ipv6addr_get_payload_anonymized_iid(const ipv6calc_ipv6addr *ipv6addrp, const uint32_t typeinfo);
 extern int      ipv6addr_get_payload_anonymized_prefix(const ipv6calc_ipv6addr *ipv6addrp, const int payload_selector, uint32_t *result_ptr);
 
@@ -481,4 +485,5 @@ extern int  libipv6addr_get_included_ipv4addr(const ipv6calc_ipv6addr *ipv6addrp
 extern uint16_t libipv6addr_cc_index_by_addr(const ipv6calc_ipv6addr *ipv6addrp, unsigned int *data_source_ptr);
 extern uint32_t libipv6addr_as_num32_by_addr(const ipv6calc_ipv6addr *ipv6addrp, unsigned int *data_source_ptr);
 extern uint32_t libipv6addr_GeonameID_by_addr(const ipv6calc_ipv6addr *ipv6addrp, unsigned int *data_source_ptr, unsigned int *GeonameID_type_ptr);
+extern void     libipv6addr_all_by_addr(const ipv6calc_ipv6addr *ipv6addrp, const int attributes, s_ipv6calc_db_attributes *attributesp);
 extern int libipv6addr_registry_num_by_addr(const ipv6calc_ipv6addr *ipv6addrp);
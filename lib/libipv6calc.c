@@ -18,6 +18,7 @@
 #include "ipv6calctypes.h"
 #include "libipv6calc.h"
 #include "libipv6calcdebug.h"
+#include "libipv6calcset.h"
 #include "librfc1924.h"
 #include "librfc2874.h"
 #include "librfc1886.h"
@@ -414,6 +415,324 @@ END_libipv6calc_autodetectinput:
 };
 
 
+/* character classes of single-pass input classifier, other characters are not handled */
+#define CLASSIFY_OTHER	0
+#define CLASSIFY_DIGIT	1	/* 0-9 */
+#define CLASSIFY_HEX	2	/* a-f A-F */
+#define CLASSIFY_COLON	3	/* : */
+#define CLASSIFY_DOT	4	/* . */
+#define CLASSIFY_SLASH	5	/* / */
+#define CLASSIFY_DASH	6	/* - */
+#define CLASSIFY_END	7	/* \0 */
+
+static const uint8_t classify_charclass[256] = {
+	/* 0x00 */ 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 4, 5,
+	/* 0x30 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 0, 0, 0, 0, 0,
+	/* 0x40 */ 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x60 */ 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	/* 0x70-0xff: CLASSIFY_OTHER */
+};
+
+/* states of single-pass input classifier */
+#define CLASSIFY_ST_START	0	/* begin of string */
+#define CLASSIFY_ST_LEADCOLON	1	/* leading ':' */
+#define CLASSIFY_ST_GROUP	2	/* in hex group */
+#define CLASSIFY_ST_COLON	3	/* after ':' */
+#define CLASSIFY_ST_DCOLON	4	/* after '::' */
+#define CLASSIFY_ST_DASH	5	/* after '-' */
+#define CLASSIFY_ST_DOT		6	/* after '.' */
+#define CLASSIFY_ST_OCTET	7	/* in decimal octet */
+#define CLASSIFY_ST_SLASH	8	/* after '/' */
+#define CLASSIFY_ST_PREFIX	9	/* in prefix length */
+
+/*
+ * autodetect input type and parse IPv4/IPv6/MAC address in the same pass
+ *  common notations are decided and parsed by a table-driven state machine,
+ *  all others (scope ID, EUI-64, reverse nibbles, errors,...) are passed
+ *  to libipv6calc_autodetectinput and have to be parsed by the caller
+ *
+ * in : string
+ * in : settype = 1: set type information of address like the parser, 0: skip
+ * out: *ipv4addrp, *ipv6addrp, *macaddrp = address of returned type is filled like by the parser, can be NULL
+ * out: *flag_parsedp = 1: address of returned type is filled, 0: caller has to parse
+ * ret: format number (same as libipv6calc_autodetectinput)
+ */
+static uint32_t libipv6calc_autodetectinput_classify(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_macaddr *macaddrp, int *flag_parsedp, const int settype) {
+	const unsigned char *cp;
+	int state = CLASSIFY_ST_START, cls, i, nwords = 0, dcolon = -1, colons = 0, dashes = 0, noctets = 0;
+	int len = 0, maxlen = 0, decimal = 0, slash = 0, plen = 0, addrlen = 0;
+	uint32_t value = 0, decvalue = 0, prefixlength = 0, words[8], octets[4], final[8];
+
+	*flag_parsedp = 0;
+
+	for (cp = (const unsigned char *) string; ; cp++) {
+		cls = classify_charclass[*cp];
+
+		switch (state) {
+			case CLASSIFY_ST_GROUP:
+				if ((cls == CLASSIFY_DIGIT) || (cls == CLASSIFY_HEX)) {
+					if (++len > 4) {
+						goto END_classify_fallback;
+					};
+					value = (value << 4) | ((cls == CLASSIFY_DIGIT) ? (*cp - '0') : ((*cp | 0x20) - 'a' + 10));
+					decvalue = decvalue * 10 + (*cp - '0');
+					decimal &= (cls == CLASSIFY_DIGIT);
+					continue;
+				};
+
+				if (cls == CLASSIFY_DOT) {
+					/* group is first octet of dotted IPv4 part */
+					if ((decimal == 0) || (len > 3) || (decvalue > 255)) {
+						goto END_classify_fallback;
+					};
+					octets[noctets++] = decvalue;
+					state = CLASSIFY_ST_DOT;
+					break;
+				};
+
+				/* end of group */
+				if (nwords == 8) {
+					goto END_classify_fallback;
+				};
+				words[nwords++] = value;
+				if (len > maxlen) {
+					maxlen = len;
+				};
+
+				if (cls == CLASSIFY_COLON) {
+					colons++;
+					state = CLASSIFY_ST_COLON;
+				} else if ((cls == CLASSIFY_DASH) && (len <= 2)) {
+					dashes++;
+					state = CLASSIFY_ST_DASH;
+				} else if (cls == CLASSIFY_SLASH) {
+					state = CLASSIFY_ST_SLASH;
+				} else if (cls != CLASSIFY_END) {
+					goto END_classify_fallback;
+				};
+				break;
+
+			case CLASSIFY_ST_START:
+			case CLASSIFY_ST_COLON:
+			case CLASSIFY_ST_DCOLON:
+			case CLASSIFY_ST_DASH:
+				if ((cls == CLASSIFY_DIGIT) || (cls == CLASSIFY_HEX)) {
+					/* begin of group */
+					len = 1;
+					value = (cls == CLASSIFY_DIGIT) ? (*cp - '0') : ((*cp | 0x20) - 'a' + 10);
+					decvalue = *cp - '0';
+					decimal = (cls == CLASSIFY_DIGIT);
+					state = CLASSIFY_ST_GROUP;
+				} else if ((cls == CLASSIFY_COLON) && ((state == CLASSIFY_ST_START) || (state == CLASSIFY_ST_COLON)) && (dcolon < 0)) {
+					dcolon = nwords;
+					colons++;
+					state = (state == CLASSIFY_ST_START) ? CLASSIFY_ST_LEADCOLON : CLASSIFY_ST_DCOLON;
+				} else if ((state == CLASSIFY_ST_DCOLON) && (cls == CLASSIFY_SLASH)) {
+					state = CLASSIFY_ST_SLASH;
+				} else if ((state != CLASSIFY_ST_DCOLON) || (cls != CLASSIFY_END)) {
+					goto END_classify_fallback;
+				};
+				break;
+
+			case CLASSIFY_ST_LEADCOLON:
+				if (cls != CLASSIFY_COLON) {
+					goto END_classify_fallback;
+				};
+				colons++;
+				state = CLASSIFY_ST_DCOLON;
+				break;
+
+			case CLASSIFY_ST_DOT:
+				if (cls != CLASSIFY_DIGIT) {
+					goto END_classify_fallback;
+				};
+				len = 1;
+				decvalue = *cp - '0';
+				state = CLASSIFY_ST_OCTET;
+				break;
+
+			case CLASSIFY_ST_OCTET:
+				if (cls == CLASSIFY_DIGIT) {
+					if (++len > 3) {
+						goto END_classify_fallback;
+					};
+					decvalue = decvalue * 10 + (*cp - '0');
+					continue;
+				};
+
+				if ((decvalue > 255) || (noctets == 4)) {
+					goto END_classify_fallback;
+				};
+				octets[noctets++] = decvalue;
+
+				if (cls == CLASSIFY_DOT) {
+					state = CLASSIFY_ST_DOT;
+				} else if ((cls == CLASSIFY_SLASH) && (noctets == 4)) {
+					state = CLASSIFY_ST_SLASH;
+				} else if ((cls != CLASSIFY_END) || (noctets != 4)) {
+					goto END_classify_fallback;
+				};
+				break;
+
+			case CLASSIFY_ST_SLASH:
+				if (cls != CLASSIFY_DIGIT) {
+					goto END_classify_fallback;
+				};
+				slash = 1;
+				addrlen = (const char *) cp - string - 1;
+				plen = 1;
+				prefixlength = *cp - '0';
+				state = CLASSIFY_ST_PREFIX;
+				break;
+
+			case CLASSIFY_ST_PREFIX:
+				if (cls == CLASSIFY_DIGIT) {
+					if (++plen > 3) {
+						goto END_classify_fallback;
+					};
+					prefixlength = prefixlength * 10 + (*cp - '0');
+					break;
+				};
+				if (cls != CLASSIFY_END) {
+					goto END_classify_fallback;
+				};
+				break;
+		};
+
+		if (cls == CLASSIFY_END) {
+			break;
+		};
+	};
+
+	if (slash == 0) {
+		addrlen = (const char *) cp - string;
+	};
+
+	/* decide on collected structure */
+	if (dashes > 0) {
+		/* MAC xx-xx-xx-xx-xx-xx */
+		if ((dashes == 5) && (colons == 0) && (nwords == 6) && (maxlen <= 2) && (noctets == 0) && (slash == 0)) {
+			goto END_classify_mac;
+		};
+		goto END_classify_fallback;
+	};
+
+	if (colons == 0) {
+		/* IPv4 d.d.d.d[/p] */
+		if ((noctets == 4) && (nwords == 0) && ((slash == 0) || ((plen <= 2) && (prefixlength <= 32)))) {
+			if (ipv4addrp != NULL) {
+				ipv4addr_clearall(ipv4addrp);
+				if (slash == 1) {
+					ipv4addrp->flag_prefixuse = 1;
+					ipv4addrp->prefixlength = (uint8_t) prefixlength;
+				};
+				for (i = 0; i <= 3; i++) {
+					ipv4addr_setoctet(ipv4addrp, (unsigned int) i, (unsigned int) octets[i]);
+				};
+				if (settype == 1) {
+					ipv4addrp->typeinfo = ipv4addr_gettype(ipv4addrp);
+				};
+				ipv4addrp->flag_valid = 1;
+				*flag_parsedp = 1;
+			};
+			DEBUGPRINT_WA(DEBUG_libipv6calc, "Classifier found type: ipv4addr (%s)", string);
+			return(FORMAT_ipv4addr);
+		};
+		goto END_classify_fallback;
+	};
+
+	if ((dcolon < 0) && (noctets == 0) && (slash == 0) && (maxlen <= 2)) {
+		/* MAC xx:xx:xx:xx:xx:xx, EUI-64 is left to autodetection */
+		if ((colons == 5) && (nwords == 6)) {
+			goto END_classify_mac;
+		};
+		goto END_classify_fallback;
+	};
+
+	/* IPv6 */
+	if ((noctets != 0) && (noctets != 4)) {
+		goto END_classify_fallback;
+	};
+	i = nwords + ((noctets == 4) ? 2 : 0);
+	if (((dcolon < 0) && (i != 8)) || ((dcolon >= 0) && (i > 7)) || (addrlen > 45) || ((slash == 1) && (prefixlength > 128))) {
+		goto END_classify_fallback;
+	};
+
+	if (ipv6addrp != NULL) {
+		for (i = 0; i < 8; i++) {
+			final[i] = 0;
+		};
+		if (noctets == 4) {
+			final[6] = (octets[0] << 8) | octets[1];
+			final[7] = (octets[2] << 8) | octets[3];
+		};
+		if (dcolon < 0) {
+			dcolon = nwords;
+		};
+		for (i = 0; i < dcolon; i++) {
+			final[i] = words[i];
+		};
+		for (i = nwords - 1; i >= dcolon; i--) {
+			final[i + 8 - nwords - ((noctets == 4) ? 2 : 0)] = words[i];
+		};
+
+		ipv6addr_clearall(ipv6addrp);
+		if (slash == 1) {
+			ipv6addrp->flag_prefixuse = 1;
+			ipv6addrp->prefixlength = (uint8_t) prefixlength;
+		};
+		ipv6addr_clear(ipv6addrp);
+		for (i = 0; i <= 7; i++) {
+			ipv6addr_setword(ipv6addrp, (unsigned int) i, (unsigned int) final[i]);
+		};
+		if (settype == 1) {
+			ipv6addr_settype(ipv6addrp);
+		};
+		ipv6addrp->flag_valid = 1;
+		*flag_parsedp = 1;
+	};
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Classifier found type: ipv6addr (%s)", string);
+	return(FORMAT_ipv6addr);
+
+END_classify_mac:
+	if (macaddrp != NULL) {
+		for (i = 0; i <= 5; i++) {
+			macaddrp->addr[i] = (uint8_t) words[i];
+		};
+		macaddrp->flag_valid = 1;
+		*flag_parsedp = 1;
+	};
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Classifier found type: mac (%s)", string);
+	return(FORMAT_mac);
+
+END_classify_fallback:
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Classifier not decided, run autodetection: %s", string);
+	return(libipv6calc_autodetectinput(string));
+};
+
+
+/*
+ * autodetect input type and parse IPv4/IPv6/MAC address in the same pass
+ *  (see libipv6calc_autodetectinput_classify)
+ */
+uint32_t libipv6calc_autodetectinput_parse(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_macaddr *macaddrp, int *flag_parsedp) {
+	return(libipv6calc_autodetectinput_classify(string, ipv4addrp, ipv6addrp, macaddrp, flag_parsedp, 1));
+};
+
+
+/*
+ * like libipv6calc_autodetectinput_parse, but type information of a parsed
+ * address is not set (typeinfo is 0), for callers using only the address
+ * value (e.g. sorting, prefix aggregation), skips IID random detection
+ */
+uint32_t libipv6calc_autodetectinput_parse_untyped(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_macaddr *macaddrp, int *flag_parsedp) {
+	return(libipv6calc_autodetectinput_classify(string, ipv4addrp, ipv6addrp, macaddrp, flag_parsedp, 0));
+};
+
+
 /*
  * clear filter master structure
  *
@@ -426,6 +745,41 @@ void libipv6calc_filter_clear(s_ipv6calc_filter_master *filter_master) {
 	return;
 };
 
+/*
+ * free prefix tries and sets of filter master structure created by filter file
+ *
+ * in : *filter    = filter structure
+ */
+void libipv6calc_filter_free(s_ipv6calc_filter_master *filter_master) {
+	libipv6calc_trie_free(filter_master->filter_ipv4addr.filter_addr.trie_must_have);
+	libipv6calc_trie_free(filter_master->filter_ipv4addr.filter_addr.trie_may_not_have);
+	libipv6calc_trie_free(filter_master->filter_ipv6addr.filter_addr.trie_must_have);
+	libipv6calc_trie_free(filter_master->filter_ipv6addr.filter_addr.trie_may_not_have);
+	filter_master->filter_ipv4addr.filter_addr.trie_must_have = NULL;
+	filter_master->filter_ipv4addr.filter_addr.trie_may_not_have = NULL;
+	filter_master->filter_ipv6addr.filter_addr.trie_must_have = NULL;
+	filter_master->filter_ipv6addr.filter_addr.trie_may_not_have = NULL;
+
+	libipv6calc_idset_free(filter_master->filter_ipv4addr.filter_db_cc.cc_must_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv4addr.filter_db_cc.cc_may_not_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv6addr.filter_db_cc.cc_must_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv6addr.filter_db_cc.cc_may_not_have_set);
+	filter_master->filter_ipv4addr.filter_db_cc.cc_must_have_set = NULL;
+	filter_master->filter_ipv4addr.filter_db_cc.cc_may_not_have_set = NULL;
+	filter_master->filter_ipv6addr.filter_db_cc.cc_must_have_set = NULL;
+	filter_master->filter_ipv6addr.filter_db_cc.cc_may_not_have_set = NULL;
+
+	libipv6calc_idset_free(filter_master->filter_ipv4addr.filter_db_asn.asn_must_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv4addr.filter_db_asn.asn_may_not_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv6addr.filter_db_asn.asn_must_have_set);
+	libipv6calc_idset_free(filter_master->filter_ipv6addr.filter_db_asn.asn_may_not_have_set);
+	filter_master->filter_ipv4addr.filter_db_asn.asn_must_have_set = NULL;
+	filter_master->filter_ipv4addr.filter_db_asn.asn_may_not_have_set = NULL;
+	filter_master->filter_ipv6addr.filter_db_asn.asn_must_have_set = NULL;
+	filter_master->filter_ipv6addr.filter_db_asn.asn_may_not_have_set = NULL;
+	return;
+};
+
 /*
  * clear filter sub structure db_cc
  *
@@ -437,6 +791,8 @@ void libipv6calc_filter_clear_db_cc(s_ipv6calc_filter_db_cc *filter_db_cc) {
 	filter_db_cc->active = 0;
 	filter_db_cc->cc_must_have_max = 0;
 	filter_db_cc->cc_may_not_have_max = 0;
+	filter_db_cc->cc_must_have_set = NULL;
+	filter_db_cc->cc_may_not_have_set = NULL;
 
 	for (i = 0; i < IPV6CALC_FILTER_DB_CC_MAX; i++) {
 		filter_db_cc->cc_must_have[i] = 0;
@@ -458,6 +814,8 @@ void libipv6calc_filter_clear_db_asn(s_ipv6calc_filter_db_asn *filter_db_asn) {
 	filter_db_asn->active = 0;
 	filter_db_asn->asn_must_have_max = 0;
 	filter_db_asn->asn_may_not_have_max = 0;
+	filter_db_asn->asn_must_have_set = NULL;
+	filter_db_asn->asn_may_not_have_set = NULL;
 
 	for (i = 0; i < IPV6CALC_FILTER_DB_ASN_MAX; i++) {
 		filter_db_asn->asn_must_have[i] = 0;
@@ -542,6 +900,189 @@ int libipv6calc_filter_parse(const char *expression, s_ipv6calc_filter_master *f
 };
 
 
+/*
+ * add number to filter set, set is created on demand
+ *
+ * mod: *idset_p   = pointer to set
+ * in : id
+ * ret: success
+ */
+static int libipv6calc_filter_idset_add(s_ipv6calc_idset **idset_p, const uint32_t id) {
+	if (*idset_p == NULL) {
+		*idset_p = libipv6calc_idset_new();
+		if (*idset_p == NULL) {
+			return(1);
+		};
+	};
+
+	return(libipv6calc_idset_add(*idset_p, id));
+};
+
+
+/*
+ * add prefix to filter trie, trie is created on demand
+ *
+ * mod: *trie_p    = pointer to trie
+ * in : key, length
+ * ret: success
+ */
+static int libipv6calc_filter_trie_add(s_ipv6calc_trie **trie_p, const uint32_t *key, const int length) {
+	if (*trie_p == NULL) {
+		*trie_p = libipv6calc_trie_new();
+		if (*trie_p == NULL) {
+			return(1);
+		};
+	};
+
+	return(libipv6calc_trie_insert(*trie_p, key, length));
+};
+
+
+/*
+ * function parses ipv6calc filter file
+ *  one entry per line, '#' starts a comment, leading '^' negates the entry
+ *  supported entries: IPv4/IPv6 address or prefix, db.cc=<CC>, db.asn=<ASN>
+ *  prefixes are stored in a prefix trie, CC and ASN in sets, so the number
+ *  of entries is not limited like in filter expressions
+ *  entries of the same kind are or'ed (must-have: any match, may-not-have: no match)
+ *
+ * in : filename
+ * mod: master filter structure
+ * ret: success
+ */
+int libipv6calc_filter_parse_file(const char *filename, s_ipv6calc_filter_master *filter_master) {
+	FILE *file;
+	char line[NI_MAXHOST];
+	char resultstring[NI_MAXHOST];
+	char *token, *end;
+	int negate, length, r, linenumber = 0, entries = 0, result = 0;
+	uint32_t inputtype, id, key[4];
+	ipv6calc_ipv4addr ipv4addr;
+	ipv6calc_ipv6addr ipv6addr;
+	s_ipv6calc_filter_db_cc filter_db_cc;
+	s_ipv6calc_filter_db_asn filter_db_asn;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "called with: %s", filename);
+
+	file = fopen(filename, "r");
+	if (file == NULL) {
+		ERRORPRINT_WA("Can't open filter file: %s", filename);
+		return (1);
+	};
+
+	while (fgets(line, sizeof(line), file) != NULL) {
+		linenumber++;
+
+		/* strip comment and surrounding whitespace */
+		end = strchr(line, '#');
+		if (end != NULL) {
+			*end = '\0';
+		};
+
+		token = line + strspn(line, " \t\r\n");
+		end = token + strlen(token);
+		while ((end > token) && (isspace((unsigned char) end[-1]))) {
+			end--;
+		};
+		*end = '\0';
+
+		if (*token == '\0') {
+			continue;
+		};
+
+		negate = 0;
+		if (*token == '^') {
+			negate = 1;
+			token++;
+		};
+
+		r = 1;
+
+		if (strncmp(token, "db.", 3) == 0) {
+			/* parse with temporary filter, resulting entry is added to the sets */
+			libipv6calc_filter_clear_db_cc(&filter_db_cc);
+			libipv6calc_filter_clear_db_asn(&filter_db_asn);
+
+			if (libipv6calc_db_cc_filter_parse(&filter_db_cc, token, negate) == 0) {
+				id = (negate == 1) ? filter_db_cc.cc_may_not_have[0] : filter_db_cc.cc_must_have[0];
+
+				if (negate == 1) {
+					r = libipv6calc_filter_idset_add(&filter_master->filter_ipv4addr.filter_db_cc.cc_may_not_have_set, id);
+					r += libipv6calc_filter_idset_add(&filter_master->filter_ipv6addr.filter_db_cc.cc_may_not_have_set, id);
+				} else {
+					r = libipv6calc_filter_idset_add(&filter_master->filter_ipv4addr.filter_db_cc.cc_must_have_set, id);
+					r += libipv6calc_filter_idset_add(&filter_master->filter_ipv6addr.filter_db_cc.cc_must_have_set, id);
+				};
+
+				filter_master->filter_ipv4addr.filter_db_cc.active = 1;
+				filter_master->filter_ipv6addr.filter_db_cc.active = 1;
+			} else if (libipv6calc_db_asn_filter_parse(&filter_db_asn, token, negate) == 0) {
+				id = (negate == 1) ? filter_db_asn.asn_may_not_have[0] : filter_db_asn.asn_must_have[0];
+
+				if (negate == 1) {
+					r = libipv6calc_filter_idset_add(&filter_master->filter_ipv4addr.filter_db_asn.asn_may_not_have_set, id);
+					r += libipv6calc_filter_idset_add(&filter_master->filter_ipv6addr.filter_db_asn.asn_may_not_have_set, id);
+				} else {
+					r = libipv6calc_filter_idset_add(&filter_master->filter_ipv4addr.filter_db_asn.asn_must_have_set, id);
+					r += libipv6calc_filter_idset_add(&filter_master->filter_ipv6addr.filter_db_asn.asn_must_have_set, id);
+				};
+
+				filter_master->filter_ipv4addr.filter_db_asn.active = 1;
+				filter_master->filter_ipv6addr.filter_db_asn.active = 1;
+			};
+
+			if (r == 0) {
+				filter_master->filter_ipv4addr.active = 1;
+				filter_master->filter_ipv6addr.active = 1;
+			};
+		} else {
+			inputtype = libipv6calc_autodetectinput(token);
+
+			if (inputtype == FORMAT_ipv4addr) {
+				if (addr_to_ipv4addrstruct(token, resultstring, sizeof(resultstring), &ipv4addr) == 0) {
+					key[0] = ipv4addr_getdword(&ipv4addr);
+					key[1] = 0;
+					key[2] = 0;
+					key[3] = 0;
+					length = (ipv4addr.flag_prefixuse == 1) ? ipv4addr.prefixlength : 32;
+
+					r = libipv6calc_filter_trie_add((negate == 1) ? &filter_master->filter_ipv4addr.filter_addr.trie_may_not_have : &filter_master->filter_ipv4addr.filter_addr.trie_must_have, key, length);
+
+					filter_master->filter_ipv4addr.filter_addr.active = 1;
+					filter_master->filter_ipv4addr.active = 1;
+				};
+			} else if (inputtype == FORMAT_ipv6addr) {
+				if (addr_to_ipv6addrstruct(token, resultstring, sizeof(resultstring), &ipv6addr) == 0) {
+					for (length = 0; length < 4; length++) {
+						key[length] = ipv6addr_getdword(&ipv6addr, length);
+					};
+					length = (ipv6addr.flag_prefixuse == 1) ? ipv6addr.prefixlength : 128;
+
+					r = libipv6calc_filter_trie_add((negate == 1) ? &filter_master->filter_ipv6addr.filter_addr.trie_may_not_have : &filter_master->filter_ipv6addr.filter_addr.trie_must_have, key, length);
+
+					filter_master->filter_ipv6addr.filter_addr.active = 1;
+					filter_master->filter_ipv6addr.active = 1;
+				};
+			};
+		};
+
+		if (r != 0) {
+			ERRORPRINT_WA("Unrecognized entry in filter file %s line %d: %s", filename, linenumber, token);
+			result = 1;
+			break;
+		};
+
+		entries++;
+	};
+
+	fclose(file);
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "filter file %s: %d entries", filename, entries);
+
+	return (result);
+};
+
+
 /*
  * function checks ipv6calc filter expression
  *
@@ -126,10 +126,14 @@ extern void string_to_reverse(char *string);
 extern void string_to_reverse_dotted(char *string, const size_t string_length);
 
 extern uint32_t libipv6calc_autodetectinput(const char *string);
+extern uint32_t libipv6calc_autodetectinput_parse(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_macaddr *macaddrp, int *flag_parsedp);
+extern uint32_t libipv6calc_autodetectinput_parse_untyped(const char *string, ipv6calc_ipv4addr *ipv4addrp, ipv6calc_ipv6addr *ipv6addrp, ipv6calc_macaddr *macaddrp, int *flag_parsedp);
 
 extern int  libipv6calc_filter_parse(const char *expression, s_ipv6calc_filter_master *filter_master);
+extern int  libipv6calc_filter_parse_file(const char *filename, s_ipv6calc_filter_master *filter_master);
 extern int  libipv6calc_filter_check(s_ipv6calc_filter_master *filter_master);
 extern void libipv6calc_filter_clear(s_ipv6calc_filter_master *filter_master);
+extern void libipv6calc_filter_free(s_ipv6calc_filter_master *filter_master);
 extern void libipv6calc_filter_clear_db_cc(s_ipv6calc_filter_db_cc *filter_db_cc);
 extern void libipv6calc_filter_clear_db_asn(s_ipv6calc_filter_db_asn *filter_db_asn);
 extern void libipv6calc_filter_clear_db_registry(s_ipv6calc_filter_db_registry *filter_db_registry);
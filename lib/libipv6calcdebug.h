@@ -51,6 +51,7 @@
 #define DEBUG_libipv6calc_db_wrapper_DBIP		0x10000000l
 #define DEBUG_libipv6calc_db_wrapper_DBIP2		0x10000000l
 #define DEBUG_libipv6calc_db_wrapper_External		0x20000000l
+#define DEBUG_libipv6calc_db_wrapper_Merged		0x20000000l
 #define DEBUG_libipv6calc_db_wrapper_BuiltIn		0x40000000l
 #define DEBUG_libipv6calc_db_wrapper_MMDB		0x80000000l
 
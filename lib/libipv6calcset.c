@@ -0,0 +1,926 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcset.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for large sets used by filters
+ *   - prefix trie: path-compressed binary trie, longest match in O(prefix bits)
+ *   - idset: bitset of 32-bit numbers (e.g. ASN, CountryCode index)
+ *   - rangeset: array of address ranges, radix sorted and merged in linear time,
+ *     union, intersection and difference of two sets by linear merge
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "libipv6calcset.h"
+
+
+/* initial number of trie nodes, doubled on demand */
+#define TRIE_NODES_INITIAL	1024
+
+
+/* 16-bit digit of sort entry, digit 0 is least significant */
+#define RADIX_DIGIT(p, words, d)	((((const uint32_t *) (p))[(words) - 1 - (d) / 2] >> (((d) & 1) * 16)) & 0xffff)
+
+/* leading/trailing zero bits of non-zero word */
+#if defined(__GNUC__) || defined(__clang__)
+#define SET_CLZ32(x)	__builtin_clz(x)
+#define SET_CTZ32(x)	__builtin_ctz(x)
+#else
+#define SET_CLZ32(x)	libipv6calc_set_clz32(x)
+#define SET_CTZ32(x)	(libipv6calc_set_clz32((x) & -(x)) ^ 31)
+#endif
+
+
+/* bit of key at position (0 = most significant bit of key[0]) */
+#define TRIE_BIT(key, pos)	(((key)[(pos) >> 5] >> (31 - ((pos) & 31))) & 1)
+
+
+/*
+ * copy key, bits behind length are cleared
+ */
+static void libipv6calc_trie_mask(uint32_t *dst, const uint32_t *src, const int length) {
+	int w;
+
+	for (w = 0; w < 4; w++) {
+		if (length >= (w + 1) * 32) {
+			dst[w] = src[w];
+		} else if (length > w * 32) {
+			dst[w] = src[w] & (0xffffffffu << (32 - (length - w * 32)));
+		} else {
+			dst[w] = 0;
+		};
+	};
+};
+
+
+/*
+ * number of leading bits both keys have in common
+ *
+ * in : a, b = keys
+ * in : length = max. number of bits to compare
+ * ret: common bits (max. length)
+ */
+static int libipv6calc_trie_common(const uint32_t *a, const uint32_t *b, const int length) {
+	int w, r;
+	uint32_t x;
+
+	for (w = 0; w * 32 < length; w++) {
+		x = a[w] ^ b[w];
+		if (x != 0) {
+			for (r = w * 32; (x & 0x80000000u) == 0; r++) {
+				x <<= 1;
+			};
+			return((r < length) ? r : length);
+		};
+	};
+
+	return(length);
+};
+
+
+/*
+ * add node
+ *
+ * mod: trie
+ * in : key (already masked), length, terminal
+ * ret: index of node, 0 = out of memory
+ */
+static uint32_t libipv6calc_trie_node_add(s_ipv6calc_trie *trie, const uint32_t *key, const int length, const int terminal) {
+	s_ipv6calc_trie_node *nodes, *node;
+
+	if (trie->nodes_used == trie->nodes_size) {
+		nodes = realloc(trie->nodes, sizeof(s_ipv6calc_trie_node) * trie->nodes_size * 2);
+		if (nodes == NULL) {
+			ERRORPRINT_WA("can't allocate memory for prefix trie nodes: %u", trie->nodes_size * 2);
+			return(0);
+		};
+		trie->nodes = nodes;
+		trie->nodes_size *= 2;
+	};
+
+	node = &trie->nodes[trie->nodes_used];
+	memcpy(node->key, key, sizeof(node->key));
+	node->length = length;
+	node->terminal = terminal;
+	node->child[0] = 0;
+	node->child[1] = 0;
+
+	return(trie->nodes_used++);
+};
+
+
+/*
+ * create new empty prefix trie
+ *
+ * ret: trie, NULL = out of memory
+ */
+s_ipv6calc_trie *libipv6calc_trie_new(void) {
+	s_ipv6calc_trie *trie;
+	static const uint32_t key_zero[4] = { 0, 0, 0, 0 };
+
+	trie = malloc(sizeof(s_ipv6calc_trie));
+	if (trie == NULL) {
+		ERRORPRINT_NA("can't allocate memory for prefix trie");
+		return(NULL);
+	};
+
+	trie->nodes = malloc(sizeof(s_ipv6calc_trie_node) * TRIE_NODES_INITIAL);
+	if (trie->nodes == NULL) {
+		ERRORPRINT_NA("can't allocate memory for prefix trie nodes");
+		free(trie);
+		return(NULL);
+	};
+
+	trie->nodes_size = TRIE_NODES_INITIAL;
+	trie->nodes_used = 0;
+	trie->prefixes = 0;
+
+	/* root */
+	libipv6calc_trie_node_add(trie, key_zero, 0, 0);
+
+	return(trie);
+};
+
+
+/*
+ * insert prefix into trie
+ *
+ * mod: trie
+ * in : key = prefix (4 x 32 bit, most significant first)
+ * in : length = prefix length (0-128)
+ * ret: 0 = ok, 1 = error
+ */
+int libipv6calc_trie_insert(s_ipv6calc_trie *trie, const uint32_t *key, const int length) {
+	uint32_t prefix[4], n = 0, c, m, l;
+	int b, common, child_length;
+
+	if ((length < 0) || (length > 128)) {
+		ERRORPRINT_WA("unsupported prefix length: %d", length);
+		return(1);
+	};
+
+	libipv6calc_trie_mask(prefix, key, length);
+
+	while (1 == 1) {
+		/* node n is prefix of key */
+		if (trie->nodes[n].length == length) {
+			if (trie->nodes[n].terminal == 0) {
+				trie->nodes[n].terminal = 1;
+				trie->prefixes++;
+			};
+			return(0);
+		};
+
+		b = TRIE_BIT(prefix, trie->nodes[n].length);
+		c = trie->nodes[n].child[b];
+
+		if (c == 0) {
+			/* new leaf */
+			l = libipv6calc_trie_node_add(trie, prefix, length, 1);
+			if (l == 0) {
+				return(1);
+			};
+			trie->nodes[n].child[b] = l;
+			trie->prefixes++;
+			return(0);
+		};
+
+		child_length = trie->nodes[c].length;
+		common = libipv6calc_trie_common(prefix, trie->nodes[c].key, (length < child_length) ? length : child_length);
+
+		if (common == child_length) {
+			/* child is prefix of key */
+			n = c;
+			continue;
+		};
+
+		if (common == length) {
+			/* key is prefix of child: insert key between node and child */
+			m = libipv6calc_trie_node_add(trie, prefix, length, 1);
+			if (m == 0) {
+				return(1);
+			};
+			trie->nodes[m].child[TRIE_BIT(trie->nodes[c].key, length)] = c;
+			trie->nodes[n].child[b] = m;
+			trie->prefixes++;
+			return(0);
+		};
+
+		/* key and child differ behind common part: insert branch node */
+		{
+			uint32_t branch[4];
+
+			libipv6calc_trie_mask(branch, prefix, common);
+			m = libipv6calc_trie_node_add(trie, branch, common, 0);
+			if (m == 0) {
+				return(1);
+			};
+		};
+
+		l = libipv6calc_trie_node_add(trie, prefix, length, 1);
+		if (l == 0) {
+			return(1);
+		};
+
+		trie->nodes[m].child[TRIE_BIT(trie->nodes[c].key, common)] = c;
+		trie->nodes[m].child[TRIE_BIT(prefix, common)] = l;
+		trie->nodes[n].child[b] = m;
+		trie->prefixes++;
+		return(0);
+	};
+};
+
+
+/*
+ * longest match of key in trie
+ *
+ * in : trie
+ * in : key = address (4 x 32 bit, most significant first)
+ * in : length = significant bits of key (IPv4: 32, IPv6: 128)
+ * ret: length of longest matching prefix, -1 = no match
+ */
+int libipv6calc_trie_lookup(const s_ipv6calc_trie *trie, const uint32_t *key, const int length) {
+	const s_ipv6calc_trie_node *node = &trie->nodes[0];
+	int result = -1;
+	uint32_t c;
+
+	while (1 == 1) {
+		if ((node->length > length) || (libipv6calc_trie_common(key, node->key, node->length) != node->length)) {
+			break;
+		};
+
+		if (node->terminal == 1) {
+			result = node->length;
+		};
+
+		if (node->length == length) {
+			break;
+		};
+
+		c = node->child[TRIE_BIT(key, node->length)];
+		if (c == 0) {
+			break;
+		};
+
+		node = &trie->nodes[c];
+	};
+
+	return(result);
+};
+
+
+/*
+ * free trie
+ */
+void libipv6calc_trie_free(s_ipv6calc_trie *trie) {
+	if (trie == NULL) {
+		return;
+	};
+
+	free(trie->nodes);
+	free(trie);
+};
+
+
+/*
+ * create new empty idset
+ *
+ * ret: idset, NULL = out of memory
+ */
+s_ipv6calc_idset *libipv6calc_idset_new(void) {
+	s_ipv6calc_idset *idset;
+
+	idset = calloc(1, sizeof(s_ipv6calc_idset));
+	if (idset == NULL) {
+		ERRORPRINT_NA("can't allocate memory for set");
+		return(NULL);
+	};
+
+	return(idset);
+};
+
+
+/*
+ * add number to idset
+ *
+ * mod: idset
+ * in : id
+ * ret: 0 = ok, 1 = error
+ */
+int libipv6calc_idset_add(s_ipv6calc_idset *idset, const uint32_t id) {
+	uint64_t *block = idset->blocks[id >> 16];
+	uint64_t bit = (uint64_t) 1 << (id & 63);
+
+	if (block == NULL) {
+		block = calloc(IPV6CALC_IDSET_BLOCK_WORDS, sizeof(uint64_t));
+		if (block == NULL) {
+			ERRORPRINT_NA("can't allocate memory for set block");
+			return(1);
+		};
+		idset->blocks[id >> 16] = block;
+	};
+
+	if ((block[(id & 0xffff) >> 6] & bit) == 0) {
+		block[(id & 0xffff) >> 6] |= bit;
+		idset->members++;
+	};
+
+	return(0);
+};
+
+
+/*
+ * test number for membership in idset
+ *
+ * in : idset, id
+ * ret: 1 = member, 0 = no member
+ */
+int libipv6calc_idset_test(const s_ipv6calc_idset *idset, const uint32_t id) {
+	const uint64_t *block = idset->blocks[id >> 16];
+
+	if (block == NULL) {
+		return(0);
+	};
+
+	return(((block[(id & 0xffff) >> 6] >> (id & 63)) & 1) ? 1 : 0);
+};
+
+
+/*
+ * free idset
+ */
+void libipv6calc_idset_free(s_ipv6calc_idset *idset) {
+	int i;
+
+	if (idset == NULL) {
+		return;
+	};
+
+	for (i = 0; i < IPV6CALC_IDSET_BLOCKS; i++) {
+		free(idset->blocks[i]);
+	};
+
+	free(idset);
+};
+
+
+#if !(defined(__GNUC__) || defined(__clang__))
+/*
+ * leading zero bits of non-zero word (binary search)
+ */
+static int libipv6calc_set_clz32(uint32_t x) {
+	int n = 0;
+
+	if ((x & 0xffff0000u) == 0) { n += 16; x <<= 16; };
+	if ((x & 0xff000000u) == 0) { n +=  8; x <<=  8; };
+	if ((x & 0xf0000000u) == 0) { n +=  4; x <<=  4; };
+	if ((x & 0xc0000000u) == 0) { n +=  2; x <<=  2; };
+	if ((x & 0x80000000u) == 0) { n +=  1; };
+
+	return(n);
+};
+#endif
+
+
+/*
+ * LSD radix sort of entries by leading key words (stable)
+ *  16-bit digits, passes with the same digit in all entries are skipped
+ *
+ * in : entries, temp (same size), count, size of entry, amount of key words
+ * mod: entries (sorted)
+ * ret: 0 = ok, 1 = out of memory
+ */
+int libipv6calc_radix_sort(void *entries, void *temp, const uint32_t count, const size_t size, const int words) {
+	char *src = entries, *dst = temp, *swap;
+	uint32_t i, c, sum, digit, *histogram;
+	int d;
+
+	if (count < 2) {
+		return(0);
+	};
+
+	histogram = malloc(sizeof(uint32_t) * 65536);
+	if (histogram == NULL) {
+		ERRORPRINT_NA("can't allocate memory for radix sort");
+		return(1);
+	};
+
+	for (d = 0; d < words * 2; d++) {
+		memset(histogram, 0, sizeof(uint32_t) * 65536);
+
+		for (i = 0; i < count; i++) {
+			histogram[RADIX_DIGIT(src + i * size, words, d)]++;
+		};
+
+		if (histogram[RADIX_DIGIT(src, words, d)] == count) {
+			// all entries have the same digit, nothing to move
+			continue;
+		};
+
+		sum = 0;
+		for (i = 0; i < 65536; i++) {
+			c = histogram[i];
+			histogram[i] = sum;
+			sum += c;
+		};
+
+		for (i = 0; i < count; i++) {
+			digit = RADIX_DIGIT(src + i * size, words, d);
+			memcpy(dst + (size_t) histogram[digit]++ * size, src + i * size, size);
+		};
+
+		swap = src;
+		src = dst;
+		dst = swap;
+	};
+
+	if (src != (char *) entries) {
+		memcpy(entries, src, (size_t) count * size);
+	};
+
+	free(histogram);
+	return(0);
+};
+
+
+/*
+ * multi-word key arithmetic (most significant word first), no bit loops
+ */
+
+/* ret: <0, 0, >0 like memcmp */
+static int libipv6calc_key_cmp(const uint32_t *a, const uint32_t *b, const int words) {
+	int w;
+
+	for (w = 0; w < words; w++) {
+		if (a[w] != b[w]) {
+			return((a[w] < b[w]) ? -1 : 1);
+		};
+	};
+
+	return(0);
+};
+
+/* mod: a += 2^bit, ret: carry out of key */
+static int libipv6calc_key_add_pow2(uint32_t *a, const int bit, const int words) {
+	int w = words - 1 - (bit >> 5);
+	uint32_t add = 1u << (bit & 31);
+
+	for (; w >= 0; w--) {
+		a[w] += add;
+		if (a[w] >= add) {
+			return(0);
+		};
+		add = 1;
+	};
+
+	return(1);
+};
+
+/* out: r = a - b (a >= b) */
+static void libipv6calc_key_sub(uint32_t *r, const uint32_t *a, const uint32_t *b, const int words) {
+	uint32_t borrow = 0, t;
+	int w;
+
+	for (w = words - 1; w >= 0; w--) {
+		t = a[w] - b[w] - borrow;
+		borrow = ((a[w] < b[w]) || ((a[w] == b[w]) && (borrow == 1))) ? 1 : 0;
+		r[w] = t;
+	};
+};
+
+/* ret: number of trailing zero bits, all bits if zero */
+static int libipv6calc_key_ctz(const uint32_t *a, const int words) {
+	int w;
+
+	for (w = words - 1; w >= 0; w--) {
+		if (a[w] != 0) {
+			return((words - 1 - w) * 32 + SET_CTZ32(a[w]));
+		};
+	};
+
+	return(words * 32);
+};
+
+/* ret: position of most significant set bit, -1 if zero */
+static int libipv6calc_key_msb(const uint32_t *a, const int words) {
+	int w;
+
+	for (w = 0; w < words; w++) {
+		if (a[w] != 0) {
+			return((words - w) * 32 - 1 - SET_CLZ32(a[w]));
+		};
+	};
+
+	return(-1);
+};
+
+
+/*
+ * split range into minimal list of prefixes
+ *
+ * in : first, last (first <= last), words
+ * out: keys (words per prefix), lengths (IPV6CALC_RANGESET_PREFIXES_MAX entries)
+ * ret: number of prefixes
+ */
+int libipv6calc_range_to_prefixes(const uint32_t *first, const uint32_t *last, const int words, uint32_t *keys, uint8_t *lengths) {
+	uint32_t cur[4], diff[4];
+	int n = 0, bits = words * 32, k, kmax;
+
+	memcpy(cur, first, sizeof(uint32_t) * words);
+
+	while (1 == 1) {
+		/* largest block fitting into remaining range: 2^k <= last - cur + 1 */
+		libipv6calc_key_sub(diff, last, cur, words);
+		if (libipv6calc_key_add_pow2(diff, 0, words) == 1) {
+			kmax = bits;	// whole address space
+		} else {
+			kmax = libipv6calc_key_msb(diff, words);
+		};
+
+		/* and aligned to cur */
+		k = libipv6calc_key_ctz(cur, words);
+		if (k > kmax) {
+			k = kmax;
+		};
+
+		memcpy(keys + n * words, cur, sizeof(uint32_t) * words);
+		lengths[n] = bits - k;
+		n++;
+
+		if ((k == kmax) && (libipv6calc_key_ctz(diff, words) == k)) {
+			/* remaining range was exactly this block */
+			break;
+		};
+
+		libipv6calc_key_add_pow2(cur, k, words);
+	};
+
+	return(n);
+};
+
+
+/*
+ * create new empty rangeset
+ *
+ * in : words (1: IPv4, 4: IPv6)
+ * ret: rangeset, NULL = out of memory
+ */
+s_ipv6calc_rangeset *libipv6calc_rangeset_new(const int words) {
+	s_ipv6calc_rangeset *rangeset;
+
+	rangeset = malloc(sizeof(s_ipv6calc_rangeset));
+	if (rangeset == NULL) {
+		ERRORPRINT_NA("can't allocate memory for range set");
+		return(NULL);
+	};
+
+	rangeset->ranges = malloc(sizeof(uint32_t) * 2 * words * IPV6CALC_RANGESET_INITIAL);
+	if (rangeset->ranges == NULL) {
+		ERRORPRINT_NA("can't allocate memory for range set entries");
+		free(rangeset);
+		return(NULL);
+	};
+
+	rangeset->count = 0;
+	rangeset->size = IPV6CALC_RANGESET_INITIAL;
+	rangeset->words = words;
+	rangeset->normalized = 1;
+
+	return(rangeset);
+};
+
+
+/*
+ * add range to rangeset
+ *
+ * mod: rangeset
+ * in : first, last (first <= last)
+ * ret: 0 = ok, 1 = error
+ */
+int libipv6calc_rangeset_add(s_ipv6calc_rangeset *rangeset, const uint32_t *first, const uint32_t *last) {
+	uint32_t *ranges, *entry;
+	int words = rangeset->words;
+
+	if (libipv6calc_key_cmp(first, last, words) > 0) {
+		ERRORPRINT_NA("begin of range is behind end");
+		return(1);
+	};
+
+	if (rangeset->count == rangeset->size) {
+		if (rangeset->size >= 0x80000000u) {
+			ERRORPRINT_WA("too many entries for range set: %u", rangeset->count);
+			return(1);
+		};
+
+		ranges = realloc(rangeset->ranges, sizeof(uint32_t) * 2 * words * (size_t) rangeset->size * 2);
+		if (ranges == NULL) {
+			ERRORPRINT_WA("can't allocate memory for range set entries: %u", rangeset->size * 2);
+			return(1);
+		};
+		rangeset->ranges = ranges;
+		rangeset->size *= 2;
+	};
+
+	entry = rangeset->ranges + (size_t) rangeset->count * 2 * words;
+	memcpy(entry, first, sizeof(uint32_t) * words);
+	memcpy(entry + words, last, sizeof(uint32_t) * words);
+
+	if ((rangeset->normalized == 1) && (rangeset->count > 0)) {
+		/* still normalized if behind the last range and not adjacent */
+		uint32_t next[4];
+
+		memcpy(next, entry - words, sizeof(uint32_t) * words);
+		if ((libipv6calc_key_add_pow2(next, 0, words) == 1) || (libipv6calc_key_cmp(first, next, words) <= 0)) {
+			rangeset->normalized = 0;
+		};
+	};
+
+	rangeset->count++;
+
+	return(0);
+};
+
+
+/*
+ * first and last address of prefix
+ *
+ * in : key, length (0 - 32 * words), words
+ * out: first, last
+ */
+void libipv6calc_prefix_to_range(const uint32_t *key, const int length, const int words, uint32_t *first, uint32_t *last) {
+	uint32_t mask;
+	int w;
+
+	for (w = 0; w < words; w++) {
+		if (length >= (w + 1) * 32) {
+			mask = 0xffffffffu;
+		} else if (length > w * 32) {
+			mask = 0xffffffffu << (32 - (length - w * 32));
+		} else {
+			mask = 0;
+		};
+		first[w] = key[w] & mask;
+		last[w] = first[w] | ~mask;
+	};
+};
+
+
+/*
+ * add prefix to rangeset
+ *
+ * mod: rangeset
+ * in : key, length (0 - 32 * words), bits behind length are ignored
+ * ret: 0 = ok, 1 = error
+ */
+int libipv6calc_rangeset_add_prefix(s_ipv6calc_rangeset *rangeset, const uint32_t *key, const int length) {
+	uint32_t first[4], last[4];
+
+	if ((length < 0) || (length > rangeset->words * 32)) {
+		ERRORPRINT_WA("unsupported prefix length: %d", length);
+		return(1);
+	};
+
+	libipv6calc_prefix_to_range(key, length, rangeset->words, first, last);
+
+	return(libipv6calc_rangeset_add(rangeset, first, last));
+};
+
+
+/*
+ * normalize rangeset: sort by begin and merge overlapping and adjacent ranges
+ *
+ * mod: rangeset
+ * ret: 0 = ok, 1 = out of memory
+ */
+int libipv6calc_rangeset_normalize(s_ipv6calc_rangeset *rangeset) {
+	uint32_t *temp, *cur, *out, next[4], i, n = 0;
+	int words = rangeset->words, stride = 2 * rangeset->words;
+
+	if (rangeset->normalized == 1) {
+		return(0);
+	};
+
+	temp = malloc(sizeof(uint32_t) * stride * (size_t) rangeset->count);
+	if (temp == NULL) {
+		ERRORPRINT_WA("can't allocate memory for sorting range set: %u", rangeset->count);
+		return(1);
+	};
+
+	if (libipv6calc_radix_sort(rangeset->ranges, temp, rangeset->count, sizeof(uint32_t) * stride, words) != 0) {
+		free(temp);
+		return(1);
+	};
+
+	free(temp);
+
+	/* linear merge, out = last range kept */
+	out = rangeset->ranges;
+	for (i = 1; i < rangeset->count; i++) {
+		cur = rangeset->ranges + (size_t) i * stride;
+
+		memcpy(next, out + words, sizeof(uint32_t) * words);
+		if ((libipv6calc_key_add_pow2(next, 0, words) == 1) || (libipv6calc_key_cmp(cur, next, words) <= 0)) {
+			/* overlapping or adjacent: extend end */
+			if (libipv6calc_key_cmp(cur + words, out + words, words) > 0) {
+				memcpy(out + words, cur + words, sizeof(uint32_t) * words);
+			};
+			continue;
+		};
+
+		out += stride;
+		n++;
+		if (out != cur) {
+			memcpy(out, cur, sizeof(uint32_t) * stride);
+		};
+	};
+
+	if (rangeset->count > 0) {
+		n++;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "range set normalized: %u -> %u ranges", rangeset->count, n);
+
+	rangeset->count = n;
+	rangeset->normalized = 1;
+
+	return(0);
+};
+
+
+/* mod: a -= 1 (a > 0) */
+static void libipv6calc_key_dec(uint32_t *a, const int words) {
+	int w;
+
+	for (w = words - 1; w >= 0; w--) {
+		if (a[w]-- != 0) {
+			return;
+		};
+	};
+};
+
+
+/*
+ * append range behind the last one of a result rangeset,
+ *  merged with the last one in case of overlapping or adjacent
+ *
+ * mod: rangeset
+ * in : first, last (first not before begin of last range)
+ * ret: 0 = ok, 1 = error
+ */
+static int libipv6calc_rangeset_append(s_ipv6calc_rangeset *rangeset, const uint32_t *first, const uint32_t *last) {
+	uint32_t *prev, next[4];
+	int words = rangeset->words;
+
+	if (rangeset->count > 0) {
+		prev = rangeset->ranges + (size_t) (rangeset->count - 1) * 2 * words;
+
+		memcpy(next, prev + words, sizeof(uint32_t) * words);
+		if ((libipv6calc_key_add_pow2(next, 0, words) == 1) || (libipv6calc_key_cmp(first, next, words) <= 0)) {
+			if (libipv6calc_key_cmp(last, prev + words, words) > 0) {
+				memcpy(prev + words, last, sizeof(uint32_t) * words);
+			};
+			return(0);
+		};
+	};
+
+	return(libipv6calc_rangeset_add(rangeset, first, last));
+};
+
+
+/*
+ * combine two rangesets by linear merge
+ *
+ * in : a, b (same words, normalized), operation IPV6CALC_RANGESET_OP_*
+ * ret: new normalized rangeset, NULL = error
+ */
+s_ipv6calc_rangeset *libipv6calc_rangeset_combine(const s_ipv6calc_rangeset *a, const s_ipv6calc_rangeset *b, const int operation) {
+	s_ipv6calc_rangeset *result;
+	const uint32_t *ra, *rb, *first, *last;
+	uint32_t i = 0, j = 0, cur[4], gap[4];
+	int words = a->words, stride = 2 * a->words, retval = 0, covered;
+
+	if ((a->words != b->words) || (a->normalized != 1) || (b->normalized != 1)) {
+		ERRORPRINT_NA("range sets need same key size and to be normalized");
+		return(NULL);
+	};
+
+	result = libipv6calc_rangeset_new(words);
+	if (result == NULL) {
+		return(NULL);
+	};
+
+	switch (operation) {
+		case IPV6CALC_RANGESET_OP_UNION:
+			/* merge by begin, overlapping ranges are joined on append */
+			while ((retval == 0) && ((i < a->count) || (j < b->count))) {
+				ra = a->ranges + (size_t) i * stride;
+				rb = b->ranges + (size_t) j * stride;
+				if ((j == b->count) || ((i < a->count) && (libipv6calc_key_cmp(ra, rb, words) <= 0))) {
+					retval = libipv6calc_rangeset_append(result, ra, ra + words);
+					i++;
+				} else {
+					retval = libipv6calc_rangeset_append(result, rb, rb + words);
+					j++;
+				};
+			};
+			break;
+
+		case IPV6CALC_RANGESET_OP_INTERSECTION:
+			/* overlap of current pair, continue with the one ending first */
+			while ((retval == 0) && (i < a->count) && (j < b->count)) {
+				ra = a->ranges + (size_t) i * stride;
+				rb = b->ranges + (size_t) j * stride;
+
+				first = (libipv6calc_key_cmp(ra, rb, words) >= 0) ? ra : rb;
+				last = (libipv6calc_key_cmp(ra + words, rb + words, words) <= 0) ? ra + words : rb + words;
+				if (libipv6calc_key_cmp(first, last, words) <= 0) {
+					retval = libipv6calc_rangeset_append(result, first, last);
+				};
+
+				if (last == ra + words) {
+					i++;
+				} else {
+					j++;
+				};
+			};
+			break;
+
+		case IPV6CALC_RANGESET_OP_DIFFERENCE:
+			/* parts of each range of a not covered by ranges of b */
+			for (i = 0; (retval == 0) && (i < a->count); i++) {
+				ra = a->ranges + (size_t) i * stride;
+				memcpy(cur, ra, sizeof(uint32_t) * words);
+				covered = 0;
+
+				/* skip ranges of b ending before */
+				while ((j < b->count) && (libipv6calc_key_cmp(b->ranges + (size_t) j * stride + words, cur, words) < 0)) {
+					j++;
+				};
+
+				while ((retval == 0) && (j < b->count)) {
+					rb = b->ranges + (size_t) j * stride;
+					if (libipv6calc_key_cmp(rb, ra + words, words) > 0) {
+						/* begins behind range */
+						break;
+					};
+
+					if (libipv6calc_key_cmp(rb, cur, words) > 0) {
+						/* uncovered part before */
+						memcpy(gap, rb, sizeof(uint32_t) * words);
+						libipv6calc_key_dec(gap, words);
+						retval = libipv6calc_rangeset_append(result, cur, gap);
+					};
+
+					if (libipv6calc_key_cmp(rb + words, ra + words, words) >= 0) {
+						/* covers the rest, can also cover next range of a */
+						covered = 1;
+						break;
+					};
+
+					memcpy(cur, rb + words, sizeof(uint32_t) * words);
+					libipv6calc_key_add_pow2(cur, 0, words);
+					j++;
+				};
+
+				if ((retval == 0) && (covered == 0)) {
+					retval = libipv6calc_rangeset_append(result, cur, ra + words);
+				};
+			};
+			break;
+
+		default:
+			ERRORPRINT_WA("unsupported range set operation: %d", operation);
+			retval = 1;
+			break;
+	};
+
+	if (retval != 0) {
+		libipv6calc_rangeset_free(result);
+		return(NULL);
+	};
+
+	result->normalized = 1;
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "range set operation %d: %u + %u -> %u ranges", operation, a->count, b->count, result->count);
+
+	return(result);
+};
+
+/*
+ * free rangeset
+ */
+void libipv6calc_rangeset_free(s_ipv6calc_rangeset *rangeset) {
+	if (rangeset == NULL) {
+		return;
+	};
+
+	free(rangeset->ranges);
+	free(rangeset);
+};
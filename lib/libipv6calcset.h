@@ -0,0 +1,40 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcset.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipv6calcset.c
+ */
+
+#include "ipv6calctypes.h"
+
+
+#ifndef _libipv6calcset_h_
+
+#define _libipv6calcset_h_
+
+/* prototypes */
+extern s_ipv6calc_trie *libipv6calc_trie_new(void);
+extern int  libipv6calc_trie_insert(s_ipv6calc_trie *trie, const uint32_t *key, const int length);
+extern int  libipv6calc_trie_lookup(const s_ipv6calc_trie *trie, const uint32_t *key, const int length);
+extern void libipv6calc_trie_free(s_ipv6calc_trie *trie);
+
+extern s_ipv6calc_idset *libipv6calc_idset_new(void);
+extern int  libipv6calc_idset_add(s_ipv6calc_idset *idset, const uint32_t id);
+extern int  libipv6calc_idset_test(const s_ipv6calc_idset *idset, const uint32_t id);
+extern void libipv6calc_idset_free(s_ipv6calc_idset *idset);
+
+extern int  libipv6calc_radix_sort(void *entries, void *temp, const uint32_t count, const size_t size, const int words);
+extern void libipv6calc_prefix_to_range(const uint32_t *key, const int length, const int words, uint32_t *first, uint32_t *last);
+extern int  libipv6calc_range_to_prefixes(const uint32_t *first, const uint32_t *last, const int words, uint32_t *keys, uint8_t *lengths);
+
+extern s_ipv6calc_rangeset *libipv6calc_rangeset_new(const int words);
+extern int  libipv6calc_rangeset_add(s_ipv6calc_rangeset *rangeset, const uint32_t *first, const uint32_t *last);
+extern int  libipv6calc_rangeset_add_prefix(s_ipv6calc_rangeset *rangeset, const uint32_t *key, const int length);
+extern int  libipv6calc_rangeset_normalize(s_ipv6calc_rangeset *rangeset);
+extern s_ipv6calc_rangeset *libipv6calc_rangeset_combine(const s_ipv6calc_rangeset *a, const s_ipv6calc_rangeset *b, const int operation);
+extern void libipv6calc_rangeset_free(s_ipv6calc_rangeset *rangeset);
+
+#endif
@@ -0,0 +1,695 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcsketch.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for fixed size statistic sketches
+ *   - HyperLogLog: approximate number of distinct values, mergeable
+ *   - Space-Saving: top-k heavy hitter prefixes with bounded memory
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "libipv6calcsketch.h"
+
+
+/* max. rank of a hash: leading zeros of the bits behind the register index + 1 */
+#define HLL_RANK_MAX	(64 - IPV6CALC_HLL_PRECISION + 1)
+
+/* sparse entry handling */
+#define HLL_SPARSE_INDEX(e)	((e) >> 8)
+#define HLL_SPARSE_RANK(e)	((e) & 0xff)
+#define HLL_SPARSE_INITIAL	8
+
+/* alphabet of string representation (6 bit per character) */
+static const char hll_alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+
+/*
+ * 64-bit hash of 32-bit words (e.g. IPv4/IPv6 address)
+ *
+ * in : words, count = number of words
+ * ret: hash
+ */
+uint64_t libipv6calc_sketch_hash(const uint32_t *words, const int count) {
+	uint64_t h = 0x9e3779b97f4a7c15ull ^ (uint64_t) count;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		h ^= words[i];
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 32;
+	};
+
+	/* final avalanche */
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdull;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ull;
+	h ^= h >> 33;
+
+	return(h);
+};
+
+
+/*
+ * create new empty HyperLogLog sketch (starts with sparse representation)
+ *
+ * ret: sketch, NULL = out of memory
+ */
+s_ipv6calc_hll *libipv6calc_hll_new(void) {
+	s_ipv6calc_hll *hll;
+
+	hll = calloc(1, sizeof(s_ipv6calc_hll));
+	if (hll == NULL) {
+		ERRORPRINT_NA("can't allocate memory for HyperLogLog sketch");
+		return(NULL);
+	};
+
+	return(hll);
+};
+
+
+/*
+ * switch sketch from sparse to register representation
+ *
+ * mod: hll
+ * ret: 0 = ok, 1 = out of memory
+ */
+static int libipv6calc_hll_densify(s_ipv6calc_hll *hll) {
+	uint32_t i;
+
+	if (hll->registers != NULL) {
+		return(0);
+	};
+
+	hll->registers = calloc(IPV6CALC_HLL_REGISTERS, sizeof(uint8_t));
+	if (hll->registers == NULL) {
+		ERRORPRINT_NA("can't allocate memory for HyperLogLog registers");
+		return(1);
+	};
+
+	for (i = 0; i < hll->sparse_used; i++) {
+		hll->registers[HLL_SPARSE_INDEX(hll->sparse[i])] = HLL_SPARSE_RANK(hll->sparse[i]);
+	};
+
+	free(hll->sparse);
+	hll->sparse = NULL;
+	hll->sparse_used = 0;
+	hll->sparse_size = 0;
+
+	return(0);
+};
+
+
+/*
+ * raise register to rank
+ *
+ * mod: hll
+ * in : index, rank
+ * ret: 0 = ok, 1 = out of memory
+ */
+static int libipv6calc_hll_set(s_ipv6calc_hll *hll, const uint32_t index, const uint8_t rank) {
+	uint32_t *sparse;
+	int lo, hi, mid;
+
+	if (hll->registers != NULL) {
+		if (hll->registers[index] < rank) {
+			hll->registers[index] = rank;
+		};
+		return(0);
+	};
+
+	/* binary search in sorted sparse entries */
+	lo = 0;
+	hi = (int) hll->sparse_used - 1;
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		if (HLL_SPARSE_INDEX(hll->sparse[mid]) == index) {
+			if (HLL_SPARSE_RANK(hll->sparse[mid]) < rank) {
+				hll->sparse[mid] = (index << 8) | rank;
+			};
+			return(0);
+		} else if (HLL_SPARSE_INDEX(hll->sparse[mid]) < index) {
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		};
+	};
+
+	if (hll->sparse_used == IPV6CALC_HLL_SPARSE_MAX) {
+		if (libipv6calc_hll_densify(hll) != 0) {
+			return(1);
+		};
+		hll->registers[index] = rank;
+		return(0);
+	};
+
+	if (hll->sparse_used == hll->sparse_size) {
+		sparse = realloc(hll->sparse, sizeof(uint32_t) * ((hll->sparse_size == 0) ? HLL_SPARSE_INITIAL : hll->sparse_size * 2));
+		if (sparse == NULL) {
+			ERRORPRINT_NA("can't allocate memory for HyperLogLog sparse entries");
+			return(1);
+		};
+		hll->sparse = sparse;
+		hll->sparse_size = (hll->sparse_size == 0) ? HLL_SPARSE_INITIAL : hll->sparse_size * 2;
+	};
+
+	/* insert at position lo */
+	memmove(&hll->sparse[lo + 1], &hll->sparse[lo], sizeof(uint32_t) * (hll->sparse_used - lo));
+	hll->sparse[lo] = (index << 8) | rank;
+	hll->sparse_used++;
+
+	return(0);
+};
+
+
+/*
+ * add hashed value to sketch
+ *
+ * mod: hll
+ * in : hash (see libipv6calc_sketch_hash)
+ * ret: 0 = ok, 1 = out of memory
+ */
+int libipv6calc_hll_add(s_ipv6calc_hll *hll, const uint64_t hash) {
+	uint64_t w = hash << IPV6CALC_HLL_PRECISION;
+	uint8_t rank = 1;
+
+	if (w == 0) {
+		rank = HLL_RANK_MAX;
+	} else {
+		while ((w & 0x8000000000000000ull) == 0) {
+			w <<= 1;
+			rank++;
+		};
+	};
+
+	return(libipv6calc_hll_set(hll, (uint32_t) (hash >> (64 - IPV6CALC_HLL_PRECISION)), rank));
+};
+
+
+/*
+ * merge sketch into another one (union)
+ *
+ * mod: dst
+ * in : src
+ * ret: 0 = ok, 1 = out of memory
+ */
+int libipv6calc_hll_merge(s_ipv6calc_hll *dst, const s_ipv6calc_hll *src) {
+	uint32_t i;
+
+	if (src->registers == NULL) {
+		for (i = 0; i < src->sparse_used; i++) {
+			if (libipv6calc_hll_set(dst, HLL_SPARSE_INDEX(src->sparse[i]), HLL_SPARSE_RANK(src->sparse[i])) != 0) {
+				return(1);
+			};
+		};
+		return(0);
+	};
+
+	if (libipv6calc_hll_densify(dst) != 0) {
+		return(1);
+	};
+
+	for (i = 0; i < IPV6CALC_HLL_REGISTERS; i++) {
+		if (dst->registers[i] < src->registers[i]) {
+			dst->registers[i] = src->registers[i];
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * raise registers to the ones of the sketch
+ *
+ * mod: registers
+ * in : hll (NULL = empty)
+ */
+static void libipv6calc_hll_registers_max(uint8_t *registers, const s_ipv6calc_hll *hll) {
+	uint32_t i;
+
+	if (hll == NULL) {
+		return;
+	};
+
+	if (hll->registers == NULL) {
+		for (i = 0; i < hll->sparse_used; i++) {
+			if (registers[HLL_SPARSE_INDEX(hll->sparse[i])] < HLL_SPARSE_RANK(hll->sparse[i])) {
+				registers[HLL_SPARSE_INDEX(hll->sparse[i])] = HLL_SPARSE_RANK(hll->sparse[i]);
+			};
+		};
+		return;
+	};
+
+	for (i = 0; i < IPV6CALC_HLL_REGISTERS; i++) {
+		if (registers[i] < hll->registers[i]) {
+			registers[i] = hll->registers[i];
+		};
+	};
+};
+
+
+/*
+ * estimate number of distinct values of the union of two sketches
+ *
+ * in : a, b (NULL = empty)
+ * ret: estimated number
+ */
+uint64_t libipv6calc_hll_estimate_union(const s_ipv6calc_hll *a, const s_ipv6calc_hll *b) {
+	uint8_t registers[IPV6CALC_HLL_REGISTERS];
+	uint32_t ranks[HLL_RANK_MAX + 1];
+	double m = IPV6CALC_HLL_REGISTERS, sum = 0, estimate;
+	uint32_t i, zeros;
+
+	memset(registers, 0, sizeof(registers));
+	libipv6calc_hll_registers_max(registers, a);
+	libipv6calc_hll_registers_max(registers, b);
+
+	/* histogram of ranks, sum is calculated per rank */
+	memset(ranks, 0, sizeof(ranks));
+	for (i = 0; i < IPV6CALC_HLL_REGISTERS; i++) {
+		ranks[registers[i]]++;
+	};
+
+	for (i = 0; i <= HLL_RANK_MAX; i++) {
+		sum += ldexp((double) ranks[i], -i);
+	};
+	zeros = ranks[0];
+
+	estimate = (0.7213 / (1.0 + 1.079 / m)) * m * m / sum;
+
+	if ((estimate <= 2.5 * m) && (zeros > 0)) {
+		/* small range correction: linear counting */
+		estimate = m * log(m / zeros);
+	};
+
+	return((uint64_t) (estimate + 0.5));
+};
+
+
+/*
+ * estimate number of distinct values
+ *
+ * in : hll (NULL = empty)
+ * ret: estimated number
+ */
+uint64_t libipv6calc_hll_estimate(const s_ipv6calc_hll *hll) {
+	return(libipv6calc_hll_estimate_union(hll, NULL));
+};
+
+
+/*
+ * string representation of sketch
+ *  "<precision>:S<entries>"   sparse, 3 characters per entry (12 bit index, rank)
+ *  "<precision>:D<registers>" one character per register
+ *
+ * in : hll
+ * mod: string
+ * ret: 0 = ok, 1 = string too small
+ */
+int libipv6calc_hll_to_string(const s_ipv6calc_hll *hll, char *string, const size_t string_length) {
+	uint32_t i, e;
+	char *cp;
+
+	if (string_length < 5 + ((hll->registers == NULL) ? hll->sparse_used * 3 : IPV6CALC_HLL_REGISTERS)) {
+		ERRORPRINT_WA("string too small for HyperLogLog sketch: %lu", (unsigned long) string_length);
+		return(1);
+	};
+
+	cp = string + snprintf(string, string_length, "%d:%c", IPV6CALC_HLL_PRECISION, (hll->registers == NULL) ? 'S' : 'D');
+
+	if (hll->registers == NULL) {
+		for (i = 0; i < hll->sparse_used; i++) {
+			e = hll->sparse[i];
+			*cp++ = hll_alphabet[HLL_SPARSE_INDEX(e) >> 6];
+			*cp++ = hll_alphabet[HLL_SPARSE_INDEX(e) & 0x3f];
+			*cp++ = hll_alphabet[HLL_SPARSE_RANK(e)];
+		};
+	} else {
+		for (i = 0; i < IPV6CALC_HLL_REGISTERS; i++) {
+			*cp++ = hll_alphabet[hll->registers[i]];
+		};
+	};
+
+	*cp = '\0';
+
+	return(0);
+};
+
+
+/*
+ * value of character of string representation
+ *
+ * ret: 0-63, -1 = invalid
+ */
+static int libipv6calc_hll_char_value(const char c) {
+	/* ranges of hll_alphabet, no lookup needed (called per register on merging many sketches) */
+	if ((c >= 'A') && (c <= 'Z')) {
+		return(c - 'A');
+	} else if ((c >= 'a') && (c <= 'z')) {
+		return(c - 'a' + 26);
+	} else if ((c >= '0') && (c <= '9')) {
+		return(c - '0' + 52);
+	} else if (c == '-') {
+		return(62);
+	} else if (c == '_') {
+		return(63);
+	};
+
+	return(-1);
+};
+
+
+/*
+ * merge sketch given as string representation (see libipv6calc_hll_to_string)
+ *
+ * mod: hll
+ * in : string
+ * ret: 0 = ok, 1 = error
+ */
+int libipv6calc_hll_merge_string(s_ipv6calc_hll *hll, const char *string) {
+	const char *cp;
+	char *endptr;
+	long precision;
+	int v0, v1, v2;
+	uint32_t i;
+
+	precision = strtol(string, &endptr, 10);
+	if ((endptr == string) || (*endptr != ':')) {
+		ERRORPRINT_WA("HyperLogLog sketch has no precision: %.16s", string);
+		return(1);
+	};
+
+	if (precision != IPV6CALC_HLL_PRECISION) {
+		ERRORPRINT_WA("HyperLogLog sketch has unsupported precision: %ld", precision);
+		return(1);
+	};
+
+	cp = endptr + 1;
+
+	if (*cp == 'S') {
+		cp++;
+		while (*cp != '\0') {
+			v0 = libipv6calc_hll_char_value(cp[0]);
+			v1 = (v0 < 0) ? -1 : libipv6calc_hll_char_value(cp[1]);
+			v2 = (v1 < 0) ? -1 : libipv6calc_hll_char_value(cp[2]);
+			if ((v2 < 1) || (v2 > HLL_RANK_MAX)) {
+				ERRORPRINT_WA("HyperLogLog sketch has invalid sparse entry at position: %d", (int) (cp - string));
+				return(1);
+			};
+			if (libipv6calc_hll_set(hll, ((uint32_t) v0 << 6) | (uint32_t) v1, (uint8_t) v2) != 0) {
+				return(1);
+			};
+			cp += 3;
+		};
+	} else if (*cp == 'D') {
+		cp++;
+		if (strlen(cp) != IPV6CALC_HLL_REGISTERS) {
+			ERRORPRINT_WA("HyperLogLog sketch has invalid number of registers: %d", (int) strlen(cp));
+			return(1);
+		};
+		if (libipv6calc_hll_densify(hll) != 0) {
+			return(1);
+		};
+		for (i = 0; i < IPV6CALC_HLL_REGISTERS; i++) {
+			v0 = libipv6calc_hll_char_value(cp[i]);
+			if ((v0 < 0) || (v0 > HLL_RANK_MAX)) {
+				ERRORPRINT_WA("HyperLogLog sketch has invalid register at position: %d", (int) (cp - string) + i);
+				return(1);
+			};
+			if (hll->registers[i] < v0) {
+				hll->registers[i] = v0;
+			};
+		};
+	} else {
+		ERRORPRINT_WA("HyperLogLog sketch has unsupported representation: %c", *cp);
+		return(1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * free sketch
+ */
+void libipv6calc_hll_free(s_ipv6calc_hll *hll) {
+	if (hll == NULL) {
+		return;
+	};
+
+	free(hll->registers);
+	free(hll->sparse);
+	free(hll);
+};
+
+
+/*
+ * create new empty Space-Saving top-k counter
+ *
+ * in : capacity = number of tracked prefixes
+ * in : length = prefix length of keys (0-128)
+ * ret: counter, NULL = out of memory
+ */
+s_ipv6calc_topk *libipv6calc_topk_new(const uint32_t capacity, const int length) {
+	s_ipv6calc_topk *topk;
+	uint32_t table_size = 16;
+
+	while (table_size < capacity * 2) {
+		table_size <<= 1;
+	};
+
+	topk = malloc(sizeof(s_ipv6calc_topk));
+	if (topk == NULL) {
+		ERRORPRINT_NA("can't allocate memory for top-k counter");
+		return(NULL);
+	};
+
+	topk->heap = malloc(sizeof(s_ipv6calc_topk_entry) * capacity);
+	topk->table = calloc(table_size, sizeof(uint32_t));
+	if ((topk->heap == NULL) || (topk->table == NULL)) {
+		ERRORPRINT_WA("can't allocate memory for top-k counter entries: %u", capacity);
+		libipv6calc_topk_free(topk);
+		return(NULL);
+	};
+
+	topk->table_mask = table_size - 1;
+	topk->capacity = capacity;
+	topk->used = 0;
+	topk->length = length;
+
+	return(topk);
+};
+
+
+/*
+ * swap heap entries, hash table is kept in sync
+ */
+static void libipv6calc_topk_swap(s_ipv6calc_topk *topk, const uint32_t a, const uint32_t b) {
+	s_ipv6calc_topk_entry entry;
+
+	entry = topk->heap[a];
+	topk->heap[a] = topk->heap[b];
+	topk->heap[b] = entry;
+
+	topk->table[topk->heap[a].slot] = a + 1;
+	topk->table[topk->heap[b].slot] = b + 1;
+};
+
+
+/*
+ * move heap entry down to restore heap order after increment
+ */
+static void libipv6calc_topk_sift_down(s_ipv6calc_topk *topk, uint32_t i) {
+	uint32_t c;
+
+	while (1 == 1) {
+		c = 2 * i + 1;
+		if (c >= topk->used) {
+			break;
+		};
+
+		if ((c + 1 < topk->used) && (topk->heap[c + 1].count < topk->heap[c].count)) {
+			c++;
+		};
+
+		if (topk->heap[i].count <= topk->heap[c].count) {
+			break;
+		};
+
+		libipv6calc_topk_swap(topk, i, c);
+		i = c;
+	};
+};
+
+
+/*
+ * move new heap entry up to restore heap order
+ */
+static void libipv6calc_topk_sift_up(s_ipv6calc_topk *topk, uint32_t i) {
+	while ((i > 0) && (topk->heap[i].count < topk->heap[(i - 1) / 2].count)) {
+		libipv6calc_topk_swap(topk, i, (i - 1) / 2);
+		i = (i - 1) / 2;
+	};
+};
+
+
+/*
+ * remove hash table slot (linear probing, backward shift of following entries)
+ */
+static void libipv6calc_topk_table_delete(s_ipv6calc_topk *topk, uint32_t i) {
+	uint32_t j = i, k;
+
+	topk->table[i] = 0;
+
+	while (1 == 1) {
+		j = (j + 1) & topk->table_mask;
+		if (topk->table[j] == 0) {
+			break;
+		};
+
+		/* home slot of entry */
+		k = topk->heap[topk->table[j] - 1].hash & topk->table_mask;
+
+		/* entry can be moved to i, if its home slot is not cyclic in (i, j] */
+		if ((i <= j) ? ((i < k) && (k <= j)) : ((i < k) || (k <= j))) {
+			continue;
+		};
+
+		topk->table[i] = topk->table[j];
+		topk->heap[topk->table[i] - 1].slot = i;
+		topk->table[j] = 0;
+		i = j;
+	};
+};
+
+
+/*
+ * add prefix of address
+ *
+ * mod: topk
+ * in : key = address (4 x 32 bit, most significant first, IPv4: key[0] only)
+ */
+void libipv6calc_topk_add(s_ipv6calc_topk *topk, const uint32_t *key) {
+	uint32_t prefix[4], slot, hash, i;
+	s_ipv6calc_topk_entry *entry;
+	uint64_t count_min;
+	int w;
+
+	for (w = 0; w < 4; w++) {
+		if (topk->length >= (w + 1) * 32) {
+			prefix[w] = key[w];
+		} else if (topk->length > w * 32) {
+			prefix[w] = key[w] & (0xffffffffu << (32 - (topk->length - w * 32)));
+		} else {
+			prefix[w] = 0;
+		};
+	};
+
+	hash = (uint32_t) libipv6calc_sketch_hash(prefix, 4);
+
+	/* lookup */
+	for (slot = hash & topk->table_mask; topk->table[slot] != 0; slot = (slot + 1) & topk->table_mask) {
+		entry = &topk->heap[topk->table[slot] - 1];
+		if ((entry->hash == hash) && (memcmp(entry->key, prefix, sizeof(prefix)) == 0)) {
+			entry->count++;
+			libipv6calc_topk_sift_down(topk, topk->table[slot] - 1);
+			return;
+		};
+	};
+
+	if (topk->used < topk->capacity) {
+		/* free entry available */
+		i = topk->used++;
+		count_min = 0;
+	} else {
+		/* replace entry with minimum count */
+		i = 0;
+		count_min = topk->heap[0].count;
+		libipv6calc_topk_table_delete(topk, topk->heap[0].slot);
+
+		/* slot can be changed by deletion */
+		slot = hash & topk->table_mask;
+		while (topk->table[slot] != 0) {
+			slot = (slot + 1) & topk->table_mask;
+		};
+	};
+
+	entry = &topk->heap[i];
+	memcpy(entry->key, prefix, sizeof(prefix));
+	entry->count = count_min + 1;
+	entry->error = count_min;
+	entry->hash = hash;
+	entry->slot = slot;
+	topk->table[slot] = i + 1;
+
+	if (count_min == 0) {
+		libipv6calc_topk_sift_up(topk, i);
+	} else {
+		libipv6calc_topk_sift_down(topk, i);
+	};
+};
+
+
+/*
+ * order of entries: count descending, prefix ascending
+ */
+static int libipv6calc_topk_compare(const void *a, const void *b) {
+	const s_ipv6calc_topk_entry *ea = a, *eb = b;
+
+	if (ea->count != eb->count) {
+		return((ea->count > eb->count) ? -1 : 1);
+	};
+
+	return(memcmp(ea->key, eb->key, sizeof(ea->key)));
+};
+
+
+/*
+ * retrieve top entries
+ *
+ * in : topk
+ * mod: entries = array with at least topk->capacity entries
+ * in : max = max. number of entries
+ * ret: number of entries
+ */
+uint32_t libipv6calc_topk_sorted(const s_ipv6calc_topk *topk, s_ipv6calc_topk_entry *entries, const uint32_t max) {
+	memcpy(entries, topk->heap, sizeof(s_ipv6calc_topk_entry) * topk->used);
+	qsort(entries, topk->used, sizeof(s_ipv6calc_topk_entry), libipv6calc_topk_compare);
+
+	return((topk->used < max) ? topk->used : max);
+};
+
+
+/*
+ * clear top-k counter for reuse
+ *
+ * mod: topk
+ */
+void libipv6calc_topk_clear(s_ipv6calc_topk *topk) {
+	memset(topk->table, 0, sizeof(uint32_t) * (topk->table_mask + 1));
+	topk->used = 0;
+};
+
+
+/*
+ * free top-k counter
+ */
+void libipv6calc_topk_free(s_ipv6calc_topk *topk) {
+	if (topk == NULL) {
+		return;
+	};
+
+	free(topk->heap);
+	free(topk->table);
+	free(topk);
+};
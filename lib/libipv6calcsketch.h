@@ -0,0 +1,36 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcsketch.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipv6calcsketch.c
+ */
+
+#include "ipv6calctypes.h"
+
+
+#ifndef _libipv6calcsketch_h_
+
+#define _libipv6calcsketch_h_
+
+/* prototypes */
+extern uint64_t libipv6calc_sketch_hash(const uint32_t *words, const int count);
+
+extern s_ipv6calc_hll *libipv6calc_hll_new(void);
+extern int  libipv6calc_hll_add(s_ipv6calc_hll *hll, const uint64_t hash);
+extern int  libipv6calc_hll_merge(s_ipv6calc_hll *dst, const s_ipv6calc_hll *src);
+extern uint64_t libipv6calc_hll_estimate(const s_ipv6calc_hll *hll);
+extern uint64_t libipv6calc_hll_estimate_union(const s_ipv6calc_hll *a, const s_ipv6calc_hll *b);
+extern int  libipv6calc_hll_to_string(const s_ipv6calc_hll *hll, char *string, const size_t string_length);
+extern int  libipv6calc_hll_merge_string(s_ipv6calc_hll *hll, const char *string);
+extern void libipv6calc_hll_free(s_ipv6calc_hll *hll);
+
+extern s_ipv6calc_topk *libipv6calc_topk_new(const uint32_t capacity, const int length);
+extern void libipv6calc_topk_add(s_ipv6calc_topk *topk, const uint32_t *key);
+extern uint32_t libipv6calc_topk_sorted(const s_ipv6calc_topk *topk, s_ipv6calc_topk_entry *entries, const uint32_t max);
+extern void libipv6calc_topk_clear(s_ipv6calc_topk *topk);
+extern void libipv6calc_topk_free(s_ipv6calc_topk *topk);
+
+#endif
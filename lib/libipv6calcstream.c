@@ -0,0 +1,1427 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcstream.c
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Function library for compressed (gzip/xz/zstd) input and output streams
+ *   the (de)compression runs in an own thread, connected to the caller by a
+ *   queue of buffers, the stream is returned as FILE (fopencookie)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+
+#include "config.h"
+
+#include "libipv6calcdebug.h"
+#include "libipv6calc.h"
+#include "libipv6calcstream.h"
+
+#ifdef SUPPORT_COMPRESSION
+#include <pthread.h>
+#endif
+
+#ifdef SUPPORT_COMPRESSION_GZIP
+#include <zlib.h>
+#endif
+
+#ifdef SUPPORT_COMPRESSION_XZ
+#include <lzma.h>
+#endif
+
+#ifdef SUPPORT_COMPRESSION_ZSTD
+#include <zstd.h>
+#endif
+
+
+/* stream types */
+typedef struct {
+	const int  type;
+	const char *name;
+	const char *suffix;
+	const unsigned char magic[6];
+	const size_t magic_length;
+} s_ipv6calc_stream_type;
+
+static const s_ipv6calc_stream_type ipv6calc_stream_types[] = {
+	{ IPV6CALC_STREAM_TYPE_GZIP, "gzip", ".gz" , { 0x1f, 0x8b }                      , 2 },
+	{ IPV6CALC_STREAM_TYPE_XZ  , "xz"  , ".xz" , { 0xfd, '7', 'z', 'X', 'Z', 0x00 } , 6 },
+	{ IPV6CALC_STREAM_TYPE_ZSTD, "zstd", ".zst", { 0x28, 0xb5, 0x2f, 0xfd }          , 4 },
+};
+
+
+#ifdef SUPPORT_COMPRESSION
+/* size of raw (compressed) data buffer of thread */
+#define IPV6CALC_STREAM_RAW_SIZE	131072
+
+typedef struct {
+	int type;
+	int fd;
+	int mode_write;		// 0: decompress input, 1: compress output
+	const char *name;
+
+	pthread_t thread;
+	pthread_mutex_t mutex;
+	pthread_cond_t cond;
+
+	/* queue of buffers with uncompressed data */
+	char *buffer[IPV6CALC_STREAM_BUFFERS];
+	size_t length[IPV6CALC_STREAM_BUFFERS];
+	int head;		// buffer to fill next
+	int tail;		// buffer to drain next
+	int count;		// filled buffers in queue
+	size_t pos;		// read position in buffer 'tail' (caller of input stream)
+
+	int eof;		// input: end of data reached / output: no more data
+	int stop;		// input: caller closed stream
+	int error;		// error in thread
+
+	/* compressed data (thread only) */
+	unsigned char raw[IPV6CALC_STREAM_RAW_SIZE];
+	int raw_eof;
+
+#ifdef SUPPORT_COMPRESSION_GZIP
+	z_stream gzip;
+#endif
+#ifdef SUPPORT_COMPRESSION_XZ
+	lzma_stream xz;
+#endif
+#ifdef SUPPORT_COMPRESSION_ZSTD
+	ZSTD_DStream *zstd_d;
+	ZSTD_CStream *zstd_c;
+	ZSTD_inBuffer zstd_in;
+	size_t zstd_remaining;	// hint of last decompress call with progress, 0 = frame complete
+#endif
+} s_ipv6calc_stream;
+
+
+/*
+ * write all raw data to file descriptor
+ *
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_stream_write_raw(s_ipv6calc_stream *streamp, const unsigned char *data, size_t length) {
+	ssize_t n;
+
+	while (length > 0) {
+		n = write(streamp->fd, data, length);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			};
+			fprintf(stderr, "Error writing compressed output (%s): %s\n", streamp->name, strerror(errno));
+			return(-1);
+		};
+		data += n;
+		length -= n;
+	};
+
+	return(0);
+};
+
+
+/*
+ * read raw data from file descriptor
+ *
+ * ret: number of bytes, 0 = end of input, -1 = error
+ */
+static ssize_t libipv6calc_stream_read_raw(s_ipv6calc_stream *streamp) {
+	ssize_t n;
+
+	do {
+		n = read(streamp->fd, streamp->raw, sizeof(streamp->raw));
+	} while ((n < 0) && (errno == EINTR));
+
+	if (n < 0) {
+		fprintf(stderr, "Error reading compressed input (%s): %s\n", streamp->name, strerror(errno));
+	} else if (n == 0) {
+		streamp->raw_eof = 1;
+	};
+
+	return(n);
+};
+
+
+/*
+ * decompress raw data into buffer
+ *
+ * in : streamp = stream
+ * mod: out = buffer, *out_length = filled bytes
+ * ret: 0 = buffer full, 1 = end of data, -1 = error
+ */
+static int libipv6calc_stream_decompress(s_ipv6calc_stream *streamp, char *out, const size_t out_size, size_t *out_length) {
+	ssize_t n;
+
+	*out_length = 0;
+
+	switch (streamp->type) {
+#ifdef SUPPORT_COMPRESSION_GZIP
+		case IPV6CALC_STREAM_TYPE_GZIP: {
+			int r;
+
+			streamp->gzip.next_out = (Bytef *) out;
+			streamp->gzip.avail_out = out_size;
+
+			while (streamp->gzip.avail_out > 0) {
+				if ((streamp->gzip.avail_in == 0) && (streamp->raw_eof == 0)) {
+					n = libipv6calc_stream_read_raw(streamp);
+					if (n < 0) {
+						return(-1);
+					};
+					streamp->gzip.next_in = streamp->raw;
+					streamp->gzip.avail_in = n;
+				};
+
+				if ((streamp->gzip.avail_in == 0) && (streamp->raw_eof == 1)) {
+					if (streamp->gzip.total_in > 0) {
+						fprintf(stderr, "Error decompressing input (%s): unexpected end of data\n", streamp->name);
+						return(-1);
+					};
+					// end after complete member
+					break;
+				};
+
+				r = inflate(&streamp->gzip, Z_NO_FLUSH);
+
+				if (r == Z_STREAM_END) {
+					// concatenated members (e.g. appended output) are continued
+					inflateReset(&streamp->gzip);
+				} else if ((r != Z_OK) && (r != Z_BUF_ERROR)) {
+					fprintf(stderr, "Error decompressing input (%s): %s\n", streamp->name, (streamp->gzip.msg != NULL) ? streamp->gzip.msg : "corrupt data");
+					return(-1);
+				};
+			};
+
+			*out_length = out_size - streamp->gzip.avail_out;
+			return((streamp->gzip.avail_out > 0) ? 1 : 0);
+		};
+#endif
+
+#ifdef SUPPORT_COMPRESSION_XZ
+		case IPV6CALC_STREAM_TYPE_XZ: {
+			lzma_ret r;
+
+			streamp->xz.next_out = (uint8_t *) out;
+			streamp->xz.avail_out = out_size;
+
+			while (streamp->xz.avail_out > 0) {
+				if ((streamp->xz.avail_in == 0) && (streamp->raw_eof == 0)) {
+					n = libipv6calc_stream_read_raw(streamp);
+					if (n < 0) {
+						return(-1);
+					};
+					streamp->xz.next_in = streamp->raw;
+					streamp->xz.avail_in = n;
+				};
+
+				r = lzma_code(&streamp->xz, (streamp->raw_eof == 1) ? LZMA_FINISH : LZMA_RUN);
+
+				if (r == LZMA_STREAM_END) {
+					*out_length = out_size - streamp->xz.avail_out;
+					return(1);
+				} else if (r != LZMA_OK) {
+					fprintf(stderr, "Error decompressing input (%s): %s (%d)\n", streamp->name, (r == LZMA_BUF_ERROR) ? "unexpected end of data" : "corrupt data", (int) r);
+					return(-1);
+				};
+			};
+
+			*out_length = out_size;
+			return(0);
+		};
+#endif
+
+#ifdef SUPPORT_COMPRESSION_ZSTD
+		case IPV6CALC_STREAM_TYPE_ZSTD: {
+			ZSTD_outBuffer zstd_out = { out, out_size, 0 };
+			size_t r, pos, pos_in;
+
+			while (zstd_out.pos < zstd_out.size) {
+				if ((streamp->zstd_in.pos == streamp->zstd_in.size) && (streamp->raw_eof == 0)) {
+					n = libipv6calc_stream_read_raw(streamp);
+					if (n < 0) {
+						return(-1);
+					};
+					streamp->zstd_in.src = streamp->raw;
+					streamp->zstd_in.size = n;
+					streamp->zstd_in.pos = 0;
+				};
+
+				pos = zstd_out.pos;
+				pos_in = streamp->zstd_in.pos;
+
+				r = ZSTD_decompressStream(streamp->zstd_d, &zstd_out, &streamp->zstd_in);
+				if (ZSTD_isError(r)) {
+					fprintf(stderr, "Error decompressing input (%s): %s\n", streamp->name, ZSTD_getErrorName(r));
+					return(-1);
+				};
+
+				if ((zstd_out.pos != pos) || (streamp->zstd_in.pos != pos_in)) {
+					// a call without progress returns the header size hint of a next frame
+					streamp->zstd_remaining = r;
+				} else if ((streamp->zstd_in.pos == streamp->zstd_in.size) && (streamp->raw_eof == 1)) {
+					if (streamp->zstd_remaining != 0) {
+						fprintf(stderr, "Error decompressing input (%s): unexpected end of data\n", streamp->name);
+						return(-1);
+					};
+					*out_length = zstd_out.pos;
+					return(1);
+				};
+			};
+
+			*out_length = zstd_out.pos;
+			return(0);
+		};
+#endif
+
+		default:
+			break;
+	};
+
+	return(-1);
+};
+
+
+/*
+ * compress buffer and write raw data
+ *
+ * in : streamp = stream
+ * in : data, length = uncompressed data
+ * in : finish = 1: end compressed stream after data
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_stream_compress(s_ipv6calc_stream *streamp, const char *data, const size_t length, const int finish) {
+	switch (streamp->type) {
+#ifdef SUPPORT_COMPRESSION_GZIP
+		case IPV6CALC_STREAM_TYPE_GZIP: {
+			int r;
+
+			streamp->gzip.next_in = (Bytef *) data;
+			streamp->gzip.avail_in = length;
+
+			do {
+				streamp->gzip.next_out = streamp->raw;
+				streamp->gzip.avail_out = sizeof(streamp->raw);
+
+				r = deflate(&streamp->gzip, (finish == 1) ? Z_FINISH : Z_NO_FLUSH);
+				if (r == Z_STREAM_ERROR) {
+					fprintf(stderr, "Error compressing output (%s)\n", streamp->name);
+					return(-1);
+				};
+
+				if (libipv6calc_stream_write_raw(streamp, streamp->raw, sizeof(streamp->raw) - streamp->gzip.avail_out) != 0) {
+					return(-1);
+				};
+			} while ((streamp->gzip.avail_out == 0) || ((finish == 1) && (r != Z_STREAM_END)));
+
+			return(0);
+		};
+#endif
+
+#ifdef SUPPORT_COMPRESSION_XZ
+		case IPV6CALC_STREAM_TYPE_XZ: {
+			lzma_ret r;
+
+			streamp->xz.next_in = (const uint8_t *) data;
+			streamp->xz.avail_in = length;
+
+			do {
+				streamp->xz.next_out = streamp->raw;
+				streamp->xz.avail_out = sizeof(streamp->raw);
+
+				r = lzma_code(&streamp->xz, (finish == 1) ? LZMA_FINISH : LZMA_RUN);
+				if ((r != LZMA_OK) && (r != LZMA_STREAM_END)) {
+					fprintf(stderr, "Error compressing output (%s): %d\n", streamp->name, (int) r);
+					return(-1);
+				};
+
+				if (libipv6calc_stream_write_raw(streamp, streamp->raw, sizeof(streamp->raw) - streamp->xz.avail_out) != 0) {
+					return(-1);
+				};
+			} while ((streamp->xz.avail_out == 0) || ((finish == 1) && (r != LZMA_STREAM_END)));
+
+			return(0);
+		};
+#endif
+
+#ifdef SUPPORT_COMPRESSION_ZSTD
+		case IPV6CALC_STREAM_TYPE_ZSTD: {
+			ZSTD_inBuffer zstd_in = { data, length, 0 };
+			ZSTD_outBuffer zstd_out;
+			size_t r;
+
+			do {
+				zstd_out.dst = streamp->raw;
+				zstd_out.size = sizeof(streamp->raw);
+				zstd_out.pos = 0;
+
+				if (zstd_in.pos < zstd_in.size) {
+					r = ZSTD_compressStream(streamp->zstd_c, &zstd_out, &zstd_in);
+				} else if (finish == 1) {
+					r = ZSTD_endStream(streamp->zstd_c, &zstd_out);
+				} else {
+					r = 0;
+				};
+
+				if (ZSTD_isError(r)) {
+					fprintf(stderr, "Error compressing output (%s): %s\n", streamp->name, ZSTD_getErrorName(r));
+					return(-1);
+				};
+
+				if (libipv6calc_stream_write_raw(streamp, streamp->raw, zstd_out.pos) != 0) {
+					return(-1);
+				};
+			} while ((zstd_in.pos < zstd_in.size) || ((finish == 1) && (r != 0)));
+
+			return(0);
+		};
+#endif
+
+		default:
+			break;
+	};
+
+	return(-1);
+};
+
+
+/*
+ * initialize codec of stream
+ *
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_stream_codec_init(s_ipv6calc_stream *streamp) {
+	switch (streamp->type) {
+#ifdef SUPPORT_COMPRESSION_GZIP
+		case IPV6CALC_STREAM_TYPE_GZIP:
+			memset(&streamp->gzip, 0, sizeof(streamp->gzip));
+			if (streamp->mode_write == 1) {
+				if (deflateInit2(&streamp->gzip, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+					return(-1);
+				};
+			} else {
+				if (inflateInit2(&streamp->gzip, 15 + 16) != Z_OK) {
+					return(-1);
+				};
+			};
+			return(0);
+#endif
+
+#ifdef SUPPORT_COMPRESSION_XZ
+		case IPV6CALC_STREAM_TYPE_XZ: {
+			lzma_stream xz = LZMA_STREAM_INIT;
+
+			streamp->xz = xz;
+			if (streamp->mode_write == 1) {
+				if (lzma_easy_encoder(&streamp->xz, LZMA_PRESET_DEFAULT, LZMA_CHECK_CRC64) != LZMA_OK) {
+					return(-1);
+				};
+			} else {
+				// concatenated streams (e.g. appended output) are continued
+				if (lzma_stream_decoder(&streamp->xz, UINT64_MAX, LZMA_CONCATENATED) != LZMA_OK) {
+					return(-1);
+				};
+			};
+			return(0);
+		};
+#endif
+
+#ifdef SUPPORT_COMPRESSION_ZSTD
+		case IPV6CALC_STREAM_TYPE_ZSTD:
+			streamp->zstd_in.src = streamp->raw;
+			streamp->zstd_in.size = 0;
+			streamp->zstd_in.pos = 0;
+			streamp->zstd_remaining = 0;
+			if (streamp->mode_write == 1) {
+				streamp->zstd_c = ZSTD_createCStream();
+				if ((streamp->zstd_c == NULL) || (ZSTD_isError(ZSTD_initCStream(streamp->zstd_c, 3)))) {
+					return(-1);
+				};
+			} else {
+				streamp->zstd_d = ZSTD_createDStream();
+				if ((streamp->zstd_d == NULL) || (ZSTD_isError(ZSTD_initDStream(streamp->zstd_d)))) {
+					return(-1);
+				};
+			};
+			return(0);
+#endif
+
+		default:
+			break;
+	};
+
+	return(-1);
+};
+
+
+/*
+ * free codec of stream
+ */
+static void libipv6calc_stream_codec_end(s_ipv6calc_stream *streamp) {
+	switch (streamp->type) {
+#ifdef SUPPORT_COMPRESSION_GZIP
+		case IPV6CALC_STREAM_TYPE_GZIP:
+			if (streamp->mode_write == 1) {
+				deflateEnd(&streamp->gzip);
+			} else {
+				inflateEnd(&streamp->gzip);
+			};
+			break;
+#endif
+
+#ifdef SUPPORT_COMPRESSION_XZ
+		case IPV6CALC_STREAM_TYPE_XZ:
+			lzma_end(&streamp->xz);
+			break;
+#endif
+
+#ifdef SUPPORT_COMPRESSION_ZSTD
+		case IPV6CALC_STREAM_TYPE_ZSTD:
+			if (streamp->mode_write == 1) {
+				ZSTD_freeCStream(streamp->zstd_c);
+			} else {
+				ZSTD_freeDStream(streamp->zstd_d);
+			};
+			break;
+#endif
+
+		default:
+			break;
+	};
+
+	return;
+};
+
+
+/*
+ * thread decompressing input into queue
+ */
+static void *libipv6calc_stream_thread_read(void *arg) {
+	s_ipv6calc_stream *streamp = (s_ipv6calc_stream *) arg;
+	size_t length;
+	int result;
+
+	while (1 == 1) {
+		pthread_mutex_lock(&streamp->mutex);
+		while ((streamp->count == IPV6CALC_STREAM_BUFFERS) && (streamp->stop == 0)) {
+			pthread_cond_wait(&streamp->cond, &streamp->mutex);
+		};
+		if (streamp->stop == 1) {
+			pthread_mutex_unlock(&streamp->mutex);
+			break;
+		};
+		pthread_mutex_unlock(&streamp->mutex);
+
+		// buffer 'head' is not in queue, so owned by thread
+		result = libipv6calc_stream_decompress(streamp, streamp->buffer[streamp->head], IPV6CALC_STREAM_BUFFER_SIZE, &length);
+
+		pthread_mutex_lock(&streamp->mutex);
+		if ((result >= 0) && (length > 0)) {
+			streamp->length[streamp->head] = length;
+			streamp->head = (streamp->head + 1) % IPV6CALC_STREAM_BUFFERS;
+			streamp->count++;
+		};
+		if (result < 0) {
+			streamp->error = 1;
+		};
+		if (result != 0) {
+			streamp->eof = 1;
+		};
+		pthread_cond_broadcast(&streamp->cond);
+		pthread_mutex_unlock(&streamp->mutex);
+
+		if (result != 0) {
+			break;
+		};
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * thread compressing queue into output
+ */
+static void *libipv6calc_stream_thread_write(void *arg) {
+	s_ipv6calc_stream *streamp = (s_ipv6calc_stream *) arg;
+	int error = 0;
+
+	while (1 == 1) {
+		pthread_mutex_lock(&streamp->mutex);
+		while ((streamp->count == 0) && (streamp->eof == 0)) {
+			pthread_cond_wait(&streamp->cond, &streamp->mutex);
+		};
+		if (streamp->count == 0) {
+			// no more data
+			pthread_mutex_unlock(&streamp->mutex);
+			break;
+		};
+		pthread_mutex_unlock(&streamp->mutex);
+
+		// buffer 'tail' is in queue, so not touched by caller, on error data is dropped
+		if (error == 0) {
+			if (libipv6calc_stream_compress(streamp, streamp->buffer[streamp->tail], streamp->length[streamp->tail], 0) != 0) {
+				error = 1;
+			};
+		};
+
+		pthread_mutex_lock(&streamp->mutex);
+		streamp->tail = (streamp->tail + 1) % IPV6CALC_STREAM_BUFFERS;
+		streamp->count--;
+		if (error == 1) {
+			streamp->error = 1;
+		};
+		pthread_cond_broadcast(&streamp->cond);
+		pthread_mutex_unlock(&streamp->mutex);
+	};
+
+	if (error == 0) {
+		if (libipv6calc_stream_compress(streamp, NULL, 0, 1) != 0) {
+			error = 1;
+		};
+	};
+
+	if (error == 1) {
+		pthread_mutex_lock(&streamp->mutex);
+		streamp->error = 1;
+		pthread_mutex_unlock(&streamp->mutex);
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * read function of FILE (called by stdio)
+ */
+static ssize_t libipv6calc_stream_cookie_read(void *cookie, char *buf, size_t size) {
+	s_ipv6calc_stream *streamp = (s_ipv6calc_stream *) cookie;
+	size_t n;
+
+	pthread_mutex_lock(&streamp->mutex);
+	while ((streamp->count == 0) && (streamp->eof == 0)) {
+		pthread_cond_wait(&streamp->cond, &streamp->mutex);
+	};
+	if (streamp->count == 0) {
+		pthread_mutex_unlock(&streamp->mutex);
+		return((streamp->error == 1) ? -1 : 0);
+	};
+	pthread_mutex_unlock(&streamp->mutex);
+
+	// buffer 'tail' is in queue, so not touched by thread
+	n = streamp->length[streamp->tail] - streamp->pos;
+	if (n > size) {
+		n = size;
+	};
+	memcpy(buf, streamp->buffer[streamp->tail] + streamp->pos, n);
+	streamp->pos += n;
+
+	if (streamp->pos == streamp->length[streamp->tail]) {
+		pthread_mutex_lock(&streamp->mutex);
+		streamp->tail = (streamp->tail + 1) % IPV6CALC_STREAM_BUFFERS;
+		streamp->count--;
+		streamp->pos = 0;
+		pthread_cond_broadcast(&streamp->cond);
+		pthread_mutex_unlock(&streamp->mutex);
+	};
+
+	return(n);
+};
+
+
+/*
+ * pass filled buffer 'head' to thread and wait for a free one
+ *
+ * ret: 0 = ok, -1 = error in thread
+ */
+static int libipv6calc_stream_queue_head(s_ipv6calc_stream *streamp) {
+	int result;
+
+	pthread_mutex_lock(&streamp->mutex);
+	streamp->head = (streamp->head + 1) % IPV6CALC_STREAM_BUFFERS;
+	streamp->count++;
+	pthread_cond_broadcast(&streamp->cond);
+	while (streamp->count == IPV6CALC_STREAM_BUFFERS) {
+		pthread_cond_wait(&streamp->cond, &streamp->mutex);
+	};
+	result = (streamp->error == 1) ? -1 : 0;
+	pthread_mutex_unlock(&streamp->mutex);
+
+	streamp->length[streamp->head] = 0;
+
+	return(result);
+};
+
+
+/*
+ * write function of FILE (called by stdio)
+ */
+static ssize_t libipv6calc_stream_cookie_write(void *cookie, const char *buf, size_t size) {
+	s_ipv6calc_stream *streamp = (s_ipv6calc_stream *) cookie;
+	size_t n, done = 0;
+
+	while (done < size) {
+		// buffer 'head' is not in queue, so owned by caller
+		n = IPV6CALC_STREAM_BUFFER_SIZE - streamp->length[streamp->head];
+		if (n > size - done) {
+			n = size - done;
+		};
+		memcpy(streamp->buffer[streamp->head] + streamp->length[streamp->head], buf + done, n);
+		streamp->length[streamp->head] += n;
+		done += n;
+
+		if (streamp->length[streamp->head] == IPV6CALC_STREAM_BUFFER_SIZE) {
+			if (libipv6calc_stream_queue_head(streamp) != 0) {
+				return(-1);
+			};
+		};
+	};
+
+	return(size);
+};
+
+
+/*
+ * free stream
+ */
+static void libipv6calc_stream_free(s_ipv6calc_stream *streamp) {
+	int i;
+
+	for (i = 0; i < IPV6CALC_STREAM_BUFFERS; i++) {
+		free(streamp->buffer[i]);
+	};
+
+	pthread_cond_destroy(&streamp->cond);
+	pthread_mutex_destroy(&streamp->mutex);
+	free(streamp);
+
+	return;
+};
+
+
+/*
+ * stop thread of stream (output: after compressing remaining data)
+ */
+static void libipv6calc_stream_thread_stop(s_ipv6calc_stream *streamp) {
+	pthread_mutex_lock(&streamp->mutex);
+	if (streamp->mode_write == 1) {
+		if (streamp->length[streamp->head] > 0) {
+			// pass last partially filled buffer
+			streamp->head = (streamp->head + 1) % IPV6CALC_STREAM_BUFFERS;
+			streamp->count++;
+		};
+		streamp->eof = 1;
+	} else {
+		streamp->stop = 1;
+	};
+	pthread_cond_broadcast(&streamp->cond);
+	pthread_mutex_unlock(&streamp->mutex);
+
+	pthread_join(streamp->thread, NULL);
+
+	return;
+};
+
+
+/*
+ * close function of FILE (called by stdio)
+ */
+static int libipv6calc_stream_cookie_close(void *cookie) {
+	s_ipv6calc_stream *streamp = (s_ipv6calc_stream *) cookie;
+	int result;
+
+	libipv6calc_stream_thread_stop(streamp);
+
+	libipv6calc_stream_codec_end(streamp);
+
+	result = (streamp->error == 1) ? -1 : 0;
+
+	if (close(streamp->fd) != 0) {
+		result = -1;
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Closed %s stream: %s (result=%d)", (streamp->mode_write == 1) ? "output" : "input", streamp->name, result);
+
+	libipv6calc_stream_free(streamp);
+
+	return(result);
+};
+#endif // SUPPORT_COMPRESSION
+
+
+/*
+ * check whether stream type is supported
+ *
+ * in : type = IPV6CALC_STREAM_TYPE_*
+ * ret: 1 = supported, 0 = not supported
+ */
+int libipv6calc_stream_supported(const int type) {
+	switch (type) {
+		case IPV6CALC_STREAM_TYPE_PLAIN:
+			return(1);
+#ifdef SUPPORT_COMPRESSION_GZIP
+		case IPV6CALC_STREAM_TYPE_GZIP:
+			return(1);
+#endif
+#ifdef SUPPORT_COMPRESSION_XZ
+		case IPV6CALC_STREAM_TYPE_XZ:
+			return(1);
+#endif
+#ifdef SUPPORT_COMPRESSION_ZSTD
+		case IPV6CALC_STREAM_TYPE_ZSTD:
+			return(1);
+#endif
+		default:
+			break;
+	};
+
+	return(0);
+};
+
+
+/*
+ * get stream type by suffix of filename
+ *
+ * in : filename
+ * ret: IPV6CALC_STREAM_TYPE_*
+ */
+int libipv6calc_stream_type_by_filename(const char *filename) {
+	size_t i, l;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_stream_types); i++) {
+		l = strlen(ipv6calc_stream_types[i].suffix);
+		if ((strlen(filename) > l) && (strcmp(filename + strlen(filename) - l, ipv6calc_stream_types[i].suffix) == 0)) {
+			return(ipv6calc_stream_types[i].type);
+		};
+	};
+
+	return(IPV6CALC_STREAM_TYPE_PLAIN);
+};
+
+
+/*
+ * get stream type by magic at begin of file (only seekable files)
+ *
+ * in : fd = file descriptor
+ * ret: IPV6CALC_STREAM_TYPE_*
+ */
+static int libipv6calc_stream_type_by_magic(const int fd) {
+	unsigned char magic[6];
+	ssize_t n;
+	size_t i;
+
+	n = pread(fd, magic, sizeof(magic), 0);
+	if (n < 0) {
+		// not seekable (pipe), no detection
+		return(IPV6CALC_STREAM_TYPE_PLAIN);
+	};
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_stream_types); i++) {
+		if (((size_t) n >= ipv6calc_stream_types[i].magic_length) && (memcmp(magic, ipv6calc_stream_types[i].magic, ipv6calc_stream_types[i].magic_length) == 0)) {
+			return(ipv6calc_stream_types[i].type);
+		};
+	};
+
+	return(IPV6CALC_STREAM_TYPE_PLAIN);
+};
+
+
+/*
+ * get name of stream type
+ */
+static const char *libipv6calc_stream_type_name(const int type) {
+	size_t i;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_stream_types); i++) {
+		if (ipv6calc_stream_types[i].type == type) {
+			return(ipv6calc_stream_types[i].name);
+		};
+	};
+
+	return("plain");
+};
+
+
+/*
+ * open stream on file descriptor
+ *
+ * in : fd = file descriptor (closed on close of stream, not on error)
+ * in : mode = "r" (decompress), "w"/"a" (compress)
+ * in : type = IPV6CALC_STREAM_TYPE_*
+ * ret: FILE, NULL = error
+ */
+FILE *libipv6calc_stream_fdopen(const int fd, const char *mode, const int type) {
+	if (type == IPV6CALC_STREAM_TYPE_PLAIN) {
+		return(fdopen(fd, mode));
+	};
+
+	if (libipv6calc_stream_supported(type) == 0) {
+		fprintf(stderr, "Support for %s compressed data not compiled-in\n", libipv6calc_stream_type_name(type));
+		return(NULL);
+	};
+
+#ifdef SUPPORT_COMPRESSION
+	s_ipv6calc_stream *streamp;
+	cookie_io_functions_t functions = {
+		libipv6calc_stream_cookie_read,
+		libipv6calc_stream_cookie_write,
+		NULL,
+		libipv6calc_stream_cookie_close
+	};
+	FILE *fp;
+	int i;
+
+	streamp = calloc(1, sizeof(s_ipv6calc_stream));
+	if (streamp == NULL) {
+		fprintf(stderr, "Can't allocate memory for stream\n");
+		return(NULL);
+	};
+
+	streamp->type = type;
+	streamp->fd = fd;
+	streamp->mode_write = (mode[0] == 'r') ? 0 : 1;
+	streamp->name = libipv6calc_stream_type_name(type);
+
+	pthread_mutex_init(&streamp->mutex, NULL);
+	pthread_cond_init(&streamp->cond, NULL);
+
+	for (i = 0; i < IPV6CALC_STREAM_BUFFERS; i++) {
+		streamp->buffer[i] = malloc(IPV6CALC_STREAM_BUFFER_SIZE);
+		if (streamp->buffer[i] == NULL) {
+			fprintf(stderr, "Can't allocate memory for stream buffer\n");
+			libipv6calc_stream_free(streamp);
+			return(NULL);
+		};
+	};
+
+	if (libipv6calc_stream_codec_init(streamp) != 0) {
+		fprintf(stderr, "Can't initialize %s %s\n", streamp->name, (streamp->mode_write == 1) ? "compression" : "decompression");
+		libipv6calc_stream_free(streamp);
+		return(NULL);
+	};
+
+	if (pthread_create(&streamp->thread, NULL, (streamp->mode_write == 1) ? libipv6calc_stream_thread_write : libipv6calc_stream_thread_read, streamp) != 0) {
+		fprintf(stderr, "Can't create thread for %s stream\n", streamp->name);
+		libipv6calc_stream_codec_end(streamp);
+		libipv6calc_stream_free(streamp);
+		return(NULL);
+	};
+
+	fp = fopencookie(streamp, (streamp->mode_write == 1) ? "w" : "r", functions);
+	if (fp == NULL) {
+		fprintf(stderr, "Can't open %s stream\n", streamp->name);
+		libipv6calc_stream_thread_stop(streamp);
+		libipv6calc_stream_codec_end(streamp);
+		libipv6calc_stream_free(streamp);
+		return(NULL);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Opened %s stream: %s", (streamp->mode_write == 1) ? "output" : "input", streamp->name);
+
+	return(fp);
+#else
+	return(NULL);
+#endif
+};
+
+
+/*
+ * open file as stream, (de)compressed if required
+ *  input : compression detected by magic, "-" is stdin
+ *  output: compression selected by suffix (.gz/.xz/.zst), "-" is stdout
+ *
+ * in : filename
+ * in : mode = "r", "w", "a"
+ * ret: FILE, NULL = error
+ */
+FILE *libipv6calc_stream_open(const char *filename, const char *mode) {
+	int fd, type;
+
+	if (strcmp(filename, "-") == 0) {
+		if (mode[0] == 'r') {
+			return(stdin);
+		} else {
+			return(stdout);
+		};
+	};
+
+	if (mode[0] == 'r') {
+		fd = open(filename, O_RDONLY);
+	} else if (mode[0] == 'a') {
+		fd = open(filename, O_WRONLY | O_CREAT | O_APPEND, 0666);
+	} else {
+		fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	};
+
+	if (fd < 0) {
+		fprintf(stderr, "Can't open file: %s (%s)\n", filename, strerror(errno));
+		return(NULL);
+	};
+
+	if (mode[0] == 'r') {
+		type = libipv6calc_stream_type_by_magic(fd);
+	} else {
+		type = libipv6calc_stream_type_by_filename(filename);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Open file: %s mode=%s type=%s", filename, mode, libipv6calc_stream_type_name(type));
+
+	FILE *fp = libipv6calc_stream_fdopen(fd, mode, type);
+	if (fp == NULL) {
+		close(fd);
+	};
+
+	return(fp);
+};
+
+
+/*
+ * initialize list of input files
+ *
+ * in : filenames, count = list of files, empty list: stdin
+ * mod: inputp = input list
+ */
+void libipv6calc_stream_input_init(s_ipv6calc_stream_input *inputp, char * const *filenames, const int count) {
+	static char * const filenames_stdin[] = { "-" };
+
+	if (count > 0) {
+		inputp->filenames = filenames;
+		inputp->count = count;
+	} else {
+		inputp->filenames = filenames_stdin;
+		inputp->count = 1;
+	};
+
+	inputp->index = 0;
+	inputp->file = NULL;
+	inputp->error = 0;
+
+	return;
+};
+
+
+/*
+ * read line from list of input files, next file is opened at end of current one
+ *
+ * in : buffer, size = like fgets
+ * mod: inputp = input list
+ * ret: buffer, NULL = end of last file or error (inputp->error set)
+ */
+char *libipv6calc_stream_input_gets(char *buffer, const int size, s_ipv6calc_stream_input *inputp) {
+	char *result;
+
+	while (inputp->index < inputp->count) {
+		if (inputp->file == NULL) {
+			inputp->file = libipv6calc_stream_open(inputp->filenames[inputp->index], "r");
+			if (inputp->file == NULL) {
+				inputp->error = 1;
+				return(NULL);
+			};
+			DEBUGPRINT_WA(DEBUG_libipv6calc, "Proceed input file: %s", inputp->filenames[inputp->index]);
+		};
+
+		result = fgets(buffer, size, inputp->file);
+		if (result != NULL) {
+			return(result);
+		};
+
+		if (ferror(inputp->file)) {
+			fprintf(stderr, "Error reading input file: %s\n", inputp->filenames[inputp->index]);
+			inputp->error = 1;
+		};
+
+		if (inputp->file != stdin) {
+			if (fclose(inputp->file) != 0) {
+				inputp->error = 1;
+			};
+		};
+		inputp->file = NULL;
+		inputp->index++;
+
+		if (inputp->error != 0) {
+			return(NULL);
+		};
+	};
+
+	return(NULL);
+};
+
+
+/*
+ * write data completely to file descriptor
+ *
+ * in : fd, iov, iovcnt = like writev
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_stream_writev_all(const int fd, struct iovec *iov, int iovcnt) {
+	ssize_t result;
+
+	while (iovcnt > 0) {
+		result = writev(fd, iov, iovcnt);
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			};
+			return(-1);
+		};
+
+		/* skip written parts */
+		while ((iovcnt > 0) && ((size_t) result >= iov->iov_len)) {
+			result -= iov->iov_len;
+			iov++;
+			iovcnt--;
+		};
+
+		if (iovcnt > 0) {
+			iov->iov_base = (char *) iov->iov_base + result;
+			iov->iov_len -= result;
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * write buffer and optional data behind
+ *
+ * mod: outputp = output
+ * in : data, length = written after buffer (can be NULL/0)
+ * ret: 0 = ok, -1 = error
+ */
+static int libipv6calc_stream_output_drain(s_ipv6calc_stream_output *outputp, const char *data, const size_t length) {
+	struct iovec iov[2];
+	int iovcnt = 0, i;
+
+	if (outputp->length > 0) {
+		iov[iovcnt].iov_base = outputp->buffer;
+		iov[iovcnt].iov_len = outputp->length;
+		iovcnt++;
+	};
+
+	if (length > 0) {
+		iov[iovcnt].iov_base = (char *) data;
+		iov[iovcnt].iov_len = length;
+		iovcnt++;
+	};
+
+	outputp->length = 0;
+
+	if (iovcnt == 0) {
+		return(0);
+	};
+
+	if (outputp->fd >= 0) {
+		if (libipv6calc_stream_writev_all(outputp->fd, iov, iovcnt) != 0) {
+			outputp->error = 1;
+			return(-1);
+		};
+	} else {
+		for (i = 0; i < iovcnt; i++) {
+			if (fwrite(iov[i].iov_base, 1, iov[i].iov_len, outputp->file) != iov[i].iov_len) {
+				outputp->error = 1;
+				return(-1);
+			};
+		};
+	};
+
+	return(0);
+};
+
+
+/*
+ * initialize buffered output
+ *  data buffered in file so far is flushed, afterwards only the buffered
+ *  output functions may write to the file until libipv6calc_stream_output_close
+ *
+ * in : file = output stream
+ * mod: outputp = output
+ * ret: 0 = ok, -1 = error
+ */
+int libipv6calc_stream_output_init(s_ipv6calc_stream_output *outputp, FILE *file) {
+	outputp->file = file;
+	outputp->length = 0;
+	outputp->error = 0;
+
+	/* streams without descriptor (compressed: fopencookie) are written through stdio */
+	outputp->fd = fileno(file);
+
+	outputp->buffer = malloc(IPV6CALC_STREAM_BUFFER_SIZE);
+	if (outputp->buffer == NULL) {
+		fprintf(stderr, "Can't allocate memory for output buffer\n");
+		return(-1);
+	};
+
+	if (fflush(file) != 0) {
+		outputp->error = 1;
+		return(-1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * reserve space at end of output buffer, buffer is written if too full
+ *  caller stores up to size bytes and appends them by
+ *  libipv6calc_stream_output_write(outputp, <returned pointer>, <length>)
+ *
+ * mod: outputp = output
+ * in : size = required space (max. IPV6CALC_STREAM_BUFFER_SIZE)
+ * ret: pointer to free space, NULL = error
+ */
+char *libipv6calc_stream_output_reserve(s_ipv6calc_stream_output *outputp, const size_t size) {
+	if (size > IPV6CALC_STREAM_BUFFER_SIZE) {
+		return(NULL);
+	};
+
+	if (outputp->length + size > IPV6CALC_STREAM_BUFFER_SIZE) {
+		if (libipv6calc_stream_output_drain(outputp, NULL, 0) != 0) {
+			return(NULL);
+		};
+	};
+
+	return(outputp->buffer + outputp->length);
+};
+
+
+/*
+ * append data to output buffer
+ *  data stored in place at the pointer returned by libipv6calc_stream_output_reserve is not copied
+ *  data not fitting into buffer is written together with buffer by writev()
+ *
+ * mod: outputp = output
+ * in : data, length
+ * ret: 0 = ok, -1 = error
+ */
+int libipv6calc_stream_output_write(s_ipv6calc_stream_output *outputp, const char *data, const size_t length) {
+	if (data == outputp->buffer + outputp->length) {
+		/* already in place */
+		outputp->length += length;
+		return(0);
+	};
+
+	if (outputp->length + length > IPV6CALC_STREAM_BUFFER_SIZE) {
+		return(libipv6calc_stream_output_drain(outputp, data, length));
+	};
+
+	memcpy(outputp->buffer + outputp->length, data, length);
+	outputp->length += length;
+
+	return(0);
+};
+
+
+/*
+ * write buffered output
+ *
+ * mod: outputp = output
+ * ret: 0 = ok, -1 = error
+ */
+int libipv6calc_stream_output_flush(s_ipv6calc_stream_output *outputp) {
+	if (libipv6calc_stream_output_drain(outputp, NULL, 0) != 0) {
+		return(-1);
+	};
+
+	if ((outputp->fd < 0) && (fflush(outputp->file) != 0)) {
+		outputp->error = 1;
+		return(-1);
+	};
+
+	return(0);
+};
+
+
+/*
+ * write buffered output and release buffer, file itself stays open
+ *
+ * mod: outputp = output
+ * ret: 0 = ok, -1 = error (also on previous write errors)
+ */
+int libipv6calc_stream_output_close(s_ipv6calc_stream_output *outputp) {
+	if (outputp->buffer != NULL) {
+		libipv6calc_stream_output_flush(outputp);
+		free(outputp->buffer);
+		outputp->buffer = NULL;
+	};
+
+	return((outputp->error != 0) ? -1 : 0);
+};
+
+
+/*
+ * process one input file into output file named by input file and suffix
+ *
+ * in : filename, suffix, mode
+ * in : worker = called with opened input and output
+ * ret: 0 = ok, 1 = error
+ */
+static int libipv6calc_stream_file_run(char * const filename, const char *suffix, const char *mode, ipv6calc_stream_worker_t worker) {
+	s_ipv6calc_stream_input input;
+	char *filenames[1];
+	char filename_out[NI_MAXHOST];
+	size_t l = strlen(filename);
+	int type, result = 0;
+	FILE *output;
+
+	/* strip suffix of compressed input file */
+	type = libipv6calc_stream_type_by_filename(filename);
+	if (type != IPV6CALC_STREAM_TYPE_PLAIN) {
+		l -= strlen(strrchr(filename, '.'));
+	};
+
+	if ((size_t) snprintf(filename_out, sizeof(filename_out), "%.*s%s", (int) l, filename, suffix) >= sizeof(filename_out)) {
+		fprintf(stderr, "Output file name too long: %s\n", filename);
+		return(1);
+	};
+
+	if (strcmp(filename, filename_out) == 0) {
+		fprintf(stderr, "Output file name equal to input file name: %s\n", filename);
+		return(1);
+	};
+
+	/* input is opened first, no output file is created for missing input */
+	filenames[0] = filename;
+	libipv6calc_stream_input_init(&input, filenames, 1);
+
+	input.file = libipv6calc_stream_open(filename, "r");
+	if (input.file == NULL) {
+		return(1);
+	};
+
+	output = libipv6calc_stream_open(filename_out, mode);
+	if (output == NULL) {
+		if (input.file != stdin) {
+			fclose(input.file);
+		};
+		return(1);
+	};
+
+	DEBUGPRINT_WA(DEBUG_libipv6calc, "Proceed input file: %s -> output file: %s", filename, filename_out);
+
+	if ((*worker)(&input, output) != 0) {
+		result = 1;
+	};
+
+	if (fclose(output) != 0) {
+		fprintf(stderr, "Error writing output file: %s\n", filename_out);
+		result = 1;
+	};
+
+	if (input.error != 0) {
+		result = 1;
+	};
+
+	return(result);
+};
+
+
+/*
+ * process list of input files, each into an own output file (input file name
+ * without compression suffix + given suffix), on jobs > 1 the files are
+ * processed concurrently by forked children, which share everything already
+ * initialized by the caller (e.g. database mappings)
+ *
+ * in : filenames, count, suffix, mode = "w", "a"
+ * in : jobs = maximum number of concurrently running children, <= 1: no fork
+ * in : worker = called per file with opened input and output
+ * in : child_init = called in child before worker (e.g. reopen file handles), can be NULL
+ * ret: number of failed files
+ */
+int libipv6calc_stream_files_run(char * const *filenames, const int count, const char *suffix, const char *mode, const int jobs, ipv6calc_stream_worker_t worker, int (*child_init)(void)) {
+	int i, status, running = 0, failed = 0;
+	pid_t pid;
+
+	for (i = 0; i < count; i++) {
+		if (jobs <= 1) {
+			failed += libipv6calc_stream_file_run(filenames[i], suffix, mode, worker);
+			continue;
+		};
+
+		while (running >= jobs) {
+			pid = wait(&status);
+			if (pid < 0) {
+				if (errno == EINTR) {
+					continue;
+				};
+				break;
+			};
+			running--;
+			if ((! WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+				failed++;
+			};
+		};
+
+		/* everything buffered so far must not be duplicated into children */
+		fflush(stdout);
+		fflush(stderr);
+
+		pid = fork();
+		if (pid < 0) {
+			fprintf(stderr, "Can't fork child for input file: %s (%s)\n", filenames[i], strerror(errno));
+			failed++;
+			continue;
+		};
+
+		if (pid == 0) {
+			if (child_init != NULL) {
+				(*child_init)();
+			};
+			exit((libipv6calc_stream_file_run(filenames[i], suffix, mode, worker) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+		};
+
+		DEBUGPRINT_WA(DEBUG_libipv6calc, "Child started for input file: %s (pid=%d)", filenames[i], (int) pid);
+		running++;
+	};
+
+	while (running > 0) {
+		pid = wait(&status);
+		if (pid < 0) {
+			if (errno == EINTR) {
+				continue;
+			};
+			break;
+		};
+		running--;
+		if ((! WIFEXITED(status)) || (WEXITSTATUS(status) != 0)) {
+			failed++;
+		};
+	};
+
+	return(failed);
+};
+
+
+/*
+ * print help for compressed streams
+ */
+void libipv6calc_stream_printhelp(void) {
+	size_t i;
+	int supported = 0;
+
+	for (i = 0; i < MAXENTRIES_ARRAY(ipv6calc_stream_types); i++) {
+		if (libipv6calc_stream_supported(ipv6calc_stream_types[i].type) == 1) {
+			if (supported == 0) {
+				fprintf(stderr, " Supported compression (input: detected, output: by suffix):");
+			};
+			fprintf(stderr, " %s(%s)", ipv6calc_stream_types[i].name, ipv6calc_stream_types[i].suffix);
+			supported++;
+		};
+	};
+
+	if (supported == 0) {
+		fprintf(stderr, " Support for compressed input/output not compiled-in\n");
+	} else {
+		fprintf(stderr, "\n");
+	};
+
+	return;
+};
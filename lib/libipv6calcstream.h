@@ -0,0 +1,70 @@
+/*
+ * Project    : ipv6calc
+ * File       : libipv6calcstream.h
+ * Version    : $Id$
+ * Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+ *
+ * Information:
+ *  Header file for libipv6calcstream.c
+ */
+
+#include <stdio.h>
+
+
+#ifndef _libipv6calcstream_h_
+
+#define _libipv6calcstream_h_
+
+/* stream types */
+#define IPV6CALC_STREAM_TYPE_PLAIN	0
+#define IPV6CALC_STREAM_TYPE_GZIP	1
+#define IPV6CALC_STREAM_TYPE_XZ		2
+#define IPV6CALC_STREAM_TYPE_ZSTD	3
+
+/* size of one buffer passed between (de)compression thread and caller */
+#define IPV6CALC_STREAM_BUFFER_SIZE	262144
+
+/* number of buffers in queue between (de)compression thread and caller */
+#define IPV6CALC_STREAM_BUFFERS		4
+
+/* list of input files read one after another */
+typedef struct {
+	char * const *filenames;
+	int count;
+	int index;		// current file
+	FILE *file;		// current stream, NULL = not opened
+	int error;		// open or read error
+} s_ipv6calc_stream_input;
+
+/* buffered output, written with write()/writev() (plain file descriptor) or stdio (compressed stream) */
+typedef struct {
+	FILE *file;
+	int fd;			// -1: no file descriptor, write through file
+	char *buffer;
+	size_t length;		// used part of buffer
+	int error;		// write error
+} s_ipv6calc_stream_output;
+
+/* processing of one input file into one output file, ret: 0 = ok */
+typedef int (*ipv6calc_stream_worker_t)(s_ipv6calc_stream_input *inputp, FILE *output);
+
+
+/* prototypes */
+extern FILE *libipv6calc_stream_open(const char *filename, const char *mode);
+extern FILE *libipv6calc_stream_fdopen(const int fd, const char *mode, const int type);
+extern int   libipv6calc_stream_supported(const int type);
+extern int   libipv6calc_stream_type_by_filename(const char *filename);
+extern void  libipv6calc_stream_printhelp(void);
+
+extern void  libipv6calc_stream_input_init(s_ipv6calc_stream_input *inputp, char * const *filenames, const int count);
+extern char *libipv6calc_stream_input_gets(char *buffer, const int size, s_ipv6calc_stream_input *inputp);
+
+extern int   libipv6calc_stream_output_init(s_ipv6calc_stream_output *outputp, FILE *file);
+extern char *libipv6calc_stream_output_reserve(s_ipv6calc_stream_output *outputp, const size_t size);
+extern int   libipv6calc_stream_output_write(s_ipv6calc_stream_output *outputp, const char *data, const size_t length);
+extern int   libipv6calc_stream_output_flush(s_ipv6calc_stream_output *outputp);
+extern int   libipv6calc_stream_output_close(s_ipv6calc_stream_output *outputp);
+
+extern int   libipv6calc_stream_files_run(char * const *filenames, const int count, const char *suffix, const char *mode, const int jobs, ipv6calc_stream_worker_t worker, int (*child_init)(void));
+
+#endif
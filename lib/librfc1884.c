@@ -237,27 +237,29 @@ int librfc1884_ipv6addrstruct_to_compaddr(const ipv6calc_ipv6addr *ipv6addrp, ch
 			DEBUGPRINT_NA(DEBUG_librfc1884, "no '0' block found");
 		};
 
-		/* create string */
+		/* create string, words are appended in place */
 		tempstring[0] = '\0';
+		s = 0;
 
 		for ( i = 0; i <= w_max; i++ ) {
 			if ( i == zstart ) {
 		
 				DEBUGPRINT_WA(DEBUG_librfc1884, "start of '0' at '%d'", i);
 				
-				snprintf(temp2string, sizeof(temp2string), "%s:", tempstring);
+				tempstring[s++] = ':';
+				tempstring[s] = '\0';
 			} else if ( i == 0 ) {
 				DEBUGPRINT_WA(DEBUG_librfc1884, "normal start value at '%d' (%x)", i, (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
 				
-				snprintf(temp2string, sizeof(temp2string), "%x", (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
+				s += snprintf(tempstring + s, sizeof(tempstring) - s, "%x", (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
 			} else if ( ( i > zend ) || ( i < zstart ) ) {
-				snprintf(temp2string, sizeof(temp2string), "%s:%x", tempstring, (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
+				s += snprintf(tempstring + s, sizeof(tempstring) - s, ":%x", (unsigned int) ipv6addr_getword(ipv6addrp, (unsigned int) i));
 			} else if ( ( i == 7 ) && ( zend == i )) {
-				snprintf(temp2string, sizeof(temp2string), "%s:", tempstring);
+				tempstring[s++] = ':';
+				tempstring[s] = '\0';
 			};
-			snprintf(tempstring, sizeof(tempstring), "%s", temp2string);
 		};
-		
+
 		if ( ((ipv6addrp->typeinfo & IPV6_ADDR_IID_32_63_HAS_IPV4) != 0) && ((ipv6addrp->typeinfo & IPV6_ADDR_ANONYMIZED_IID) == 0)) {
 			/* append IPv4 address */
 			snprintf(temp2string, sizeof(temp2string), "%s:%u.%u.%u.%u", \
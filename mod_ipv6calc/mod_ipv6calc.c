@@ -32,6 +32,7 @@
  *   ipv6calcOption disable-ip2location     yes
  *   ipv6calcOption mask-ipv4               16
  *   ipv6calcOption mask-ipv6               32
+ *   ipv6calcOption db-reload-interval      300
  *
  *   see also
  *    ipv6calc -h
@@ -44,6 +45,7 @@
 #include <http_log.h>
 #include <http_protocol.h>
 #include <apr_strings.h>
+#include <apr_thread_mutex.h>
 
 // ipv6calc related includes
 #undef PACKAGE_BUGREPORT
@@ -136,6 +138,19 @@ static struct in_addr  ipv6calc_cache_lri_ipv4_token[IPV6CALC_CACHE_LRI_SIZE];
 static struct in6_addr ipv6calc_cache_lri_ipv6_token[IPV6CALC_CACHE_LRI_SIZE];
 #endif
 
+/* generation of cache content, increased on flush, stores of older lookups are dropped */
+static unsigned long ipv6calc_cache_generation = 0;
+
+/* cache access lock (threaded MPM), created per child */
+#if APR_HAS_THREADS
+static apr_thread_mutex_t *ipv6calc_cache_mutex = NULL;
+#define IPV6CALC_CACHE_LOCK	if (ipv6calc_cache_mutex != NULL) { apr_thread_mutex_lock(ipv6calc_cache_mutex); }
+#define IPV6CALC_CACHE_UNLOCK	if (ipv6calc_cache_mutex != NULL) { apr_thread_mutex_unlock(ipv6calc_cache_mutex); }
+#else
+#define IPV6CALC_CACHE_LOCK
+#define IPV6CALC_CACHE_UNLOCK
+#endif
+
 
 /***************************
  * Static values
@@ -524,6 +539,16 @@ static void ipv6calc_child_init(apr_pool_t *p, server_rec *s) {
 
 	ipv6calc_support_init(s);
 
+#if APR_HAS_THREADS
+	if (apr_thread_mutex_create(&ipv6calc_cache_mutex, APR_THREAD_MUTEX_DEFAULT, p) != APR_SUCCESS) {
+		ap_log_error(APLOG_MARK, APLOG_ERR, 0, s
+			, "can't create cache mutex, cache disabled"
+		);
+		ipv6calc_cache_mutex = NULL;
+		config->cache = 0;
+	};
+#endif
+
 	/* check for KeepTypeAsnCC support */
 	if ((libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV4_REQ_DB) == 1) \
 	    && (libipv6calc_db_wrapper_has_features(ANON_METHOD_KEEPTYPEASNCC_IPV6_REQ_DB) == 1)) {
@@ -581,7 +606,8 @@ static int ipv6calc_post_read_request(request_rec *r) {
 	char asn[APRMAXHOSTLEN];
 	char registry[APRMAXHOSTLEN];
 	char geonameid[APRMAXHOSTLEN];
-	unsigned int data_source;
+	char *result_anon_p = NULL;
+	unsigned long cache_generation = 0;
 
 	int result;
 
@@ -644,6 +670,22 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		return OK;
 	};
 
+	/* reload replaced database files (ipv6calcOption db-reload-interval) */
+	if (libipv6calc_db_wrapper_reload_check() > 0) {
+		// results of reloaded databases can differ, flush cache
+		IPV6CALC_CACHE_LOCK;
+		for (i = 0; i < 2; i++) {
+			ipv6calc_cache_lri_max[i] = 0;
+			ipv6calc_cache_lri_last[i] = 0;
+		};
+		ipv6calc_cache_generation++;
+		IPV6CALC_CACHE_UNLOCK;
+
+		ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+			, "database files reloaded, cache flushed"
+		);
+	};
+
 	/* cache lookup */
 	if (config->cache == 1) {
 		hit = -1;
@@ -669,6 +711,8 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			     )
 #endif
 
+		IPV6CALC_CACHE_LOCK;
+		cache_generation = ipv6calc_cache_generation;
 
 		if (ipv6calc_cache_lri_max[pi] > 0) {
 			ipv6calc_cache_lri_checked[pi]++;
@@ -830,6 +874,7 @@ static int ipv6calc_post_read_request(request_rec *r) {
 					apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", anon_method_name);
 				};
 
+				IPV6CALC_CACHE_UNLOCK;
 				return OK;
 			};
 
@@ -849,6 +894,8 @@ static int ipv6calc_post_read_request(request_rec *r) {
 				};
 			};
 		};
+
+		IPV6CALC_CACHE_UNLOCK;
 	};
 
 	/* post cache lookup */
@@ -877,48 +924,18 @@ static int ipv6calc_post_read_request(request_rec *r) {
 #endif
 	};
 
-	/* store address in cache */
-	if (config->cache == 1) {
-		if (ipv6calc_cache_lri_max[pi] < config->cache_limit) {
-			ipv6calc_cache_lri_last[pi]++;
-			ipv6calc_cache_lri_max[pi]++;
-		} else {
-			if (ipv6calc_cache_lri_last[pi] == config->cache_limit) {
-				ipv6calc_cache_lri_last[pi] = 1;
-			} else {
-				ipv6calc_cache_lri_last[pi]++;
-			};
-		};
-
-		if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-			ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-				, "store IPv%s address in cache on position: %d"
-				, (pi == 0) ? "4" : "6"
-				, ipv6calc_cache_lri_last[pi] - 1
-			);
-		};
-
-		if (pi == mod_ipv6calc_pi_IPV4) {
-			// store token
-			if (p_mapped == 0) {
-				ipv6calc_cache_lri_ipv4_token[ipv6calc_cache_lri_last[pi] - 1] = client_addr_p->sa.sin.sin_addr;
-			} else {
-				ipv6calc_cache_lri_ipv4_token[ipv6calc_cache_lri_last[pi] - 1].s_addr = client_addr_p->sa.sin6.sin6_addr.s6_addr32[3];
-			};
-#if APR_HAVE_IPV6
-		} else if (pi == mod_ipv6calc_pi_IPV6) {
-			// store token
-			ipv6calc_cache_lri_ipv6_token[ipv6calc_cache_lri_last[pi] - 1] = client_addr_p->sa.sin6.sin6_addr;
-#endif
-		};
-	};
-
 	// retrieve data
 	int result_cc = -1;
 	int result_registry = -1;
 	const char *data_source_string = "-";
 	uint32_t asn_num = 0;
 	uint32_t result_geonameid = 0;
+	s_ipv6calc_db_attributes db_attributes;
+	int db_attributes_selector = 0;
+	int db_attributes_found = 0;
+
+	// keep database handles of all lookups and the anonymization of this request consistent
+	libipv6calc_db_wrapper_read_lock();
 
 	if (	(config->action_countrycode == 1)
 	     ||	(config->action_asn == 1)
@@ -971,13 +988,29 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			);
 		};
 
+		// retrieve CountryCode, ASN and GeonameID of IP at once
+		if ((config->action_countrycode == 1) && (retrieve_cc != 0)) {
+			db_attributes_selector |= IPV6CALC_DB_ATTR_CC;
+		};
+		if ((config->action_asn == 1) && (retrieve_asn != 0)) {
+			db_attributes_selector |= IPV6CALC_DB_ATTR_AS;
+		};
+		if ((config->action_geonameid == 1) && (retrieve_geonameid != 0)) {
+			db_attributes_selector |= IPV6CALC_DB_ATTR_GEONAMEID;
+		};
+		if (db_attributes_selector != 0) {
+			db_attributes_found = libipv6calc_db_wrapper_all_by_addr(&ipaddr, db_attributes_selector, &db_attributes);
+		};
+
 		// set country code of IP in environment
 		if (config->action_countrycode == 1) {
 			if (retrieve_cc != 0) {
-				result_cc = libipv6calc_db_wrapper_country_code_by_addr(cc, sizeof(cc), &ipaddr, &data_source);
+				if ((db_attributes_found & IPV6CALC_DB_ATTR_CC) != 0) {
+					result_cc = libipv6calc_db_wrapper_country_code_by_cc_index(cc, sizeof(cc), db_attributes.cc_index);
+				};
 
 				if ((result_cc == 0) && (strlen(cc) > 0)) {
-					data_source_string = libipv6calc_db_wrapper_get_data_source_name_by_number(data_source);
+					data_source_string = libipv6calc_db_wrapper_get_data_source_name_by_number(db_attributes.data_source_cc);
 				} else {
 					snprintf(cc, sizeof(cc), "%s", "-");
 				};
@@ -992,26 +1025,12 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			};
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_COUNTRYCODE", cc); 
-
-			if (config->cache == 1) {
-				// store value
-				snprintf(ipv6calc_cache_lri_value_cc[pi][ipv6calc_cache_lri_last[pi] - 1]
-				    , sizeof(ipv6calc_cache_lri_value_cc[pi][ipv6calc_cache_lri_last[pi] - 1])
-				    , "%s", cc);
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store CountryCode of IPv%s address in cache on position: %d"
-						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
-					);
-				};
-			};
 		};
 
 		// set ASN of IP in environment
 		if (config->action_asn == 1) {
 			if (retrieve_asn != 0) {
-				asn_num = libipv6calc_db_wrapper_as_num32_by_addr(&ipaddr, NULL);
+				asn_num = db_attributes.as_num32;
 
 				snprintf(asn, sizeof(asn), "%u", asn_num);
 
@@ -1024,20 +1043,6 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			};
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_ASN", asn); 
-
-			if (config->cache == 1) {
-				// store value
-				snprintf(ipv6calc_cache_lri_value_asn[pi][ipv6calc_cache_lri_last[pi] - 1]
-				    , sizeof(ipv6calc_cache_lri_value_asn[pi][ipv6calc_cache_lri_last[pi] - 1])
-				    , "%s", asn);
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store ASN of IPv%s address in cache on position: %d"
-						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
-					);
-				};
-			};
 		};
 
 		// set Registry of IP in environment
@@ -1060,28 +1065,14 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			};
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_REGISTRY", registry); 
-
-			if (config->cache == 1) {
-				// store value
-				snprintf(ipv6calc_cache_lri_value_registry[pi][ipv6calc_cache_lri_last[pi] - 1]
-				    , sizeof(ipv6calc_cache_lri_value_registry[pi][ipv6calc_cache_lri_last[pi] - 1])
-				    , "%s", registry);
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store Registry of IPv%s address in cache on position: %d"
-						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
-					);
-				};
-			};
 		};
 
 		// set GeonameID of IP in environment
 		if (config->action_geonameid == 1) {
 			if (retrieve_geonameid != 0) {
-				result_geonameid = libipv6calc_db_wrapper_GeonameID_by_addr(&ipaddr, NULL, NULL);
+				result_geonameid = db_attributes.GeonameID;
 
-				if (result_registry == IPV6CALC_DB_GEO_GEONAMEID_UNKNOWN) {
+				if ((db_attributes_found & IPV6CALC_DB_ATTR_GEONAMEID) != 0) {
 					snprintf(geonameid, sizeof(geonameid), "%u", result_geonameid);
 				} else {
 					snprintf(geonameid, sizeof(geonameid), "%s", "-");
@@ -1096,20 +1087,6 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			};
 
 			apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_GEONAMEID", geonameid); 
-
-			if (config->cache == 1) {
-				// store value
-				snprintf(ipv6calc_cache_lri_value_geonameid[pi][ipv6calc_cache_lri_last[pi] - 1]
-				    , sizeof(ipv6calc_cache_lri_value_geonameid[pi][ipv6calc_cache_lri_last[pi] - 1])
-				    , "%s", geonameid);
-				if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
-					ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-						, "store GeonameID of IPv%s address in cache on position: %d"
-						, (pi == 0) ? "4" : "6"
-						, ipv6calc_cache_lri_last[pi] - 1
-					);
-				};
-			};
 		};
 	};
 
@@ -1151,8 +1128,6 @@ static int ipv6calc_post_read_request(request_rec *r) {
 		// get address string
 		result = libipaddr_ipaddrstruct_to_string(&ipaddr, client_addr_string_anonymized, sizeof(client_addr_string_anonymized), 0); 
 
-		char *result_anon_p;
-
 		if (result == 0) {
 			ap_log_rerror(APLOG_MARK, mod_ipv6calc_APLOG_DEBUG, 0, r
 				, "client IP address anonymized: %s"
@@ -1171,22 +1146,84 @@ static int ipv6calc_post_read_request(request_rec *r) {
 			result_anon_p = r->connection->remote_ip;
 #endif
 		};
+	} else {
+		apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_IP_ANON", "disabled"); 
+		apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", "disabled");
+	};
 
-		if (config->cache == 1) {
-			// store value
-			snprintf(ipv6calc_cache_lri_value_anon[pi][ipv6calc_cache_lri_last[pi] - 1], sizeof(ipv6calc_cache_lri_value_anon[pi][ipv6calc_cache_lri_last[pi] - 1]), "%s", result_anon_p);
+	libipv6calc_db_wrapper_read_unlock();
 
+	/* store address and data in cache at once, concurrent lookups see complete entries only */
+	if (config->cache == 1) {
+		IPV6CALC_CACHE_LOCK;
+
+		if (cache_generation != ipv6calc_cache_generation) {
+			// cache was flushed by a database reload meanwhile
 			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
 				ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
-					, "store anonymized IPv%s address in cache on position: %d"
+					, "skip store of IPv%s address in cache, flushed meanwhile"
 					, (pi == 0) ? "4" : "6"
-					, ipv6calc_cache_lri_last[pi] - 1
 				);
 			};
+		} else {
+			if (ipv6calc_cache_lri_max[pi] < config->cache_limit) {
+				ipv6calc_cache_lri_last[pi]++;
+				ipv6calc_cache_lri_max[pi]++;
+			} else {
+				if (ipv6calc_cache_lri_last[pi] == config->cache_limit) {
+					ipv6calc_cache_lri_last[pi] = 1;
+				} else {
+					ipv6calc_cache_lri_last[pi]++;
+				};
+			};
+
+			i = ipv6calc_cache_lri_last[pi] - 1;
+
+			if (config->debuglevel & IPV6CALC_DEBUG_CACHE_STORE) {
+				ap_log_rerror(APLOG_MARK, APLOG_NOTICE, 0, r
+					, "store IPv%s address in cache on position: %d"
+					, (pi == 0) ? "4" : "6"
+					, i
+				);
+			};
+
+			if (pi == mod_ipv6calc_pi_IPV4) {
+				// store token
+				if (p_mapped == 0) {
+					ipv6calc_cache_lri_ipv4_token[i] = client_addr_p->sa.sin.sin_addr;
+				} else {
+					ipv6calc_cache_lri_ipv4_token[i].s_addr = client_addr_p->sa.sin6.sin6_addr.s6_addr32[3];
+				};
+#if APR_HAVE_IPV6
+			} else if (pi == mod_ipv6calc_pi_IPV6) {
+				// store token
+				ipv6calc_cache_lri_ipv6_token[i] = client_addr_p->sa.sin6.sin6_addr;
+#endif
+			};
+
+			// store values
+			if (config->action_countrycode == 1) {
+				snprintf(ipv6calc_cache_lri_value_cc[pi][i], sizeof(ipv6calc_cache_lri_value_cc[pi][i]), "%s", cc);
+			};
+
+			if (config->action_asn == 1) {
+				snprintf(ipv6calc_cache_lri_value_asn[pi][i], sizeof(ipv6calc_cache_lri_value_asn[pi][i]), "%s", asn);
+			};
+
+			if (config->action_registry == 1) {
+				snprintf(ipv6calc_cache_lri_value_registry[pi][i], sizeof(ipv6calc_cache_lri_value_registry[pi][i]), "%s", registry);
+			};
+
+			if (config->action_geonameid == 1) {
+				snprintf(ipv6calc_cache_lri_value_geonameid[pi][i], sizeof(ipv6calc_cache_lri_value_geonameid[pi][i]), "%s", geonameid);
+			};
+
+			if ((config->action_anonymize == 1) && (result_anon_p != NULL)) {
+				snprintf(ipv6calc_cache_lri_value_anon[pi][i], sizeof(ipv6calc_cache_lri_value_anon[pi][i]), "%s", result_anon_p);
+			};
 		};
-	} else {
-		apr_table_set(r->subprocess_env, "IPV6CALC_CLIENT_IP_ANON", "disabled"); 
-		apr_table_set(r->subprocess_env, "IPV6CALC_ANON_METHOD", "disabled");
+
+		IPV6CALC_CACHE_UNLOCK;
 	};
 
 	return OK;
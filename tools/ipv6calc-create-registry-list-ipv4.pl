@@ -20,6 +20,7 @@ use XML::Simple;
 use Getopt::Std;
 use BerkeleyDB;
 use POSIX qw(strftime);
+use File::Basename;
 
 my $progname = $0;
 
@@ -572,6 +573,13 @@ static const s_ipv4addr_info dbipv4addr_info[] = {
 
 	print $OUT "};\n";
 
+	close($OUT);
+
+
+	## packed registry tables (used for lookups)
+	my $packer = dirname($0) . "/ipv6calc-pack-registry-list-ipv4.pl";
+	system($packer, $file_dst_h) == 0 || die "Cannot add packed tables to header file: $file_dst_h";
+
 
 	## END
 	print "INFO  : finished creation of header file: " . $file_dst_h . "\n";
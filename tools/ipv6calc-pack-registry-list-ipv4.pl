@@ -0,0 +1,224 @@
+#!/usr/bin/perl -w
+#
+# Project    : ipv6calc/databases/ipv4-assignment
+# File       : ipv6calc-pack-registry-list-ipv4.pl
+# Version    : $Id$
+# Copyright  : 2019 by Peter Bieringer <pb (at) bieringer.de>
+# License    : GNU GPL v2
+#
+# Information:
+#  Perl program which adds packed IPv4 registry tables to the IPv4 address
+#  assignment header created by ipv6calc-create-registry-list-ipv4.pl
+#
+#  dbipv4addr_assignment and dbipv4addr_assignment_iana (first/last/registry)
+#  are converted into one sorted list of range starts covering the whole
+#  address space (IANA as fallback, gaps as REGISTRY_UNKNOWN, neighbors with
+#  same registry merged) and a 4-bit registry column. The original tables are
+#  kept as reference (not compiled) for the equivalence test.
+
+use strict;
+use warnings;
+
+use Getopt::Std;
+
+my $progname = $0;
+
+# starts per index entry (16 * 4 bytes = one cache line)
+my $block = 16;
+
+sub help {
+	print qq|
+Usage: $progname [-h] <HEADER-FILE>
+	-h		this online help
+
+|;
+	exit 0;
+};
+
+# parse options
+our ($opt_h);
+getopts('h') || help();
+
+if (defined $opt_h) {
+	help();
+};
+
+my $file = shift;
+
+if (! defined $file) {
+	help();
+};
+
+open(my $IN, "<", $file) || die "Cannot open file: $file";
+my @lines = <$IN>;
+close($IN);
+
+if (grep(/dbipv4addr_assignment_packed_start/, @lines)) {
+	print "INFO  : header file contains already packed tables: " . $file . "\n";
+	exit 0;
+};
+
+my %registry_num = (
+	'APNIC'    => 0x02,
+	'RIPENCC'  => 0x03,
+	'LACNIC'   => 0x04,
+	'AFRINIC'  => 0x05,
+	'ARIN'     => 0x06,
+	'IANA'     => 0x09,
+	'RESERVED' => 0x0e,
+	'UNKNOWN'  => 0x0f,
+);
+
+my %tables;
+my $table;
+
+for my $line (@lines) {
+	if ($line =~ /^static const s_ipv4addr_assignment (\w+)\[\] = \{/o) {
+		$table = $1;
+		$tables{$table} = [];
+		next;
+	};
+
+	if (defined $table) {
+		if ($line =~ /^\};/o) {
+			undef $table;
+			next;
+		};
+
+		if ($line =~ /^\s*\{ 0x([0-9a-f]{8}), 0x([0-9a-f]{8}), REGISTRY_(\w+)\s*\}/o) {
+			die "Unsupported registry: $3" if (! defined $registry_num{$3});
+			push @{$tables{$table}}, [ hex($1), hex($2), $3 ];
+		};
+	};
+};
+
+for my $name ("dbipv4addr_assignment", "dbipv4addr_assignment_iana") {
+	die "Table not found in header file: $name" if (! defined $tables{$name});
+};
+
+## range starts of both tables
+my %starts = (0 => 1);
+
+for my $name (keys %tables) {
+	for my $entry (@{$tables{$name}}) {
+		$starts{$$entry[0]} = 1;
+		$starts{$$entry[1] + 1} = 1 if ($$entry[1] < 0xffffffff);
+	};
+};
+
+## registry of an address (assignment, fallback IANA), tables are sorted
+my %pos = ("dbipv4addr_assignment" => 0, "dbipv4addr_assignment_iana" => 0);
+
+sub registry_by_addr($) {
+	my $ipv4 = shift;
+
+	for my $name ("dbipv4addr_assignment", "dbipv4addr_assignment_iana") {
+		my $list = $tables{$name};
+
+		while (($pos{$name} < scalar(@$list)) && ($$list[$pos{$name}]->[1] < $ipv4)) {
+			$pos{$name}++;
+		};
+
+		if (($pos{$name} < scalar(@$list)) && ($$list[$pos{$name}]->[0] <= $ipv4)) {
+			return $$list[$pos{$name}]->[2];
+		};
+	};
+
+	return "UNKNOWN";
+};
+
+my @packed_start;
+my @packed_registry;
+
+for my $ipv4 (sort { $a <=> $b } keys %starts) {
+	my $registry = registry_by_addr($ipv4);
+
+	next if ((scalar(@packed_registry) > 0) && ($packed_registry[-1] eq $registry));
+
+	push @packed_start, $ipv4;
+	push @packed_registry, $registry;
+};
+
+my $rows = scalar(@packed_start);
+
+## create output
+my $out = "";
+
+$out .= qq|
+/* packed registry table created by ipv6calc-pack-registry-list-ipv4.pl
+ *  range starts covering the whole address space, registry of range as 4-bit value
+ *  rows: $rows (source: | . scalar(@{$tables{"dbipv4addr_assignment"}}) . " + " . scalar(@{$tables{"dbipv4addr_assignment_iana"}}) . qq|)
+ */
+#define DBIPV4ADDR_ASSIGNMENT_PACKED_ROWS	$rows
+#define DBIPV4ADDR_ASSIGNMENT_PACKED_BLOCK	$block
+
+static const uint32_t dbipv4addr_assignment_packed_start[] __attribute__ ((aligned (64))) = {
+|;
+
+for (my $i = 0; $i < $rows; $i += 8) {
+	$out .= "\t" . join(", ", map { sprintf("0x%08x", $_) } @packed_start[$i .. (($i + 7 < $rows) ? $i + 7 : $rows - 1)]) . ",\n";
+};
+
+$out .= qq|};
+
+/* first range start of each block */
+static const uint32_t dbipv4addr_assignment_packed_index[] = {
+|;
+
+my @index;
+for (my $i = 0; $i < $rows; $i += $block) {
+	push @index, $packed_start[$i];
+};
+
+for (my $i = 0; $i < scalar(@index); $i += 8) {
+	$out .= "\t" . join(", ", map { sprintf("0x%08x", $_) } @index[$i .. (($i + 7 < scalar(@index)) ? $i + 7 : scalar(@index) - 1)]) . ",\n";
+};
+
+$out .= qq|};
+
+/* registry of range, 2 per byte (low nibble: even row) */
+static const uint8_t dbipv4addr_assignment_packed_registry[] = {
+|;
+
+my @nibbles;
+for (my $i = 0; $i < $rows; $i += 2) {
+	my $low = $registry_num{$packed_registry[$i]};
+	my $high = ($i + 1 < $rows) ? $registry_num{$packed_registry[$i + 1]} : 0;
+	push @nibbles, ($high << 4) | $low;
+};
+
+for (my $i = 0; $i < scalar(@nibbles); $i += 16) {
+	$out .= "\t" . join(", ", map { sprintf("0x%02x", $_) } @nibbles[$i .. (($i + 15 < scalar(@nibbles)) ? $i + 15 : scalar(@nibbles) - 1)]) . ",\n";
+};
+
+$out .= qq|};
+
+/* reference tables, source of packed table (not compiled, used by equivalence test) */
+#ifdef DBIPV4ADDR_ASSIGNMENT_REFERENCE
+|;
+
+## insert packed table before reference tables, close reference section after them
+my $result = "";
+my $state = 0; # 0: before, 1: in reference section, 2: after
+
+for my $line (@lines) {
+	if (($state == 0) && ($line =~ /^static const s_ipv4addr_assignment dbipv4addr_assignment\[\] = \{/o)) {
+		$result .= $out;
+		$state = 1;
+	} elsif (($state == 1) && ($line =~ /^static const s_ipv4addr_info /o)) {
+		$result .= "#endif // DBIPV4ADDR_ASSIGNMENT_REFERENCE\n\n";
+		$state = 2;
+	};
+
+	$result .= $line;
+};
+
+die "Unexpected header file format: $file" if ($state != 2);
+
+open(my $OUT, ">", $file . ".new") || die "Cannot open outfile: $file.new";
+print $OUT $result;
+close($OUT);
+
+rename($file . ".new", $file) || die "Cannot rename $file.new to $file";
+
+print "INFO  : packed tables added to header file: " . $file . " (rows: $rows)\n";